@@ -0,0 +1,411 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/percpu.h>
+#include <linux/local64.h>
+#include <linux/ktime.h>
+#include <linux/slab.h>
+#include <linux/mm.h>
+#include <linux/sort.h>
+#include <linux/debugfs.h>
+#include <linux/seq_file.h>
+#include <linux/uaccess.h>
+
+#include "sl_module.h"
+#include "base/sl_core_log.h"
+#include "base/sl_core_io_trace.h"
+
+#define LOG_NAME SL_CORE_IO_TRACE_LOG_NAME
+
+#define SL_CORE_IO_TRACE_DIR_NAME "io_trace"
+
+struct sl_core_io_trace_ring {
+	local64_t                    head;
+	u64                          tail; /* head at last clear */
+	struct sl_core_io_trace_rec *recs;
+};
+
+struct sl_core_io_trace_snap {
+	u32                         count;
+	struct sl_core_io_trace_rec recs[];
+};
+
+DEFINE_STATIC_KEY_FALSE(sl_core_io_trace_key);
+
+static struct sl_core_io_trace_ring __percpu *sl_core_io_trace_rings;
+static struct dentry                         *sl_core_io_trace_dir;
+
+void sl_core_io_trace_rec(u8 op, u8 ldev_num, u8 lgrp_num, u8 link_num,
+	u64 addr, u64 data, u32 aux, int rtn)
+{
+	struct sl_core_io_trace_ring *ring;
+	struct sl_core_io_trace_rec  *rec;
+	u64                           seq;
+
+	ring = get_cpu_ptr(sl_core_io_trace_rings);
+
+	/* local64 keeps nested irq writers on this CPU in separate slots */
+	seq = local64_add_return(1, &ring->head);
+	rec = &ring->recs[(seq - 1) & SL_CORE_IO_TRACE_RING_MASK];
+
+	WRITE_ONCE(rec->seq, 0);
+	smp_wmb();
+
+	rec->time_ns  = ktime_get_ns();
+	rec->addr     = addr;
+	rec->data     = data;
+	rec->aux      = aux;
+	rec->rtn      = rtn;
+	rec->op       = op;
+	rec->ldev_num = ldev_num;
+	rec->lgrp_num = lgrp_num;
+	rec->link_num = link_num;
+
+	smp_wmb();
+	WRITE_ONCE(rec->seq, seq);
+
+	put_cpu_ptr(sl_core_io_trace_rings);
+}
+
+static void sl_core_io_trace_rings_free(struct sl_core_io_trace_ring __percpu *rings)
+{
+	int cpu;
+
+	if (!rings)
+		return;
+
+	for_each_possible_cpu(cpu)
+		kvfree(per_cpu_ptr(rings, cpu)->recs);
+	free_percpu(rings);
+}
+
+/* rings are only allocated on first enable so idle systems pay nothing */
+static int sl_core_io_trace_rings_alloc(void)
+{
+	int                                    cpu;
+	struct sl_core_io_trace_ring __percpu *rings;
+	struct sl_core_io_trace_ring          *ring;
+
+	if (READ_ONCE(sl_core_io_trace_rings))
+		return 0;
+
+	rings = alloc_percpu(struct sl_core_io_trace_ring);
+	if (!rings)
+		return -ENOMEM;
+
+	for_each_possible_cpu(cpu) {
+		ring = per_cpu_ptr(rings, cpu);
+		local64_set(&ring->head, 0);
+		ring->tail = 0;
+		ring->recs = kvcalloc(SL_CORE_IO_TRACE_RING_SIZE, sizeof(*ring->recs), GFP_KERNEL);
+		if (!ring->recs) {
+			sl_core_io_trace_rings_free(rings);
+			return -ENOMEM;
+		}
+	}
+
+	if (cmpxchg(&sl_core_io_trace_rings, NULL, rings))
+		sl_core_io_trace_rings_free(rings);
+
+	return 0;
+}
+
+static int sl_core_io_trace_rec_cmp(const void *a, const void *b)
+{
+	const struct sl_core_io_trace_rec *rec_a = a;
+	const struct sl_core_io_trace_rec *rec_b = b;
+
+	if (rec_a->time_ns < rec_b->time_ns)
+		return -1;
+	if (rec_a->time_ns > rec_b->time_ns)
+		return 1;
+	return 0;
+}
+
+/* seq before the oldest record still in the ring, a clear racing the read can't pass head */
+static u64 sl_core_io_trace_ring_first(struct sl_core_io_trace_ring *ring, u64 head)
+{
+	return min(head, max(READ_ONCE(ring->tail),
+		(head > SL_CORE_IO_TRACE_RING_SIZE) ? head - SL_CORE_IO_TRACE_RING_SIZE : 0));
+}
+
+/* sized from the heads at open, records added after that are not shown */
+static struct sl_core_io_trace_snap *sl_core_io_trace_snap_create(void)
+{
+	int                           cpu;
+	u64                          *heads;
+	u64                           head;
+	u64                           seq;
+	u64                           seq_before;
+	u64                           seq_after;
+	size_t                        num_recs;
+	struct sl_core_io_trace_ring *ring;
+	struct sl_core_io_trace_rec  *rec;
+	struct sl_core_io_trace_snap *snap;
+	struct sl_core_io_trace_rec  *snap_rec;
+
+	if (!sl_core_io_trace_rings)
+		return kvzalloc(sizeof(*snap), GFP_KERNEL);
+
+	heads = kcalloc(nr_cpu_ids, sizeof(*heads), GFP_KERNEL);
+	if (!heads)
+		return NULL;
+
+	num_recs = 0;
+	for_each_possible_cpu(cpu) {
+		ring        = per_cpu_ptr(sl_core_io_trace_rings, cpu);
+		heads[cpu]  = local64_read(&ring->head);
+		num_recs   += heads[cpu] - sl_core_io_trace_ring_first(ring, heads[cpu]);
+	}
+
+	snap = kvzalloc(struct_size(snap, recs, num_recs), GFP_KERNEL);
+	if (!snap) {
+		kfree(heads);
+		return NULL;
+	}
+
+	for_each_possible_cpu(cpu) {
+		ring = per_cpu_ptr(sl_core_io_trace_rings, cpu);
+		head = heads[cpu];
+		seq  = sl_core_io_trace_ring_first(ring, head);
+
+		for (++seq; (seq <= head) && (snap->count < num_recs); ++seq) {
+			rec      = &ring->recs[(seq - 1) & SL_CORE_IO_TRACE_RING_MASK];
+			snap_rec = &snap->recs[snap->count];
+
+			/* skip records being written or already overwritten */
+			seq_before = READ_ONCE(rec->seq);
+			smp_rmb();
+			*snap_rec = *rec;
+			smp_rmb();
+			seq_after = READ_ONCE(rec->seq);
+			if ((seq_before != seq) || (seq_after != seq))
+				continue;
+
+			snap_rec->cpu = cpu;
+			snap->count++;
+		}
+	}
+
+	kfree(heads);
+
+	sort(snap->recs, snap->count, sizeof(*snap->recs), sl_core_io_trace_rec_cmp, NULL);
+
+	return snap;
+}
+
+static void *sl_core_io_trace_seq_start(struct seq_file *s, loff_t *pos)
+{
+	struct sl_core_io_trace_snap *snap = s->private;
+
+	return (*pos < snap->count) ? &snap->recs[*pos] : NULL;
+}
+
+static void *sl_core_io_trace_seq_next(struct seq_file *s, void *v, loff_t *pos)
+{
+	++*pos;
+
+	return sl_core_io_trace_seq_start(s, pos);
+}
+
+static void sl_core_io_trace_seq_stop(struct seq_file *s, void *v)
+{
+}
+
+static int sl_core_io_trace_seq_show(struct seq_file *s, void *v)
+{
+	struct sl_core_io_trace_rec *rec = v;
+	u64                          secs;
+	u32                          nsecs;
+
+	secs = div_u64_rem(rec->time_ns, NSEC_PER_SEC, &nsecs);
+
+	seq_printf(s, "%llu.%09u %3u ldev%u lgrp%02u ", secs, nsecs, rec->cpu,
+		rec->ldev_num, rec->lgrp_num);
+	if (rec->link_num == SL_CORE_IO_TRACE_NUM_NONE)
+		seq_puts(s, "link- ");
+	else
+		seq_printf(s, "link%u ", rec->link_num);
+
+	switch (rec->op) {
+	case SL_CORE_IO_TRACE_OP_FLSH:
+		seq_printf(s, "FLSH (addr = 0x%016llX)\n", rec->addr);
+		break;
+	case SL_CORE_IO_TRACE_OP_RD64:
+		seq_printf(s, "RD64 (addr = 0x%016llX, data = 0x%016llX)\n", rec->addr, rec->data);
+		break;
+	case SL_CORE_IO_TRACE_OP_WR64:
+		seq_printf(s, "WR64 (addr = 0x%016llX, data = 0x%016llX)\n", rec->addr, rec->data);
+		break;
+	case SL_CORE_IO_TRACE_OP_PMI_RD:
+		seq_printf(s, "PMI RD (rtn = %d, addr = 0x%08llX, data = 0x%04llX)\n",
+			rec->rtn, rec->addr, rec->data);
+		break;
+	case SL_CORE_IO_TRACE_OP_PMI_WR:
+		seq_printf(s, "PMI WR (rtn = %d, addr = 0x%08llX, data = 0x%04llX, mask = 0x%04X)\n",
+			rec->rtn, rec->addr, rec->data, rec->aux);
+		break;
+	case SL_CORE_IO_TRACE_OP_SBUS_RD:
+	case SL_CORE_IO_TRACE_OP_SBUS_WR:
+		seq_printf(s, "SBUS %s (rtn = %d, ring = %llu, dev_addr = 0x%02llX, reg = 0x%02llX, data = 0x%08llX)\n",
+			(rec->op == SL_CORE_IO_TRACE_OP_SBUS_RD) ? "RD" : "WR", rec->rtn,
+			(rec->addr >> 16) & 0xFF, (rec->addr >> 8) & 0xFF, rec->addr & 0xFF, rec->data);
+		break;
+	case SL_CORE_IO_TRACE_OP_SBUS_WR_BLK:
+		seq_printf(s, "SBUS WR BLK (rtn = %d, ring = %llu, dev_addr = 0x%02llX, reg = 0x%02llX, count = %u)\n",
+			rec->rtn, (rec->addr >> 16) & 0xFF, (rec->addr >> 8) & 0xFF, rec->addr & 0xFF,
+			rec->aux);
+		break;
+	case SL_CORE_IO_TRACE_OP_SBUS_RST:
+		seq_printf(s, "SBUS RST (rtn = %d, ring = %llu, dev_addr = 0x%02llX)\n",
+			rec->rtn, (rec->addr >> 16) & 0xFF, (rec->addr >> 8) & 0xFF);
+		break;
+	default:
+		seq_printf(s, "op%u (addr = 0x%016llX, data = 0x%016llX)\n", rec->op, rec->addr, rec->data);
+		break;
+	}
+
+	return 0;
+}
+
+static const struct seq_operations sl_core_io_trace_seq_ops = {
+	.start = sl_core_io_trace_seq_start,
+	.next  = sl_core_io_trace_seq_next,
+	.stop  = sl_core_io_trace_seq_stop,
+	.show  = sl_core_io_trace_seq_show,
+};
+
+static int sl_core_io_trace_open(struct inode *inode, struct file *f)
+{
+	int                           rtn;
+	struct sl_core_io_trace_snap *snap;
+
+	if (!(f->f_mode & FMODE_READ))
+		return 0;
+
+	snap = sl_core_io_trace_snap_create();
+	if (!snap)
+		return -ENOMEM;
+
+	rtn = seq_open(f, &sl_core_io_trace_seq_ops);
+	if (rtn) {
+		kvfree(snap);
+		return rtn;
+	}
+	((struct seq_file *)f->private_data)->private = snap;
+
+	return 0;
+}
+
+static int sl_core_io_trace_release(struct inode *inode, struct file *f)
+{
+	if (!(f->f_mode & FMODE_READ))
+		return 0;
+
+	kvfree(((struct seq_file *)f->private_data)->private);
+
+	return seq_release(inode, f);
+}
+
+/* any write clears the rings, like the ftrace trace file */
+static ssize_t sl_core_io_trace_write(struct file *f, const char __user *buf, size_t count, loff_t *pos)
+{
+	int                           cpu;
+	struct sl_core_io_trace_ring *ring;
+
+	if (!sl_core_io_trace_rings)
+		return count;
+
+	for_each_possible_cpu(cpu) {
+		ring = per_cpu_ptr(sl_core_io_trace_rings, cpu);
+		WRITE_ONCE(ring->tail, local64_read(&ring->head));
+	}
+
+	return count;
+}
+
+static const struct file_operations sl_core_io_trace_fops = {
+	.owner   = THIS_MODULE,
+	.open    = sl_core_io_trace_open,
+	.read    = seq_read,
+	.llseek  = seq_lseek,
+	.write   = sl_core_io_trace_write,
+	.release = sl_core_io_trace_release,
+};
+
+static ssize_t sl_core_io_trace_enable_read(struct file *f, char __user *buf, size_t size, loff_t *pos)
+{
+	char str[3];
+
+	snprintf(str, sizeof(str), "%d\n", static_key_enabled(&sl_core_io_trace_key));
+
+	return simple_read_from_buffer(buf, size, pos, str, strlen(str));
+}
+
+static ssize_t sl_core_io_trace_enable_write(struct file *f, const char __user *buf, size_t count, loff_t *pos)
+{
+	int  rtn;
+	bool enable;
+
+	rtn = kstrtobool_from_user(buf, count, &enable);
+	if (rtn)
+		return rtn;
+
+	if (!enable) {
+		static_branch_disable(&sl_core_io_trace_key);
+		return count;
+	}
+
+	rtn = sl_core_io_trace_rings_alloc();
+	if (rtn) {
+		sl_core_log_err(NULL, LOG_NAME, "rings alloc failed [%d]", rtn);
+		return rtn;
+	}
+
+	static_branch_enable(&sl_core_io_trace_key);
+
+	return count;
+}
+
+static const struct file_operations sl_core_io_trace_enable_fops = {
+	.owner = THIS_MODULE,
+	.open  = simple_open,
+	.read  = sl_core_io_trace_enable_read,
+	.write = sl_core_io_trace_enable_write,
+};
+
+int sl_core_io_trace_init(void)
+{
+	sl_core_log_dbg(NULL, LOG_NAME, "init");
+
+	if (!sl_debugfs_dir_get()) {
+		sl_core_log_warn(NULL, LOG_NAME, "no sl debugfs dir");
+		return 0;
+	}
+
+	sl_core_io_trace_dir = debugfs_create_dir(SL_CORE_IO_TRACE_DIR_NAME, sl_debugfs_dir_get());
+	if (IS_ERR_OR_NULL(sl_core_io_trace_dir)) {
+		sl_core_log_warn(NULL, LOG_NAME, "debugfs_create_dir failed");
+		sl_core_io_trace_dir = NULL;
+		return 0;
+	}
+
+	debugfs_create_file("enable", 0644, sl_core_io_trace_dir, NULL, &sl_core_io_trace_enable_fops);
+	debugfs_create_file("trace", 0644, sl_core_io_trace_dir, NULL, &sl_core_io_trace_fops);
+
+	return 0;
+}
+
+void sl_core_io_trace_exit(void)
+{
+	sl_core_log_dbg(NULL, LOG_NAME, "exit");
+
+	debugfs_remove_recursive(sl_core_io_trace_dir);
+	sl_core_io_trace_dir = NULL;
+
+	static_branch_disable(&sl_core_io_trace_key);
+	synchronize_rcu();
+
+	sl_core_io_trace_rings_free(sl_core_io_trace_rings);
+	sl_core_io_trace_rings = NULL;
+}
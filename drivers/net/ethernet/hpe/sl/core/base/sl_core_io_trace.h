@@ -0,0 +1,71 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#ifndef _SL_CORE_IO_TRACE_H_
+#define _SL_CORE_IO_TRACE_H_
+
+#include <linux/types.h>
+#include <linux/jump_label.h>
+
+/*
+ * Binary per-CPU ring of register, PMI and SBUS accesses.
+ *
+ * Records are stored raw and only decoded when the debugfs trace file is
+ * read, so the enabled cost is a timestamp and a few stores per access.
+ * Disabled, the cost is a single patched branch.
+ */
+
+#define SL_CORE_IO_TRACE_RING_SIZE  4096 /* records per CPU, power of 2 */
+#define SL_CORE_IO_TRACE_RING_MASK  (SL_CORE_IO_TRACE_RING_SIZE - 1)
+
+#define SL_CORE_IO_TRACE_NUM_NONE   0xFF
+
+enum sl_core_io_trace_op {
+	SL_CORE_IO_TRACE_OP_FLSH = 1,
+	SL_CORE_IO_TRACE_OP_RD64,
+	SL_CORE_IO_TRACE_OP_WR64,
+	SL_CORE_IO_TRACE_OP_PMI_RD,
+	SL_CORE_IO_TRACE_OP_PMI_WR,
+	SL_CORE_IO_TRACE_OP_SBUS_RD,
+	SL_CORE_IO_TRACE_OP_SBUS_WR,
+	SL_CORE_IO_TRACE_OP_SBUS_WR_BLK,
+	SL_CORE_IO_TRACE_OP_SBUS_RST,
+};
+
+/*
+ * addr  - CSR address, PMI address or SBUS (ring << 16 | dev_addr << 8 | reg)
+ * data  - value read or written
+ * aux   - PMI write mask or SBUS block count
+ * seq   - written last, 0 while the record is being filled
+ */
+struct sl_core_io_trace_rec {
+	u64 seq;
+	u64 time_ns;
+	u64 addr;
+	u64 data;
+	u32 aux;
+	u32 cpu;
+	s16 rtn;
+	u8  op;
+	u8  ldev_num;
+	u8  lgrp_num;
+	u8  link_num;
+	u16 pad;
+};
+
+DECLARE_STATIC_KEY_FALSE(sl_core_io_trace_key);
+
+void sl_core_io_trace_rec(u8 op, u8 ldev_num, u8 lgrp_num, u8 link_num,
+	u64 addr, u64 data, u32 aux, int rtn);
+
+static inline void sl_core_io_trace(u8 op, u8 ldev_num, u8 lgrp_num, u8 link_num,
+	u64 addr, u64 data, u32 aux, int rtn)
+{
+	if (static_branch_unlikely(&sl_core_io_trace_key))
+		sl_core_io_trace_rec(op, ldev_num, lgrp_num, link_num, addr, data, aux, rtn);
+}
+
+int  sl_core_io_trace_init(void);
+void sl_core_io_trace_exit(void);
+
+#endif /* _SL_CORE_IO_TRACE_H_ */
@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2023,2024 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_CORE_LOG_H_
 #define _SL_CORE_LOG_H_
@@ -30,6 +30,7 @@
 
 #define SL_CORE_WORK_LINK_LOG_NAME        "work-lnk"
 #define SL_CORE_WORK_LLR_LOG_NAME         "work-llr"
+#define SL_CORE_WORKQ_LOG_NAME            "workq"
 
 #define SL_CORE_HW_LOG_NAME               "hw"
 #define SL_CORE_HW_INTR_LOG_NAME          "hw-intr"
@@ -44,10 +45,14 @@
 #define SL_CORE_HW_SBUS_LOG_NAME          "hw-sbus"
 #define SL_CORE_HW_SBUS_PMI_LOG_NAME      "hw-sbpmi"
 #define SL_CORE_HW_PMI_LOG_NAME           "hw-pmi"
+#define SL_CORE_IO_TRACE_LOG_NAME         "io-trace"
+#define SL_CORE_OP_HIST_LOG_NAME          "op-hist"
+#define SL_CORE_SERDES_FW_CACHE_LOG_NAME  "fw-cache"
 
 #define SL_CORE_TEST_FEC_LOG_NAME         "test-fec"
 #define SL_CORE_TEST_AN_LOG_NAME          "test-an"
 #define SL_CORE_TEST_SERDES_LOG_NAME      "test-ser"
+#define SL_CORE_TEST_UC_RAM_LOG_NAME      "test-ucr"
 
 #define SL_CORE_SERDES_LOG_NAME           "serdes"
 #define SL_CORE_RESET_LOG_NAME            "reset"
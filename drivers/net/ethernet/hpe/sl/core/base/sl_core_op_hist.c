@@ -0,0 +1,286 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/ktime.h>
+#include <linux/slab.h>
+#include <linux/mm.h>
+#include <linux/log2.h>
+#include <linux/debugfs.h>
+#include <linux/seq_file.h>
+
+#include "sl_core_lgrp.h"
+#include "sl_module.h"
+#include "base/sl_core_log.h"
+#include "base/sl_core_op_hist.h"
+
+#define LOG_NAME SL_CORE_OP_HIST_LOG_NAME
+
+#define SL_CORE_OP_HIST_DIR_NAME "op_hist"
+#define SL_CORE_OP_HIST_MASK     (CONFIG_SL_CORE_OP_HIST_SIZE - 1)
+
+#define SL_CORE_OP_HIST_LAST_TRIES 4
+
+static struct dentry *sl_core_op_hist_dir;
+
+static void sl_core_op_hist_slot_write(struct sl_core_op_hist_rec *slot, struct sl_core_op_hist_rec *rec)
+{
+	WRITE_ONCE(slot->seq, 0);
+	smp_wmb();
+
+	slot->time_ns  = rec->time_ns;
+	slot->data     = rec->data;
+	slot->mask     = rec->mask;
+	slot->result   = rec->result;
+	slot->addr     = rec->addr;
+	slot->op       = rec->op;
+	slot->dev_addr = rec->dev_addr;
+	slot->dev_id   = rec->dev_id;
+	slot->lane     = rec->lane;
+	slot->pll      = rec->pll;
+	slot->reg      = rec->reg;
+	slot->lsb      = rec->lsb;
+
+	smp_wmb();
+}
+
+/* only the newest op of its kind is published */
+static void sl_core_op_hist_last_write(struct sl_core_lgrp *core_lgrp, struct sl_core_op_hist_rec *rec)
+{
+	atomic64_t                 *last_seq;
+	struct sl_core_op_hist_rec *slot;
+	s64                         old_seq;
+
+	last_seq = &core_lgrp->op_hist.last_seq[rec->op];
+	slot     = &core_lgrp->op_hist.last[rec->op];
+
+	old_seq = atomic64_read(last_seq);
+	do {
+		if (old_seq >= (s64)rec->seq)
+			return;
+	} while (!atomic64_try_cmpxchg(last_seq, &old_seq, rec->seq));
+
+	sl_core_op_hist_slot_write(slot, rec);
+
+	/* a newer writer may have overlapped the fill, leave the slot unpublished */
+	if (atomic64_read(last_seq) != (s64)rec->seq)
+		return;
+
+	WRITE_ONCE(slot->seq, rec->seq);
+}
+
+void sl_core_op_hist_add(struct sl_core_lgrp *core_lgrp, u8 op, u8 dev_addr, u8 dev_id, u8 lane, u8 pll,
+			 u8 reg, u8 lsb, u16 addr, u32 data, u32 mask, int result)
+{
+	struct sl_core_op_hist_rec *slot;
+	struct sl_core_op_hist_rec  rec;
+	u64                         seq;
+
+	seq  = atomic64_inc_return(&core_lgrp->op_hist.head);
+	slot = &core_lgrp->op_hist.recs[(seq - 1) & SL_CORE_OP_HIST_MASK];
+
+	rec.seq      = seq;
+	rec.time_ns  = ktime_get_ns();
+	rec.data     = data;
+	rec.mask     = mask;
+	rec.result   = result;
+	rec.addr     = addr;
+	rec.op       = op;
+	rec.dev_addr = dev_addr;
+	rec.dev_id   = dev_id;
+	rec.lane     = lane;
+	rec.pll      = pll;
+	rec.reg      = reg;
+	rec.lsb      = lsb;
+
+	sl_core_op_hist_slot_write(slot, &rec);
+	WRITE_ONCE(slot->seq, seq);
+
+	if (op < SL_CORE_OP_HIST_OP_NUM)
+		sl_core_op_hist_last_write(core_lgrp, &rec);
+}
+
+/* false if the slot doesn't hold seq or was rewritten while copying */
+static bool sl_core_op_hist_slot_read(struct sl_core_op_hist_rec *slot, u64 seq, struct sl_core_op_hist_rec *rec)
+{
+	if (READ_ONCE(slot->seq) != seq)
+		return false;
+	smp_rmb();
+	*rec = *slot;
+	smp_rmb();
+
+	return (READ_ONCE(slot->seq) == seq);
+}
+
+static bool sl_core_op_hist_rec_read(struct sl_core_lgrp *core_lgrp, u64 seq, struct sl_core_op_hist_rec *rec)
+{
+	return sl_core_op_hist_slot_read(&core_lgrp->op_hist.recs[(seq - 1) & SL_CORE_OP_HIST_MASK], seq, rec);
+}
+
+/* rec is zeroed when the op hasn't been done yet or kept being rewritten */
+void sl_core_op_hist_last_get(struct sl_core_lgrp *core_lgrp, u8 op, struct sl_core_op_hist_rec *rec)
+{
+	u64 seq;
+	int tries;
+
+	if (op < SL_CORE_OP_HIST_OP_NUM) {
+		for (tries = 0; tries < SL_CORE_OP_HIST_LAST_TRIES; ++tries) {
+			seq = atomic64_read(&core_lgrp->op_hist.last_seq[op]);
+			if (!seq)
+				break;
+			if (sl_core_op_hist_slot_read(&core_lgrp->op_hist.last[op], seq, rec))
+				return;
+			cpu_relax();
+		}
+	}
+
+	memset(rec, 0, sizeof(*rec));
+}
+
+static const char *sl_core_op_hist_op_str(u8 op)
+{
+	switch (op) {
+	case SL_CORE_OP_HIST_OP_PMI_RD:
+		return "PMI RD";
+	case SL_CORE_OP_HIST_OP_PMI_WR:
+		return "PMI WR";
+	case SL_CORE_OP_HIST_OP_SBUS_RD:
+		return "SBUS RD";
+	case SL_CORE_OP_HIST_OP_SBUS_WR:
+		return "SBUS WR";
+	case SL_CORE_OP_HIST_OP_SBUS_RST:
+		return "SBUS RST";
+	case SL_CORE_OP_HIST_OP_SBUS_PMI_RD:
+		return "SBUS PMI RD";
+	case SL_CORE_OP_HIST_OP_SBUS_PMI_WR:
+		return "SBUS PMI WR";
+	default:
+		return "unknown";
+	}
+}
+
+static void sl_core_op_hist_rec_show(struct seq_file *s, struct sl_core_op_hist_rec *rec)
+{
+	u64 secs;
+	u32 nsecs;
+
+	secs = div_u64_rem(rec->time_ns, NSEC_PER_SEC, &nsecs);
+
+	seq_printf(s, "%llu.%09u %8llu %s ", secs, nsecs, rec->seq, sl_core_op_hist_op_str(rec->op));
+
+	switch (rec->op) {
+	case SL_CORE_OP_HIST_OP_PMI_RD:
+	case SL_CORE_OP_HIST_OP_PMI_WR:
+		seq_printf(s, "(result = %d, dev_id = 0x%02X, lane = %u, pll = %u, addr = 0x%04X, data = 0x%04X, mask = 0x%04X)\n",
+			rec->result, rec->dev_id, rec->lane, rec->pll, rec->addr, rec->data, rec->mask);
+		break;
+	case SL_CORE_OP_HIST_OP_SBUS_RD:
+	case SL_CORE_OP_HIST_OP_SBUS_WR:
+		seq_printf(s, "(result = %d, dev_addr = 0x%02X, reg = 0x%02X, lsb = %u, data = 0x%08X, mask = 0x%08X)\n",
+			rec->result, rec->dev_addr, rec->reg, rec->lsb, rec->data, rec->mask);
+		break;
+	case SL_CORE_OP_HIST_OP_SBUS_RST:
+		seq_printf(s, "(result = %d, dev_addr = 0x%02X)\n", rec->result, rec->dev_addr);
+		break;
+	case SL_CORE_OP_HIST_OP_SBUS_PMI_RD:
+	case SL_CORE_OP_HIST_OP_SBUS_PMI_WR:
+		seq_printf(s, "(result = %d, dev_addr = 0x%02X, dev_id = 0x%02X, lane = %u, pll = %u, addr = 0x%04X, data = 0x%04X, mask = 0x%04X)\n",
+			rec->result, rec->dev_addr, rec->dev_id, rec->lane, rec->pll, rec->addr, rec->data, rec->mask);
+		break;
+	default:
+		seq_puts(s, "\n");
+		break;
+	}
+}
+
+/* oldest first, slots rewritten during the dump are skipped */
+static int sl_core_op_hist_show(struct seq_file *s, void *unused)
+{
+	struct sl_core_lgrp        *core_lgrp;
+	struct sl_core_op_hist_rec  rec;
+	u64                         head;
+	u64                         seq;
+
+	core_lgrp = s->private;
+
+	head = atomic64_read(&core_lgrp->op_hist.head);
+	seq  = (head > CONFIG_SL_CORE_OP_HIST_SIZE) ? (head - CONFIG_SL_CORE_OP_HIST_SIZE + 1) : 1;
+
+	seq_printf(s, "ldev%u lgrp%02u (ops = %llu, size = %u)\n", core_lgrp->core_ldev->num,
+		core_lgrp->num, head, CONFIG_SL_CORE_OP_HIST_SIZE);
+
+	for (; seq <= head; ++seq) {
+		if (!sl_core_op_hist_rec_read(core_lgrp, seq, &rec))
+			continue;
+		sl_core_op_hist_rec_show(s, &rec);
+	}
+
+	return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(sl_core_op_hist);
+
+int sl_core_op_hist_new(struct sl_core_lgrp *core_lgrp)
+{
+	char name[32];
+	u8   op;
+
+	BUILD_BUG_ON(!is_power_of_2(CONFIG_SL_CORE_OP_HIST_SIZE));
+
+	atomic64_set(&core_lgrp->op_hist.head, 0);
+	for (op = 0; op < SL_CORE_OP_HIST_OP_NUM; ++op)
+		atomic64_set(&core_lgrp->op_hist.last_seq[op], 0);
+	memset(core_lgrp->op_hist.last, 0, sizeof(core_lgrp->op_hist.last));
+	core_lgrp->op_hist.recs = kvcalloc(CONFIG_SL_CORE_OP_HIST_SIZE, sizeof(*core_lgrp->op_hist.recs),
+		GFP_KERNEL);
+	if (!core_lgrp->op_hist.recs)
+		return -ENOMEM;
+
+	core_lgrp->op_hist.dentry = NULL;
+	if (!sl_core_op_hist_dir)
+		return 0;
+
+	snprintf(name, sizeof(name), "ldev%u_lgrp%02u", core_lgrp->core_ldev->num, core_lgrp->num);
+	core_lgrp->op_hist.dentry = debugfs_create_file(name, 0444, sl_core_op_hist_dir,
+		core_lgrp, &sl_core_op_hist_fops);
+	if (IS_ERR(core_lgrp->op_hist.dentry)) {
+		sl_core_log_warn(core_lgrp, LOG_NAME, "debugfs_create_file failed");
+		core_lgrp->op_hist.dentry = NULL;
+	}
+
+	return 0;
+}
+
+/* debugfs removal waits for readers in the show */
+void sl_core_op_hist_del(struct sl_core_lgrp *core_lgrp)
+{
+	debugfs_remove(core_lgrp->op_hist.dentry);
+	core_lgrp->op_hist.dentry = NULL;
+
+	kvfree(core_lgrp->op_hist.recs);
+	core_lgrp->op_hist.recs = NULL;
+}
+
+int sl_core_op_hist_init(void)
+{
+	sl_core_log_dbg(NULL, LOG_NAME, "init");
+
+	if (!sl_debugfs_dir_get()) {
+		sl_core_log_warn(NULL, LOG_NAME, "no sl debugfs dir");
+		return 0;
+	}
+
+	sl_core_op_hist_dir = debugfs_create_dir(SL_CORE_OP_HIST_DIR_NAME, sl_debugfs_dir_get());
+	if (IS_ERR_OR_NULL(sl_core_op_hist_dir)) {
+		sl_core_log_warn(NULL, LOG_NAME, "debugfs_create_dir failed");
+		sl_core_op_hist_dir = NULL;
+	}
+
+	return 0;
+}
+
+void sl_core_op_hist_exit(void)
+{
+	sl_core_log_dbg(NULL, LOG_NAME, "exit");
+
+	debugfs_remove_recursive(sl_core_op_hist_dir);
+	sl_core_op_hist_dir = NULL;
+}
@@ -0,0 +1,74 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#ifndef _SL_CORE_OP_HIST_H_
+#define _SL_CORE_OP_HIST_H_
+
+#include <linux/types.h>
+#include <linux/atomic.h>
+
+struct dentry;
+struct sl_core_lgrp;
+
+/*
+ * Per lgrp ring of the last SBUS, PMI and SBUS PMI ops.
+ *
+ * Writers claim a slot with one atomic increment and never take a lock.
+ * Readers copy a record and keep it only if its seq didn't change while
+ * copying. The last op of each kind is also kept in its own slot, so it
+ * survives being pushed out of the ring. The newest writer of an op wins
+ * the op's last seq with a cmpxchg and publishes the slot the same way the
+ * ring does.
+ */
+
+#ifndef CONFIG_SL_CORE_OP_HIST_SIZE
+#define CONFIG_SL_CORE_OP_HIST_SIZE 256 /* ops per lgrp, power of 2 */
+#endif
+
+enum sl_core_op_hist_op {
+	SL_CORE_OP_HIST_OP_PMI_RD = 1,
+	SL_CORE_OP_HIST_OP_PMI_WR,
+	SL_CORE_OP_HIST_OP_SBUS_RD,
+	SL_CORE_OP_HIST_OP_SBUS_WR,
+	SL_CORE_OP_HIST_OP_SBUS_RST,
+	SL_CORE_OP_HIST_OP_SBUS_PMI_RD,
+	SL_CORE_OP_HIST_OP_SBUS_PMI_WR,
+	SL_CORE_OP_HIST_OP_NUM,
+};
+
+/* seq is written last, 0 while the record is being filled */
+struct sl_core_op_hist_rec {
+	u64 seq;
+	u64 time_ns;
+	u32 data;
+	u32 mask;
+	int result;
+	u16 addr;
+	u8  op;
+	u8  dev_addr;
+	u8  dev_id;
+	u8  lane;
+	u8  pll;
+	u8  reg;
+	u8  lsb;
+};
+
+struct sl_core_op_hist {
+	atomic64_t                  head;
+	struct sl_core_op_hist_rec *recs;
+	atomic64_t                  last_seq[SL_CORE_OP_HIST_OP_NUM];
+	struct sl_core_op_hist_rec  last[SL_CORE_OP_HIST_OP_NUM];
+	struct dentry              *dentry;
+};
+
+int  sl_core_op_hist_new(struct sl_core_lgrp *core_lgrp);
+void sl_core_op_hist_del(struct sl_core_lgrp *core_lgrp);
+
+void sl_core_op_hist_add(struct sl_core_lgrp *core_lgrp, u8 op, u8 dev_addr, u8 dev_id, u8 lane, u8 pll,
+			 u8 reg, u8 lsb, u16 addr, u32 data, u32 mask, int result);
+void sl_core_op_hist_last_get(struct sl_core_lgrp *core_lgrp, u8 op, struct sl_core_op_hist_rec *rec);
+
+int  sl_core_op_hist_init(void);
+void sl_core_op_hist_exit(void);
+
+#endif /* _SL_CORE_OP_HIST_H_ */
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/firmware.h>
+#include <linux/slab.h>
+#include <linux/mm.h>
+#include <linux/crc32.h>
+#include <linux/string.h>
+#include <linux/spinlock.h>
+
+#include "sl_asic.h"
+#include "sl_module.h"
+#include "base/sl_core_log.h"
+#include "base/sl_core_serdes_fw_cache.h"
+#include "hw/sl_core_hw_serdes_fw.h"
+
+#define LOG_NAME SL_CORE_SERDES_FW_CACHE_LOG_NAME
+
+static struct sl_core_serdes_fw_image       sl_core_serdes_fw_image;
+static struct sl_core_serdes_fw_cache_stats sl_core_serdes_fw_cache_stats;
+static struct sl_core_serdes_fw_loaded      sl_core_serdes_fw_loaded[SL_ASIC_MAX_LDEVS][SL_ASIC_MAX_SERDES];
+static DEFINE_SPINLOCK(sl_core_serdes_fw_cache_lock);
+
+static int sl_core_serdes_fw_cache_load(struct sl_core_serdes_fw_image *image)
+{
+	int                    rtn;
+	const struct firmware *fw;
+	u8                    *data;
+
+	rtn = request_firmware(&fw, SL_HW_SERDES_FW_FILE, sl_device_get());
+	if (rtn) {
+		sl_core_log_err(NULL, LOG_NAME, "request_firmware failed [%d]", rtn);
+		return -EIO;
+	}
+
+	if (!fw->size) {
+		sl_core_log_err(NULL, LOG_NAME, "empty image (file = %s)", SL_HW_SERDES_FW_FILE);
+		release_firmware(fw);
+		return -EIO;
+	}
+
+	data = kvmalloc(fw->size, GFP_KERNEL);
+	if (!data) {
+		release_firmware(fw);
+		return -ENOMEM;
+	}
+	memcpy(data, fw->data, fw->size);
+
+	image->data = data;
+	image->size = fw->size;
+	image->crc  = crc32_le(~0, data, fw->size) ^ ~0;
+
+	release_firmware(fw);
+
+	sl_core_log_dbg(NULL, LOG_NAME, "load (file = %s, size = %zu, crc = 0x%08X)",
+		SL_HW_SERDES_FW_FILE, image->size, image->crc);
+
+	return 0;
+}
+
+/* the image stays valid until the module exits */
+int sl_core_serdes_fw_cache_get(const struct sl_core_serdes_fw_image **image)
+{
+	int                            rtn;
+	struct sl_core_serdes_fw_image new_image;
+
+	spin_lock(&sl_core_serdes_fw_cache_lock);
+	if (sl_core_serdes_fw_image.data) {
+		sl_core_serdes_fw_cache_stats.hits++;
+		spin_unlock(&sl_core_serdes_fw_cache_lock);
+		*image = &sl_core_serdes_fw_image;
+		return 0;
+	}
+	sl_core_serdes_fw_cache_stats.misses++;
+	spin_unlock(&sl_core_serdes_fw_cache_lock);
+
+	rtn = sl_core_serdes_fw_cache_load(&new_image);
+	if (rtn)
+		return rtn;
+
+	/* another ldev may have loaded it in the meantime */
+	spin_lock(&sl_core_serdes_fw_cache_lock);
+	if (!sl_core_serdes_fw_image.data) {
+		sl_core_serdes_fw_image = new_image;
+		new_image.data          = NULL;
+	}
+	spin_unlock(&sl_core_serdes_fw_cache_lock);
+
+	kvfree(new_image.data);
+
+	*image = &sl_core_serdes_fw_image;
+
+	return 0;
+}
+
+void sl_core_serdes_fw_cache_stats_get(struct sl_core_serdes_fw_cache_stats *stats)
+{
+	spin_lock(&sl_core_serdes_fw_cache_lock);
+	*stats = sl_core_serdes_fw_cache_stats;
+	spin_unlock(&sl_core_serdes_fw_cache_lock);
+}
+
+void sl_core_serdes_fw_cache_loaded_set(u8 ldev_num, u8 serdes_num, u32 signature, u8 version, u32 image_crc)
+{
+	struct sl_core_serdes_fw_loaded *loaded;
+
+	sl_core_log_dbg(NULL, LOG_NAME,
+		"loaded set (ldev_num = %u, serdes_num = %u, signature = 0x%06X, version = 0x%02X, image_crc = 0x%08X)",
+		ldev_num, serdes_num, signature, version, image_crc);
+
+	spin_lock(&sl_core_serdes_fw_cache_lock);
+	loaded            = &sl_core_serdes_fw_loaded[ldev_num][serdes_num];
+	loaded->is_loaded = true;
+	loaded->signature = signature;
+	loaded->version   = version;
+	loaded->image_crc = image_crc;
+	spin_unlock(&sl_core_serdes_fw_cache_lock);
+}
+
+void sl_core_serdes_fw_cache_loaded_clr(u8 ldev_num, u8 serdes_num)
+{
+	spin_lock(&sl_core_serdes_fw_cache_lock);
+	memset(&sl_core_serdes_fw_loaded[ldev_num][serdes_num], 0, sizeof(struct sl_core_serdes_fw_loaded));
+	spin_unlock(&sl_core_serdes_fw_cache_lock);
+}
+
+bool sl_core_serdes_fw_cache_loaded_get(u8 ldev_num, u8 serdes_num, struct sl_core_serdes_fw_loaded *loaded)
+{
+	spin_lock(&sl_core_serdes_fw_cache_lock);
+	*loaded = sl_core_serdes_fw_loaded[ldev_num][serdes_num];
+	spin_unlock(&sl_core_serdes_fw_cache_lock);
+
+	return loaded->is_loaded;
+}
+
+int sl_core_serdes_fw_cache_init(void)
+{
+	sl_core_log_dbg(NULL, LOG_NAME, "init");
+
+	memset(&sl_core_serdes_fw_image, 0, sizeof(sl_core_serdes_fw_image));
+	memset(&sl_core_serdes_fw_cache_stats, 0, sizeof(sl_core_serdes_fw_cache_stats));
+	memset(sl_core_serdes_fw_loaded, 0, sizeof(sl_core_serdes_fw_loaded));
+
+	return 0;
+}
+
+/* must be called after every ldev is deleted */
+void sl_core_serdes_fw_cache_exit(void)
+{
+	sl_core_log_dbg(NULL, LOG_NAME, "exit");
+
+	kvfree(sl_core_serdes_fw_image.data);
+	memset(&sl_core_serdes_fw_image, 0, sizeof(sl_core_serdes_fw_image));
+}
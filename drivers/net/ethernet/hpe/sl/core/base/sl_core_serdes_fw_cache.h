@@ -0,0 +1,46 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#ifndef _SL_CORE_SERDES_FW_CACHE_H_
+#define _SL_CORE_SERDES_FW_CACHE_H_
+
+#include <linux/types.h>
+
+/*
+ * SerDes firmware image cache.
+ *
+ * The image is read from the filesystem on first use and kept until the
+ * module exits, with its CRC32 worked out once on the host. The firmware
+ * each SerDes was last loaded with is also kept for the module lifetime,
+ * so it outlives ldev delete and new.
+ */
+
+struct sl_core_serdes_fw_image {
+	const u8 *data;
+	size_t    size;
+	u32       crc;
+};
+
+struct sl_core_serdes_fw_loaded {
+	bool is_loaded;
+	u32  signature;
+	u8   version;
+	u32  image_crc;
+};
+
+struct sl_core_serdes_fw_cache_stats {
+	u32 hits;
+	u32 misses;
+};
+
+int  sl_core_serdes_fw_cache_get(const struct sl_core_serdes_fw_image **image);
+void sl_core_serdes_fw_cache_stats_get(struct sl_core_serdes_fw_cache_stats *stats);
+
+void sl_core_serdes_fw_cache_loaded_set(u8 ldev_num, u8 serdes_num, u32 signature, u8 version, u32 image_crc);
+void sl_core_serdes_fw_cache_loaded_clr(u8 ldev_num, u8 serdes_num);
+bool sl_core_serdes_fw_cache_loaded_get(u8 ldev_num, u8 serdes_num, struct sl_core_serdes_fw_loaded *loaded);
+
+int  sl_core_serdes_fw_cache_init(void);
+void sl_core_serdes_fw_cache_exit(void);
+
+#endif /* _SL_CORE_SERDES_FW_CACHE_H_ */
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2022,2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2022,2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 #include <linux/spinlock.h>
@@ -17,6 +17,7 @@
 #include "data/sl_core_data_link.h"
 
 #include "hw/sl_core_hw_intr.h"
+#include "sl_trace.h"
 
 #define LOG_NAME SL_CORE_TIMER_LINK_LOG_NAME
 
@@ -67,6 +68,7 @@ void sl_core_timer_link_begin(struct sl_core_link *core_link, u32 timer_num)
 	case SL_CORE_LINK_STATE_AN:
 	case SL_CORE_LINK_STATE_GOING_UP:
 	case SL_CORE_LINK_STATE_UP:
+		trace_sl_core_link_timer_arm(core_link, timer_num);
 		add_timer(&(core_link->timers[timer_num].timer));
 		spin_unlock(&core_link->link.data_lock);
 		return;
@@ -98,7 +100,8 @@ void sl_core_timer_link_timeout(struct timer_list *timer)
 		"timeout %s (core_link = 0x%p, timer_num = %u, work_num = %u)",
 		info->data.log, core_link, info->data.timer_num, info->data.work_num);
 
-	queue_work(core_link->core_lgrp->core_ldev->workqueue, &(core_link->work[info->data.work_num]));
+	trace_sl_core_link_timer_fire(core_link, info->data.timer_num);
+	sl_core_work_link_queue(core_link, info->data.work_num);
 }
 
 void sl_core_timer_link_end(struct sl_core_link *core_link, u32 timer_num)
@@ -108,4 +111,6 @@ void sl_core_timer_link_end(struct sl_core_link *core_link, u32 timer_num)
 		core_link->timers[timer_num].data.log, core_link, timer_num);
 
 	timer_delete_sync(&(core_link->timers[timer_num].timer));
+
+	trace_sl_core_link_timer_end(core_link, timer_num);
 }
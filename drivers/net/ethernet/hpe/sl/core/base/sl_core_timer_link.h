@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2022,2023,2024 Hewlett Packard Enterprise Development LP */
+/* Copyright 2022,2023,2024,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_CORE_TIMER_LINK_H_
 #define _SL_CORE_TIMER_LINK_H_
@@ -15,6 +15,7 @@ enum {
 	SL_CORE_TIMER_LINK_UP_FEC_CHECK,
 	SL_CORE_TIMER_LINK_UP_HIGH_POWER,
 	SL_CORE_TIMER_LINK_AN_LP_CAPS_GET,
+	SL_CORE_TIMER_LINK_PML_REC_POLL,
 
 	SL_CORE_TIMER_LINK_COUNT           /* must be last */
 };
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 #include <linux/timer.h>
@@ -11,6 +11,7 @@
 #include "base/sl_core_timer_llr.h"
 #include "base/sl_core_work_llr.h"
 #include "base/sl_core_log.h"
+#include "sl_trace.h"
 
 #define LOG_NAME SL_CORE_TIMER_LLR_LOG_NAME
 
@@ -39,6 +40,7 @@ void sl_core_timer_llr_begin(struct sl_core_llr *core_llr, u32 timer_num)
 	switch (llr_state) {
 	case SL_CORE_LLR_STATE_SETTING_UP:
 	case SL_CORE_LLR_STATE_STARTING:
+		trace_sl_core_llr_timer_arm(core_llr, timer_num);
 		add_timer(&(core_llr->timers[timer_num].timer));
 		spin_unlock(&core_llr->data_lock);
 		return;
@@ -72,7 +74,8 @@ void sl_core_timer_llr_timeout(struct timer_list *timer)
 		info->data.log, core_llr,
 		info->data.timer_num, info->data.work_num);
 
-	queue_work(core_llr->core_lgrp->core_ldev->workqueue, &(core_llr->work[info->data.work_num]));
+	trace_sl_core_llr_timer_fire(core_llr, info->data.timer_num);
+	sl_core_work_llr_queue(core_llr, info->data.work_num);
 }
 
 void sl_core_timer_llr_end(struct sl_core_llr *core_llr, u32 timer_num)
@@ -82,4 +85,6 @@ void sl_core_timer_llr_end(struct sl_core_llr *core_llr, u32 timer_num)
 		core_llr->timers[timer_num].data.log, core_llr, timer_num);
 
 	timer_delete_sync(&(core_llr->timers[timer_num].timer));
+
+	trace_sl_core_llr_timer_end(core_llr, timer_num);
 }
@@ -1,9 +1,11 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2024 Hewlett Packard Enterprise Development LP */
+/* Copyright 2024,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_CORE_WORK_LLR_H_
 #define _SL_CORE_WORK_LLR_H_
 
+struct sl_core_llr;
+
 enum {
 	SL_CORE_WORK_LLR_SETUP                  = 0,
 	SL_CORE_WORK_LLR_SETUP_TIMEOUT,
@@ -16,4 +18,7 @@ enum {
 	SL_CORE_WORK_LLR_COUNT                         /* must be last */
 };
 
+bool sl_core_work_llr_queue(struct sl_core_llr *core_llr, u32 work_num);
+bool sl_core_work_llr_cancel(struct sl_core_llr *core_llr, u32 work_num);
+
 #endif /* _SL_CORE_WORK_LLR_H_ */
@@ -0,0 +1,376 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/types.h>
+#include <linux/spinlock.h>
+#include <linux/workqueue.h>
+#include <linux/cpumask.h>
+#include <linux/topology.h>
+#include <linux/nodemask.h>
+#include <linux/ktime.h>
+#include <linux/jiffies.h>
+
+#include "sl_asic.h"
+#include "sl_core_ldev.h"
+#include "sl_core_lgrp.h"
+#include "sl_core_link.h"
+#include "sl_core_llr.h"
+#include "base/sl_core_log.h"
+#include "base/sl_core_workq.h"
+#include "base/sl_core_work_link.h"
+#include "base/sl_core_work_llr.h"
+#include "sl_trace.h"
+
+#define LOG_NAME SL_CORE_WORKQ_LOG_NAME
+
+static void sl_core_workq_max_update(atomic64_t *max, s64 val)
+{
+	s64 old;
+
+	old = atomic64_read(max);
+	while (val > old) {
+		if (atomic64_try_cmpxchg(max, &old, val))
+			break;
+	}
+}
+
+static void sl_core_workq_shard_destroy(struct sl_core_workq *core_workq)
+{
+	if (core_workq->notif_workq)
+		destroy_workqueue(core_workq->notif_workq);
+	if (core_workq->workq)
+		destroy_workqueue(core_workq->workq);
+	free_cpumask_var(core_workq->cpumask);
+
+	core_workq->notif_workq = NULL;
+	core_workq->workq       = NULL;
+}
+
+int sl_core_workq_create(struct sl_core_ldev *core_ldev)
+{
+	struct sl_core_workq *core_workq;
+	u8                    shard_num;
+
+	for (shard_num = 0; shard_num < SL_CORE_WORKQ_NUM_SHARDS; ++shard_num) {
+		core_workq = &(core_ldev->workqs[shard_num]);
+
+		core_workq->ldev_num  = core_ldev->num;
+		core_workq->num       = shard_num;
+		core_workq->numa_node = NUMA_NO_NODE;
+		core_workq->next_cpu  = -1;
+		spin_lock_init(&(core_workq->data_lock));
+
+		if (!zalloc_cpumask_var(&(core_workq->cpumask), GFP_KERNEL))
+			goto out;
+
+		/* bound so the shard cpumask can steer work with queue_work_on */
+		core_workq->workq = alloc_workqueue("%s%u-wq%u", WQ_MEM_RECLAIM, 0,
+			"sl-ldev", core_ldev->num, shard_num);
+		if (!core_workq->workq) {
+			free_cpumask_var(core_workq->cpumask);
+			goto out;
+		}
+
+		core_workq->notif_workq = alloc_workqueue("%s%u-notif%u", WQ_MEM_RECLAIM, 0,
+			"sl-ldev", core_ldev->num, shard_num);
+		if (!core_workq->notif_workq) {
+			destroy_workqueue(core_workq->workq);
+			core_workq->workq = NULL;
+			free_cpumask_var(core_workq->cpumask);
+			goto out;
+		}
+
+		sl_core_workq_stats_clr(core_workq);
+	}
+
+	sl_core_log_dbg(core_ldev, LOG_NAME, "create (num_shards = %u, lgrps_per_shard = %u)",
+		SL_CORE_WORKQ_NUM_SHARDS, SL_CORE_WORKQ_LGRPS_PER_SHARD);
+
+	return 0;
+
+out:
+	sl_core_log_err(core_ldev, LOG_NAME, "create failed (shard_num = %u)", shard_num);
+
+	while (shard_num--)
+		sl_core_workq_shard_destroy(&(core_ldev->workqs[shard_num]));
+
+	return -ENOMEM;
+}
+
+void sl_core_workq_destroy(struct sl_core_ldev *core_ldev)
+{
+	u8 shard_num;
+
+	sl_core_log_dbg(core_ldev, LOG_NAME, "destroy");
+
+	for (shard_num = 0; shard_num < SL_CORE_WORKQ_NUM_SHARDS; ++shard_num)
+		sl_core_workq_shard_destroy(&(core_ldev->workqs[shard_num]));
+}
+
+struct sl_core_workq *sl_core_workq_get(u8 ldev_num, u8 lgrp_num)
+{
+	struct sl_core_ldev *core_ldev;
+
+	core_ldev = sl_core_ldev_get(ldev_num);
+	if (!core_ldev)
+		return NULL;
+
+	return &(core_ldev->workqs[SL_CORE_WORKQ_SHARD(lgrp_num)]);
+}
+
+static int sl_core_workq_cpu_next(struct sl_core_workq *core_workq)
+{
+	unsigned long irq_flags;
+	int           cpu;
+
+	spin_lock_irqsave(&(core_workq->data_lock), irq_flags);
+	cpu = cpumask_next_and(core_workq->next_cpu, core_workq->cpumask, cpu_online_mask);
+	if (cpu >= nr_cpu_ids)
+		cpu = cpumask_first_and(core_workq->cpumask, cpu_online_mask);
+	if (cpu < nr_cpu_ids)
+		core_workq->next_cpu = cpu;
+	spin_unlock_irqrestore(&(core_workq->data_lock), irq_flags);
+
+	return cpu;
+}
+
+static bool sl_core_workq_queue_on(struct sl_core_workq *core_workq, struct workqueue_struct *workq,
+	struct work_struct *work, u64 *queue_ns)
+{
+	int  cpu;
+	bool queued;
+
+	/* don't restamp work that is still waiting to run */
+	if (work_pending(work)) {
+		atomic64_inc(&(core_workq->stats.busy));
+		return false;
+	}
+
+	WRITE_ONCE(*queue_ns, ktime_get_ns());
+
+	cpu = sl_core_workq_cpu_next(core_workq);
+	if (cpu < nr_cpu_ids)
+		queued = queue_work_on(cpu, workq, work);
+	else
+		queued = queue_work(workq, work);
+
+	if (!queued) {
+		atomic64_inc(&(core_workq->stats.busy));
+		return false;
+	}
+
+	atomic64_inc(&(core_workq->stats.queued));
+	sl_core_workq_max_update(&(core_workq->stats.depth_max),
+		atomic64_inc_return(&(core_workq->stats.depth)));
+
+	return true;
+}
+
+bool sl_core_workq_queue(struct sl_core_workq *core_workq, struct work_struct *work, u64 *queue_ns)
+{
+	return sl_core_workq_queue_on(core_workq, core_workq->workq, work, queue_ns);
+}
+
+bool sl_core_workq_notif_queue(struct sl_core_workq *core_workq, struct work_struct *work, u64 *queue_ns)
+{
+	return sl_core_workq_queue_on(core_workq, core_workq->notif_workq, work, queue_ns);
+}
+
+bool sl_core_workq_cancel(struct sl_core_workq *core_workq, struct work_struct *work)
+{
+	if (!cancel_work_sync(work))
+		return false;
+
+	atomic64_dec(&(core_workq->stats.depth));
+
+	return true;
+}
+
+/* queue_ns is when the work is due so the latency is how late it ran */
+bool sl_core_workq_delayed_queue(struct sl_core_workq *core_workq, struct delayed_work *dwork,
+	unsigned long delay, u64 *queue_ns)
+{
+	int  cpu;
+	bool queued;
+
+	if (delayed_work_pending(dwork)) {
+		atomic64_inc(&(core_workq->stats.busy));
+		return false;
+	}
+
+	WRITE_ONCE(*queue_ns, ktime_get_ns() + jiffies_to_nsecs(delay));
+
+	cpu = sl_core_workq_cpu_next(core_workq);
+	if (cpu < nr_cpu_ids)
+		queued = queue_delayed_work_on(cpu, core_workq->workq, dwork, delay);
+	else
+		queued = queue_delayed_work(core_workq->workq, dwork, delay);
+
+	if (!queued) {
+		atomic64_inc(&(core_workq->stats.busy));
+		return false;
+	}
+
+	atomic64_inc(&(core_workq->stats.queued));
+	sl_core_workq_max_update(&(core_workq->stats.depth_max),
+		atomic64_inc_return(&(core_workq->stats.depth)));
+
+	return true;
+}
+
+bool sl_core_workq_delayed_cancel(struct sl_core_workq *core_workq, struct delayed_work *dwork)
+{
+	if (!cancel_delayed_work_sync(dwork))
+		return false;
+
+	atomic64_dec(&(core_workq->stats.depth));
+
+	return true;
+}
+
+u64 sl_core_workq_work_start(struct sl_core_workq *core_workq, u64 queue_ns)
+{
+	u64 start_ns;
+	u64 lat_ns;
+
+	start_ns = ktime_get_ns();
+
+	atomic64_dec(&(core_workq->stats.depth));
+	atomic64_inc(&(core_workq->stats.run));
+
+	if (queue_ns && (start_ns > queue_ns)) {
+		lat_ns = start_ns - queue_ns;
+		atomic64_add(lat_ns, &(core_workq->stats.lat_sum_ns));
+		sl_core_workq_max_update(&(core_workq->stats.lat_max_ns), lat_ns);
+	}
+
+	return start_ns;
+}
+
+void sl_core_workq_work_end(struct sl_core_workq *core_workq, u64 start_ns)
+{
+	u64 run_ns;
+
+	run_ns = ktime_get_ns() - start_ns;
+
+	atomic64_add(run_ns, &(core_workq->stats.run_sum_ns));
+	sl_core_workq_max_update(&(core_workq->stats.run_max_ns), run_ns);
+}
+
+bool sl_core_work_link_queue(struct sl_core_link *core_link, u32 work_num)
+{
+	trace_sl_core_link_work_queue(core_link, work_num);
+
+	return sl_core_workq_queue(core_link->core_lgrp->core_workq,
+		&(core_link->work[work_num]), &(core_link->work_queue_ns[work_num]));
+}
+
+bool sl_core_work_llr_queue(struct sl_core_llr *core_llr, u32 work_num)
+{
+	trace_sl_core_llr_work_queue(core_llr, work_num);
+
+	return sl_core_workq_queue(core_llr->core_lgrp->core_workq,
+		&(core_llr->work[work_num]), &(core_llr->work_queue_ns[work_num]));
+}
+
+bool sl_core_work_link_cancel(struct sl_core_link *core_link, u32 work_num)
+{
+	return sl_core_workq_cancel(core_link->core_lgrp->core_workq, &(core_link->work[work_num]));
+}
+
+bool sl_core_work_llr_cancel(struct sl_core_llr *core_llr, u32 work_num)
+{
+	return sl_core_workq_cancel(core_llr->core_lgrp->core_workq, &(core_llr->work[work_num]));
+}
+
+int sl_core_workq_cpumask_set(struct sl_core_workq *core_workq, const struct cpumask *cpumask)
+{
+	unsigned long irq_flags;
+
+	if (!cpumask_empty(cpumask) && !cpumask_intersects(cpumask, cpu_online_mask))
+		return -EINVAL;
+
+	spin_lock_irqsave(&(core_workq->data_lock), irq_flags);
+	cpumask_copy(core_workq->cpumask, cpumask);
+	core_workq->numa_node = NUMA_NO_NODE;
+	core_workq->next_cpu  = -1;
+	spin_unlock_irqrestore(&(core_workq->data_lock), irq_flags);
+
+	sl_core_log_dbg(NULL, LOG_NAME, "cpumask set (ldev_num = %u, shard_num = %u, cpumask = %*pbl)",
+		core_workq->ldev_num, core_workq->num, cpumask_pr_args(cpumask));
+
+	return 0;
+}
+
+void sl_core_workq_cpumask_get(struct sl_core_workq *core_workq, struct cpumask *cpumask)
+{
+	unsigned long irq_flags;
+
+	spin_lock_irqsave(&(core_workq->data_lock), irq_flags);
+	cpumask_copy(cpumask, core_workq->cpumask);
+	spin_unlock_irqrestore(&(core_workq->data_lock), irq_flags);
+}
+
+int sl_core_workq_numa_node_set(struct sl_core_workq *core_workq, int numa_node)
+{
+	unsigned long irq_flags;
+
+	if ((numa_node != NUMA_NO_NODE) &&
+	    ((numa_node < 0) || (numa_node >= nr_node_ids) || !node_online(numa_node)))
+		return -EINVAL;
+
+	spin_lock_irqsave(&(core_workq->data_lock), irq_flags);
+	if (numa_node == NUMA_NO_NODE)
+		cpumask_clear(core_workq->cpumask);
+	else
+		cpumask_copy(core_workq->cpumask, cpumask_of_node(numa_node));
+	core_workq->numa_node = numa_node;
+	core_workq->next_cpu  = -1;
+	spin_unlock_irqrestore(&(core_workq->data_lock), irq_flags);
+
+	sl_core_log_dbg(NULL, LOG_NAME, "numa node set (ldev_num = %u, shard_num = %u, numa_node = %d)",
+		core_workq->ldev_num, core_workq->num, numa_node);
+
+	return 0;
+}
+
+int sl_core_workq_numa_node_get(struct sl_core_workq *core_workq)
+{
+	unsigned long irq_flags;
+	int           numa_node;
+
+	spin_lock_irqsave(&(core_workq->data_lock), irq_flags);
+	numa_node = core_workq->numa_node;
+	spin_unlock_irqrestore(&(core_workq->data_lock), irq_flags);
+
+	return numa_node;
+}
+
+void sl_core_workq_stats_get(struct sl_core_workq *core_workq, struct sl_core_workq_stats *stats)
+{
+	s64 depth;
+
+	stats->queued     = atomic64_read(&(core_workq->stats.queued));
+	stats->busy       = atomic64_read(&(core_workq->stats.busy));
+	stats->run        = atomic64_read(&(core_workq->stats.run));
+	depth             = atomic64_read(&(core_workq->stats.depth));
+	stats->depth      = (depth > 0) ? depth : 0;
+	stats->depth_max  = atomic64_read(&(core_workq->stats.depth_max));
+	stats->lat_sum_ns = atomic64_read(&(core_workq->stats.lat_sum_ns));
+	stats->lat_max_ns = atomic64_read(&(core_workq->stats.lat_max_ns));
+	stats->run_sum_ns = atomic64_read(&(core_workq->stats.run_sum_ns));
+	stats->run_max_ns = atomic64_read(&(core_workq->stats.run_max_ns));
+}
+
+/* depth is live state and is not cleared */
+void sl_core_workq_stats_clr(struct sl_core_workq *core_workq)
+{
+	atomic64_set(&(core_workq->stats.queued), 0);
+	atomic64_set(&(core_workq->stats.busy), 0);
+	atomic64_set(&(core_workq->stats.run), 0);
+	atomic64_set(&(core_workq->stats.depth_max), atomic64_read(&(core_workq->stats.depth)));
+	atomic64_set(&(core_workq->stats.lat_sum_ns), 0);
+	atomic64_set(&(core_workq->stats.lat_max_ns), 0);
+	atomic64_set(&(core_workq->stats.run_sum_ns), 0);
+	atomic64_set(&(core_workq->stats.run_max_ns), 0);
+}
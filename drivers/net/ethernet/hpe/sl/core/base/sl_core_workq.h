@@ -0,0 +1,85 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#ifndef _SL_CORE_WORKQ_H_
+#define _SL_CORE_WORKQ_H_
+
+#include <linux/types.h>
+#include <linux/spinlock.h>
+#include <linux/workqueue.h>
+#include <linux/cpumask.h>
+#include <linux/atomic.h>
+
+#include "sl_asic.h"
+
+struct sl_core_ldev;
+
+/*
+ * Link work is sharded across workqueues by lgrp so a slow lgrp only
+ * backs up the lgrps sharing its shard. Each shard has a second
+ * workqueue for notifications since link work flushes them.
+ */
+#define SL_CORE_WORKQ_LGRPS_PER_SHARD 4
+#define SL_CORE_WORKQ_NUM_SHARDS      DIV_ROUND_UP(SL_ASIC_MAX_LGRPS, SL_CORE_WORKQ_LGRPS_PER_SHARD)
+#define SL_CORE_WORKQ_SHARD(_lgrp_num) ((_lgrp_num) / SL_CORE_WORKQ_LGRPS_PER_SHARD)
+
+struct sl_core_workq_stats {
+	u64 queued;
+	u64 busy;
+	u64 run;
+	u64 depth;
+	u64 depth_max;
+	u64 lat_sum_ns;
+	u64 lat_max_ns;
+	u64 run_sum_ns;
+	u64 run_max_ns;
+};
+
+struct sl_core_workq {
+	u8                        ldev_num;
+	u8                        num;
+
+	struct workqueue_struct  *workq;
+	struct workqueue_struct  *notif_workq;
+
+	spinlock_t                data_lock;
+	cpumask_var_t             cpumask;
+	int                       numa_node;
+	int                       next_cpu;
+
+	struct {
+		atomic64_t        queued;
+		atomic64_t        busy;
+		atomic64_t        run;
+		atomic64_t        depth;
+		atomic64_t        depth_max;
+		atomic64_t        lat_sum_ns;
+		atomic64_t        lat_max_ns;
+		atomic64_t        run_sum_ns;
+		atomic64_t        run_max_ns;
+	} stats;
+};
+
+int  sl_core_workq_create(struct sl_core_ldev *core_ldev);
+void sl_core_workq_destroy(struct sl_core_ldev *core_ldev);
+
+struct sl_core_workq *sl_core_workq_get(u8 ldev_num, u8 lgrp_num);
+
+bool sl_core_workq_queue(struct sl_core_workq *core_workq, struct work_struct *work, u64 *queue_ns);
+bool sl_core_workq_notif_queue(struct sl_core_workq *core_workq, struct work_struct *work, u64 *queue_ns);
+bool sl_core_workq_cancel(struct sl_core_workq *core_workq, struct work_struct *work);
+bool sl_core_workq_delayed_queue(struct sl_core_workq *core_workq, struct delayed_work *dwork,
+				 unsigned long delay, u64 *queue_ns);
+bool sl_core_workq_delayed_cancel(struct sl_core_workq *core_workq, struct delayed_work *dwork);
+u64  sl_core_workq_work_start(struct sl_core_workq *core_workq, u64 queue_ns);
+void sl_core_workq_work_end(struct sl_core_workq *core_workq, u64 start_ns);
+
+int  sl_core_workq_cpumask_set(struct sl_core_workq *core_workq, const struct cpumask *cpumask);
+void sl_core_workq_cpumask_get(struct sl_core_workq *core_workq, struct cpumask *cpumask);
+int  sl_core_workq_numa_node_set(struct sl_core_workq *core_workq, int numa_node);
+int  sl_core_workq_numa_node_get(struct sl_core_workq *core_workq);
+
+void sl_core_workq_stats_get(struct sl_core_workq *core_workq, struct sl_core_workq_stats *stats);
+void sl_core_workq_stats_clr(struct sl_core_workq *core_workq);
+
+#endif /* _SL_CORE_WORKQ_H_ */
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2022,2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2022,2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 #include <linux/spinlock.h>
@@ -11,6 +11,7 @@
 
 #include "sl_asic.h"
 #include "base/sl_core_log.h"
+#include "base/sl_core_workq.h"
 #include "sl_core_ldev.h"
 #include "sl_core_lgrp.h"
 #include "data/sl_core_data_ldev.h"
@@ -24,12 +25,17 @@ static DEFINE_SPINLOCK(core_ldevs_lock);
 
 #define LOG_NAME SL_CORE_DATA_LDEV_LOG_NAME
 
+#define SL_CORE_DATA_LDEV_SERDES_INIT_MAX_ACTIVE 8 /* serdes init workers */
+
 int sl_core_data_ldev_new(u8 ldev_num, struct sl_accessors *accessors,
-	struct sl_ops *ops, struct workqueue_struct *workqueue)
+	struct sl_ops *ops, struct workqueue_struct *workqueue, u32 options)
 {
 	int                  rtn;
 	struct sl_core_ldev *core_ldev;
+	u8                   platform;
+	u16                  revision;
 	u16                  proto;
+	int                  serdes_num;
 
 	core_ldev = sl_core_ldev_get(ldev_num);
 	if (core_ldev) {
@@ -37,6 +43,18 @@ int sl_core_data_ldev_new(u8 ldev_num, struct sl_accessors *accessors,
 		return -EBADRQC;
 	}
 
+	rtn = ops->mb_info_get(accessors->mb, &platform, &revision, &proto);
+	if (rtn) {
+		sl_core_log_err(NULL, LOG_NAME, "mb_info_get failed [%d]", rtn);
+		return -EIO;
+	}
+
+	/* lane mapping only comes from the device tree on hardware */
+	if ((platform == PLATFORM_ASIC) && !ops->dt_info_get) {
+		sl_core_log_err(NULL, LOG_NAME, "NULL ops dt_info_get");
+		return -EINVAL;
+	}
+
 	core_ldev = kzalloc(sizeof(struct sl_core_ldev), GFP_KERNEL);
 	if (core_ldev == NULL)
 		return -ENOMEM;
@@ -45,16 +63,35 @@ int sl_core_data_ldev_new(u8 ldev_num, struct sl_accessors *accessors,
 	core_ldev->num             = ldev_num;
 	core_ldev->accessors       = *accessors;
 	core_ldev->ops             = *ops;
+	core_ldev->options         = options;
+	core_ldev->platform        = platform;
+	core_ldev->revision        = revision;
 	spin_lock_init(&(core_ldev->data_lock));
 
-	rtn = core_ldev->ops.mb_info_get(core_ldev->accessors.mb,
-		&(core_ldev->platform), &(core_ldev->revision), &proto);
+	core_ldev->workqueue = workqueue;
+
+	core_ldev->serdes.init_workq = alloc_workqueue("%s%u-serdes", WQ_UNBOUND,
+		SL_CORE_DATA_LDEV_SERDES_INIT_MAX_ACTIVE, "sl-ldev", ldev_num);
+	if (!core_ldev->serdes.init_workq) {
+		sl_core_log_err(core_ldev, LOG_NAME, "alloc_workqueue serdes init failed");
+		kfree(core_ldev);
+		return -ENOMEM;
+	}
+
+	rtn = sl_core_workq_create(core_ldev);
 	if (rtn) {
-		sl_core_log_err(core_ldev, LOG_NAME, "mb_info_get failed [%d]", rtn);
-		return -EIO;
+		sl_core_log_err(core_ldev, LOG_NAME, "workq_create failed [%d]", rtn);
+		destroy_workqueue(core_ldev->serdes.init_workq);
+		kfree(core_ldev);
+		return rtn;
 	}
 
-	core_ldev->workqueue = workqueue;
+	for (serdes_num = 0; serdes_num < SL_ASIC_MAX_SERDES; ++serdes_num) {
+		INIT_WORK(&(core_ldev->serdes.init_work[serdes_num].work), sl_core_ldev_serdes_init_work);
+		mutex_init(&(core_ldev->serdes.uc_ram_lock[serdes_num]));
+	}
+	atomic_set(&(core_ldev->serdes.init_pending), 0);
+	init_completion(&(core_ldev->serdes.init_complete));
 
 	// FIXME: for now we assume it's R2, so Osprey
 	core_ldev->serdes.addrs = serdes_addrs_osprey;
@@ -89,6 +126,9 @@ void sl_core_data_ldev_del(u8 ldev_num)
 	for (lgrp_num = 0; lgrp_num < SL_ASIC_MAX_LGRPS; ++lgrp_num)
 		sl_core_data_lgrp_del(ldev_num, lgrp_num);
 
+	destroy_workqueue(core_ldev->serdes.init_workq);
+	sl_core_workq_destroy(core_ldev);
+
 	kfree(core_ldev);
 }
 
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2022,2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2022,2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/spinlock.h>
 #include <linux/slab.h>
@@ -39,12 +39,16 @@ int sl_core_data_lgrp_new(u8 ldev_num, u8 lgrp_num)
 	if (core_lgrp == NULL)
 		return -ENOMEM;
 
-	core_lgrp->magic     = SL_CORE_LGRP_MAGIC;
-	core_lgrp->core_ldev = sl_core_data_ldev_get(ldev_num);
-	core_lgrp->num       = lgrp_num;
+	core_lgrp->magic      = SL_CORE_LGRP_MAGIC;
+	core_lgrp->core_ldev  = sl_core_data_ldev_get(ldev_num);
+	core_lgrp->num        = lgrp_num;
+	core_lgrp->core_workq = &(core_lgrp->core_ldev->workqs[SL_CORE_WORKQ_SHARD(lgrp_num)]);
 	snprintf(core_lgrp->log_connect_id, sizeof(core_lgrp->log_connect_id), "core-lgrp%02u", lgrp_num);
 	spin_lock_init(&(core_lgrp->log_lock));
 	spin_lock_init(&(core_lgrp->data_lock));
+	spin_lock_init(&(core_lgrp->link_up.data_lock));
+	spin_lock_init(&(core_lgrp->eyes.data_lock));
+	spin_lock_init(&(core_lgrp->serdes_settle.data_lock));
 
 	if (SL_PLATFORM_IS_HARDWARE(core_lgrp->core_ldev)) {
 		rtn = core_lgrp->core_ldev->ops.dt_info_get(core_lgrp->core_ldev->accessors.dt,
@@ -82,6 +86,13 @@ int sl_core_data_lgrp_new(u8 ldev_num, u8 lgrp_num)
 	sl_core_log_dbg(core_lgrp, LOG_NAME, "new - dt info (id = %u, addr = 0x%X)",
 		core_lgrp->serdes.dt.dev_id, core_lgrp->serdes.dt.dev_addr);
 
+	rtn = sl_core_op_hist_new(core_lgrp);
+	if (rtn) {
+		sl_core_log_err(core_lgrp, LOG_NAME, "new - op_hist_new failed [%d]", rtn);
+		kfree(core_lgrp);
+		return rtn;
+	}
+
 	sl_core_log_dbg(core_lgrp, LOG_NAME, "new (lgrp = 0x%p)", core_lgrp);
 
 	spin_lock(&core_lgrps_lock);
@@ -134,6 +145,8 @@ void sl_core_data_lgrp_del(u8 ldev_num, u8 lgrp_num)
 
 	sl_core_log_dbg(core_lgrp, LOG_NAME, "del (lgrp = 0x%p)", core_lgrp);
 
+	sl_core_op_hist_del(core_lgrp);
+
 	kfree(core_lgrp);
 }
 
@@ -257,3 +270,103 @@ int sl_core_data_lgrp_warn_trace_enable_set(struct sl_core_lgrp *core_lgrp, bool
 
 	return 0;
 }
+
+void sl_core_data_lgrp_link_up_hist_inc(struct sl_core_lgrp *core_lgrp, u32 phase, u32 bucket)
+{
+	spin_lock(&core_lgrp->link_up.data_lock);
+	core_lgrp->link_up.hist.buckets[phase][bucket]++;
+	spin_unlock(&core_lgrp->link_up.data_lock);
+}
+
+int sl_core_data_lgrp_link_up_hist_get(struct sl_core_lgrp *core_lgrp, u32 phase, u32 *buckets)
+{
+	if (phase >= SL_CORE_LINK_UP_PHASE_COUNT)
+		return -EINVAL;
+
+	spin_lock(&core_lgrp->link_up.data_lock);
+	memcpy(buckets, core_lgrp->link_up.hist.buckets[phase], sizeof(core_lgrp->link_up.hist.buckets[phase]));
+	spin_unlock(&core_lgrp->link_up.data_lock);
+
+	return 0;
+}
+
+void sl_core_data_lgrp_link_up_hist_clr(struct sl_core_lgrp *core_lgrp)
+{
+	sl_core_log_dbg(core_lgrp, LOG_NAME, "link up hist clr");
+
+	spin_lock(&core_lgrp->link_up.data_lock);
+	memset(&core_lgrp->link_up.hist, 0, sizeof(core_lgrp->link_up.hist));
+	spin_unlock(&core_lgrp->link_up.data_lock);
+}
+
+void sl_core_data_lgrp_serdes_settle_add(struct sl_core_lgrp *core_lgrp, u32 step, u32 us, u32 polls, bool is_timeout)
+{
+	struct sl_core_serdes_settle_stats *stats;
+
+	stats = &core_lgrp->serdes_settle.stats[step];
+
+	spin_lock(&core_lgrp->serdes_settle.data_lock);
+	stats->count++;
+	if (is_timeout)
+		stats->timeouts++;
+	stats->polls_last = polls;
+	stats->us_last    = us;
+	stats->us_max     = max(stats->us_max, us);
+	stats->us_sum    += us;
+	spin_unlock(&core_lgrp->serdes_settle.data_lock);
+}
+
+int sl_core_data_lgrp_serdes_settle_get(struct sl_core_lgrp *core_lgrp, u32 step,
+					struct sl_core_serdes_settle_stats *stats)
+{
+	if (step >= SL_CORE_SERDES_SETTLE_COUNT)
+		return -EINVAL;
+
+	spin_lock(&core_lgrp->serdes_settle.data_lock);
+	*stats = core_lgrp->serdes_settle.stats[step];
+	spin_unlock(&core_lgrp->serdes_settle.data_lock);
+
+	return 0;
+}
+
+void sl_core_data_lgrp_serdes_settle_clr(struct sl_core_lgrp *core_lgrp)
+{
+	sl_core_log_dbg(core_lgrp, LOG_NAME, "serdes settle clr");
+
+	spin_lock(&core_lgrp->serdes_settle.data_lock);
+	memset(core_lgrp->serdes_settle.stats, 0, sizeof(core_lgrp->serdes_settle.stats));
+	spin_unlock(&core_lgrp->serdes_settle.data_lock);
+}
+
+/* only active lanes are updated, other lanes keep their last sample and history */
+void sl_core_data_lgrp_eyes_set(struct sl_core_lgrp *core_lgrp, u64 timestamp_ns, u8 active_lanes,
+				u8 *eye_upper, u8 *eye_lower)
+{
+	struct sl_core_lgrp_eyes *snapshot;
+	u8                        asic_lane_num;
+	u32                       idx;
+
+	snapshot = &core_lgrp->eyes.snapshot;
+
+	spin_lock(&core_lgrp->eyes.data_lock);
+	snapshot->timestamp_ns = timestamp_ns;
+	snapshot->active_lanes = active_lanes;
+	for (asic_lane_num = 0; asic_lane_num < SL_MAX_LANES; ++asic_lane_num) {
+		if (!(active_lanes & BIT(asic_lane_num)))
+			continue;
+		idx = snapshot->lanes[asic_lane_num].num_samples % SL_CORE_LGRP_EYES_HIST_NUM;
+		snapshot->lanes[asic_lane_num].upper           = eye_upper[asic_lane_num];
+		snapshot->lanes[asic_lane_num].lower           = eye_lower[asic_lane_num];
+		snapshot->lanes[asic_lane_num].upper_hist[idx] = eye_upper[asic_lane_num];
+		snapshot->lanes[asic_lane_num].lower_hist[idx] = eye_lower[asic_lane_num];
+		snapshot->lanes[asic_lane_num].num_samples++;
+	}
+	spin_unlock(&core_lgrp->eyes.data_lock);
+}
+
+void sl_core_data_lgrp_eyes_get(struct sl_core_lgrp *core_lgrp, struct sl_core_lgrp_eyes *eyes)
+{
+	spin_lock(&core_lgrp->eyes.data_lock);
+	*eyes = core_lgrp->eyes.snapshot;
+	spin_unlock(&core_lgrp->eyes.data_lock);
+}
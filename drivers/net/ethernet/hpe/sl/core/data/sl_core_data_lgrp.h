@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2022,2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2022,2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_CORE_DATA_LGRP_H_
 #define _SL_CORE_DATA_LGRP_H_
@@ -22,4 +22,17 @@ int  sl_core_data_lgrp_warn_trace_enable_set(struct sl_core_lgrp *core_lgrp, boo
 
 u32  sl_core_data_lgrp_config_flags_get(struct sl_core_lgrp *core_lgrp);
 
+void sl_core_data_lgrp_link_up_hist_inc(struct sl_core_lgrp *core_lgrp, u32 phase, u32 bucket);
+int  sl_core_data_lgrp_link_up_hist_get(struct sl_core_lgrp *core_lgrp, u32 phase, u32 *buckets);
+void sl_core_data_lgrp_link_up_hist_clr(struct sl_core_lgrp *core_lgrp);
+
+void sl_core_data_lgrp_eyes_set(struct sl_core_lgrp *core_lgrp, u64 timestamp_ns, u8 active_lanes,
+				u8 *eye_upper, u8 *eye_lower);
+void sl_core_data_lgrp_eyes_get(struct sl_core_lgrp *core_lgrp, struct sl_core_lgrp_eyes *eyes);
+
+void sl_core_data_lgrp_serdes_settle_add(struct sl_core_lgrp *core_lgrp, u32 step, u32 us, u32 polls, bool is_timeout);
+int  sl_core_data_lgrp_serdes_settle_get(struct sl_core_lgrp *core_lgrp, u32 step,
+					 struct sl_core_serdes_settle_stats *stats);
+void sl_core_data_lgrp_serdes_settle_clr(struct sl_core_lgrp *core_lgrp);
+
 #endif /* _SL_CORE_DATA_LGRP_H_ */
@@ -7,15 +7,19 @@
 #include <linux/err.h>
 #include <linux/workqueue.h>
 #include <linux/ktime.h>
+#include <linux/bitops.h>
+#include <linux/math64.h>
 
 #include "base/sl_core_work_link.h"
 #include "base/sl_core_log.h"
+#include "base/sl_core_workq.h"
 #include "sl_core_ldev.h"
 #include "sl_core_lgrp.h"
 #include "sl_core_link.h"
 #include "sl_core_str.h"
 #include "sl_ctrl_link.h"
 #include "sl_ctrl_link_counters.h"
+#include "data/sl_core_data_lgrp.h"
 #include "data/sl_core_data_link.h"
 #include "hw/sl_core_hw_intr.h"
 #include "hw/sl_core_hw_link.h"
@@ -28,6 +32,7 @@
 #include "hw/sl_core_hw_settings.h"
 #include "hw/sl_core_hw_llr.h"
 #include "hw/sl_core_hw_io.h"
+#include "sl_trace.h"
 
 /* 0x01002510 (hni_pcs_corrected_cw)
  * 0x01002618 (hni_pcs_corrected_cw_bin_14)
@@ -63,6 +68,66 @@ static DEFINE_SPINLOCK(core_links_lock);
 			_log, SL_CORE_HW_INTR_LOG_SIZE);               \
 	} while (0)
 
+/* wrappers so every work item start and end is traced and counted against its workq shard */
+#define SL_CORE_WORK_LINK_TRACED(_fn, _work_num)                                      \
+	static void _fn##_traced(struct work_struct *work)                            \
+	{                                                                             \
+		struct sl_core_link *core_link;                                       \
+		u64                 start_ns;                                         \
+	                                                                              \
+		core_link = container_of(work, struct sl_core_link,                   \
+			work[_work_num]);                                             \
+		trace_sl_core_link_work_start(core_link, _work_num);                  \
+		start_ns = sl_core_workq_work_start(core_link->core_lgrp->core_workq, \
+			core_link->work_queue_ns[_work_num]);                         \
+		_fn(work);                                                            \
+		sl_core_workq_work_end(core_link->core_lgrp->core_workq, start_ns);   \
+		trace_sl_core_link_work_end(core_link, _work_num);                    \
+	}
+
+/* interrupt works also record handler entry to work start and run time per interrupt */
+#define SL_CORE_WORK_LINK_INTR_TRACED(_fn, _work_num, _intr_num)                         \
+	static void _fn##_traced(struct work_struct *work)                               \
+	{                                                                                \
+		struct sl_core_link *core_link;                                          \
+		u64                  start_ns;                                           \
+		u64                  intr_start_ns;                                      \
+	                                                                                 \
+		core_link = container_of(work, struct sl_core_link,                      \
+			work[_work_num]);                                                \
+		trace_sl_core_link_work_start(core_link, _work_num);                     \
+		start_ns = sl_core_workq_work_start(core_link->core_lgrp->core_workq,    \
+			core_link->work_queue_ns[_work_num]);                            \
+		intr_start_ns = sl_core_data_link_intr_work_start(core_link, _intr_num); \
+		_fn(work);                                                               \
+		sl_core_data_link_intr_work_end(core_link, _intr_num, intr_start_ns);    \
+		sl_core_workq_work_end(core_link->core_lgrp->core_workq, start_ns);      \
+		trace_sl_core_link_work_end(core_link, _work_num);                       \
+	}
+
+SL_CORE_WORK_LINK_TRACED(sl_core_hw_an_up_start_work, SL_CORE_WORK_LINK_AN_UP_START)
+SL_CORE_WORK_LINK_TRACED(sl_core_hw_link_up_start_work, SL_CORE_WORK_LINK_UP_START)
+SL_CORE_WORK_LINK_TRACED(sl_core_hw_link_up_work, SL_CORE_WORK_LINK_UP)
+SL_CORE_WORK_LINK_INTR_TRACED(sl_core_hw_link_up_intr_work, SL_CORE_WORK_LINK_UP_INTR, SL_CORE_HW_INTR_LINK_UP)
+SL_CORE_WORK_LINK_TRACED(sl_core_hw_link_up_timeout_work, SL_CORE_WORK_LINK_UP_TIMEOUT)
+SL_CORE_WORK_LINK_TRACED(sl_core_hw_link_up_check_work, SL_CORE_WORK_LINK_UP_CHECK)
+SL_CORE_WORK_LINK_INTR_TRACED(sl_core_hw_link_high_ser_intr_work, SL_CORE_WORK_LINK_HIGH_SER_INTR, SL_CORE_HW_INTR_LINK_HIGH_SER)
+SL_CORE_WORK_LINK_INTR_TRACED(sl_core_hw_link_llr_max_starvation_intr_work, SL_CORE_WORK_LINK_LLR_MAX_STARVATION_INTR, SL_CORE_HW_INTR_LINK_LLR_MAX_STARVATION)
+SL_CORE_WORK_LINK_INTR_TRACED(sl_core_hw_link_llr_starved_intr_work, SL_CORE_WORK_LINK_LLR_STARVED_INTR, SL_CORE_HW_INTR_LINK_LLR_STARVED)
+SL_CORE_WORK_LINK_INTR_TRACED(sl_core_hw_link_fault_intr_work, SL_CORE_WORK_LINK_FAULT_INTR, SL_CORE_HW_INTR_LINK_FAULT)
+SL_CORE_WORK_LINK_TRACED(sl_core_hw_link_up_cancel_work, SL_CORE_WORK_LINK_UP_CANCEL)
+SL_CORE_WORK_LINK_TRACED(sl_core_hw_link_up_fail_work, SL_CORE_WORK_LINK_UP_FAIL)
+SL_CORE_WORK_LINK_TRACED(sl_core_hw_link_down_work, SL_CORE_WORK_LINK_DOWN)
+SL_CORE_WORK_LINK_TRACED(sl_core_hw_link_pml_rec_poll_work, SL_CORE_WORK_LINK_PML_REC_POLL)
+SL_CORE_WORK_LINK_TRACED(sl_core_hw_an_lp_caps_get_work, SL_CORE_WORK_LINK_AN_LP_CAPS_GET)
+SL_CORE_WORK_LINK_TRACED(sl_core_hw_an_lp_caps_get_timeout_work, SL_CORE_WORK_LINK_AN_LP_CAPS_GET_TIMEOUT)
+SL_CORE_WORK_LINK_TRACED(sl_core_hw_an_lp_caps_get_done_work, SL_CORE_WORK_LINK_AN_LP_CAPS_GET_DONE)
+SL_CORE_WORK_LINK_TRACED(sl_core_hw_an_up_work, SL_CORE_WORK_LINK_AN_UP)
+SL_CORE_WORK_LINK_TRACED(sl_core_hw_an_up_done_work, SL_CORE_WORK_LINK_AN_UP_DONE)
+SL_CORE_WORK_LINK_TRACED(sl_core_hw_link_up_fec_settle_work, SL_CORE_WORK_LINK_UP_FEC_SETTLE)
+SL_CORE_WORK_LINK_TRACED(sl_core_hw_link_up_fec_check_work, SL_CORE_WORK_LINK_UP_FEC_CHECK)
+SL_CORE_WORK_LINK_INTR_TRACED(sl_core_hw_link_lane_degrade_intr_work, SL_CORE_WORK_LINK_LANE_DEGRADE_INTR, SL_CORE_HW_INTR_LANE_DEGRADE)
+
 static int sl_core_data_link_init(struct sl_core_lgrp *core_lgrp, u8 link_num, struct sl_core_link *core_link)
 {
 	sl_core_log_dbg(core_link, LOG_NAME,
@@ -77,6 +142,11 @@ static int sl_core_data_link_init(struct sl_core_lgrp *core_lgrp, u8 link_num, s
 	spin_lock_init(&(core_link->data_lock));
 	spin_lock_init(&(core_link->irq_data_lock));
 	spin_lock_init(&(core_link->serdes.data_lock));
+	spin_lock_init(&(core_link->up_phase.data_lock));
+	spin_lock_init(&(core_link->intr_lat.data_lock));
+	spin_lock_init(&(core_link->intr_clr_txn.lock));
+	spin_lock_init(&(core_link->fec.data_txn.lock));
+	core_link->up_phase.phase = SL_CORE_LINK_UP_PHASE_NONE;
 
 	/* ----- link ----- */
 
@@ -107,36 +177,43 @@ static int sl_core_data_link_init(struct sl_core_lgrp *core_lgrp, u8 link_num, s
 		SL_CORE_WORK_LINK_FAULT_INTR, "link fault");
 
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_AN_UP_START]),
-		sl_core_hw_an_up_start_work);
+		sl_core_hw_an_up_start_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_UP_START]),
-		sl_core_hw_link_up_start_work);
+		sl_core_hw_link_up_start_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_UP]),
-		sl_core_hw_link_up_work);
+		sl_core_hw_link_up_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_UP_INTR]),
-		sl_core_hw_link_up_intr_work);
+		sl_core_hw_link_up_intr_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_UP_TIMEOUT]),
-		sl_core_hw_link_up_timeout_work);
+		sl_core_hw_link_up_timeout_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_UP_CHECK]),
-		sl_core_hw_link_up_check_work);
+		sl_core_hw_link_up_check_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_HIGH_SER_INTR]),
-		sl_core_hw_link_high_ser_intr_work);
+		sl_core_hw_link_high_ser_intr_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_LLR_MAX_STARVATION_INTR]),
-		sl_core_hw_link_llr_max_starvation_intr_work);
+		sl_core_hw_link_llr_max_starvation_intr_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_LLR_STARVED_INTR]),
-		sl_core_hw_link_llr_starved_intr_work);
+		sl_core_hw_link_llr_starved_intr_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_FAULT_INTR]),
-		sl_core_hw_link_fault_intr_work);
+		sl_core_hw_link_fault_intr_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_UP_CANCEL]),
-		sl_core_hw_link_up_cancel_work);
+		sl_core_hw_link_up_cancel_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_UP_FAIL]),
-		sl_core_hw_link_up_fail_work);
+		sl_core_hw_link_up_fail_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_DOWN]),
-		sl_core_hw_link_down_work);
+		sl_core_hw_link_down_work_traced);
 
 	/* ----- pml recovery ----- */
 
+	spin_lock_init(&(core_link->pml_rec.data_lock));
+
+	timer_setup(&(core_link->timers[SL_CORE_TIMER_LINK_PML_REC_POLL].timer),
+		sl_core_timer_link_timeout, 0);
+	SL_CORE_TIMER_INIT(core_link, SL_CORE_TIMER_LINK_PML_REC_POLL,
+		SL_CORE_WORK_LINK_PML_REC_POLL, "pml rec poll");
+	core_link->timers[SL_CORE_TIMER_LINK_PML_REC_POLL].data.timeout_ms = SL_CORE_LINK_PML_REC_POLL_MS;
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_PML_REC_POLL]),
-		  sl_core_hw_link_pml_rec_poll_work);
+		  sl_core_hw_link_pml_rec_poll_work_traced);
 
 	/* ----- an ----- */
 
@@ -151,15 +228,15 @@ static int sl_core_data_link_init(struct sl_core_lgrp *core_lgrp, u8 link_num, s
 	SL_CORE_INTR_INIT(core_link, SL_CORE_HW_INTR_AN_PAGE_RECV, 0, "an page recv");
 
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_AN_LP_CAPS_GET]),
-		sl_core_hw_an_lp_caps_get_work);
+		sl_core_hw_an_lp_caps_get_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_AN_LP_CAPS_GET_TIMEOUT]),
-		sl_core_hw_an_lp_caps_get_timeout_work);
+		sl_core_hw_an_lp_caps_get_timeout_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_AN_LP_CAPS_GET_DONE]),
-		sl_core_hw_an_lp_caps_get_done_work);
+		sl_core_hw_an_lp_caps_get_done_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_AN_UP]),
-		sl_core_hw_an_up_work);
+		sl_core_hw_an_up_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_AN_UP_DONE]),
-		sl_core_hw_an_up_done_work);
+		sl_core_hw_an_up_done_work_traced);
 
 	/* ----- fec ----- */
 
@@ -173,11 +250,13 @@ static int sl_core_data_link_init(struct sl_core_lgrp *core_lgrp, u8 link_num, s
 		SL_CORE_WORK_LINK_UP_FEC_CHECK, "link up fec check");
 
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_UP_FEC_SETTLE]),
-		sl_core_hw_link_up_fec_settle_work);
+		sl_core_hw_link_up_fec_settle_work_traced);
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_UP_FEC_CHECK]),
-		sl_core_hw_link_up_fec_check_work);
+		sl_core_hw_link_up_fec_check_work_traced);
 
 	spin_lock_init(&core_link->fec.test_lock);
+	spin_lock_init(&core_link->fec.snapshot.lock);
+	core_link->fec.snapshot.max_age_ms = SL_CORE_LINK_FEC_SNAPSHOT_MAX_AGE_MS;
 
 	atomic_set(&core_link->an.retry_count, 0);
 
@@ -187,10 +266,11 @@ static int sl_core_data_link_init(struct sl_core_lgrp *core_lgrp, u8 link_num, s
 		SL_CORE_WORK_LINK_LANE_DEGRADE_INTR, "lane degrade");
 
 	INIT_WORK(&(core_link->work[SL_CORE_WORK_LINK_LANE_DEGRADE_INTR]),
-		sl_core_hw_link_lane_degrade_intr_work);
+		sl_core_hw_link_lane_degrade_intr_work_traced);
 
 	/* do very last thing */
 	core_link->link.state = SL_CORE_LINK_STATE_UNCONFIGURED;
+	trace_sl_core_link_state(core_link, core_link->link.state);
 	sl_media_jack_led_set(core_link->core_lgrp->core_ldev->num, core_link->core_lgrp->num);
 
 	return 0;
@@ -283,21 +363,21 @@ static void sl_core_data_link_free(struct sl_core_link *core_link)
 	sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP_CHECK);
 	sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP_HIGH_POWER);
 
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_AN_LP_CAPS_GET]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_AN_LP_CAPS_GET_TIMEOUT]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_AN_LP_CAPS_GET_DONE]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_AN_UP_START]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_AN_UP]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_AN_UP_DONE]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_START]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_TIMEOUT]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_CHECK]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_FEC_SETTLE]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_FEC_CHECK]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_FAIL]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_CANCEL]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_DOWN]));
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_LP_CAPS_GET);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_LP_CAPS_GET_TIMEOUT);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_LP_CAPS_GET_DONE);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_UP_START);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_UP);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_UP_DONE);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_START);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_TIMEOUT);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_CHECK);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_FEC_SETTLE);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_FEC_CHECK);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_FAIL);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_CANCEL);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_DOWN);
 
 	sl_core_hw_intr_flgs_disable(core_link, SL_CORE_HW_INTR_LINK_UP);
 	sl_core_hw_intr_flgs_disable(core_link, SL_CORE_HW_INTR_LINK_HIGH_SER);
@@ -305,13 +385,13 @@ static void sl_core_data_link_free(struct sl_core_link *core_link)
 	sl_core_hw_intr_flgs_disable(core_link, SL_CORE_HW_INTR_LINK_LLR_STARVED);
 	sl_core_hw_intr_flgs_disable(core_link, SL_CORE_HW_INTR_LINK_FAULT);
 
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_HIGH_SER_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_LLR_MAX_STARVATION_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_LLR_STARVED_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_FAULT_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_LANE_DEGRADE_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_PML_REC_POLL]));
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_HIGH_SER_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_LLR_MAX_STARVATION_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_LLR_STARVED_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_FAULT_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_LANE_DEGRADE_INTR);
+	sl_core_hw_link_pml_rec_poll_stop(core_link);
 }
 
 void sl_core_data_link_del(u8 ldev_num, u8 lgrp_num, u8 link_num)
@@ -601,8 +681,11 @@ void sl_core_data_link_state_set(struct sl_core_link *core_link, u32 link_state)
 {
 	spin_lock(&core_link->link.data_lock);
 	core_link->link.state = link_state;
+	trace_sl_core_link_state(core_link, core_link->link.state);
 	spin_unlock(&core_link->link.data_lock);
 
+	sl_core_link_fec_snapshot_invalidate(core_link);
+
 	sl_media_jack_led_set(core_link->core_lgrp->core_ldev->num, core_link->core_lgrp->num);
 
 	sl_core_log_dbg(core_link, LOG_NAME,
@@ -962,6 +1045,7 @@ void sl_core_data_link_an_lp_caps_state_set(struct sl_core_link *core_link, u32
 {
 	spin_lock(&core_link->an.data_lock);
 	core_link->an.lp_caps_state = lp_caps_state;
+	trace_sl_core_link_an_lp_caps_state(core_link, lp_caps_state);
 	spin_unlock(&core_link->an.data_lock);
 
 	sl_core_log_dbg(core_link, LOG_NAME, "lp caps state set (lp_caps_state = %u %s)",
@@ -1266,3 +1350,226 @@ int sl_core_data_link_fec_up_ccw_limit_get(struct sl_core_link *core_link, s32 *
 
 	return 0;
 }
+
+static u32 sl_core_data_link_up_hist_bucket(u32 ms)
+{
+	return min_t(u32, fls(ms), SL_CORE_LINK_UP_HIST_NUM_BUCKETS - 1);
+}
+
+void sl_core_data_link_up_phase_begin(struct sl_core_link *core_link, u32 phase)
+{
+	sl_core_log_dbg(core_link, LOG_NAME, "up phase begin (phase = %u %s)",
+			phase, sl_core_link_up_phase_str(phase));
+
+	spin_lock(&core_link->up_phase.data_lock);
+	memset(core_link->up_phase.last_ms, 0, sizeof(core_link->up_phase.last_ms));
+	core_link->up_phase.phase       = phase;
+	core_link->up_phase.phase_start = ktime_get();
+	spin_unlock(&core_link->up_phase.data_lock);
+}
+
+/*
+ * Ends the phase in progress, records it and starts the next phase.
+ * Nothing is recorded if no up is being timed.
+ */
+void sl_core_data_link_up_phase_set(struct sl_core_link *core_link, u32 phase)
+{
+	ktime_t now;
+	u32     prev_phase;
+	u32     ms;
+	u32     bucket;
+
+	now = ktime_get();
+
+	spin_lock(&core_link->up_phase.data_lock);
+	prev_phase = core_link->up_phase.phase;
+	if (prev_phase == SL_CORE_LINK_UP_PHASE_NONE) {
+		spin_unlock(&core_link->up_phase.data_lock);
+		return;
+	}
+	ms     = ktime_ms_delta(now, core_link->up_phase.phase_start);
+	bucket = sl_core_data_link_up_hist_bucket(ms);
+	core_link->up_phase.last_ms[prev_phase] = ms;
+	core_link->up_phase.hist.buckets[prev_phase][bucket]++;
+	core_link->up_phase.phase       = phase;
+	core_link->up_phase.phase_start = now;
+	spin_unlock(&core_link->up_phase.data_lock);
+
+	sl_core_data_lgrp_link_up_hist_inc(core_link->core_lgrp, prev_phase, bucket);
+
+	sl_core_log_dbg(core_link, LOG_NAME, "up phase set (%s = %ums, next = %s)",
+			sl_core_link_up_phase_str(prev_phase), ms, sl_core_link_up_phase_str(phase));
+}
+
+void sl_core_data_link_up_phase_end(struct sl_core_link *core_link)
+{
+	sl_core_data_link_up_phase_set(core_link, SL_CORE_LINK_UP_PHASE_NONE);
+}
+
+void sl_core_data_link_up_phase_cancel(struct sl_core_link *core_link)
+{
+	spin_lock(&core_link->up_phase.data_lock);
+	core_link->up_phase.phase = SL_CORE_LINK_UP_PHASE_NONE;
+	spin_unlock(&core_link->up_phase.data_lock);
+}
+
+int sl_core_data_link_up_phase_last_ms_get(struct sl_core_link *core_link, u32 phase, u32 *last_ms)
+{
+	if (phase >= SL_CORE_LINK_UP_PHASE_COUNT)
+		return -EINVAL;
+
+	spin_lock(&core_link->up_phase.data_lock);
+	*last_ms = core_link->up_phase.last_ms[phase];
+	spin_unlock(&core_link->up_phase.data_lock);
+
+	return 0;
+}
+
+int sl_core_data_link_up_phase_hist_get(struct sl_core_link *core_link, u32 phase, u32 *buckets)
+{
+	if (phase >= SL_CORE_LINK_UP_PHASE_COUNT)
+		return -EINVAL;
+
+	spin_lock(&core_link->up_phase.data_lock);
+	memcpy(buckets, core_link->up_phase.hist.buckets[phase], sizeof(core_link->up_phase.hist.buckets[phase]));
+	spin_unlock(&core_link->up_phase.data_lock);
+
+	return 0;
+}
+
+int sl_core_data_link_serdes_lanes_up_phase_us_get(struct sl_core_link *core_link, u32 phase, u32 *last_us)
+{
+	if (phase >= SL_CORE_HW_SERDES_LANES_UP_PHASE_COUNT)
+		return -EINVAL;
+
+	spin_lock(&core_link->serdes.data_lock);
+	*last_us = core_link->serdes.lanes_up_phase_us[phase];
+	spin_unlock(&core_link->serdes.data_lock);
+
+	return 0;
+}
+
+void sl_core_data_link_up_phase_hist_clr(struct sl_core_link *core_link)
+{
+	sl_core_log_dbg(core_link, LOG_NAME, "up phase hist clr");
+
+	spin_lock(&core_link->up_phase.data_lock);
+	memset(&core_link->up_phase.hist, 0, sizeof(core_link->up_phase.hist));
+	memset(core_link->up_phase.last_ms, 0, sizeof(core_link->up_phase.last_ms));
+	spin_unlock(&core_link->up_phase.data_lock);
+}
+
+static u32 sl_core_data_link_pml_rec_hist_bucket(s64 ms)
+{
+	if (ms <= 0)
+		return 0;
+
+	return min_t(u32, fls64(ms), SL_CORE_LINK_PML_REC_HIST_NUM_BUCKETS - 1);
+}
+
+void sl_core_data_link_pml_rec_hist_add(struct sl_core_link *core_link, bool is_success, s64 ms)
+{
+	u32 bucket;
+
+	bucket = sl_core_data_link_pml_rec_hist_bucket(ms);
+
+	spin_lock(&core_link->pml_rec.data_lock);
+	core_link->pml_rec.hist.count++;
+	if (is_success)
+		core_link->pml_rec.hist.success[bucket]++;
+	else
+		core_link->pml_rec.hist.fail[bucket]++;
+	spin_unlock(&core_link->pml_rec.data_lock);
+}
+
+void sl_core_data_link_pml_rec_hist_get(struct sl_core_link *core_link, struct sl_core_link_pml_rec_hist *hist)
+{
+	spin_lock(&core_link->pml_rec.data_lock);
+	*hist = core_link->pml_rec.hist;
+	spin_unlock(&core_link->pml_rec.data_lock);
+}
+
+void sl_core_data_link_pml_rec_hist_clr(struct sl_core_link *core_link)
+{
+	sl_core_log_dbg(core_link, LOG_NAME, "pml rec hist clr");
+
+	spin_lock(&core_link->pml_rec.data_lock);
+	memset(&core_link->pml_rec.hist, 0, sizeof(core_link->pml_rec.hist));
+	spin_unlock(&core_link->pml_rec.data_lock);
+}
+
+static u32 sl_core_data_link_intr_hist_bucket(u64 ns)
+{
+	return min_t(u32, fls64(div_u64(ns, NSEC_PER_USEC)), SL_CORE_LINK_INTR_HIST_NUM_BUCKETS - 1);
+}
+
+/* called from the interrupt handler */
+void sl_core_data_link_intr_entry(struct sl_core_link *core_link, u32 intr_num)
+{
+	unsigned long irq_flags;
+
+	spin_lock_irqsave(&core_link->intr_lat.data_lock, irq_flags);
+	core_link->intr_lat.entry_ns[intr_num] = ktime_get_ns();
+	core_link->intr_lat.hist[intr_num].count++;
+	spin_unlock_irqrestore(&core_link->intr_lat.data_lock, irq_flags);
+}
+
+/*
+ * Records handler entry to work start. Each entry is only counted once, so a
+ * work run without a new interrupt only records its run time.
+ */
+u64 sl_core_data_link_intr_work_start(struct sl_core_link *core_link, u32 intr_num)
+{
+	unsigned long irq_flags;
+	u64           now;
+	u64           entry_ns;
+
+	now = ktime_get_ns();
+
+	spin_lock_irqsave(&core_link->intr_lat.data_lock, irq_flags);
+	entry_ns = core_link->intr_lat.entry_ns[intr_num];
+	core_link->intr_lat.entry_ns[intr_num] = 0;
+	if (entry_ns && (now >= entry_ns))
+		core_link->intr_lat.hist[intr_num].lat[sl_core_data_link_intr_hist_bucket(now - entry_ns)]++;
+	spin_unlock_irqrestore(&core_link->intr_lat.data_lock, irq_flags);
+
+	return now;
+}
+
+void sl_core_data_link_intr_work_end(struct sl_core_link *core_link, u32 intr_num, u64 start_ns)
+{
+	unsigned long irq_flags;
+	u32           bucket;
+
+	bucket = sl_core_data_link_intr_hist_bucket(ktime_get_ns() - start_ns);
+
+	spin_lock_irqsave(&core_link->intr_lat.data_lock, irq_flags);
+	core_link->intr_lat.hist[intr_num].run[bucket]++;
+	spin_unlock_irqrestore(&core_link->intr_lat.data_lock, irq_flags);
+}
+
+int sl_core_data_link_intr_hist_get(struct sl_core_link *core_link, u32 intr_num,
+				    struct sl_core_link_intr_hist *hist)
+{
+	unsigned long irq_flags;
+
+	if (intr_num >= SL_CORE_HW_INTR_COUNT)
+		return -EINVAL;
+
+	spin_lock_irqsave(&core_link->intr_lat.data_lock, irq_flags);
+	*hist = core_link->intr_lat.hist[intr_num];
+	spin_unlock_irqrestore(&core_link->intr_lat.data_lock, irq_flags);
+
+	return 0;
+}
+
+void sl_core_data_link_intr_hist_clr(struct sl_core_link *core_link)
+{
+	unsigned long irq_flags;
+
+	sl_core_log_dbg(core_link, LOG_NAME, "intr hist clr");
+
+	spin_lock_irqsave(&core_link->intr_lat.data_lock, irq_flags);
+	memset(core_link->intr_lat.hist, 0, sizeof(core_link->intr_lat.hist));
+	spin_unlock_irqrestore(&core_link->intr_lat.data_lock, irq_flags);
+}
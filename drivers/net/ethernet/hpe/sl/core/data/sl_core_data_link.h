@@ -83,5 +83,24 @@ int sl_core_data_link_pml_rec_link_down_cause_get(struct sl_core_link *core_link
 int sl_core_data_link_pml_rec_link_fault_failed_cause_get(struct sl_core_link *core_link, int *fault_failed_cause);
 int sl_core_data_link_pml_rec_link_down_failed_cause_get(struct sl_core_link *core_link, int *down_failed_cause);
 int sl_core_data_link_pml_rec_rate_limit_exceeded_get(struct sl_core_link *core_link, int *rate_limit_exceeded);
+void sl_core_data_link_pml_rec_hist_add(struct sl_core_link *core_link, bool is_success, s64 ms);
+void sl_core_data_link_pml_rec_hist_get(struct sl_core_link *core_link, struct sl_core_link_pml_rec_hist *hist);
+void sl_core_data_link_pml_rec_hist_clr(struct sl_core_link *core_link);
+
+void sl_core_data_link_up_phase_begin(struct sl_core_link *core_link, u32 phase);
+void sl_core_data_link_up_phase_set(struct sl_core_link *core_link, u32 phase);
+void sl_core_data_link_up_phase_end(struct sl_core_link *core_link);
+void sl_core_data_link_up_phase_cancel(struct sl_core_link *core_link);
+int  sl_core_data_link_up_phase_last_ms_get(struct sl_core_link *core_link, u32 phase, u32 *last_ms);
+int  sl_core_data_link_up_phase_hist_get(struct sl_core_link *core_link, u32 phase, u32 *buckets);
+void sl_core_data_link_up_phase_hist_clr(struct sl_core_link *core_link);
+int  sl_core_data_link_serdes_lanes_up_phase_us_get(struct sl_core_link *core_link, u32 phase, u32 *last_us);
+
+void sl_core_data_link_intr_entry(struct sl_core_link *core_link, u32 intr_num);
+u64  sl_core_data_link_intr_work_start(struct sl_core_link *core_link, u32 intr_num);
+void sl_core_data_link_intr_work_end(struct sl_core_link *core_link, u32 intr_num, u64 start_ns);
+int  sl_core_data_link_intr_hist_get(struct sl_core_link *core_link, u32 intr_num,
+				     struct sl_core_link_intr_hist *hist);
+void sl_core_data_link_intr_hist_clr(struct sl_core_link *core_link);
 
 #endif /* _SL_CORE_DATA_LINK_H_ */
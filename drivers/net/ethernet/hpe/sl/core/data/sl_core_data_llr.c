@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2022,2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2022,2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 #include <linux/slab.h>
@@ -10,6 +10,7 @@
 #include <linux/hpe/sl/sl_media.h>
 
 #include "base/sl_core_log.h"
+#include "base/sl_core_workq.h"
 #include "sl_core_lgrp.h"
 #include "sl_core_llr.h"
 #include "sl_core_str.h"
@@ -18,6 +19,7 @@
 #include "sl_core_hw_intr_flgs_llr.h"
 #include "data/sl_core_data_llr.h"
 #include "sl_ctrl_llr_counters.h"
+#include "sl_trace.h"
 
 static struct sl_core_llr *core_llrs[SL_ASIC_MAX_LDEVS][SL_ASIC_MAX_LGRPS][SL_ASIC_MAX_LINKS];
 static DEFINE_SPINLOCK(core_llrs_lock);
@@ -43,6 +45,31 @@ static DEFINE_SPINLOCK(core_llrs_lock);
 			_log, SL_CORE_HW_INTR_LLR_LOG_SIZE);              \
 	} while (0)
 
+/* wrappers so every work item start and end is traced and counted against its workq shard */
+#define SL_CORE_WORK_LLR_TRACED(_fn, _work_num)                                      \
+	static void _fn##_traced(struct work_struct *work)                           \
+	{                                                                            \
+		struct sl_core_llr *core_llr;                                        \
+		u64                start_ns;                                         \
+	                                                                             \
+		core_llr = container_of(work, struct sl_core_llr,                    \
+			work[_work_num]);                                            \
+		trace_sl_core_llr_work_start(core_llr, _work_num);                   \
+		start_ns = sl_core_workq_work_start(core_llr->core_lgrp->core_workq, \
+			core_llr->work_queue_ns[_work_num]);                         \
+		_fn(work);                                                           \
+		sl_core_workq_work_end(core_llr->core_lgrp->core_workq, start_ns);   \
+		trace_sl_core_llr_work_end(core_llr, _work_num);                     \
+	}
+
+SL_CORE_WORK_LLR_TRACED(sl_core_hw_llr_setup_work, SL_CORE_WORK_LLR_SETUP)
+SL_CORE_WORK_LLR_TRACED(sl_core_hw_llr_setup_timeout_work, SL_CORE_WORK_LLR_SETUP_TIMEOUT)
+SL_CORE_WORK_LLR_TRACED(sl_core_hw_llr_setup_unexp_loop_time_intr_work, SL_CORE_WORK_LLR_SETUP_UNEXP_LOOP_TIME_INTR)
+SL_CORE_WORK_LLR_TRACED(sl_core_hw_llr_setup_loop_time_intr_work, SL_CORE_WORK_LLR_SETUP_LOOP_TIME_INTR)
+SL_CORE_WORK_LLR_TRACED(sl_core_hw_llr_start_work, SL_CORE_WORK_LLR_START)
+SL_CORE_WORK_LLR_TRACED(sl_core_hw_llr_start_timeout_work, SL_CORE_WORK_LLR_START_TIMEOUT)
+SL_CORE_WORK_LLR_TRACED(sl_core_hw_llr_start_init_complete_intr_work, SL_CORE_WORK_LLR_START_INIT_COMPLETE_INTR)
+
 int sl_core_data_llr_new(u8 ldev_num, u8 lgrp_num, u8 llr_num)
 {
 	int                 rtn;
@@ -79,19 +106,19 @@ int sl_core_data_llr_new(u8 ldev_num, u8 lgrp_num, u8 llr_num)
 		SL_CORE_WORK_LLR_START_TIMEOUT, "llr start");
 
 	INIT_WORK(&(core_llr->work[SL_CORE_WORK_LLR_SETUP]),
-		sl_core_hw_llr_setup_work);
+		sl_core_hw_llr_setup_work_traced);
 	INIT_WORK(&(core_llr->work[SL_CORE_WORK_LLR_SETUP_TIMEOUT]),
-		sl_core_hw_llr_setup_timeout_work);
+		sl_core_hw_llr_setup_timeout_work_traced);
 	INIT_WORK(&(core_llr->work[SL_CORE_WORK_LLR_SETUP_UNEXP_LOOP_TIME_INTR]),
-		sl_core_hw_llr_setup_unexp_loop_time_intr_work);
+		sl_core_hw_llr_setup_unexp_loop_time_intr_work_traced);
 	INIT_WORK(&(core_llr->work[SL_CORE_WORK_LLR_SETUP_LOOP_TIME_INTR]),
-		sl_core_hw_llr_setup_loop_time_intr_work);
+		sl_core_hw_llr_setup_loop_time_intr_work_traced);
 	INIT_WORK(&(core_llr->work[SL_CORE_WORK_LLR_START]),
-		sl_core_hw_llr_start_work);
+		sl_core_hw_llr_start_work_traced);
 	INIT_WORK(&(core_llr->work[SL_CORE_WORK_LLR_START_TIMEOUT]),
-		sl_core_hw_llr_start_timeout_work);
+		sl_core_hw_llr_start_timeout_work_traced);
 	INIT_WORK(&(core_llr->work[SL_CORE_WORK_LLR_START_INIT_COMPLETE_INTR]),
-		sl_core_hw_llr_start_init_complete_intr_work);
+		sl_core_hw_llr_start_init_complete_intr_work_traced);
 
 	SL_CORE_INTR_LLR_INIT(core_llr, SL_CORE_HW_INTR_LLR_SETUP_UNEXP_LOOP_TIME,
 		SL_CORE_WORK_LLR_SETUP_UNEXP_LOOP_TIME_INTR, "llr setup unexp loop time");
@@ -135,18 +162,18 @@ void sl_core_data_llr_del(u8 ldev_num, u8 lgrp_num, u8 llr_num)
 	sl_core_timer_llr_end(core_llr, SL_CORE_TIMER_LLR_SETUP);
 	sl_core_timer_llr_end(core_llr, SL_CORE_TIMER_LLR_START);
 
-	cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_SETUP]));
-	cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_SETUP_TIMEOUT]));
-	cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_START]));
-	cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_START_TIMEOUT]));
+	sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_SETUP);
+	sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_SETUP_TIMEOUT);
+	sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_START);
+	sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_START_TIMEOUT);
 
 	sl_core_hw_intr_llr_flgs_disable(core_llr, SL_CORE_HW_INTR_LLR_SETUP_UNEXP_LOOP_TIME);
 	sl_core_hw_intr_llr_flgs_disable(core_llr, SL_CORE_HW_INTR_LLR_SETUP_LOOP_TIME);
 	sl_core_hw_intr_llr_flgs_disable(core_llr, SL_CORE_HW_INTR_LLR_START_INIT_COMPLETE);
 
-	cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_SETUP_UNEXP_LOOP_TIME_INTR]));
-	cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_SETUP_LOOP_TIME_INTR]));
-	cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_START_INIT_COMPLETE_INTR]));
+	sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_SETUP_UNEXP_LOOP_TIME_INTR);
+	sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_SETUP_LOOP_TIME_INTR);
+	sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_START_INIT_COMPLETE_INTR);
 
 	sl_core_hw_intr_llr_hdlr_unregister(core_llr);
 
@@ -311,6 +338,7 @@ void sl_core_data_llr_state_set(struct sl_core_llr *core_llr, u32 llr_state)
 {
 	spin_lock(&core_llr->data_lock);
 	core_llr->state = llr_state;
+	trace_sl_core_llr_state(core_llr, core_llr->state);
 	spin_unlock(&core_llr->data_lock);
 
 	sl_core_log_dbg(core_llr, LOG_NAME, "set (llr_state = %u %s)",
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2022,2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2022,2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 #include <linux/random.h>
@@ -594,22 +594,28 @@ out:
 	if (rtn != 0)
 		sl_core_log_warn_trace(core_link, LOG_NAME, "page recv intr disable failed [%d]", rtn);
 
-	queue_work(core_link->core_lgrp->core_ldev->workqueue, &(core_link->work[core_link->an.done_work_num]));
+	sl_core_work_link_queue(core_link, core_link->an.done_work_num);
 }
 
 void sl_core_hw_an_intr_hdlr(u64 *err_flgs, int num_err_flgs, void *data)
 {
 	struct sl_core_hw_intr_data *info;
 	struct sl_core_link         *core_link;
+	u64                          start_ns;
 
 	info = data;
 	core_link = info->link;
 
+	sl_core_data_link_intr_entry(core_link, SL_CORE_HW_INTR_AN_PAGE_RECV);
+
 	sl_core_log_dbg(core_link, LOG_NAME,
 		"hdlr %s (link = 0x%p, intr = %u)",
 		info->log, core_link, info->intr_num);
 
 	sl_core_hw_intr_flgs_clr(core_link, SL_CORE_HW_INTR_AN_PAGE_RECV);
 
+	/* pages are handled in the handler so latency is only the flags clear */
+	start_ns = sl_core_data_link_intr_work_start(core_link, SL_CORE_HW_INTR_AN_PAGE_RECV);
 	sl_core_hw_an_page_recv_intr(core_link);
+	sl_core_data_link_intr_work_end(core_link, SL_CORE_HW_INTR_AN_PAGE_RECV, start_ns);
 }
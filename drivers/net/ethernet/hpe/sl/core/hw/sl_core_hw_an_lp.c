@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2022,2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2022,2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 #include <linux/slab.h>
@@ -66,7 +66,8 @@ void sl_core_hw_an_lp_caps_get_cmd(struct sl_core_link *core_link, u32 link_stat
 	memset(&(core_link->an.lp_caps), 0, sizeof(core_link->an.lp_caps));
 	core_link->an.lp_caps.magic = SL_CORE_LINK_AN_MAGIC;
 
-	if (!SL_PLATFORM_IS_HARDWARE(core_link->core_lgrp->core_ldev)) {
+	if (!SL_PLATFORM_IS_HARDWARE(core_link->core_lgrp->core_ldev) &&
+		!(core_link->core_lgrp->core_ldev->options & SL_LDEV_ATTR_OPT_AN_EMU)) {
 		sl_core_data_link_state_set(core_link, core_link->an.link_state);
 		sl_core_an_lp_caps_get_callback(core_link);
 		return;
@@ -79,7 +80,7 @@ void sl_core_hw_an_lp_caps_get_cmd(struct sl_core_link *core_link, u32 link_stat
 		sl_core_log_warn_trace(core_link, LOG_NAME,
 			"lp caps get cmd - an page recv disable failed [%d]", rtn);
 
-	queue_work(core_link->core_lgrp->core_ldev->workqueue, &(core_link->work[SL_CORE_WORK_LINK_AN_LP_CAPS_GET]));
+	sl_core_work_link_queue(core_link, SL_CORE_WORK_LINK_AN_LP_CAPS_GET);
 }
 
 void sl_core_hw_an_lp_caps_get_work(struct work_struct *work)
@@ -148,8 +149,8 @@ void sl_core_hw_an_lp_caps_stop_cmd(struct sl_core_link *core_link)
 		sl_core_log_warn_trace(core_link, LOG_NAME,
 			"lp caps stop cmd - an page recv disable failed [%d]", rtn);
 
-	cancel_work_sync(&core_link->work[SL_CORE_WORK_LINK_AN_LP_CAPS_GET]);
-	cancel_work_sync(&core_link->work[SL_CORE_WORK_LINK_AN_LP_CAPS_GET_TIMEOUT]);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_LP_CAPS_GET);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_LP_CAPS_GET_TIMEOUT);
 
 	sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_AN_LP_CAPS_GET);
 
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2022,2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2022,2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 #include <linux/slab.h>
@@ -110,7 +110,7 @@ void sl_core_hw_an_up_start_work(struct work_struct *work)
 		return;
 	}
 
-	queue_work(core_link->core_lgrp->core_ldev->workqueue, &(core_link->work[SL_CORE_WORK_LINK_AN_UP]));
+	sl_core_work_link_queue(core_link, SL_CORE_WORK_LINK_AN_UP);
 }
 
 static void sl_core_hw_an_up(struct sl_core_link *core_link)
@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2023,2024 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_CORE_HW_FEC_H_
 #define _SL_CORE_HW_FEC_H_
@@ -9,12 +9,9 @@ struct sl_core_link_fec_cw_cntrs;
 struct sl_core_link_fec_lane_cntrs;
 struct sl_core_link_fec_tail_cntrs;
 
-int sl_core_hw_fec_cw_cntrs_get(struct sl_core_link *core_link,
-				struct sl_core_link_fec_cw_cntrs *cw_cntrs);
-int sl_core_hw_fec_lane_cntrs_get(struct sl_core_link *core_link,
-				  struct sl_core_link_fec_lane_cntrs *lane_cntrs);
-int sl_core_hw_fec_tail_cntrs_get(struct sl_core_link *core_link,
-				  struct sl_core_link_fec_tail_cntrs *tail_cntrs);
+/* cw counters, lane counters and ccw bins in one snapshot */
+#define SL_CORE_HW_FEC_DATA_TXN_OPS (3 + SL_CORE_LINK_FEC_NUM_LANES + SL_CORE_LINK_FEC_NUM_CCW_BINS)
+
 int sl_core_hw_fec_data_get(struct sl_core_link *core_link,
 			    struct sl_core_link_fec_cw_cntrs *cw_cntrs,
 			    struct sl_core_link_fec_lane_cntrs *lane_cntrs,
@@ -15,16 +15,21 @@
 #include "hw/sl_core_hw_intr.h"
 #include "data/sl_core_data_link.h"
 #include "hw/sl_core_hw_io.h"
+#include "hw/sl_core_hw_reg_txn.h"
 #include "hw/sl_core_hw_intr.h"
 #include "hw/sl_core_hw_an.h"
+#include "sl_trace.h"
 
 #define LOG_NAME SL_CORE_HW_INTR_LOG_NAME
 
 static void sl_core_hw_intr_flgs_clr_source(struct sl_core_link *core_link, u32 intr_num)
 {
-	int x;
-	u64 addr;
-	u32 port;
+	int                       x;
+	u64                       addr;
+	u32                       port;
+	struct sl_core_hw_reg_txn txn;
+	unsigned long             irq_flags;
+	int                       rtn;
 
 	port = core_link->core_lgrp->num;
 
@@ -37,10 +42,23 @@ static void sl_core_hw_intr_flgs_clr_source(struct sl_core_link *core_link, u32
 		core_link->intrs[intr_num].source[2],
 		core_link->intrs[intr_num].source[3]);
 
+	spin_lock_irqsave(&core_link->intr_clr_txn.lock, irq_flags);
+
+	sl_core_hw_reg_txn_init(&txn, core_link->core_lgrp, core_link->num,
+		core_link->intr_clr_txn.ops, core_link->intr_clr_txn.reg_ops,
+		ARRAY_SIZE(core_link->intr_clr_txn.ops));
+
 	addr = SS2_PORT_PML_ERR_CLR;
 	for (x = 0; x < SL_CORE_HW_INTR_FLGS_COUNT; ++x, addr += 8)
-		sl_core_write64(core_link, addr, core_link->intrs[intr_num].source[x]);
-	sl_core_flush64(core_link, SS2_PORT_PML_ERR_CLR);
+		sl_core_hw_reg_txn_write64(&txn, addr, core_link->intrs[intr_num].source[x]);
+	sl_core_hw_reg_txn_flush64(&txn, SS2_PORT_PML_ERR_CLR);
+
+	rtn = sl_core_hw_reg_txn_commit(&txn);
+
+	spin_unlock_irqrestore(&core_link->intr_clr_txn.lock, irq_flags);
+
+	if (rtn)
+		sl_core_log_warn_trace(core_link, LOG_NAME, "flgs clr source - reg txn commit failed [%d]", rtn);
 }
 
 void sl_core_hw_intr_hdlr(u64 *err_flgs, int num_err_flgs, void *data)
@@ -53,6 +71,9 @@ void sl_core_hw_intr_hdlr(u64 *err_flgs, int num_err_flgs, void *data)
 	info = data;
 	core_link = info->link;
 
+	trace_sl_core_link_intr(core_link, info->intr_num);
+	sl_core_data_link_intr_entry(core_link, info->intr_num);
+
 	sl_core_log_dbg(core_link, LOG_NAME,
 		"hdlr - %s (link = 0x%p, intr = %u, work = %u)",
 		info->log, core_link, info->intr_num, info->work_num);
@@ -68,7 +89,7 @@ void sl_core_hw_intr_hdlr(u64 *err_flgs, int num_err_flgs, void *data)
 
 	sl_core_hw_intr_flgs_clr_source(core_link, info->intr_num);
 
-	queue_work(core_link->core_lgrp->core_ldev->workqueue, &(core_link->work[info->work_num]));
+	sl_core_work_link_queue(core_link, info->work_num);
 }
 
 int sl_core_hw_intr_hdlr_register(struct sl_core_link *core_link)
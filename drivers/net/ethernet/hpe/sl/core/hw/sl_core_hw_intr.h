@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2022,2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2022,2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_CORE_HW_INTR_H_
 #define _SL_CORE_HW_INTR_H_
@@ -22,6 +22,8 @@ enum {
 
 #define SL_CORE_HW_INTR_FLGS_COUNT ((int)(SS2_PORT_PML_ERR_FLG_SIZE / sizeof(u64)))
 
+#define SL_CORE_HW_INTR_CLR_TXN_OPS (SL_CORE_HW_INTR_FLGS_COUNT + 1) /* ERR_CLR writes and a flush */
+
 typedef void (*sl_core_hw_intr_hdlr_t)(u64 *err_flgs, int num_err_flgs, void *data);
 
 #define SL_CORE_HW_INTR_LOG_SIZE 30
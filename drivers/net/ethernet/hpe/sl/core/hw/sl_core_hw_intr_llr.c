@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 #include <linux/string.h>
@@ -9,6 +9,7 @@
 #include "base/sl_core_log.h"
 #include "hw/sl_core_hw_io.h"
 #include "hw/sl_core_hw_intr_llr.h"
+#include "sl_trace.h"
 
 #define LOG_NAME SL_CORE_HW_INTR_LLR_LOG_NAME
 
@@ -29,6 +30,8 @@ void sl_core_hw_intr_llr_hdlr(u64 *err_flgs, int num_err_flgs, void *data)
 	info = data;
 	core_llr = info->core_llr;
 
+	trace_sl_core_llr_intr(core_llr, info->intr_num);
+
 	sl_core_log_dbg(core_llr, LOG_NAME,
 		"hdlr - %s (llr = 0x%p, intr = %d, work = %d)",
 		info->log, core_llr, info->intr_num, info->work_num);
@@ -42,7 +45,7 @@ void sl_core_hw_intr_llr_hdlr(u64 *err_flgs, int num_err_flgs, void *data)
 	memcpy(&(core_llr->intrs[info->intr_num].source), err_flgs,
 		sizeof(core_llr->intrs[info->intr_num].source));
 
-	queue_work(core_llr->core_lgrp->core_ldev->workqueue, &(core_llr->work[info->work_num]));
+	sl_core_work_llr_queue(core_llr, info->work_num);
 }
 
 int sl_core_hw_intr_llr_hdlr_register(struct sl_core_llr *core_llr)
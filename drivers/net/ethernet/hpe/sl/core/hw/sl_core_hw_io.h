@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2022,2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2022,2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_CORE_HW_IO_H_
 #define _SL_CORE_HW_IO_H_
@@ -11,14 +11,16 @@
 #include "sl_core_link.h"
 #include "sl_core_mac.h"
 #include "sl_core_llr.h"
+#include "base/sl_core_io_trace.h"
 
 static inline void sl_core_lgrp_flush64(struct sl_core_lgrp *core_lgrp, u64 addr)
 {
 	(void)core_lgrp->core_ldev->ops.read64(
 		core_lgrp->core_ldev->accessors.pci, addr);
 
-	sl_core_log_dbg(core_lgrp, SL_CORE_HW_IO_LOG_NAME,
-		"FLSH (addr = 0x%016llX)", addr);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_FLSH,
+		core_lgrp->core_ldev->num, core_lgrp->num, SL_CORE_IO_TRACE_NUM_NONE,
+		addr, 0, 0, 0);
 }
 
 static inline void sl_core_lgrp_read64(struct sl_core_lgrp *core_lgrp, u64 addr, u64 *data64)
@@ -26,8 +28,9 @@ static inline void sl_core_lgrp_read64(struct sl_core_lgrp *core_lgrp, u64 addr,
 	*data64 = core_lgrp->core_ldev->ops.read64(
 		core_lgrp->core_ldev->accessors.pci, addr);
 
-	sl_core_log_dbg(core_lgrp, SL_CORE_HW_IO_LOG_NAME,
-		"RD64 (addr = 0x%016llX, data = 0x%016llX)", addr, *data64);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_RD64,
+		core_lgrp->core_ldev->num, core_lgrp->num, SL_CORE_IO_TRACE_NUM_NONE,
+		addr, *data64, 0, 0);
 }
 
 static inline void sl_core_lgrp_write64(struct sl_core_lgrp *core_lgrp, u64 addr, u64 data64)
@@ -35,8 +38,9 @@ static inline void sl_core_lgrp_write64(struct sl_core_lgrp *core_lgrp, u64 addr
 	core_lgrp->core_ldev->ops.write64(
 		core_lgrp->core_ldev->accessors.pci, addr, data64);
 
-	sl_core_log_dbg(core_lgrp, SL_CORE_HW_IO_LOG_NAME,
-		"WR64 (addr = 0x%016llX, data = 0x%016llX)", addr, data64);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_WR64,
+		core_lgrp->core_ldev->num, core_lgrp->num, SL_CORE_IO_TRACE_NUM_NONE,
+		addr, data64, 0, 0);
 }
 
 static inline void sl_core_flush64(struct sl_core_link *core_link, u64 addr)
@@ -44,8 +48,9 @@ static inline void sl_core_flush64(struct sl_core_link *core_link, u64 addr)
 	(void)core_link->core_lgrp->core_ldev->ops.read64(
 		core_link->core_lgrp->core_ldev->accessors.pci, addr);
 
-	sl_core_log_dbg(core_link, SL_CORE_HW_IO_LOG_NAME,
-		"FLSH (addr = 0x%016llX)", addr);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_FLSH,
+		core_link->core_lgrp->core_ldev->num, core_link->core_lgrp->num, core_link->num,
+		addr, 0, 0, 0);
 }
 
 static inline void sl_core_read64(struct sl_core_link *core_link, u64 addr, u64 *data64)
@@ -53,8 +58,9 @@ static inline void sl_core_read64(struct sl_core_link *core_link, u64 addr, u64
 	*data64 = core_link->core_lgrp->core_ldev->ops.read64(
 		core_link->core_lgrp->core_ldev->accessors.pci, addr);
 
-	sl_core_log_dbg(core_link, SL_CORE_HW_IO_LOG_NAME,
-		"RD64 (addr = 0x%016llX, data = 0x%016llX)", addr, *data64);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_RD64,
+		core_link->core_lgrp->core_ldev->num, core_link->core_lgrp->num, core_link->num,
+		addr, *data64, 0, 0);
 }
 
 static inline void sl_core_write64(struct sl_core_link *core_link, u64 addr, u64 data64)
@@ -62,8 +68,9 @@ static inline void sl_core_write64(struct sl_core_link *core_link, u64 addr, u64
 	core_link->core_lgrp->core_ldev->ops.write64(
 		core_link->core_lgrp->core_ldev->accessors.pci, addr, data64);
 
-	sl_core_log_dbg(core_link, SL_CORE_HW_IO_LOG_NAME,
-		"WR64 (addr = 0x%016llX, data = 0x%016llX)", addr, data64);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_WR64,
+		core_link->core_lgrp->core_ldev->num, core_link->core_lgrp->num, core_link->num,
+		addr, data64, 0, 0);
 }
 
 static inline void sl_core_mac_flush64(struct sl_core_mac *core_mac, u64 addr)
@@ -71,8 +78,9 @@ static inline void sl_core_mac_flush64(struct sl_core_mac *core_mac, u64 addr)
 	(void)core_mac->core_lgrp->core_ldev->ops.read64(
 		core_mac->core_lgrp->core_ldev->accessors.pci, addr);
 
-	sl_core_log_dbg(core_mac, SL_CORE_HW_IO_LOG_NAME,
-		"FLSH (addr = 0x%016llX)", addr);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_FLSH,
+		core_mac->core_lgrp->core_ldev->num, core_mac->core_lgrp->num, core_mac->num,
+		addr, 0, 0, 0);
 }
 
 static inline void sl_core_mac_read64(struct sl_core_mac *core_mac, u64 addr, u64 *data64)
@@ -80,8 +88,9 @@ static inline void sl_core_mac_read64(struct sl_core_mac *core_mac, u64 addr, u6
 	*data64 = core_mac->core_lgrp->core_ldev->ops.read64(
 		core_mac->core_lgrp->core_ldev->accessors.pci, addr);
 
-	sl_core_log_dbg(core_mac, SL_CORE_HW_IO_LOG_NAME,
-		"RD64 (addr = 0x%016llX, data = 0x%016llX)", addr, *data64);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_RD64,
+		core_mac->core_lgrp->core_ldev->num, core_mac->core_lgrp->num, core_mac->num,
+		addr, *data64, 0, 0);
 }
 
 static inline void sl_core_mac_write64(struct sl_core_mac *core_mac, u64 addr, u64 data64)
@@ -89,8 +98,9 @@ static inline void sl_core_mac_write64(struct sl_core_mac *core_mac, u64 addr, u
 	core_mac->core_lgrp->core_ldev->ops.write64(
 		core_mac->core_lgrp->core_ldev->accessors.pci, addr, data64);
 
-	sl_core_log_dbg(core_mac, SL_CORE_HW_IO_LOG_NAME,
-		"WR64 (addr = 0x%016llX, data = 0x%016llX)", addr, data64);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_WR64,
+		core_mac->core_lgrp->core_ldev->num, core_mac->core_lgrp->num, core_mac->num,
+		addr, data64, 0, 0);
 }
 
 static inline void sl_core_llr_write64(struct sl_core_llr *core_llr, u64 addr, u64 data64)
@@ -98,8 +108,9 @@ static inline void sl_core_llr_write64(struct sl_core_llr *core_llr, u64 addr, u
 	core_llr->core_lgrp->core_ldev->ops.write64(
 		core_llr->core_lgrp->core_ldev->accessors.pci, addr, data64);
 
-	sl_core_log_dbg(core_llr, SL_CORE_HW_IO_LOG_NAME,
-		"WR64 (addr = 0x%016llX, data = 0x%016llX)", addr, data64);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_WR64,
+		core_llr->core_lgrp->core_ldev->num, core_llr->core_lgrp->num, core_llr->num,
+		addr, data64, 0, 0);
 }
 
 static inline void sl_core_llr_flush64(struct sl_core_llr *core_llr, u64 addr)
@@ -107,8 +118,9 @@ static inline void sl_core_llr_flush64(struct sl_core_llr *core_llr, u64 addr)
 	(void)core_llr->core_lgrp->core_ldev->ops.read64(
 		core_llr->core_lgrp->core_ldev->accessors.pci, addr);
 
-	sl_core_log_dbg(core_llr, SL_CORE_HW_IO_LOG_NAME,
-		"FLSH (addr = 0x%016llX)", addr);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_FLSH,
+		core_llr->core_lgrp->core_ldev->num, core_llr->core_lgrp->num, core_llr->num,
+		addr, 0, 0, 0);
 }
 
 static inline void sl_core_llr_read64(struct sl_core_llr *core_llr, u64 addr, u64 *data64)
@@ -116,8 +128,9 @@ static inline void sl_core_llr_read64(struct sl_core_llr *core_llr, u64 addr, u6
 	*data64 = core_llr->core_lgrp->core_ldev->ops.read64(
 		core_llr->core_lgrp->core_ldev->accessors.pci, addr);
 
-	sl_core_log_dbg(core_llr, SL_CORE_HW_IO_LOG_NAME,
-		"RD64 (addr = 0x%016llX, data = 0x%016llX)", addr, *data64);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_RD64,
+		core_llr->core_lgrp->core_ldev->num, core_llr->core_lgrp->num, core_llr->num,
+		addr, *data64, 0, 0);
 }
 
 static inline int sl_core_pmi_rd(struct sl_core_lgrp *core_lgrp, u32 addr, u16 *data)
@@ -128,8 +141,9 @@ static inline int sl_core_pmi_rd(struct sl_core_lgrp *core_lgrp, u32 addr, u16 *
 		core_lgrp->core_ldev->accessors.pmi,
 		core_lgrp->num, SL_PMI_OP_RD, addr, data, 0, 0);
 
-	sl_core_log_dbg(core_lgrp, SL_CORE_HW_IO_LOG_NAME,
-		"PMI RD (rtn = %d, addr = 0x%08X, data = 0x%04X)", rtn, addr, *data);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_PMI_RD,
+		core_lgrp->core_ldev->num, core_lgrp->num, SL_CORE_IO_TRACE_NUM_NONE,
+		addr, *data, 0, rtn);
 
 	return rtn;
 }
@@ -142,9 +156,9 @@ static inline int sl_core_pmi_wr(struct sl_core_lgrp *core_lgrp, u32 addr, u16 d
 		core_lgrp->core_ldev->accessors.pmi,
 		core_lgrp->num, SL_PMI_OP_WR, addr, NULL, data, mask);
 
-	sl_core_log_dbg(core_lgrp, SL_CORE_HW_IO_LOG_NAME,
-		"PMI WR (rtn = %d, addr = 0x%08X, data = 0x%04X, mask = 0x%04X)",
-		rtn, addr, data, mask);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_PMI_WR,
+		core_lgrp->core_ldev->num, core_lgrp->num, SL_CORE_IO_TRACE_NUM_NONE,
+		addr, data, mask, rtn);
 
 	return rtn;
 }
@@ -157,9 +171,25 @@ static inline int sl_core_sbus_wr(struct sl_core_lgrp *core_lgrp, u32 dev_addr,
 		core_lgrp->core_ldev->accessors.sbus,
 		SL_SBUS_OP_WR, core_lgrp->serdes.dt.sbus_ring, dev_addr, reg, NULL, data);
 
-	sl_core_log_dbg(core_lgrp, SL_CORE_HW_IO_LOG_NAME,
-		"SBUS WR (rtn = %d, dev_addr = 0x%02X, reg = 0x%02X, data = 0x%08X)",
-		rtn, dev_addr, reg, data);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_SBUS_WR,
+		core_lgrp->core_ldev->num, core_lgrp->num, SL_CORE_IO_TRACE_NUM_NONE,
+		((u64)core_lgrp->serdes.dt.sbus_ring << 16) | ((dev_addr & 0xFF) << 8) | reg, data, 0, rtn);
+
+	return rtn;
+}
+
+static inline int sl_core_sbus_wr_blk(struct sl_core_lgrp *core_lgrp, u32 dev_addr, u8 reg,
+	const u32 *data, u32 count)
+{
+	int rtn;
+
+	rtn = core_lgrp->core_ldev->ops.sbus_wr_blk(
+		core_lgrp->core_ldev->accessors.sbus,
+		core_lgrp->serdes.dt.sbus_ring, dev_addr, reg, data, count);
+
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_SBUS_WR_BLK,
+		core_lgrp->core_ldev->num, core_lgrp->num, SL_CORE_IO_TRACE_NUM_NONE,
+		((u64)core_lgrp->serdes.dt.sbus_ring << 16) | ((dev_addr & 0xFF) << 8) | reg, 0, count, rtn);
 
 	return rtn;
 }
@@ -172,9 +202,9 @@ static inline int sl_core_sbus_rd(struct sl_core_lgrp *core_lgrp, u32 dev_addr,
 		core_lgrp->core_ldev->accessors.sbus,
 		SL_SBUS_OP_RD, core_lgrp->serdes.dt.sbus_ring, dev_addr, reg, data, 0);
 
-	sl_core_log_dbg(core_lgrp, SL_CORE_HW_IO_LOG_NAME,
-		"SBUS RD (rtn = %d, dev_addr = 0x%02X, reg = 0x%02X, data = 0x%08X)",
-		rtn, dev_addr, reg, *data);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_SBUS_RD,
+		core_lgrp->core_ldev->num, core_lgrp->num, SL_CORE_IO_TRACE_NUM_NONE,
+		((u64)core_lgrp->serdes.dt.sbus_ring << 16) | ((dev_addr & 0xFF) << 8) | reg, *data, 0, rtn);
 
 	return rtn;
 }
@@ -187,8 +217,9 @@ static inline int sl_core_sbus_rst(struct sl_core_lgrp *core_lgrp, u32 dev_addr)
 		core_lgrp->core_ldev->accessors.sbus,
 		SL_SBUS_OP_RST, core_lgrp->serdes.dt.sbus_ring, dev_addr, 0, NULL, 0);
 
-	sl_core_log_dbg(core_lgrp, SL_CORE_HW_IO_LOG_NAME,
-		"SBUS RST (rtn = %d, dev_addr = 0x%02X", rtn, dev_addr);
+	sl_core_io_trace(SL_CORE_IO_TRACE_OP_SBUS_RST,
+		core_lgrp->core_ldev->num, core_lgrp->num, SL_CORE_IO_TRACE_NUM_NONE,
+		((u64)core_lgrp->serdes.dt.sbus_ring << 16) | ((dev_addr & 0xFF) << 8), 0, 0, rtn);
 
 	return rtn;
 }
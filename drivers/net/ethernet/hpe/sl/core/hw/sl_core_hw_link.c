@@ -32,6 +32,7 @@
 #include "hw/sl_core_hw_reset.h"
 #include "sl_ctrl_lgrp.h"
 #include "sl_ctrl_link_counters.h"
+#include "sl_trace.h"
 
 #define LOG_NAME SL_CORE_HW_LINK_LOG_NAME
 
@@ -257,12 +258,13 @@ void sl_core_hw_link_up_cmd(struct sl_core_link *core_link,
 	/* clear link caps */
 	memset(core_link->core_lgrp->link_caps, 0, sizeof(core_link->core_lgrp->link_caps));
 
-	if (is_flag_set(core_link->config.flags, SL_LINK_CONFIG_OPT_AUTONEG_ENABLE))
-		queue_work(core_link->core_lgrp->core_ldev->workqueue,
-			&(core_link->work[SL_CORE_WORK_LINK_AN_UP_START]));
-	else
-		queue_work(core_link->core_lgrp->core_ldev->workqueue,
-			&(core_link->work[SL_CORE_WORK_LINK_UP_START]));
+	if (is_flag_set(core_link->config.flags, SL_LINK_CONFIG_OPT_AUTONEG_ENABLE)) {
+		sl_core_data_link_up_phase_begin(core_link, SL_CORE_LINK_UP_PHASE_AN);
+		sl_core_work_link_queue(core_link, SL_CORE_WORK_LINK_AN_UP_START);
+	} else {
+		sl_core_data_link_up_phase_begin(core_link, SL_CORE_LINK_UP_PHASE_START);
+		sl_core_work_link_queue(core_link, SL_CORE_WORK_LINK_UP_START);
+	}
 }
 
 void sl_core_hw_link_up_start_work(struct work_struct *work)
@@ -280,11 +282,13 @@ void sl_core_hw_link_up_start_work(struct work_struct *work)
 	if (rtn) {
 		sl_core_log_err_trace(core_link, LOG_NAME,
 				      "up start work link_state_get failed [%d]", rtn);
+		sl_core_data_link_up_phase_cancel(core_link);
 		return;
 	}
 	if (link_state != SL_CORE_LINK_STATE_GOING_UP) {
 		sl_core_log_err_trace(core_link, LOG_NAME, "up start work invalid state (link_state = %u %s)",
 				      link_state, sl_core_link_state_str(link_state));
+		sl_core_data_link_up_phase_cancel(core_link);
 		return;
 	}
 
@@ -353,7 +357,7 @@ void sl_core_hw_link_up_start_work(struct work_struct *work)
 		}
 	}
 
-	queue_work(core_link->core_lgrp->core_ldev->workqueue, &(core_link->work[SL_CORE_WORK_LINK_UP]));
+	sl_core_work_link_queue(core_link, SL_CORE_WORK_LINK_UP);
 }
 
 void sl_core_hw_link_up_after_an_start(struct sl_core_link *core_link)
@@ -368,18 +372,22 @@ void sl_core_hw_link_up_after_an_start(struct sl_core_link *core_link)
 	switch (link_state) {
 	case SL_CORE_LINK_STATE_AN:
 		core_link->link.state = SL_CORE_LINK_STATE_GOING_UP;
+		trace_sl_core_link_state(core_link, core_link->link.state);
 		sl_core_log_dbg(core_link, LOG_NAME, "up after an start going up");
 		spin_unlock(&core_link->link.data_lock);
+		sl_core_data_link_up_phase_set(core_link, SL_CORE_LINK_UP_PHASE_START);
 		break;
 	case SL_CORE_LINK_STATE_CANCELING:
 		sl_core_log_dbg(core_link, LOG_NAME, "up after an start canceled");
 		spin_unlock(&core_link->link.data_lock);
 		sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP);
+		sl_core_data_link_up_phase_cancel(core_link);
 		return;
 	case SL_CORE_LINK_STATE_TIMEOUT:
 		sl_core_log_dbg(core_link, LOG_NAME, "up after an start timeout");
 		spin_unlock(&core_link->link.data_lock);
 		sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP);
+		sl_core_data_link_up_phase_cancel(core_link);
 		return;
 	default:
 		sl_core_log_err(core_link, LOG_NAME,
@@ -387,6 +395,7 @@ void sl_core_hw_link_up_after_an_start(struct sl_core_link *core_link)
 				link_state, sl_core_link_state_str(link_state));
 		spin_unlock(&core_link->link.data_lock);
 		sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP);
+		sl_core_data_link_up_phase_cancel(core_link);
 		return;
 	};
 
@@ -434,7 +443,7 @@ void sl_core_hw_link_up_after_an_start(struct sl_core_link *core_link)
 	sl_core_hw_intr_flgs_clr(core_link, SL_CORE_HW_INTR_LINK_LLR_STARVED);
 	sl_core_hw_intr_flgs_clr(core_link, SL_CORE_HW_INTR_LINK_FAULT);
 
-	queue_work(core_link->core_lgrp->core_ldev->workqueue, &(core_link->work[SL_CORE_WORK_LINK_UP]));
+	sl_core_work_link_queue(core_link, SL_CORE_WORK_LINK_UP);
 }
 
 void sl_core_hw_link_up_work(struct work_struct *work)
@@ -453,15 +462,19 @@ void sl_core_hw_link_up_work(struct work_struct *work)
 		sl_core_log_err_trace(core_link, LOG_NAME,
 				      "up work link_state_get failed [%d]", rtn);
 		sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP);
+		sl_core_data_link_up_phase_cancel(core_link);
 		return;
 	}
 	if ((link_state != SL_CORE_LINK_STATE_GOING_UP) && (link_state != SL_CORE_LINK_STATE_AN)) {
 		sl_core_log_err_trace(core_link, LOG_NAME, "up work invalid state (link_state = %u %s)",
 				      link_state, sl_core_link_state_str(link_state));
 		sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP);
+		sl_core_data_link_up_phase_cancel(core_link);
 		return;
 	}
 
+	sl_core_data_link_up_phase_set(core_link, SL_CORE_LINK_UP_PHASE_MEDIA);
+
 	sl_core_hw_serdes_link_down(core_link);
 
 	sl_core_hw_pcs_config(core_link);
@@ -506,6 +519,8 @@ void sl_core_hw_link_up_work(struct work_struct *work)
 		}
 	}
 
+	sl_core_data_link_up_phase_set(core_link, SL_CORE_LINK_UP_PHASE_SERDES);
+
 	rtn = sl_core_hw_serdes_link_up(core_link);
 	if (rtn) {
 		sl_core_log_err_trace(core_link, LOG_NAME,
@@ -518,6 +533,8 @@ void sl_core_hw_link_up_work(struct work_struct *work)
 		return;
 	}
 
+	sl_core_data_link_up_phase_set(core_link, SL_CORE_LINK_UP_PHASE_PCS_LOCK);
+
 	sl_core_hw_intr_flgs_clr(core_link, SL_CORE_HW_INTR_LINK_UP);
 	rtn = sl_core_hw_intr_flgs_enable(core_link, SL_CORE_HW_INTR_LINK_UP);
 	if (rtn != 0) {
@@ -554,6 +571,7 @@ void sl_core_hw_link_up_intr_work(struct work_struct *work)
 		sl_core_log_err_trace(core_link, LOG_NAME,
 				      "up intr work link_state_get failed [%d]", rtn);
 		sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP);
+		sl_core_data_link_up_phase_cancel(core_link);
 		return;
 	}
 	if ((link_state != SL_CORE_LINK_STATE_GOING_UP) && (link_state != SL_CORE_LINK_STATE_AN)) {
@@ -561,9 +579,12 @@ void sl_core_hw_link_up_intr_work(struct work_struct *work)
 				      "up intr work invalid state (link_state = %u %s)",
 				      link_state, sl_core_link_state_str(link_state));
 		sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP);
+		sl_core_data_link_up_phase_cancel(core_link);
 		return;
 	}
 
+	sl_core_data_link_up_phase_set(core_link, SL_CORE_LINK_UP_PHASE_UP_CHECK);
+
 	sl_core_timer_link_begin(core_link, SL_CORE_TIMER_LINK_UP_CHECK);
 }
 
@@ -627,6 +648,8 @@ static void sl_core_hw_link_up_success(struct sl_core_link *core_link)
 
 	sl_core_log_dbg(core_link, LOG_NAME, "up success");
 
+	sl_core_data_link_up_phase_end(core_link);
+
 	media_lgrp = sl_media_lgrp_get(core_link->core_lgrp->core_ldev->num, core_link->core_lgrp->num);
 
 	sl_media_jack_fault_cause_set(media_lgrp->media_jack, SL_MEDIA_FAULT_CAUSE_NONE);
@@ -699,6 +722,7 @@ static void sl_core_hw_link_up_success(struct sl_core_link *core_link)
 		set_bit(SL_CORE_INFO_MAP_LINK_UP, (unsigned long *)&(core_link->info_map));
 
 		core_link->link.state                  = SL_CORE_LINK_STATE_UP;
+		trace_sl_core_link_state(core_link, core_link->link.state);
 
 		link_up_info.state                     = core_link->link.state;
 		link_up_info.info_map                  = core_link->info_map;
@@ -788,6 +812,7 @@ void sl_core_hw_link_up_check_work(struct work_struct *work)
 		sl_core_log_err_trace(core_link, LOG_NAME,
 				      "up check work link_state_get failed [%d]", rtn);
 		sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP);
+		sl_core_data_link_up_phase_cancel(core_link);
 		return;
 	}
 
@@ -795,6 +820,7 @@ void sl_core_hw_link_up_check_work(struct work_struct *work)
 		sl_core_log_err_trace(core_link, LOG_NAME, "up check work invalid state (link_state = %u %s)",
 				      link_state, sl_core_link_state_str(link_state));
 		sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP);
+		sl_core_data_link_up_phase_cancel(core_link);
 		return;
 	}
 
@@ -870,10 +896,14 @@ out:
 	sl_core_write64(core_link, SS2_PORT_PML_ERR_INFO_PCS_TX_DP, data64);
 
 	if (core_link->fec.settings.up_settle_wait_ms) {
+		sl_core_data_link_up_phase_set(core_link, SL_CORE_LINK_UP_PHASE_FEC_SETTLE);
 		sl_core_timer_link_begin(core_link, SL_CORE_TIMER_LINK_UP_FEC_SETTLE);
 		return;
 	}
 
+	/* no settle, so the rest of the up is timed as the FEC check */
+	sl_core_data_link_up_phase_set(core_link, SL_CORE_LINK_UP_PHASE_FEC_CHECK);
+
 	sl_core_hw_link_up_ald(core_link);
 
 	sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP);
@@ -901,6 +931,7 @@ void sl_core_hw_link_up_fec_settle_work(struct work_struct *work)
 		sl_core_log_err_trace(core_link, LOG_NAME,
 				      "up fec settle work link_state_get failed [%d]", rtn);
 		sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP);
+		sl_core_data_link_up_phase_cancel(core_link);
 		return;
 	}
 
@@ -909,6 +940,7 @@ void sl_core_hw_link_up_fec_settle_work(struct work_struct *work)
 				      "up fec settle work invalid state (link_state = %u %s)",
 				      link_state, sl_core_link_state_str(link_state));
 		sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP);
+		sl_core_data_link_up_phase_cancel(core_link);
 		return;
 	}
 
@@ -919,6 +951,8 @@ void sl_core_hw_link_up_fec_settle_work(struct work_struct *work)
 	else
 		sl_ctrl_link_fec_data_store(ctrl_link, &cw_cntrs, &lane_cntrs, &tail_cntrs);
 
+	sl_core_data_link_up_phase_set(core_link, SL_CORE_LINK_UP_PHASE_FEC_CHECK);
+
 	sl_core_timer_link_begin(core_link, SL_CORE_TIMER_LINK_UP_FEC_CHECK);
 }
 
@@ -943,6 +977,7 @@ void sl_core_hw_link_up_fec_check_work(struct work_struct *work)
 		sl_core_log_err_trace(core_link, LOG_NAME,
 				      "up fec check work link_state_get failed [%d]", rtn);
 		sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP);
+		sl_core_data_link_up_phase_cancel(core_link);
 		return;
 	}
 
@@ -951,6 +986,7 @@ void sl_core_hw_link_up_fec_check_work(struct work_struct *work)
 				      "up fec check work invalid state (link_state = %u %s)",
 				      link_state, sl_core_link_state_str(link_state));
 		sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP);
+		sl_core_data_link_up_phase_cancel(core_link);
 		return;
 	}
 
@@ -1038,6 +1074,7 @@ void sl_core_hw_link_up_timeout_work(struct work_struct *work)
 	case SL_CORE_LINK_STATE_AN:
 		sl_core_log_dbg(core_link, LOG_NAME, "up timeout work going down");
 		core_link->link.state = SL_CORE_LINK_STATE_TIMEOUT;
+		trace_sl_core_link_state(core_link, core_link->link.state);
 		spin_unlock(&core_link->link.data_lock);
 		sl_core_data_link_last_up_fail_cause_map_set(core_link, SL_LINK_DOWN_CAUSE_TIMEOUT_MAP);
 		break;
@@ -1058,17 +1095,19 @@ void sl_core_hw_link_up_timeout_work(struct work_struct *work)
 	sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP_FEC_CHECK);
 	sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP_HIGH_POWER);
 
+	sl_core_data_link_up_phase_cancel(core_link);
+
 	/* cancel work - except for timeout work */
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_AN_UP_START]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_AN_UP]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_AN_UP_DONE]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_START]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_CHECK]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_FEC_SETTLE]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_FEC_CHECK]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_FAIL]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_CANCEL]));
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_UP_START);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_UP);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_UP_DONE);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_START);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_CHECK);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_FEC_SETTLE);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_FEC_CHECK);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_FAIL);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_CANCEL);
 
 	/* disable interrupts */
 	sl_core_hw_intr_flgs_disable(core_link, SL_CORE_HW_INTR_LINK_UP);
@@ -1079,14 +1118,14 @@ void sl_core_hw_link_up_timeout_work(struct work_struct *work)
 	if (core_link->num == 0)
 		sl_core_hw_intr_flgs_disable(core_link, SL_CORE_HW_INTR_LANE_DEGRADE);
 
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_HIGH_SER_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_LLR_MAX_STARVATION_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_LLR_STARVED_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_FAULT_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_PML_REC_POLL]));
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_HIGH_SER_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_LLR_MAX_STARVATION_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_LLR_STARVED_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_FAULT_INTR);
+	sl_core_hw_link_pml_rec_poll_stop(core_link);
 	if (core_link->num == 0)
-		cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_LANE_DEGRADE_INTR]));
+		sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_LANE_DEGRADE_INTR);
 
 	/* Check media */
 	if (sl_core_hw_link_is_media_present(core_link)) {
@@ -1149,17 +1188,19 @@ void sl_core_hw_link_up_cancel_work(struct work_struct *work)
 	sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP_FEC_CHECK);
 	sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP_HIGH_POWER);
 
+	sl_core_data_link_up_phase_cancel(core_link);
+
 	/* cancel work */
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_AN_UP_START]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_AN_UP]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_AN_UP_DONE]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_START]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_TIMEOUT]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_CHECK]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_FEC_SETTLE]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_FEC_CHECK]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_FAIL]));
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_UP_START);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_UP);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_UP_DONE);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_START);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_TIMEOUT);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_CHECK);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_FEC_SETTLE);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_FEC_CHECK);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_FAIL);
 
 	/* disable interrupts */
 	sl_core_hw_intr_flgs_disable(core_link, SL_CORE_HW_INTR_LINK_UP);
@@ -1171,14 +1212,14 @@ void sl_core_hw_link_up_cancel_work(struct work_struct *work)
 		sl_core_hw_intr_flgs_disable(core_link, SL_CORE_HW_INTR_LANE_DEGRADE);
 
 	/* Cancel work queued from interrupt */
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_HIGH_SER_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_LLR_MAX_STARVATION_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_LLR_STARVED_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_FAULT_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_PML_REC_POLL]));
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_HIGH_SER_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_LLR_MAX_STARVATION_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_LLR_STARVED_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_FAULT_INTR);
+	sl_core_hw_link_pml_rec_poll_stop(core_link);
 	if (core_link->num == 0)
-		cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_LANE_DEGRADE_INTR]));
+		sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_LANE_DEGRADE_INTR);
 
 	/* Check media */
 	if (sl_core_hw_link_is_media_present(core_link)) {
@@ -1243,17 +1284,19 @@ void sl_core_hw_link_up_fail_work(struct work_struct *work)
 	sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP_FEC_CHECK);
 	sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_UP_HIGH_POWER);
 
+	sl_core_data_link_up_phase_cancel(core_link);
+
 	/* cancel work */
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_AN_UP_START]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_AN_UP]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_AN_UP_DONE]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_START]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_TIMEOUT]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_CHECK]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_FEC_SETTLE]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_FEC_CHECK]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_CANCEL]));
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_UP_START);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_UP);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_AN_UP_DONE);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_START);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_TIMEOUT);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_CHECK);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_FEC_SETTLE);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_FEC_CHECK);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_CANCEL);
 
 	/* disable interrupts */
 	sl_core_hw_intr_flgs_disable(core_link, SL_CORE_HW_INTR_LINK_UP);
@@ -1265,14 +1308,14 @@ void sl_core_hw_link_up_fail_work(struct work_struct *work)
 		sl_core_hw_intr_flgs_disable(core_link, SL_CORE_HW_INTR_LANE_DEGRADE);
 
 	/* Cancel work queued from interrupt */
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_UP_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_HIGH_SER_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_LLR_MAX_STARVATION_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_LLR_STARVED_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_FAULT_INTR]));
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_PML_REC_POLL]));
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_UP_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_HIGH_SER_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_LLR_MAX_STARVATION_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_LLR_STARVED_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_FAULT_INTR);
+	sl_core_hw_link_pml_rec_poll_stop(core_link);
 	if (core_link->num == 0)
-		cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_LANE_DEGRADE_INTR]));
+		sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_LANE_DEGRADE_INTR);
 
 	/* Check media */
 	if (sl_core_hw_link_is_media_present(core_link)) {
@@ -1351,13 +1394,13 @@ void sl_core_hw_link_down_work(struct work_struct *work)
 					       "down work lane degrade disable failed [%d]", rtn);
 	}
 
-	cancel_work_sync(&core_link->work[SL_CORE_WORK_LINK_HIGH_SER_INTR]);
-	cancel_work_sync(&core_link->work[SL_CORE_WORK_LINK_LLR_MAX_STARVATION_INTR]);
-	cancel_work_sync(&core_link->work[SL_CORE_WORK_LINK_LLR_STARVED_INTR]);
-	cancel_work_sync(&core_link->work[SL_CORE_WORK_LINK_FAULT_INTR]);
-	cancel_work_sync(&(core_link->work[SL_CORE_WORK_LINK_PML_REC_POLL]));
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_HIGH_SER_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_LLR_MAX_STARVATION_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_LLR_STARVED_INTR);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_FAULT_INTR);
+	sl_core_hw_link_pml_rec_poll_stop(core_link);
 	if (core_link->num == 0)
-		cancel_work_sync(&core_link->work[SL_CORE_WORK_LINK_LANE_DEGRADE_INTR]);
+		sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_LANE_DEGRADE_INTR);
 
 	rtn = sl_core_hw_fec_data_get(core_link, &cw_cntrs, &lane_cntrs, &tail_cntrs);
 	if (rtn)
@@ -1537,6 +1580,7 @@ static void sl_core_hw_link_fault_callback_start(struct sl_core_link *core_link)
 	switch (link_state) {
 	case SL_CORE_LINK_STATE_UP:
 		core_link->link.state = SL_CORE_LINK_STATE_GOING_DOWN;
+		trace_sl_core_link_state(core_link, core_link->link.state);
 		core_link->config.fault_start_callback(core_link->core_lgrp->core_ldev->num,
 						       core_link->core_lgrp->num, core_link->num);
 		spin_unlock(&core_link->link.data_lock);
@@ -1693,6 +1737,10 @@ static void sl_core_hw_link_pml_rec_fail(struct sl_core_link *core_link)
 	sl_core_hw_link_fault_link_down(core_link);
 }
 
+/*
+ * One check per run. The poll timer queues the next run, so no worker is
+ * held while the PCS recovers.
+ */
 void sl_core_hw_link_pml_rec_poll_work(struct work_struct *work)
 {
 	struct sl_core_link *core_link;
@@ -1703,84 +1751,97 @@ void sl_core_hw_link_pml_rec_poll_work(struct work_struct *work)
 
 	sl_core_log_dbg(core_link, LOG_NAME, "pml rec poll work");
 
-	while (1) {
-		if (atomic_read(&core_link->pml_rec.pml_rec_running) == 0)
-			return;
+	if (atomic_read(&core_link->pml_rec.pml_rec_running) == 0)
+		return;
 
-		current_time = ktime_get();
+	current_time = ktime_get();
 
-		if (!sl_core_hw_link_is_pml_rec_window_valid(core_link, current_time)) {
-			sl_core_log_dbg(core_link, LOG_NAME, "pml rec poll work window elapsed");
-			core_link->pml_rec.pml_rec_window_start_time   = current_time;
-			core_link->pml_rec.pml_rec_poll_start_time     = current_time;
-			core_link->pml_rec.pml_rec_attempts_total_time = 0;
-		}
+	if (!sl_core_hw_link_is_pml_rec_window_valid(core_link, current_time)) {
+		sl_core_log_dbg(core_link, LOG_NAME, "pml rec poll work window elapsed");
+		core_link->pml_rec.pml_rec_window_start_time   = current_time;
+		core_link->pml_rec.pml_rec_poll_start_time     = current_time;
+		core_link->pml_rec.pml_rec_attempts_total_time = 0;
+	}
 
-		core_link->pml_rec.pml_rec_attempts_total_time = ktime_add(core_link->pml_rec.pml_rec_attempts_total_time,
-									   ktime_sub(current_time, core_link->pml_rec.pml_rec_poll_start_time));
+	core_link->pml_rec.pml_rec_attempts_total_time = ktime_add(core_link->pml_rec.pml_rec_attempts_total_time,
+								   ktime_sub(current_time, core_link->pml_rec.pml_rec_poll_start_time));
 
-		sl_core_log_dbg(core_link, LOG_NAME, "pml rec poll work (attempt_total_time = %lldms)",
-				ktime_to_ms(core_link->pml_rec.pml_rec_attempts_total_time));
+	sl_core_log_dbg(core_link, LOG_NAME, "pml rec poll work (attempt_total_time = %lldms)",
+			ktime_to_ms(core_link->pml_rec.pml_rec_attempts_total_time));
 
-		if (sl_core_hw_pcs_is_pml_rec_success(core_link)) {
+	elapsed_time = ktime_ms_delta(current_time, core_link->pml_rec.pml_rec_attempt_start_time);
 
-			elapsed_time = ktime_ms_delta(current_time, core_link->pml_rec.pml_rec_attempt_start_time);
-			sl_core_log_warn_trace(core_link, LOG_NAME,
-					       "pml rec poll work successful (elapsed_time = %lldms, down_cause = %s)",
-					       elapsed_time,
-					       sl_core_link_pml_rec_down_cause_str(core_link->pml_rec.pml_rec_last_down_cause));
+	if (sl_core_hw_pcs_is_pml_rec_success(core_link)) {
 
-			atomic_inc(&core_link->pml_rec.pml_rec_info.pml_rec_counters[SL_LINK_PML_REC_SUCCESSES]);
-			atomic_set(&core_link->pml_rec.pml_rec_running, 0);
+		sl_core_log_warn_trace(core_link, LOG_NAME,
+				       "pml rec poll work successful (elapsed_time = %lldms, down_cause = %s)",
+				       elapsed_time,
+				       sl_core_link_pml_rec_down_cause_str(core_link->pml_rec.pml_rec_last_down_cause));
 
-			sl_core_hw_link_pml_rec_success(core_link);
+		atomic_inc(&core_link->pml_rec.pml_rec_info.pml_rec_counters[SL_LINK_PML_REC_SUCCESSES]);
+		atomic_set(&core_link->pml_rec.pml_rec_running, 0);
+		sl_core_data_link_pml_rec_hist_add(core_link, true, elapsed_time);
 
-			return;
-		}
+		sl_core_hw_link_pml_rec_success(core_link);
 
-		if (ktime_ms_delta(current_time, core_link->pml_rec.pml_rec_attempt_start_time) >
-		    core_link->config.pml_rec_timeout_ms) {
+		return;
+	}
 
-			elapsed_time = ktime_ms_delta(current_time, core_link->pml_rec.pml_rec_attempt_start_time);
-			sl_core_log_err_trace(core_link, LOG_NAME,
-					      "pml rec poll work timedout (elapsed_time = %lldms, down_cause = %s)",
-					      elapsed_time,
-					      sl_core_link_pml_rec_down_cause_str(core_link->pml_rec.pml_rec_last_down_cause));
+	if (elapsed_time > core_link->config.pml_rec_timeout_ms) {
 
-			if (core_link->pml_rec.pml_rec_last_down_cause == PML_REC_DOWN_CAUSE_LOCAL_FAULT)
-				atomic_inc(&core_link->pml_rec.pml_rec_info.pml_rec_counters[SL_LINK_PML_REC_LINK_LOCAL_FAULT_FAILED_CAUSE]);
-			else if (core_link->pml_rec.pml_rec_last_down_cause == PML_REC_DOWN_CAUSE_LINK_DOWN)
-				atomic_inc(&core_link->pml_rec.pml_rec_info.pml_rec_counters[SL_LINK_PML_REC_LINK_DOWN_FAILED_CAUSE]);
+		sl_core_log_err_trace(core_link, LOG_NAME,
+				      "pml rec poll work timedout (elapsed_time = %lldms, down_cause = %s)",
+				      elapsed_time,
+				      sl_core_link_pml_rec_down_cause_str(core_link->pml_rec.pml_rec_last_down_cause));
 
-			atomic_set(&core_link->pml_rec.pml_rec_running, 0);
+		if (core_link->pml_rec.pml_rec_last_down_cause == PML_REC_DOWN_CAUSE_LOCAL_FAULT)
+			atomic_inc(&core_link->pml_rec.pml_rec_info.pml_rec_counters[SL_LINK_PML_REC_LINK_LOCAL_FAULT_FAILED_CAUSE]);
+		else if (core_link->pml_rec.pml_rec_last_down_cause == PML_REC_DOWN_CAUSE_LINK_DOWN)
+			atomic_inc(&core_link->pml_rec.pml_rec_info.pml_rec_counters[SL_LINK_PML_REC_LINK_DOWN_FAILED_CAUSE]);
 
-			sl_core_hw_link_pml_rec_fail(core_link);
+		atomic_set(&core_link->pml_rec.pml_rec_running, 0);
+		sl_core_data_link_pml_rec_hist_add(core_link, false, elapsed_time);
 
-			return;
-		}
+		sl_core_hw_link_pml_rec_fail(core_link);
 
-		if (ktime_to_ms(core_link->pml_rec.pml_rec_attempts_total_time) >
-		    core_link->config.pml_rec_rate_limit_max_time_ms) {
-			sl_core_log_err_trace(core_link, LOG_NAME, "pml recovery rate limit exceeded");
-
-			if (core_link->pml_rec.pml_rec_last_down_cause == PML_REC_DOWN_CAUSE_LOCAL_FAULT)
-				atomic_inc(&core_link->pml_rec.pml_rec_info.pml_rec_counters[SL_LINK_PML_REC_LINK_LOCAL_FAULT_FAILED_CAUSE]);
-			else if (core_link->pml_rec.pml_rec_last_down_cause == PML_REC_DOWN_CAUSE_LINK_DOWN)
-				atomic_inc(&core_link->pml_rec.pml_rec_info.pml_rec_counters[SL_LINK_PML_REC_LINK_DOWN_FAILED_CAUSE]);
+		return;
+	}
 
-			atomic_inc(&core_link->pml_rec.pml_rec_info.pml_rec_counters[SL_LINK_PML_REC_RATE_LIMIT_EXCEEDED]);
-			atomic_set(&core_link->pml_rec.pml_rec_running, 0);
-			atomic_set(&core_link->pml_rec.pml_rec_rate_limit_exceeded, 1);
+	if (ktime_to_ms(core_link->pml_rec.pml_rec_attempts_total_time) >
+	    core_link->config.pml_rec_rate_limit_max_time_ms) {
+		sl_core_log_err_trace(core_link, LOG_NAME, "pml recovery rate limit exceeded");
 
-			sl_core_hw_link_pml_rec_fail(core_link);
+		if (core_link->pml_rec.pml_rec_last_down_cause == PML_REC_DOWN_CAUSE_LOCAL_FAULT)
+			atomic_inc(&core_link->pml_rec.pml_rec_info.pml_rec_counters[SL_LINK_PML_REC_LINK_LOCAL_FAULT_FAILED_CAUSE]);
+		else if (core_link->pml_rec.pml_rec_last_down_cause == PML_REC_DOWN_CAUSE_LINK_DOWN)
+			atomic_inc(&core_link->pml_rec.pml_rec_info.pml_rec_counters[SL_LINK_PML_REC_LINK_DOWN_FAILED_CAUSE]);
 
-			return;
-		}
+		atomic_inc(&core_link->pml_rec.pml_rec_info.pml_rec_counters[SL_LINK_PML_REC_RATE_LIMIT_EXCEEDED]);
+		atomic_set(&core_link->pml_rec.pml_rec_running, 0);
+		atomic_set(&core_link->pml_rec.pml_rec_rate_limit_exceeded, 1);
+		sl_core_data_link_pml_rec_hist_add(core_link, false, elapsed_time);
 
-		core_link->pml_rec.pml_rec_poll_start_time = current_time;
+		sl_core_hw_link_pml_rec_fail(core_link);
 
-		usleep_range(3500, 4000);
+		return;
 	}
+
+	core_link->pml_rec.pml_rec_poll_start_time = current_time;
+
+	sl_core_timer_link_begin(core_link, SL_CORE_TIMER_LINK_PML_REC_POLL);
+}
+
+/* abandons a recovery in progress, on return nothing is polling */
+void sl_core_hw_link_pml_rec_poll_stop(struct sl_core_link *core_link)
+{
+	sl_core_log_dbg(core_link, LOG_NAME, "pml rec poll stop");
+
+	atomic_set(&core_link->pml_rec.pml_rec_running, 0);
+
+	/* a run in progress can arm the timer one last time */
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_PML_REC_POLL);
+	sl_core_timer_link_end(core_link, SL_CORE_TIMER_LINK_PML_REC_POLL);
+	sl_core_work_link_cancel(core_link, SL_CORE_WORK_LINK_PML_REC_POLL);
 }
 
 static void sl_core_hw_link_pml_recovery(struct sl_core_link *core_link)
@@ -1811,8 +1872,7 @@ static void sl_core_hw_link_pml_recovery(struct sl_core_link *core_link)
 
 	atomic_inc(&core_link->pml_rec.pml_rec_info.pml_rec_counters[SL_LINK_PML_REC_ATTEMPTS]);
 
-	queue_work(core_link->core_lgrp->core_ldev->workqueue,
-		   &(core_link->work[SL_CORE_WORK_LINK_PML_REC_POLL]));
+	sl_core_work_link_queue(core_link, SL_CORE_WORK_LINK_PML_REC_POLL);
 }
 
 static inline void sl_core_hw_link_fault_handling_start(struct sl_core_link *core_link)
@@ -31,5 +31,6 @@ void sl_core_hw_link_llr_starved_intr_work(struct work_struct *work);
 void sl_core_hw_link_fault_intr_work(struct work_struct *work);
 void sl_core_hw_link_lane_degrade_intr_work(struct work_struct *work);
 void sl_core_hw_link_pml_rec_poll_work(struct work_struct *work);
+void sl_core_hw_link_pml_rec_poll_stop(struct sl_core_link *core_link);
 
 #endif /* _SL_CORE_HW_LINK_H_ */
@@ -16,8 +16,10 @@
 #include "data/sl_core_data_lgrp.h"
 #include "data/sl_core_data_llr.h"
 #include "hw/sl_core_hw_io.h"
+#include "hw/sl_core_hw_reg_txn.h"
 #include "hw/sl_core_hw_llr.h"
 #include "hw/sl_core_hw_pcs.h"
+#include "sl_trace.h"
 
 #define SL_CORE_LLR_BYTES_PER_FRAME    9216ULL
 #define SL_CORE_LLR_NUM_FRAMES         2ULL
@@ -28,6 +30,9 @@
 
 #define SL_CORE_LLR_STOP_TIMEOUT       2000
 
+#define SL_CORE_HW_LLR_CAPACITY_TXN_OPS 2 /* capacity update and flush */
+#define SL_CORE_HW_LLR_CONFIG_TXN_OPS   5 /* one merged update per register */
+
 #define LOG_NAME SL_CORE_HW_LLR_LOG_NAME
 
 void sl_core_hw_llr_link_init(struct sl_core_link *core_link)
@@ -206,13 +211,16 @@ static void sl_core_hw_llr_discard(struct sl_core_llr *core_llr)
 #define SL_CORE_PACKET_BYTES_MAX 9000
 static void sl_core_hw_llr_capacity_set(struct sl_core_llr *core_llr)
 {
-	u32                port;
-	u64                bytes;
-	u64                calc_data;
-	int                x;
-	u64                total_time;
-	u64                data64;
-	struct sl_llr_data llr_data;
+	u32                          port;
+	u64                          bytes;
+	u64                          calc_data;
+	int                          x;
+	u64                          total_time;
+	struct sl_llr_data           llr_data;
+	struct sl_core_hw_reg_txn    txn;
+	struct sl_core_hw_reg_txn_op txn_ops[SL_CORE_HW_LLR_CAPACITY_TXN_OPS];
+	struct sl_reg_op             txn_reg_ops[SL_CORE_HW_LLR_CAPACITY_TXN_OPS];
+	int                          rtn;
 
 	port = core_llr->core_lgrp->num;
 
@@ -259,11 +267,14 @@ static void sl_core_hw_llr_capacity_set(struct sl_core_llr *core_llr)
 	if (core_llr->settings.replay_timer_max > 15500)
 		core_llr->settings.replay_timer_max = 15500;
 
-	sl_core_llr_read64(core_llr, SS2_PORT_PML_CFG_LLR_CAPACITY(core_llr->num), &data64);
-	data64 = SS2_PORT_PML_CFG_LLR_CAPACITY_MAX_DATA_UPDATE(data64, calc_data);
-	sl_core_llr_write64(core_llr, SS2_PORT_PML_CFG_LLR_CAPACITY(core_llr->num), data64);
-
-	sl_core_llr_flush64(core_llr, SS2_PORT_PML_CFG_LLR_CAPACITY(core_llr->num));
+	sl_core_hw_reg_txn_init(&txn, core_llr->core_lgrp, core_llr->num,
+		txn_ops, txn_reg_ops, ARRAY_SIZE(txn_ops));
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR_CAPACITY(core_llr->num),
+		SS2_PORT_PML_CFG_LLR_CAPACITY_MAX_DATA_UPDATE, calc_data);
+	sl_core_hw_reg_txn_flush64(&txn, SS2_PORT_PML_CFG_LLR_CAPACITY(core_llr->num));
+	rtn = sl_core_hw_reg_txn_commit(&txn);
+	if (rtn)
+		sl_core_log_err_trace(core_llr, LOG_NAME, "capacity set - reg txn commit failed [%d]", rtn);
 
 	// FIXME: temp
 	{
@@ -279,8 +290,11 @@ static void sl_core_hw_llr_capacity_set(struct sl_core_llr *core_llr)
 
 static void sl_core_hw_llr_config(struct sl_core_llr *core_llr)
 {
-	u32 port;
-	u64 data64;
+	u32                          port;
+	struct sl_core_hw_reg_txn    txn;
+	struct sl_core_hw_reg_txn_op txn_ops[SL_CORE_HW_LLR_CONFIG_TXN_OPS];
+	struct sl_reg_op             txn_reg_ops[SL_CORE_HW_LLR_CONFIG_TXN_OPS];
+	int                          rtn;
 
 	port = core_llr->core_lgrp->num;
 
@@ -288,46 +302,57 @@ static void sl_core_hw_llr_config(struct sl_core_llr *core_llr)
 
 	sl_core_data_llr_info_map_set(core_llr, SL_CORE_INFO_MAP_LLR_CONFIG);
 
-	sl_core_llr_read64(core_llr, SS2_PORT_PML_CFG_LLR, &data64);
-	data64 = SS2_PORT_PML_CFG_LLR_SIZE_UPDATE(data64,
-		core_llr->settings.size);
-	data64 = SS2_PORT_PML_CFG_LLR_ACK_NACK_ERR_CHECK_UPDATE(data64, 1);
-	data64 = SS2_PORT_PML_CFG_LLR_PREAMBLE_SEQ_CHECK_UPDATE(data64, 1);
-	sl_core_llr_write64(core_llr, SS2_PORT_PML_CFG_LLR, data64);
+	sl_core_hw_reg_txn_init(&txn, core_llr->core_lgrp, core_llr->num,
+		txn_ops, txn_reg_ops, ARRAY_SIZE(txn_ops));
 
-	sl_core_llr_read64(core_llr, SS2_PORT_PML_CFG_LLR_SUBPORT(core_llr->num), &data64);
-	data64 = SS2_PORT_PML_CFG_LLR_SUBPORT_FILTER_LOSSLESS_WHEN_OFF_UPDATE(data64,
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR,
+		SS2_PORT_PML_CFG_LLR_SIZE_UPDATE, core_llr->settings.size);
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR,
+		SS2_PORT_PML_CFG_LLR_ACK_NACK_ERR_CHECK_UPDATE, 1);
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR,
+		SS2_PORT_PML_CFG_LLR_PREAMBLE_SEQ_CHECK_UPDATE, 1);
+
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR_SUBPORT(core_llr->num),
+		SS2_PORT_PML_CFG_LLR_SUBPORT_FILTER_LOSSLESS_WHEN_OFF_UPDATE,
 		core_llr->settings.lossless_when_off);
-	data64 = SS2_PORT_PML_CFG_LLR_SUBPORT_LINK_DOWN_BEHAVIOR_UPDATE(data64,
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR_SUBPORT(core_llr->num),
+		SS2_PORT_PML_CFG_LLR_SUBPORT_LINK_DOWN_BEHAVIOR_UPDATE,
 		core_llr->settings.link_down_behavior);
-	data64 = SS2_PORT_PML_CFG_LLR_SUBPORT_FILTER_CTL_FRAMES_UPDATE(data64,
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR_SUBPORT(core_llr->num),
+		SS2_PORT_PML_CFG_LLR_SUBPORT_FILTER_CTL_FRAMES_UPDATE,
 		core_llr->settings.filter_ctl_frames);
-	data64 = SS2_PORT_PML_CFG_LLR_SUBPORT_ENABLE_LOOP_TIMING_UPDATE(data64, 0);
-	data64 = SS2_PORT_PML_CFG_LLR_SUBPORT_LLR_MODE_UPDATE(data64, 0);
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR_SUBPORT(core_llr->num),
+		SS2_PORT_PML_CFG_LLR_SUBPORT_ENABLE_LOOP_TIMING_UPDATE, 0);
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR_SUBPORT(core_llr->num),
+		SS2_PORT_PML_CFG_LLR_SUBPORT_LLR_MODE_UPDATE, 0);
 	// FIXME: Setting to REPLAY_TIMER_MAX reset value for now. Need to get better # from SV.
-	data64 = SS2_PORT_PML_CFG_LLR_SUBPORT_MAX_STARVATION_LIMIT_UPDATE(data64, 1550);
-	sl_core_llr_write64(core_llr, SS2_PORT_PML_CFG_LLR_SUBPORT(core_llr->num), data64);
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR_SUBPORT(core_llr->num),
+		SS2_PORT_PML_CFG_LLR_SUBPORT_MAX_STARVATION_LIMIT_UPDATE, 1550);
 
-	sl_core_llr_read64(core_llr, SS2_PORT_PML_CFG_LLR_CF_SMAC, &data64);
-	data64 = SS2_PORT_PML_CFG_LLR_CF_SMAC_CTL_FRAME_SMAC_UPDATE(data64,
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR_CF_SMAC,
+		SS2_PORT_PML_CFG_LLR_CF_SMAC_CTL_FRAME_SMAC_UPDATE,
 		core_llr->settings.ctl_frame_smac);
-	sl_core_llr_write64(core_llr, SS2_PORT_PML_CFG_LLR_CF_SMAC, data64);
 
-	sl_core_llr_read64(core_llr, SS2_PORT_PML_CFG_LLR_CF_ETYPE, &data64);
-	data64 = SS2_PORT_PML_CFG_LLR_CF_ETYPE_CTL_FRAME_ETHERTYPE_UPDATE(data64,
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR_CF_ETYPE,
+		SS2_PORT_PML_CFG_LLR_CF_ETYPE_CTL_FRAME_ETHERTYPE_UPDATE,
 		core_llr->settings.ctl_frame_ethertype);
-	sl_core_llr_write64(core_llr, SS2_PORT_PML_CFG_LLR_CF_ETYPE, data64);
 
-	sl_core_llr_read64(core_llr, SS2_PORT_PML_CFG_LLR_SM(core_llr->num), &data64);
-	data64 = SS2_PORT_PML_CFG_LLR_SM_RETRY_THRESHOLD_UPDATE(data64,
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR_SM(core_llr->num),
+		SS2_PORT_PML_CFG_LLR_SM_RETRY_THRESHOLD_UPDATE,
 		core_llr->settings.retry_threshold);
-	data64 = SS2_PORT_PML_CFG_LLR_SM_ALLOW_RE_INIT_UPDATE(data64,
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR_SM(core_llr->num),
+		SS2_PORT_PML_CFG_LLR_SM_ALLOW_RE_INIT_UPDATE,
 		core_llr->settings.allow_re_init);
-	data64 = SS2_PORT_PML_CFG_LLR_SM_REPLAY_CT_MAX_UPDATE(data64,
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR_SM(core_llr->num),
+		SS2_PORT_PML_CFG_LLR_SM_REPLAY_CT_MAX_UPDATE,
 		core_llr->settings.replay_ct_max);
-	data64 = SS2_PORT_PML_CFG_LLR_SM_REPLAY_TIMER_MAX_UPDATE(data64,
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR_SM(core_llr->num),
+		SS2_PORT_PML_CFG_LLR_SM_REPLAY_TIMER_MAX_UPDATE,
 		core_llr->settings.replay_timer_max);
-	sl_core_llr_write64(core_llr, SS2_PORT_PML_CFG_LLR_SM(core_llr->num), data64);
+
+	rtn = sl_core_hw_reg_txn_commit(&txn);
+	if (rtn)
+		sl_core_log_err_trace(core_llr, LOG_NAME, "config - reg txn commit failed [%d]", rtn);
 
 	sl_core_hw_llr_config_timeouts(core_llr);
 }
@@ -369,7 +394,7 @@ void sl_core_hw_llr_setup_cmd(struct sl_core_llr *core_llr,
 	sl_core_hw_llr_ordered_sets_stop(core_llr);
 	sl_core_hw_llr_config(core_llr);
 
-	queue_work(core_llr->core_lgrp->core_ldev->workqueue, &(core_llr->work[SL_CORE_WORK_LLR_SETUP]));
+	sl_core_work_llr_queue(core_llr, SL_CORE_WORK_LLR_SETUP);
 }
 
 void sl_core_hw_llr_setup_work(struct work_struct *work)
@@ -409,8 +434,8 @@ void sl_core_hw_llr_setup_work(struct work_struct *work)
 		sl_core_data_llr_info_map_clr(core_llr, SL_CORE_INFO_MAP_LLR_SETTING_UP);
 		sl_core_hw_intr_llr_flgs_disable(core_llr, SL_CORE_HW_INTR_LLR_SETUP_UNEXP_LOOP_TIME);
 		sl_core_hw_intr_llr_flgs_disable(core_llr, SL_CORE_HW_INTR_LLR_SETUP_LOOP_TIME);
-		cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_SETUP_UNEXP_LOOP_TIME_INTR]));
-		cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_SETUP_LOOP_TIME_INTR]));
+		sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_SETUP_UNEXP_LOOP_TIME_INTR);
+		sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_SETUP_LOOP_TIME_INTR);
 		sl_core_data_llr_state_set(core_llr, SL_CORE_LLR_STATE_CONFIGURED);
 		sl_core_data_llr_last_fail_cause_set(core_llr, SL_LLR_FAIL_CAUSE_SETUP_INTR_ENABLE);
 		sl_core_hw_llr_setup_callback(core_llr);
@@ -490,6 +515,7 @@ void sl_core_hw_llr_setup_loop_time_intr_work(struct work_struct *work)
 	case SL_CORE_LLR_STATE_SETTING_UP:
 		sl_core_log_dbg(core_llr, LOG_NAME, "setup loop time - setup");
 		core_llr->state = SL_CORE_LLR_STATE_SETUP;
+		trace_sl_core_llr_state(core_llr, core_llr->state);
 		clear_bit(SL_CORE_INFO_MAP_LLR_SETTING_UP, (unsigned long *)&(core_llr->info_map));
 		set_bit(SL_CORE_INFO_MAP_LLR_SETUP, (unsigned long *)&(core_llr->info_map));
 		spin_unlock(&core_llr->data_lock);
@@ -545,6 +571,7 @@ void sl_core_hw_llr_setup_timeout_work(struct work_struct *work)
 	switch (llr_state) {
 	case SL_CORE_LLR_STATE_SETTING_UP:
 		core_llr->state = SL_CORE_LLR_STATE_SETUP_TIMEOUT;
+		trace_sl_core_llr_state(core_llr, core_llr->state);
 		spin_unlock(&core_llr->data_lock);
 		break;
 	default:
@@ -582,8 +609,8 @@ void sl_core_hw_llr_settingup_cancel_cmd(struct sl_core_llr *core_llr)
 
 	sl_core_timer_llr_end(core_llr, SL_CORE_TIMER_LLR_SETUP);
 
-	cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_SETUP]));
-	cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_SETUP_TIMEOUT]));
+	sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_SETUP);
+	sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_SETUP_TIMEOUT);
 
 	rtn = sl_core_hw_intr_llr_flgs_disable(core_llr, SL_CORE_HW_INTR_LLR_SETUP_UNEXP_LOOP_TIME);
 	if (rtn != 0)
@@ -595,8 +622,8 @@ void sl_core_hw_llr_settingup_cancel_cmd(struct sl_core_llr *core_llr)
 		sl_core_log_warn_trace(core_llr, LOG_NAME,
 			"settingup cancel cmd llr_flgs_disable failed [%d]", rtn);
 
-	cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_SETUP_LOOP_TIME_INTR]));
-	cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_SETUP_UNEXP_LOOP_TIME_INTR]));
+	sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_SETUP_LOOP_TIME_INTR);
+	sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_SETUP_UNEXP_LOOP_TIME_INTR);
 
 	sl_core_hw_llr_loop_time_stop(core_llr);
 	sl_core_hw_llr_ordered_sets_stop(core_llr);
@@ -640,7 +667,7 @@ void sl_core_hw_llr_start_cmd(struct sl_core_llr *core_llr,
 		sl_core_log_warn_trace(core_llr, LOG_NAME,
 				       "start cmd llr_flgs_disable failed [%d]", rtn);
 
-	queue_work(core_llr->core_lgrp->core_ldev->workqueue, &(core_llr->work[SL_CORE_WORK_LLR_START]));
+	sl_core_work_llr_queue(core_llr, SL_CORE_WORK_LLR_START);
 }
 
 void sl_core_hw_llr_start_work(struct work_struct *work)
@@ -676,7 +703,7 @@ void sl_core_hw_llr_start_work(struct work_struct *work)
 		sl_core_data_llr_state_set(core_llr, SL_CORE_LLR_STATE_START_CANCELING);
 		sl_core_data_llr_info_map_clr(core_llr, SL_CORE_INFO_MAP_LLR_STARTING);
 		sl_core_hw_intr_llr_flgs_disable(core_llr, SL_CORE_HW_INTR_LLR_START_INIT_COMPLETE);
-		cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_START_INIT_COMPLETE_INTR]));
+		sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_START_INIT_COMPLETE_INTR);
 		sl_core_data_llr_state_set(core_llr, SL_CORE_LLR_STATE_SETUP);
 		sl_core_data_llr_last_fail_cause_set(core_llr, SL_LLR_FAIL_CAUSE_START_INTR_ENABLE);
 		sl_core_hw_llr_start_callback(core_llr);
@@ -738,6 +765,7 @@ void sl_core_hw_llr_start_init_complete_intr_work(struct work_struct *work)
 	case SL_CORE_LLR_STATE_STARTING:
 		sl_core_log_dbg(core_llr, LOG_NAME, "start init complete - running");
 		core_llr->state = SL_CORE_LLR_STATE_RUNNING;
+		trace_sl_core_llr_state(core_llr, core_llr->state);
 		set_bit(SL_CORE_INFO_MAP_LLR_RUNNING, (unsigned long *)&(core_llr->info_map));
 		clear_bit(SL_CORE_INFO_MAP_LLR_STARTING, (unsigned long *)&(core_llr->info_map));
 		spin_unlock(&core_llr->data_lock);
@@ -767,6 +795,7 @@ void sl_core_hw_llr_start_timeout_work(struct work_struct *work)
 	switch (llr_state) {
 	case SL_CORE_LLR_STATE_STARTING:
 		core_llr->state = SL_CORE_LLR_STATE_START_TIMEOUT;
+		trace_sl_core_llr_state(core_llr, core_llr->state);
 		spin_unlock(&core_llr->data_lock);
 		break;
 	default:
@@ -776,14 +805,14 @@ void sl_core_hw_llr_start_timeout_work(struct work_struct *work)
 		return;
 	}
 
-	cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_START]));
+	sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_START);
 
 	rtn = sl_core_hw_intr_llr_flgs_disable(core_llr, SL_CORE_HW_INTR_LLR_START_INIT_COMPLETE);
 	if (rtn != 0)
 		sl_core_log_warn_trace(core_llr, LOG_NAME,
 			"start timeout work llr_flgs_disable failed [%d]", rtn);
 
-	cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_START_INIT_COMPLETE_INTR]));
+	sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_START_INIT_COMPLETE_INTR);
 
 	sl_core_hw_llr_loop_time_stop(core_llr);
 	sl_core_hw_llr_ordered_sets_stop(core_llr);
@@ -808,15 +837,15 @@ void sl_core_hw_llr_starting_cancel_cmd(struct sl_core_llr *core_llr)
 
 	sl_core_timer_llr_end(core_llr, SL_CORE_TIMER_LLR_START);
 
-	cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_START]));
-	cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_START_TIMEOUT]));
+	sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_START);
+	sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_START_TIMEOUT);
 
 	rtn = sl_core_hw_intr_llr_flgs_disable(core_llr, SL_CORE_HW_INTR_LLR_START_INIT_COMPLETE);
 	if (rtn != 0)
 		sl_core_log_warn_trace(core_llr, LOG_NAME,
 			"starting cancel cmd llr_flgs_disable failed [%d]", rtn);
 
-	cancel_work_sync(&(core_llr->work[SL_CORE_WORK_LLR_START_INIT_COMPLETE_INTR]));
+	sl_core_work_llr_cancel(core_llr, SL_CORE_WORK_LLR_START_INIT_COMPLETE_INTR);
 
 	sl_core_hw_llr_loop_time_stop(core_llr);
 	sl_core_hw_llr_ordered_sets_stop(core_llr);
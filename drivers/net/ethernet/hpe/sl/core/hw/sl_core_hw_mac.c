@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2022,2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2022,2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 
@@ -8,14 +8,20 @@
 #include "sl_core_str.h"
 #include "data/sl_core_data_mac.h"
 #include "hw/sl_core_hw_io.h"
+#include "hw/sl_core_hw_reg_txn.h"
 #include "hw/sl_core_hw_mac.h"
 
 #define LOG_NAME SL_CORE_HW_MAC_LOG_NAME
 
+#define SL_CORE_HW_MAC_TX_CONFIG_TXN_OPS 3 /* LLR subport update, TX MAC update and flush */
+
 void sl_core_hw_mac_tx_config(struct sl_core_mac *core_mac)
 {
-	u64 data64;
-	u32 port;
+	u32                          port;
+	struct sl_core_hw_reg_txn    txn;
+	struct sl_core_hw_reg_txn_op txn_ops[SL_CORE_HW_MAC_TX_CONFIG_TXN_OPS];
+	struct sl_reg_op             txn_reg_ops[SL_CORE_HW_MAC_TX_CONFIG_TXN_OPS];
+	int                          rtn;
 
 	port = core_mac->core_lgrp->num;
 
@@ -23,22 +29,29 @@ void sl_core_hw_mac_tx_config(struct sl_core_mac *core_mac)
 
 	sl_core_data_mac_info_map_set(core_mac, SL_CORE_INFO_MAP_MAC_TX_CONFIG);
 
+	sl_core_hw_reg_txn_init(&txn, core_mac->core_lgrp, core_mac->num,
+		txn_ops, txn_reg_ops, ARRAY_SIZE(txn_ops));
+
 	/* need to set mac_if_credits for llr before mac is turned on */
-	sl_core_mac_read64(core_mac, SS2_PORT_PML_CFG_LLR_SUBPORT(core_mac->num), &data64);
-	data64 = SS2_PORT_PML_CFG_LLR_SUBPORT_MAC_IF_CREDITS_UPDATE(data64,
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_LLR_SUBPORT(core_mac->num),
+		SS2_PORT_PML_CFG_LLR_SUBPORT_MAC_IF_CREDITS_UPDATE,
 		core_mac->settings.llr_if_credits);
-	sl_core_mac_write64(core_mac, SS2_PORT_PML_CFG_LLR_SUBPORT(core_mac->num), data64);
 
-	sl_core_mac_read64(core_mac, SS2_PORT_PML_CFG_TX_MAC, &data64);
-	data64 = SS2_PORT_PML_CFG_TX_MAC_IEEE_IFG_ADJUSTMENT_UPDATE(data64,
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_TX_MAC,
+		SS2_PORT_PML_CFG_TX_MAC_IEEE_IFG_ADJUSTMENT_UPDATE,
 		core_mac->settings.tx_ifg_adj);
-	data64 = SS2_PORT_PML_CFG_TX_MAC_IFG_MODE_UPDATE(data64,
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_TX_MAC,
+		SS2_PORT_PML_CFG_TX_MAC_IFG_MODE_UPDATE,
 		core_mac->settings.tx_ifg_mode);
-	data64 = SS2_PORT_PML_CFG_TX_MAC_MAC_PAD_IDLE_THRESH_UPDATE(data64,
+	SL_CORE_HW_REG_TXN_UPDATE(&txn, SS2_PORT_PML_CFG_TX_MAC,
+		SS2_PORT_PML_CFG_TX_MAC_MAC_PAD_IDLE_THRESH_UPDATE,
 		core_mac->settings.tx_pad_idle_thresh);
-	sl_core_mac_write64(core_mac, SS2_PORT_PML_CFG_TX_MAC, data64);
 
-	sl_core_mac_flush64(core_mac, SS2_PORT_PML_CFG_TX_MAC);
+	sl_core_hw_reg_txn_flush64(&txn, SS2_PORT_PML_CFG_TX_MAC);
+
+	rtn = sl_core_hw_reg_txn_commit(&txn);
+	if (rtn)
+		sl_core_log_err_trace(core_mac, LOG_NAME, "tx - config reg txn commit failed [%d]", rtn);
 
 	sl_core_hw_mac_tx_config_subport(core_mac);
 }
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 #include <linux/umh.h>
@@ -19,14 +19,8 @@ int pmi_rd(struct sl_core_lgrp *core_lgrp, u8 dev_id, u8 lane, u8 pll, u16 addr,
 	if (rtn)
 		sl_core_log_err_trace(core_lgrp, LOG_NAME, "PMI RD (addr = 0x%04X, data = 0x%04X)", addr, *data);
 
-	spin_lock(&core_lgrp->data_lock);
-	core_lgrp->pmi.rd.addr   =  addr;
-	core_lgrp->pmi.rd.data   = *data;
-	core_lgrp->pmi.rd.dev_id =  dev_id;
-	core_lgrp->pmi.rd.lane   =  lane;
-	core_lgrp->pmi.rd.pll    =  pll;
-	core_lgrp->pmi.rd.result =  rtn;
-	spin_unlock(&core_lgrp->data_lock);
+	sl_core_op_hist_add(core_lgrp, SL_CORE_OP_HIST_OP_PMI_RD,
+		0, dev_id, lane, pll, 0, 0, addr, *data, 0xFFFF, rtn);
 
 	return rtn;
 }
@@ -40,15 +34,8 @@ int pmi_wr(struct sl_core_lgrp *core_lgrp, u8 dev_id, u8 lane, u8 pll, u16 addr,
 		sl_core_log_err_trace(core_lgrp, LOG_NAME, "PMI WR (addr = 0x%04X, data = 0x%04X, mask = 0x%04X)",
 				      addr, data, mask);
 
-	spin_lock(&core_lgrp->data_lock);
-	core_lgrp->pmi.wr.addr   = addr;
-	core_lgrp->pmi.wr.data   = data;
-	core_lgrp->pmi.wr.mask   = mask;
-	core_lgrp->pmi.wr.dev_id = dev_id;
-	core_lgrp->pmi.wr.lane   = lane;
-	core_lgrp->pmi.wr.pll    = pll;
-	core_lgrp->pmi.wr.result = rtn;
-	spin_unlock(&core_lgrp->data_lock);
+	sl_core_op_hist_add(core_lgrp, SL_CORE_OP_HIST_OP_PMI_WR,
+		0, dev_id, lane, pll, 0, 0, addr, data, mask, rtn);
 
 	return rtn;
 }
@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/types.h>
+#include <linux/string.h>
+
+#include "sl_core_ldev.h"
+#include "sl_core_lgrp.h"
+#include "base/sl_core_log.h"
+#include "base/sl_core_io_trace.h"
+#include "hw/sl_core_hw_reg_txn.h"
+
+#define LOG_NAME SL_CORE_HW_IO_LOG_NAME
+
+void sl_core_hw_reg_txn_init(struct sl_core_hw_reg_txn *txn, struct sl_core_lgrp *core_lgrp, u8 num,
+			     struct sl_core_hw_reg_txn_op *ops, struct sl_reg_op *reg_ops, u32 max_ops)
+{
+	txn->core_lgrp = core_lgrp;
+	txn->ops       = ops;
+	txn->reg_ops   = reg_ops;
+	txn->max_ops   = max_ops;
+	txn->count     = 0;
+	txn->rtn       = 0;
+	txn->num       = num;
+}
+
+static struct sl_core_hw_reg_txn_op *sl_core_hw_reg_txn_op_add(struct sl_core_hw_reg_txn *txn,
+							       u8 type, u64 addr)
+{
+	struct sl_core_hw_reg_txn_op *op;
+
+	if (txn->count == txn->max_ops)
+		(void)sl_core_hw_reg_txn_commit(txn);
+
+	op = &txn->ops[txn->count++];
+	op->type = type;
+	op->addr = addr;
+	op->data = 0;
+	op->keep = 0;
+
+	return op;
+}
+
+void sl_core_hw_reg_txn_read64(struct sl_core_hw_reg_txn *txn, u64 addr, u64 *data64)
+{
+	struct sl_core_hw_reg_txn_op *op;
+
+	op = sl_core_hw_reg_txn_op_add(txn, SL_CORE_HW_REG_TXN_OP_RD64, addr);
+	op->rd_data = data64;
+}
+
+void sl_core_hw_reg_txn_write64(struct sl_core_hw_reg_txn *txn, u64 addr, u64 data64)
+{
+	struct sl_core_hw_reg_txn_op *op;
+
+	op = sl_core_hw_reg_txn_op_add(txn, SL_CORE_HW_REG_TXN_OP_WR64, addr);
+	op->data = data64;
+}
+
+/*
+ * Register becomes (read & keep) | set. Back to back updates of the same
+ * register are merged into one read and one write.
+ */
+void sl_core_hw_reg_txn_update64(struct sl_core_hw_reg_txn *txn, u64 addr, u64 keep, u64 set)
+{
+	struct sl_core_hw_reg_txn_op *op;
+
+	if (txn->count) {
+		op = &txn->ops[txn->count - 1];
+		if ((op->type == SL_CORE_HW_REG_TXN_OP_UPDATE64) && (op->addr == addr)) {
+			op->data  = (op->data & keep) | set;
+			op->keep &= keep;
+			return;
+		}
+	}
+
+	op = sl_core_hw_reg_txn_op_add(txn, SL_CORE_HW_REG_TXN_OP_UPDATE64, addr);
+	op->keep = keep;
+	op->data = set;
+}
+
+void sl_core_hw_reg_txn_flush64(struct sl_core_hw_reg_txn *txn, u64 addr)
+{
+	(void)sl_core_hw_reg_txn_op_add(txn, SL_CORE_HW_REG_TXN_OP_FLUSH64, addr);
+}
+
+static int sl_core_hw_reg_txn_access(struct sl_core_hw_reg_txn *txn, u32 count)
+{
+	struct sl_core_ldev *core_ldev;
+	struct sl_reg_op    *reg_op;
+	int                  rtn;
+	u32                  x;
+
+	if (count == 0)
+		return 0;
+
+	core_ldev = txn->core_lgrp->core_ldev;
+
+	if (core_ldev->ops.reg_ops) {
+		rtn = core_ldev->ops.reg_ops(core_ldev->accessors.pci, txn->reg_ops, count);
+		if (rtn != 0)
+			sl_core_log_err_trace(txn->core_lgrp, LOG_NAME,
+					      "reg txn reg_ops failed (count = %u) [%d]", count, rtn);
+		return rtn;
+	}
+
+	for (x = 0; x < count; ++x) {
+		reg_op = &txn->reg_ops[x];
+		if (reg_op->op == SL_REG_OP_RD64)
+			reg_op->data = core_ldev->ops.read64(core_ldev->accessors.pci, reg_op->addr);
+		else
+			core_ldev->ops.write64(core_ldev->accessors.pci, reg_op->addr, reg_op->data);
+	}
+
+	return 0;
+}
+
+static void sl_core_hw_reg_txn_trace(struct sl_core_hw_reg_txn *txn, u8 trace_op,
+				     u64 addr, u64 data64, int rtn)
+{
+	sl_core_io_trace(trace_op, txn->core_lgrp->core_ldev->num, txn->core_lgrp->num, txn->num,
+			 addr, data64, 0, rtn);
+}
+
+int sl_core_hw_reg_txn_commit(struct sl_core_hw_reg_txn *txn)
+{
+	struct sl_core_hw_reg_txn_op *op;
+	int                           rtn;
+	u32                           count;
+	u32                           x;
+
+	if (txn->rtn != 0)
+		goto out;
+
+	/* reads */
+	count = 0;
+	for (x = 0; x < txn->count; ++x) {
+		op = &txn->ops[x];
+		if ((op->type != SL_CORE_HW_REG_TXN_OP_RD64) && (op->type != SL_CORE_HW_REG_TXN_OP_UPDATE64))
+			continue;
+		txn->reg_ops[count].op   = SL_REG_OP_RD64;
+		txn->reg_ops[count].addr = op->addr;
+		txn->reg_ops[count].data = 0;
+		count++;
+	}
+
+	rtn = sl_core_hw_reg_txn_access(txn, count);
+
+	count = 0;
+	for (x = 0; x < txn->count; ++x) {
+		op = &txn->ops[x];
+		if ((op->type != SL_CORE_HW_REG_TXN_OP_RD64) && (op->type != SL_CORE_HW_REG_TXN_OP_UPDATE64))
+			continue;
+		sl_core_hw_reg_txn_trace(txn, SL_CORE_IO_TRACE_OP_RD64, op->addr, txn->reg_ops[count].data, rtn);
+		if (op->type == SL_CORE_HW_REG_TXN_OP_RD64)
+			*op->rd_data = txn->reg_ops[count].data;
+		else
+			op->data = (txn->reg_ops[count].data & op->keep) | op->data;
+		count++;
+	}
+
+	if (rtn != 0) {
+		txn->rtn = rtn;
+		goto out;
+	}
+
+	/* writes and flushes */
+	count = 0;
+	for (x = 0; x < txn->count; ++x) {
+		op = &txn->ops[x];
+		if (op->type == SL_CORE_HW_REG_TXN_OP_RD64)
+			continue;
+		txn->reg_ops[count].op   = (op->type == SL_CORE_HW_REG_TXN_OP_FLUSH64) ?
+			SL_REG_OP_RD64 : SL_REG_OP_WR64;
+		txn->reg_ops[count].addr = op->addr;
+		txn->reg_ops[count].data = op->data;
+		count++;
+	}
+
+	rtn = sl_core_hw_reg_txn_access(txn, count);
+
+	for (x = 0; x < txn->count; ++x) {
+		op = &txn->ops[x];
+		if (op->type == SL_CORE_HW_REG_TXN_OP_RD64)
+			continue;
+		if (op->type == SL_CORE_HW_REG_TXN_OP_FLUSH64)
+			sl_core_hw_reg_txn_trace(txn, SL_CORE_IO_TRACE_OP_FLSH, op->addr, 0, rtn);
+		else
+			sl_core_hw_reg_txn_trace(txn, SL_CORE_IO_TRACE_OP_WR64, op->addr, op->data, rtn);
+	}
+
+	txn->rtn = rtn;
+
+out:
+	txn->count = 0;
+
+	return txn->rtn;
+}
@@ -0,0 +1,67 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#ifndef _SL_CORE_HW_REG_TXN_H_
+#define _SL_CORE_HW_REG_TXN_H_
+
+#include <linux/types.h>
+
+#include <linux/hpe/sl/sl_ldev.h>
+
+struct sl_core_lgrp;
+
+/*
+ * Register transaction for one block.
+ *
+ * Reads, writes, field updates and flushes are queued then issued on commit.
+ * A commit is at most two accesses: every read (including the read half of
+ * field updates) goes first, then the writes and flushes in queue order. The
+ * platform reg_ops batch is used for each access when it's provided,
+ * otherwise the ops are issued one at a time.
+ *
+ * The caller supplies the op arrays, sized for the batch, so a transaction
+ * can live off the stack. Queueing past max_ops commits what's already
+ * queued.
+ */
+
+enum sl_core_hw_reg_txn_op_type {
+	SL_CORE_HW_REG_TXN_OP_RD64 = 1,
+	SL_CORE_HW_REG_TXN_OP_WR64,
+	SL_CORE_HW_REG_TXN_OP_UPDATE64,
+	SL_CORE_HW_REG_TXN_OP_FLUSH64,
+};
+
+struct sl_core_hw_reg_txn_op {
+	u64          addr;
+	u64          data;    /* write data or update set bits */
+	union {
+		u64  keep;    /* update bits kept from the read */
+		u64 *rd_data; /* read destination */
+	};
+	u8           type;
+};
+
+struct sl_core_hw_reg_txn {
+	struct sl_core_lgrp          *core_lgrp;
+	struct sl_core_hw_reg_txn_op *ops;
+	struct sl_reg_op             *reg_ops;
+	u32                           max_ops;
+	u32                           count;
+	int                           rtn;
+	u8                            num;
+};
+
+/* field update using a CSR _UPDATE(data64, value) macro */
+#define SL_CORE_HW_REG_TXN_UPDATE(_txn, _addr, _update, _value)          \
+	sl_core_hw_reg_txn_update64((_txn), (_addr), _update(~0ULL, (_value)), \
+				    _update(0ULL, (_value)))
+
+void sl_core_hw_reg_txn_init(struct sl_core_hw_reg_txn *txn, struct sl_core_lgrp *core_lgrp, u8 num,
+			     struct sl_core_hw_reg_txn_op *ops, struct sl_reg_op *reg_ops, u32 max_ops);
+void sl_core_hw_reg_txn_read64(struct sl_core_hw_reg_txn *txn, u64 addr, u64 *data64);
+void sl_core_hw_reg_txn_write64(struct sl_core_hw_reg_txn *txn, u64 addr, u64 data64);
+void sl_core_hw_reg_txn_update64(struct sl_core_hw_reg_txn *txn, u64 addr, u64 keep, u64 set);
+void sl_core_hw_reg_txn_flush64(struct sl_core_hw_reg_txn *txn, u64 addr);
+int  sl_core_hw_reg_txn_commit(struct sl_core_hw_reg_txn *txn);
+
+#endif /* _SL_CORE_HW_REG_TXN_H_ */
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 #include <linux/umh.h>
@@ -20,14 +20,48 @@ int sbus_wr(struct sl_core_lgrp *core_lgrp, u8 dev_addr, u8 reg, u32 data)
 		sl_core_log_err_trace(core_lgrp, LOG_NAME, "SBUS WR (dev = 0x%02X, reg = 0x%02X, data = 0x%08X)",
 				      dev_addr, reg, data);
 
-	spin_lock(&core_lgrp->data_lock);
-	core_lgrp->sbus.wr.dev_addr = dev_addr;
-	core_lgrp->sbus.wr.data     = data;
-	core_lgrp->sbus.wr.mask     = 0xFFFFFFFF;
-	core_lgrp->sbus.wr.reg      = reg;
-	core_lgrp->sbus.wr.lsb      = 0;
-	core_lgrp->sbus.wr.result   = rtn;
-	spin_unlock(&core_lgrp->data_lock);
+	sl_core_op_hist_add(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_WR,
+		dev_addr, 0, 0, 0, reg, 0, 0, data, 0xFFFFFFFF, rtn);
+
+	return rtn;
+}
+
+/*
+ * Writes count words to the same register. Uses the platform block write
+ * when it's provided, otherwise falls back to one SBUS op per word.
+ * Only the last word is recorded as the last write.
+ */
+int sbus_wr_blk(struct sl_core_lgrp *core_lgrp, u8 dev_addr, u8 reg, const u32 *data, u32 count)
+{
+	int rtn;
+	u32 x;
+
+	if (count == 0)
+		return 0;
+
+	if (core_lgrp->core_ldev->ops.sbus_wr_blk) {
+		x = count - 1;
+		rtn = sl_core_sbus_wr_blk(core_lgrp, dev_addr, reg, data, count);
+		if (rtn != 0)
+			sl_core_log_err_trace(core_lgrp, LOG_NAME,
+					      "SBUS WR BLK (dev = 0x%02X, reg = 0x%02X, count = %u)",
+					      dev_addr, reg, count);
+	} else {
+		for (x = 0; x < count; ++x) {
+			rtn = sl_core_sbus_wr(core_lgrp, dev_addr, reg, data[x]);
+			if (rtn != 0) {
+				sl_core_log_err_trace(core_lgrp, LOG_NAME,
+						      "SBUS WR BLK (dev = 0x%02X, reg = 0x%02X, word = %u, data = 0x%08X)",
+						      dev_addr, reg, x, data[x]);
+				break;
+			}
+		}
+		if (x == count)
+			x = count - 1;
+	}
+
+	sl_core_op_hist_add(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_WR,
+		dev_addr, 0, 0, 0, reg, 0, 0, data[x], 0xFFFFFFFF, rtn);
 
 	return rtn;
 }
@@ -52,14 +86,8 @@ int sbus_field_wr(struct sl_core_lgrp *core_lgrp, u8 dev_addr, u8 reg, u8 lsb, u
 				      dev_addr, reg, lsb, data32);
 
 out:
-	spin_lock(&core_lgrp->data_lock);
-	core_lgrp->sbus.wr.dev_addr = dev_addr;
-	core_lgrp->sbus.wr.data     = data;
-	core_lgrp->sbus.wr.mask     = mask;
-	core_lgrp->sbus.wr.reg      = reg;
-	core_lgrp->sbus.wr.lsb      = lsb;
-	core_lgrp->sbus.wr.result   = rtn;
-	spin_unlock(&core_lgrp->data_lock);
+	sl_core_op_hist_add(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_WR,
+		dev_addr, 0, 0, 0, reg, lsb, 0, data, mask, rtn);
 
 	return rtn;
 }
@@ -72,14 +100,8 @@ int sbus_rd(struct sl_core_lgrp *core_lgrp, u8 dev_addr, u8 reg, u32 *data)
 	if (rtn != 0)
 		sl_core_log_err_trace(core_lgrp, LOG_NAME, "SBUS RD (dev = 0x%02X, reg = 0x%02X)", dev_addr, reg);
 
-	spin_lock(&core_lgrp->data_lock);
-	core_lgrp->sbus.rd.dev_addr =  dev_addr;
-	core_lgrp->sbus.rd.data     = *data;
-	core_lgrp->sbus.rd.mask     =  0xFFFFFFFF;
-	core_lgrp->sbus.rd.reg      =  reg;
-	core_lgrp->sbus.rd.lsb      =  0;
-	core_lgrp->sbus.rd.result   =  rtn;
-	spin_unlock(&core_lgrp->data_lock);
+	sl_core_op_hist_add(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_RD,
+		dev_addr, 0, 0, 0, reg, 0, 0, *data, 0xFFFFFFFF, rtn);
 
 	return rtn;
 }
@@ -96,14 +118,8 @@ int sbus_field_rd(struct sl_core_lgrp *core_lgrp, u8 dev_addr, u8 reg, u8 lsb, u
 
 	*data = ((data32 >> lsb) & mask);
 
-	spin_lock(&core_lgrp->data_lock);
-	core_lgrp->sbus.rd.dev_addr =  dev_addr;
-	core_lgrp->sbus.rd.data     = *data;
-	core_lgrp->sbus.rd.mask     =  mask;
-	core_lgrp->sbus.rd.reg      =  reg;
-	core_lgrp->sbus.rd.lsb      =  lsb;
-	core_lgrp->sbus.rd.result   =  rtn;
-	spin_unlock(&core_lgrp->data_lock);
+	sl_core_op_hist_add(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_RD,
+		dev_addr, 0, 0, 0, reg, lsb, 0, *data, mask, rtn);
 
 	return rtn;
 }
@@ -116,10 +132,8 @@ int sbus_rst(struct sl_core_lgrp *core_lgrp, u8 dev_addr)
 	if (rtn != 0)
 		sl_core_log_err_trace(core_lgrp, LOG_NAME, "SBUS RST (dev = 0x%02X)", dev_addr);
 
-	spin_lock(&core_lgrp->data_lock);
-	core_lgrp->sbus.rst.dev_addr = dev_addr;
-	core_lgrp->sbus.rst.result   = rtn;
-	spin_unlock(&core_lgrp->data_lock);
+	sl_core_op_hist_add(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_RST,
+		dev_addr, 0, 0, 0, 0, 0, 0, 0, 0, rtn);
 
 	return rtn;
 }
@@ -11,6 +11,13 @@
 			goto out;                                     \
 	} while (0)
 
+#define SL_CORE_HW_SBUS_WR_BLK(_lgrp, _dev_addr, _reg, _data, _count)               \
+	do {                                                                        \
+		rtn = sbus_wr_blk((_lgrp), (_dev_addr), (_reg), (_data), (_count)); \
+		if (rtn != 0)                                                       \
+			goto out;                                                   \
+	} while (0)
+
 #define SL_CORE_HW_SBUS_FIELD_WR(_lgrp, _dev_addr, _reg, _data, _lsb, _mask)                 \
 	do {                                                                                 \
 		rtn = sbus_field_wr((_lgrp), (_dev_addr), (_reg), (_lsb), (_mask), (_data)); \
@@ -44,6 +51,7 @@
 struct sl_core_lgrp;
 
 int sbus_wr(struct sl_core_lgrp *core_lgrp, u8 dev_addr, u8 reg, u32 data);
+int sbus_wr_blk(struct sl_core_lgrp *core_lgrp, u8 dev_addr, u8 reg, const u32 *data, u32 count);
 int sbus_field_wr(struct sl_core_lgrp *core_lgrp, u8 dev_addr, u8 reg, u8 lsb, u32 mask, u32 data);
 int sbus_rd(struct sl_core_lgrp *core_lgrp, u8 dev_addr, u8 reg, u32 *data);
 int sbus_field_rd(struct sl_core_lgrp *core_lgrp, u8 dev_addr, u8 reg, u8 lsb, u32 mask, u32 *data);
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 #include <linux/umh.h>
@@ -51,20 +51,9 @@ int sbus_pmi_rd(struct sl_core_lgrp *core_lgrp, u8 dev_addr, u8 dev_id, u8 lane,
 
 	*data = (u16)data32 & mask;
 
-	sl_core_log_dbg(core_lgrp, LOG_NAME, "SBUS PMI RD (dev = 0x%02X, addr = 0x%08X, data = 0x%08X)",
-			dev_addr, addr32, *data);
-
 out:
-	spin_lock(&core_lgrp->data_lock);
-	core_lgrp->sbus_pmi.rd.dev_addr =  dev_addr;
-	core_lgrp->sbus_pmi.rd.addr     =  addr;
-	core_lgrp->sbus_pmi.rd.data     = *data;
-	core_lgrp->sbus_pmi.rd.mask     =  mask;
-	core_lgrp->sbus_pmi.rd.dev_id   =  dev_id;
-	core_lgrp->sbus_pmi.rd.lane     =  lane;
-	core_lgrp->sbus_pmi.rd.pll      =  pll;
-	core_lgrp->sbus_pmi.rd.result   =  rtn;
-	spin_unlock(&core_lgrp->data_lock);
+	sl_core_op_hist_add(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_RD,
+		dev_addr, dev_id, lane, pll, 0, 0, addr, *data, mask, rtn);
 
 	return rtn;
 }
@@ -79,9 +68,6 @@ int sbus_pmi_wr(struct sl_core_lgrp *core_lgrp, u8 dev_addr, u8 dev_id, u8 lane,
 	addr32 = PMI_ADDR32(dev_id, pll, lane, addr);
 	data32 = (~mask & 0xFFFF) | (data << 16);
 
-	sl_core_log_dbg(core_lgrp, LOG_NAME, "SBUS PMI WR (dev = 0x%02X, addr = 0x%08X, data = 0x%08X)",
-			dev_addr, addr32, data32);
-
 	rtn = sl_core_sbus_wr(core_lgrp, dev_addr, SL_CORE_HW_SBUS_PMI_ADDR_REG, addr32); /* PMI_ADDR */
 	if (rtn) {
 		sl_core_log_err_trace(core_lgrp, LOG_NAME,
@@ -97,16 +83,8 @@ int sbus_pmi_wr(struct sl_core_lgrp *core_lgrp, u8 dev_addr, u8 dev_id, u8 lane,
 				      dev_addr, dev_id, addr, data, mask);
 
 out:
-	spin_lock(&core_lgrp->data_lock);
-	core_lgrp->sbus_pmi.wr.dev_addr = dev_addr;
-	core_lgrp->sbus_pmi.wr.addr     = addr;
-	core_lgrp->sbus_pmi.wr.data     = data;
-	core_lgrp->sbus_pmi.wr.mask     = mask;
-	core_lgrp->sbus_pmi.wr.dev_id   = dev_id;
-	core_lgrp->sbus_pmi.wr.lane     = lane;
-	core_lgrp->sbus_pmi.wr.pll      = pll;
-	core_lgrp->sbus_pmi.wr.result   = rtn;
-	spin_unlock(&core_lgrp->data_lock);
+	sl_core_op_hist_add(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_WR,
+		dev_addr, dev_id, lane, pll, 0, 0, addr, data, mask, rtn);
 
 	return rtn;
 }
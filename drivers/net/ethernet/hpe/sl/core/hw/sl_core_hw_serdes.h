@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2022,2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2022,2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_CORE_HW_SERDES_H_
 #define _SL_CORE_HW_SERDES_H_
@@ -13,6 +13,17 @@ struct sl_core_lgrp;
 
 #define LGRP_TO_SERDES(_lgrp_num) ((_lgrp_num) >> 1)
 
+enum sl_core_hw_serdes_lanes_up_phase {
+	SL_CORE_HW_SERDES_LANES_UP_PHASE_START = 0,
+	SL_CORE_HW_SERDES_LANES_UP_PHASE_CLOCK_ALIGN,
+	SL_CORE_HW_SERDES_LANES_UP_PHASE_TX_CHECK,
+	SL_CORE_HW_SERDES_LANES_UP_PHASE_SETTLE,
+	SL_CORE_HW_SERDES_LANES_UP_PHASE_RX_CHECK,
+	SL_CORE_HW_SERDES_LANES_UP_PHASE_QUALITY_CHECK,
+
+	SL_CORE_HW_SERDES_LANES_UP_PHASE_COUNT      /* must be last */
+};
+
 int  sl_core_hw_serdes_init(struct sl_core_lgrp *core_lgrp);
 int  sl_core_hw_serdes_swizzles(struct sl_core_lgrp *core_lgrp);
 int  sl_core_hw_serdes_hw_info_get(struct sl_core_lgrp *core_lgrp);
@@ -1,8 +1,9 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 #include <linux/delay.h>
+#include <linux/ktime.h>
 
 #include "sl_asic.h"
 #include "sl_core_ldev.h"
@@ -16,14 +17,110 @@
 #include "hw/sl_core_hw_serdes_lane.h"
 #include "hw/sl_core_hw_serdes_core.h"
 #include "hw/sl_core_hw_serdes_addrs.h"
+#include "data/sl_core_data_lgrp.h"
+#include "sl_core_str.h"
 
 #define LOG_NAME SL_CORE_SERDES_LOG_NAME
 
-#define SL_HW_SERDES_WAIT_UC_ACTIVE_TRIES 10
-static int sl_core_hw_serdes_core_proc_reset(struct sl_core_lgrp *core_lgrp)
+/*
+ * Settle polling. The first poll is short and the wait between polls doubles
+ * up to SL_CORE_HW_SERDES_CORE_POLL_MAX_US until the step is ready or its
+ * budget runs out. The budgets are the old fixed worst case waits.
+ */
+#define SL_CORE_HW_SERDES_CORE_POLL_FIRST_US         20
+#define SL_CORE_HW_SERDES_CORE_POLL_MAX_US           1000
+#define SL_CORE_HW_SERDES_CORE_UC_ACTIVE_BUDGET_US   20000
+#define SL_CORE_HW_SERDES_CORE_CLOCK_INIT_BUDGET_US  10000
+#define SL_CORE_HW_SERDES_CORE_PLL_LOCK_BUDGET_US    10000
+
+typedef int (*sl_core_hw_serdes_core_is_ready_t)(struct sl_core_lgrp *core_lgrp, bool *is_ready);
+
+static int sl_core_hw_serdes_core_settle(struct sl_core_lgrp *core_lgrp, u32 step, u32 budget_us,
+					 sl_core_hw_serdes_core_is_ready_t is_ready_fn)
+{
+	int     rtn;
+	ktime_t start;
+	s64     elapsed_us;
+	u32     wait_us;
+	u32     polls;
+	bool    is_ready;
+
+	start    = ktime_get();
+	wait_us  = SL_CORE_HW_SERDES_CORE_POLL_FIRST_US;
+	polls    = 0;
+	is_ready = false;
+
+	for (;;) {
+		usleep_range(wait_us, wait_us + (wait_us / 2));
+		polls++;
+
+		rtn = is_ready_fn(core_lgrp, &is_ready);
+		if (rtn) {
+			sl_core_log_err_trace(core_lgrp, LOG_NAME, "settle %s is_ready failed [%d]",
+					      sl_core_serdes_settle_step_str(step), rtn);
+			return rtn;
+		}
+
+		elapsed_us = ktime_us_delta(ktime_get(), start);
+		if (is_ready || (elapsed_us >= budget_us))
+			break;
+
+		wait_us = min_t(u32, wait_us * 2, SL_CORE_HW_SERDES_CORE_POLL_MAX_US);
+	}
+
+	sl_core_data_lgrp_serdes_settle_add(core_lgrp, step, elapsed_us, polls, !is_ready);
+
+	sl_core_log_dbg(core_lgrp, LOG_NAME, "settle %s (is_ready = %d, time = %lldus, polls = %u)",
+			sl_core_serdes_settle_step_str(step), is_ready, elapsed_us, polls);
+
+	return is_ready ? 0 : -ETIMEDOUT;
+}
+
+static int sl_core_hw_serdes_core_uc_is_active(struct sl_core_lgrp *core_lgrp, bool *is_ready)
+{
+	int  rtn;
+	u16  data16;
+	u16 *addrs;
+
+	addrs     = core_lgrp->core_ldev->serdes.addrs;
+	*is_ready = false;
+
+	SL_CORE_HW_PMI_RD(core_lgrp, core_lgrp->serdes.dt.dev_id, 0xFF, 0,
+		addrs[SERDES_DIG_COM_RESET_CONTROL_PMD], &data16); /* all micros init */
+	sl_core_log_dbg(core_lgrp, LOG_NAME, "micro init D101 = 0x%X", data16);
+	if ((data16 & 0x0002) == 0)
+		goto done;
+	SL_CORE_HW_PMI_RD(core_lgrp, core_lgrp->serdes.dt.dev_id, 0xFF, 0,
+		addrs[SERDES_MICRO_B_COM_RMI_MICRO_SDK_STATUS0], &data16); /* micro status */
+	sl_core_log_dbg(core_lgrp, LOG_NAME, "micro status D21A = 0x%X", data16);
+	if ((data16 & 0x000F) != SL_SERDES_ACTIVE_MICROS)
+		goto done;
+
+	*is_ready = true;
+done:
+	rtn = 0;
+out:
+	return rtn;
+}
+
+static int sl_core_hw_serdes_core_pll_is_locked(struct sl_core_lgrp *core_lgrp, bool *is_ready)
 {
 	int  rtn;
 	u16  data16;
+
+	SL_CORE_HW_PMI_RD(core_lgrp, core_lgrp->serdes.dt.dev_id, 0xFF, 0,
+		core_lgrp->core_ldev->serdes.addrs[SERDES_PLL_CAL_COM_STS_0], &data16);
+
+	*is_ready = ((data16 & 0x0200) != 0); /* PLL lock status */
+
+	rtn = 0;
+out:
+	return rtn;
+}
+
+static int sl_core_hw_serdes_core_proc_reset(struct sl_core_lgrp *core_lgrp)
+{
+	int  rtn;
 	u8   x;
 	u16 *addrs;
 
@@ -98,28 +195,18 @@ static int sl_core_hw_serdes_core_proc_reset(struct sl_core_lgrp *core_lgrp)
 			addrs[SERDES_MICRO_E_COM_MICRO_CORE_RESET_CONTROL0], 0x0001, 0x0001); /* clear micro reset */
 	}
 
-	for (x = 0; x < SL_HW_SERDES_WAIT_UC_ACTIVE_TRIES; ++x) {
-		usleep_range(1000, 2000);
-		SL_CORE_HW_PMI_RD(core_lgrp, core_lgrp->serdes.dt.dev_id, 0xFF, 0,
-			addrs[SERDES_DIG_COM_RESET_CONTROL_PMD], &data16); /* all micros init */
-		sl_core_log_dbg(core_lgrp, LOG_NAME, "micro init D101 = 0x%X", data16);
-		if ((data16 & 0x0002) == 0)
-			continue;
-		SL_CORE_HW_PMI_RD(core_lgrp, core_lgrp->serdes.dt.dev_id, 0xFF, 0,
-			addrs[SERDES_MICRO_B_COM_RMI_MICRO_SDK_STATUS0], &data16); /* micro status */
-		sl_core_log_dbg(core_lgrp, LOG_NAME, "micro status D21A = 0x%X", data16);
-		if ((data16 & 0x000F) != SL_SERDES_ACTIVE_MICROS)
-			continue;
-		break;
-	}
-	if (x >= SL_HW_SERDES_WAIT_UC_ACTIVE_TRIES) {
+	rtn = sl_core_hw_serdes_core_settle(core_lgrp, SL_CORE_SERDES_SETTLE_UC_ACTIVE,
+		SL_CORE_HW_SERDES_CORE_UC_ACTIVE_BUDGET_US, sl_core_hw_serdes_core_uc_is_active);
+	if (rtn == -ETIMEDOUT) {
 		sl_core_log_err(core_lgrp, LOG_NAME, "uc active failed");
 		rtn = -EIO;
 		goto out;
 	}
+	if (rtn)
+		goto out;
 	sl_core_log_dbg(core_lgrp, LOG_NAME, "uc active");
 
-	SL_CORE_HW_PMI_WR(core_lgrp, core_lgrp->serdes.dt.dev_id, 0xFF, x,
+	SL_CORE_HW_PMI_WR(core_lgrp, core_lgrp->serdes.dt.dev_id, 0xFF, 0,
 		addrs[SERDES_DIG_COM_TOP_USER_CONTROL_0], 0x04E2, 0xFFF); /* set heartbeat_count */
 
 	rtn = 0;
@@ -231,7 +318,13 @@ static int sl_core_hw_serdes_core_clock_init(struct sl_core_lgrp *core_lgrp)
 	SL_CORE_HW_PMI_WR(core_lgrp, core_lgrp->serdes.dt.dev_id, 0xFF, 0,
 		addrs[SERDES_CORE_PLL_COM_TOP_USER_CONTROL], 0x2000, 0x2000); /* clear PLL reset */
 
-	usleep_range(5000, 10000);
+	/* lock is checked when the PLL is set for a link, here it only ends the wait early */
+	rtn = sl_core_hw_serdes_core_settle(core_lgrp, SL_CORE_SERDES_SETTLE_CLOCK_INIT,
+		SL_CORE_HW_SERDES_CORE_CLOCK_INIT_BUDGET_US, sl_core_hw_serdes_core_pll_is_locked);
+	if (rtn == -ETIMEDOUT)
+		sl_core_log_dbg(core_lgrp, LOG_NAME, "clock init settle timeout");
+	else if (rtn)
+		goto out;
 
 	rtn = 0;
 out:
@@ -414,7 +507,13 @@ int sl_core_hw_serdes_core_pll(struct sl_core_lgrp *core_lgrp, u16 clocking, u16
 	SL_CORE_HW_PMI_WR(core_lgrp, core_lgrp->serdes.dt.dev_id, 0xFF, 0,
 		addrs[SERDES_CORE_PLL_COM_TOP_USER_CONTROL], 0x2000, 0x2000); /* clear PLL reset */
 
-	usleep_range(5000, 10000);
+	/* a timeout is reported by the check */
+	rtn = sl_core_hw_serdes_core_settle(core_lgrp, SL_CORE_SERDES_SETTLE_PLL_LOCK,
+		SL_CORE_HW_SERDES_CORE_PLL_LOCK_BUDGET_US, sl_core_hw_serdes_core_pll_is_locked);
+	if (rtn && (rtn != -ETIMEDOUT)) {
+		sl_core_log_err_trace(core_lgrp, LOG_NAME, "core_settle failed [%d]", rtn);
+		goto out;
+	}
 
 	rtn = sl_core_hw_serdes_core_pll_check(core_lgrp);
 	if (rtn) {
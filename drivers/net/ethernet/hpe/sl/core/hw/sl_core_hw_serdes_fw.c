@@ -1,16 +1,17 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 #include <linux/umh.h>
 #include <linux/delay.h>
-#include <linux/firmware.h>
+#include <linux/slab.h>
 
 #include "sl_asic.h"
 #include "sl_platform.h"
 #include "sl_core_ldev.h"
 #include "sl_core_lgrp.h"
 #include "base/sl_core_log.h"
+#include "base/sl_core_serdes_fw_cache.h"
 #include "hw/sl_core_hw_pmi.h"
 #include "hw/sl_core_hw_sbus.h"
 #include "hw/sl_core_hw_sbus_pmi.h"
@@ -125,30 +126,52 @@ out:
 	return rtn;
 }
 
+#define SL_HW_SERDES_FW_WR_BLK_WORDS 1024
 int sl_core_hw_serdes_fw_write(struct sl_core_lgrp *core_lgrp)
 {
-	int                    rtn;
-	u32                    x;
-	u32                    data32;
-	const struct firmware *fw;
+	int                                   rtn;
+	u32                                   x;
+	u32                                   offset;
+	u32                                   num_words;
+	u32                                   blk_words;
+	u32                                  *blk;
+	const struct sl_core_serdes_fw_image *fw;
 
-	fw = core_lgrp->core_ldev->serdes.fw;
+	fw = core_lgrp->core_ldev->serdes.fw_image;
 
 	if (!SL_PLATFORM_IS_HARDWARE(core_lgrp->core_ldev))
 		return 0;
 
 	sl_core_log_dbg(core_lgrp, LOG_NAME, "fw write (size = %lu bytes)", fw->size);
 
-	for (x = 0; x < fw->size; x += 4) {
-		data32 = (fw->data[x] |
-			(fw->data[x+1] << 8) |
-			(fw->data[x+2] << 16) |
-			(fw->data[x+3] << 24));
-		SL_CORE_HW_SBUS_WR(core_lgrp, 0xFA, 10, data32);
+	if (fw->size & 0x3) {
+		sl_core_log_err(core_lgrp, LOG_NAME,
+			"fw write size not word aligned (size = %lu bytes)", fw->size);
+		return -EINVAL;
+	}
+
+	blk = kmalloc_array(SL_HW_SERDES_FW_WR_BLK_WORDS, sizeof(u32), GFP_KERNEL);
+	if (!blk)
+		return -ENOMEM;
+
+	offset    = 0;
+	num_words = fw->size >> 2;
+
+	while (num_words) {
+		blk_words = min_t(u32, num_words, SL_HW_SERDES_FW_WR_BLK_WORDS);
+		for (x = 0; x < blk_words; ++x, offset += 4)
+			blk[x] = (fw->data[offset] |
+				(fw->data[offset+1] << 8) |
+				(fw->data[offset+2] << 16) |
+				(fw->data[offset+3] << 24));
+		SL_CORE_HW_SBUS_WR_BLK(core_lgrp, SBUS_BROADCAST_ADDR, 10, blk, blk_words);
+		num_words -= blk_words;
 	}
 
 	rtn = 0;
 out:
+	kfree(blk);
+
 	return rtn;
 }
 
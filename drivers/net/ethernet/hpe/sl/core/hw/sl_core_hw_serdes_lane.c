@@ -3,6 +3,7 @@
 
 #include <linux/types.h>
 #include <linux/delay.h>
+#include <linux/ktime.h>
 
 #include "sl_core_lgrp.h"
 #include "sl_core_link.h"
@@ -425,225 +426,243 @@ out:
 }
 #endif
 
-#define LANE_UP_TX_CHECK_NUM_TRIES 10
-#define LANE_UP_TX_DATA_VALID_BIT  BIT(20)
-#define LANE_UP_TX_CLOCK_VALID_BIT BIT(16)
-#define LANE_UP_TX_CHECK_BITS      (LANE_UP_TX_DATA_VALID_BIT | \
-				    LANE_UP_TX_CLOCK_VALID_BIT)
-static int sl_core_hw_serdes_lane_up_tx_check(struct sl_core_link *core_link, u8 serdes_lane_num)
-{
-	int                  rtn;
-	bool                 is_canceled_or_timed_out;
-	u8                   x;
-	u32                  port;
-	u64                  status;
-	u8                   asic_lane_num;
-	struct sl_core_lgrp *core_lgrp;
+/*
+ * Lane checks poll every lane of the link that is still pending on each pass.
+ * The interval starts short and doubles up to the old fixed per-try sleep, so
+ * lanes that settle quickly are seen quickly and slow lanes are not polled
+ * harder than before. The timeout is the old per-lane budget. A check whose
+ * status can be read before it is valid passes a longer first interval.
+ */
+#define LANE_UP_POLL_INTERVAL_MIN_MS 5
 
-	core_lgrp     = core_link->core_lgrp;
-	port          = core_lgrp->num;
-	asic_lane_num = sl_core_hw_serdes_tx_asic_lane_num_get(core_link, serdes_lane_num);
+typedef int (*sl_core_hw_serdes_lane_check_t)(struct sl_core_link *core_link, u8 serdes_lane_num, bool *is_done);
 
-	sl_core_log_dbg(core_lgrp, LOG_NAME,
-		"lane up tx check (port = %u, serdes_lane_num = %u, asic_lane_num = %u)",
-		port, serdes_lane_num, asic_lane_num);
+static int sl_core_hw_serdes_lanes_poll(struct sl_core_link *core_link, unsigned long *lane_map,
+					sl_core_hw_serdes_lane_check_t check, u32 interval_min_ms,
+					u32 interval_max_ms, u32 timeout_ms)
+{
+	int           rtn;
+	bool          is_canceled_or_timed_out;
+	bool          is_done;
+	u8            serdes_lane_num;
+	u32           interval_ms;
+	unsigned long timeout;
 
-	sl_core_hw_serdes_tx_lane_state_set(core_lgrp,
-		asic_lane_num, SL_CORE_HW_SERDES_LANE_STATE_CHECK);
+	interval_ms = interval_min_ms;
+	timeout     = jiffies + msecs_to_jiffies(timeout_ms);
 
-	for (x = 0; x < LANE_UP_TX_CHECK_NUM_TRIES; ++x) {
+	while (*lane_map) {
 		rtn = sl_core_link_is_canceled_or_timed_out(core_link, &is_canceled_or_timed_out);
 		if (rtn) {
-			sl_core_log_err_trace(core_lgrp, LOG_NAME,
-					      "lane up tx check - is_canceled_or_timed_out failed [%d]", rtn);
+			sl_core_log_err_trace(core_link, LOG_NAME,
+				"lanes poll - is_canceled_or_timed_out failed [%d]", rtn);
 			return rtn;
 		}
 
 		if (is_canceled_or_timed_out) {
-			sl_core_log_dbg(core_link, LOG_NAME, "lane up tx check canceled");
+			sl_core_log_dbg(core_link, LOG_NAME, "lanes poll canceled");
 			return -ECANCELED;
 		}
-		msleep(100);
-		sl_core_lgrp_read64(core_lgrp, SS2_PORT_PML_STS_SERDES(asic_lane_num), &status);
-		sl_core_log_dbg(core_lgrp, LOG_NAME,
-			"lane up tx check (asic_lane_num = %u, status = 0x%llX)", asic_lane_num, status);
-		if ((status & LANE_UP_TX_CHECK_BITS) == LANE_UP_TX_CHECK_BITS)
-			return 0;
+
+		usleep_range(interval_ms * USEC_PER_MSEC, (interval_ms + 1) * USEC_PER_MSEC);
+
+		for_each_set_bit(serdes_lane_num, lane_map, SL_MAX_SERDES_LANES) {
+			rtn = check(core_link, serdes_lane_num, &is_done);
+			if (rtn)
+				return rtn;
+			if (is_done)
+				clear_bit(serdes_lane_num, lane_map);
+		}
+
+		if (*lane_map && time_after(jiffies, timeout))
+			return -EIO;
+
+		interval_ms = min(interval_ms * 2, interval_max_ms);
 	}
 
-	sl_core_log_err_trace(core_lgrp, LOG_NAME,
-		"lane up tx check fail (lane = %u, status = 0x%llX)", asic_lane_num, status);
-	return -EIO;
+	return 0;
+}
+
+#define LANE_UP_TX_CHECK_INTERVAL_MS 100
+#define LANE_UP_TX_CHECK_TIMEOUT_MS  1000
+#define LANE_UP_TX_DATA_VALID_BIT    BIT(20)
+#define LANE_UP_TX_CLOCK_VALID_BIT   BIT(16)
+#define LANE_UP_TX_CHECK_BITS        (LANE_UP_TX_DATA_VALID_BIT | \
+				      LANE_UP_TX_CLOCK_VALID_BIT)
+static int sl_core_hw_serdes_lane_up_tx_check(struct sl_core_link *core_link, u8 serdes_lane_num, bool *is_done)
+{
+	u64 status;
+	u8  asic_lane_num;
+
+	asic_lane_num = sl_core_hw_serdes_tx_asic_lane_num_get(core_link, serdes_lane_num);
+
+	sl_core_lgrp_read64(core_link->core_lgrp, SS2_PORT_PML_STS_SERDES(asic_lane_num), &status);
+	sl_core_log_dbg(core_link, LOG_NAME,
+		"lane up tx check (asic_lane_num = %u, status = 0x%llX)", asic_lane_num, status);
+
+	*is_done = ((status & LANE_UP_TX_CHECK_BITS) == LANE_UP_TX_CHECK_BITS);
+
+	return 0;
 }
 
-#define LANE_UP_RX_CHECK_NUM_TRIES        70
+#define LANE_UP_RX_CHECK_INTERVAL_MS      300
+#define LANE_UP_RX_CHECK_TIMEOUT_MS       21000
 #define LANE_UP_RX_CHECK_DATA_VALID_BIT   BIT(12)
 #define LANE_UP_RX_CHECK_CLOCK_VALID_BIT  BIT(8)
 #define LANE_UP_RX_CHECK_LOCK_BIT         BIT(4)
 #define LANE_UP_RX_CHECK_BITS             (LANE_UP_RX_CHECK_DATA_VALID_BIT  | \
 					   LANE_UP_RX_CHECK_CLOCK_VALID_BIT | \
 					   LANE_UP_RX_CHECK_LOCK_BIT)
-/* wait for 6s for PAM4 and 1.5s for NRZ */
-static int sl_core_hw_serdes_lane_up_rx_check(struct sl_core_link *core_link, u8 serdes_lane_num)
+static int sl_core_hw_serdes_lane_up_rx_check(struct sl_core_link *core_link, u8 serdes_lane_num, bool *is_done)
+{
+	u64 status;
+	u8  asic_lane_num;
+
+	asic_lane_num = sl_core_hw_serdes_rx_asic_lane_num_get(core_link, serdes_lane_num);
+
+	sl_core_lgrp_read64(core_link->core_lgrp, SS2_PORT_PML_STS_SERDES(asic_lane_num), &status);
+	sl_core_log_dbg(core_link, LOG_NAME,
+		"lane up rx check (asic_lane_num = %u, status = 0x%llX)", asic_lane_num, status);
+
+	*is_done = ((status & LANE_UP_RX_CHECK_BITS) == LANE_UP_RX_CHECK_BITS);
+
+	return 0;
+}
+
+static int sl_core_hw_serdes_lane_up_eye_limits_update(struct sl_core_link *core_link, u8 serdes_lane_num)
 {
 	int                  rtn;
-	bool                 is_canceled_or_timed_out;
-	u8                   x;
-	u32                  port;
-	u64                  status;
 	u8                   asic_lane_num;
+	u16                  extended;
+	u64                  data64;
 	struct sl_core_lgrp *core_lgrp;
 
 	core_lgrp     = core_link->core_lgrp;
-	port          = core_lgrp->num;
 	asic_lane_num = sl_core_hw_serdes_rx_asic_lane_num_get(core_link, serdes_lane_num);
 
-	sl_core_log_dbg(core_lgrp, LOG_NAME,
-		"lane up rx check (port = %u, serdes_lane_num = %u, asic_lane_num = %u)",
-		port, serdes_lane_num, asic_lane_num);
-
-	sl_core_hw_serdes_rx_lane_state_set(core_lgrp,
-		asic_lane_num, SL_CORE_HW_SERDES_LANE_STATE_CHECK);
+	/* if link training decides extended reach, then modify eye limits */
+	if (!is_flag_set(core_lgrp->link_caps[core_link->num].hpe_map, SL_LINK_CONFIG_HPE_LINKTRAIN))
+		return 0;
 
-	for (x = 0; x < LANE_UP_RX_CHECK_NUM_TRIES; ++x) {
-		rtn = sl_core_link_is_canceled_or_timed_out(core_link, &is_canceled_or_timed_out);
-		if (rtn) {
-			sl_core_log_err_trace(core_lgrp, LOG_NAME,
-					      "lane up rx check - is_canceled_or_timed_out failed [%d]", rtn);
-			return rtn;
-		}
+	sl_core_lgrp_read64(core_lgrp, SS2_PORT_PML_CFG_SERDES_TX(asic_lane_num), &data64);
+	if (!(SS2_PORT_PML_CFG_SERDES_TX_PMD_TX_OSR_MODE_GET(data64) & 0x40))
+		return 0;
 
-		if (is_canceled_or_timed_out) {
-			sl_core_log_dbg(core_link, LOG_NAME, "lane up rx check canceled");
-			return -ECANCELED;
+	SL_CORE_HW_PMI_RD(core_lgrp, core_lgrp->serdes.dt.dev_id, serdes_lane_num, 0,
+		core_lgrp->core_ldev->serdes.addrs[SERDES_CDR_CONTROL_0], &extended);
+	sl_core_log_dbg(core_lgrp, LOG_NAME,
+		"extended get (serdes_lane_num = %u, extended = 0x%X)",
+		serdes_lane_num, (extended & 0x8000));
+	if (extended & 0x8000) {
+		sl_core_log_dbg(core_lgrp, LOG_NAME, "lane up quality check extended reach");
+		core_lgrp->serdes.eye_limits[asic_lane_num].low  = 5;
+		core_lgrp->serdes.eye_limits[asic_lane_num].high = 30;
+		if (core_link->pcs.settings.pcs_mode == SL_CORE_HW_PCS_MODE_BJ_100G) {
+			core_lgrp->serdes.eye_limits[asic_lane_num].low  = 25;
+			core_lgrp->serdes.eye_limits[asic_lane_num].high = 150;
 		}
-		msleep(300);
-		sl_core_lgrp_read64(core_lgrp, SS2_PORT_PML_STS_SERDES(asic_lane_num), &status);
-		sl_core_log_dbg(core_lgrp, LOG_NAME,
-			"lane up rx check (asic_lane_num = %u, status = 0x%llX)", asic_lane_num, status);
-		if ((status & LANE_UP_RX_CHECK_BITS) == LANE_UP_RX_CHECK_BITS)
-			return 0;
 	}
 
-	sl_core_log_err_trace(core_lgrp, LOG_NAME,
-		"lane up rx check fail (asic_lane_num = %u, status = 0x%llX)", asic_lane_num, status);
-	return -EIO;
+	return 0;
+out:
+	sl_core_log_err_trace(core_lgrp, LOG_NAME, "eye limits update pmi_rd failed [%d]", rtn);
+	return rtn;
 }
 
-#define LANE_UP_QUALITY_CHECK_NUM_TRIES 20
-static int sl_core_hw_serdes_lane_up_quality_check(struct sl_core_link *core_link, u8 serdes_lane_num)
+static int sl_core_hw_serdes_lane_up_eye_check(struct sl_core_link *core_link, u8 serdes_lane_num,
+					       u32 addr_offset, const char *eye_name, bool *is_done)
 {
 	int                  rtn;
-	u8                   x;
-	u32                  port;
 	u8                   asic_lane_num;
-	u32                  addr;
-	u8                   eye_upper;
-	u8                   eye_lower;
-	u16                  data16;
+	u8                   eye;
 	struct sl_core_lgrp *core_lgrp;
-	u16                  extended;
-	u64                  data64;
-	bool                 is_canceled_or_timed_out;
 
 	core_lgrp     = core_link->core_lgrp;
-	port          = core_lgrp->num;
 	asic_lane_num = sl_core_hw_serdes_rx_asic_lane_num_get(core_link, serdes_lane_num);
 
+	SL_CORE_HW_UC_RAM_RD8(core_lgrp, core_lgrp->serdes.dt.dev_addr, core_lgrp->serdes.dt.dev_id,
+		serdes_lane_num, SL_CORE_HW_SERDES_LANE_ADDR(addr_offset, serdes_lane_num, core_lgrp), &eye);
 	sl_core_log_dbg(core_lgrp, LOG_NAME,
-		"lane up quality check (port = %u, serdes_lane_num = %u, asic_lane_num = %u)",
-		port, serdes_lane_num, asic_lane_num);
+		"lane up quality check (serdes_lane_num = %u, asic_lane_num = %u, %s = %u, low = %u, high = %u)",
+		serdes_lane_num, asic_lane_num, eye_name, eye,
+		core_lgrp->serdes.eye_limits[asic_lane_num].low,
+		core_lgrp->serdes.eye_limits[asic_lane_num].high);
 
-	/* if link training decides extended reach, then modify eye limits */
-	if (is_flag_set(core_link->core_lgrp->link_caps[core_link->num].hpe_map, SL_LINK_CONFIG_HPE_LINKTRAIN)) {
-		sl_core_lgrp_read64(core_lgrp, SS2_PORT_PML_CFG_SERDES_TX(asic_lane_num), &data64);
-		if (SS2_PORT_PML_CFG_SERDES_TX_PMD_TX_OSR_MODE_GET(data64) & 0x40) {
-			SL_CORE_HW_PMI_RD(core_lgrp, core_lgrp->serdes.dt.dev_id, serdes_lane_num, 0,
-				core_lgrp->core_ldev->serdes.addrs[SERDES_CDR_CONTROL_0], &extended);
-			sl_core_log_dbg(core_lgrp, LOG_NAME,
-				"extended get (serdes_lane_num = %u, extended = 0x%X)",
-				serdes_lane_num, (extended & 0x8000));
-			if (extended & 0x8000) {
-				sl_core_log_dbg(core_lgrp, LOG_NAME, "lane up quality check extended reach");
-				core_link->core_lgrp->serdes.eye_limits[asic_lane_num].low  = 5;
-				core_link->core_lgrp->serdes.eye_limits[asic_lane_num].high = 30;
-				if (core_link->pcs.settings.pcs_mode == SL_CORE_HW_PCS_MODE_BJ_100G) {
-					core_link->core_lgrp->serdes.eye_limits[asic_lane_num].low  = 25;
-					core_link->core_lgrp->serdes.eye_limits[asic_lane_num].high = 150;
-				}
-			}
-		}
-	}
+	*is_done = ((eye > core_lgrp->serdes.eye_limits[asic_lane_num].low) &&
+		(eye < core_lgrp->serdes.eye_limits[asic_lane_num].high));
 
-	addr = SL_CORE_HW_SERDES_LANE_ADDR(0x7, serdes_lane_num, core_lgrp);
+	return 0;
+out:
+	return rtn;
+}
 
-	for (x = 0; x < LANE_UP_QUALITY_CHECK_NUM_TRIES; ++x) {
-		rtn = sl_core_link_is_canceled_or_timed_out(core_link, &is_canceled_or_timed_out);
-		if (rtn) {
-			sl_core_log_err_trace(core_lgrp, LOG_NAME,
-					      "lane up quality check - is_canceled_or_timed_out failed [%d]", rtn);
-			return rtn;
-		}
+static int sl_core_hw_serdes_lane_up_eye_upper_check(struct sl_core_link *core_link, u8 serdes_lane_num,
+						     bool *is_done)
+{
+	return sl_core_hw_serdes_lane_up_eye_check(core_link, serdes_lane_num, 0x7, "eye_upper", is_done);
+}
 
-		if (is_canceled_or_timed_out) {
-			sl_core_log_dbg(core_lgrp, LOG_NAME, "lane up quality check canceled");
-			return -ECANCELED;
-		}
-		msleep(200);
-		SL_CORE_HW_UC_RAM_RD8(core_lgrp, core_lgrp->serdes.dt.dev_addr, core_lgrp->serdes.dt.dev_id,
-			serdes_lane_num, addr, &eye_upper);
-		sl_core_log_dbg(core_lgrp, LOG_NAME,
-			"lane up quality check (serdes_lane_num = %u, asic_lane_num = %u, eye_upper = %u, low = %u, high = %u)",
-			serdes_lane_num, asic_lane_num, eye_upper,
-			core_lgrp->serdes.eye_limits[asic_lane_num].low,
-			core_lgrp->serdes.eye_limits[asic_lane_num].high);
-		if ((eye_upper > core_lgrp->serdes.eye_limits[asic_lane_num].low) &&
-			(eye_upper < core_lgrp->serdes.eye_limits[asic_lane_num].high))
-			break;
-	}
-	if (x >= LANE_UP_QUALITY_CHECK_NUM_TRIES)
-		return -EIO;
+static int sl_core_hw_serdes_lane_up_eye_lower_check(struct sl_core_link *core_link, u8 serdes_lane_num,
+						     bool *is_done)
+{
+	return sl_core_hw_serdes_lane_up_eye_check(core_link, serdes_lane_num, 0x8, "eye_lower", is_done);
+}
 
-	addr = SL_CORE_HW_SERDES_LANE_ADDR(0x8, serdes_lane_num, core_lgrp);
+/*
+ * The eye registers hold the last measurement, which can be from before the
+ * lane locked. There is no status bit for a fresh eye, so the first read waits
+ * the full interval the per-lane check always slept before reading.
+ */
+#define LANE_UP_QUALITY_CHECK_INTERVAL_MS 200
+#define LANE_UP_QUALITY_CHECK_TIMEOUT_MS  4000
+static int sl_core_hw_serdes_lanes_up_quality_check(struct sl_core_link *core_link, unsigned long lane_map)
+{
+	int                  rtn;
+	unsigned long        check_map;
+	u8                   serdes_lane_num;
+	u16                  data16;
+	struct sl_core_lgrp *core_lgrp;
 
-	for (x = 0; x < LANE_UP_QUALITY_CHECK_NUM_TRIES; ++x) {
-		rtn = sl_core_link_is_canceled_or_timed_out(core_link, &is_canceled_or_timed_out);
-		if (rtn) {
-			sl_core_log_err_trace(core_lgrp, LOG_NAME,
-					      "lane up quality check - is_canceled_or_timed_out failed [%d]", rtn);
+	core_lgrp = core_link->core_lgrp;
+
+	sl_core_log_dbg(core_link, LOG_NAME, "lanes up quality check (lane_map = 0x%02lX)", lane_map);
+
+	for_each_set_bit(serdes_lane_num, &lane_map, SL_MAX_SERDES_LANES) {
+		rtn = sl_core_hw_serdes_lane_up_eye_limits_update(core_link, serdes_lane_num);
+		if (rtn)
 			return rtn;
-		}
+	}
 
-		if (is_canceled_or_timed_out) {
-			sl_core_log_dbg(core_lgrp, LOG_NAME, "lane up quality check canceled");
-			return -ECANCELED;
-		}
-		msleep(200);
-		SL_CORE_HW_UC_RAM_RD8(core_lgrp, core_lgrp->serdes.dt.dev_addr, core_lgrp->serdes.dt.dev_id,
-			serdes_lane_num, addr, &eye_lower);
-		sl_core_log_dbg(core_lgrp, LOG_NAME,
-			"lane up quality check (serdes_lane_num = %u, asic_lane_num = %u, eye_lower = %u, low = %u, high = %u)",
-			serdes_lane_num, asic_lane_num, eye_lower,
-			core_lgrp->serdes.eye_limits[asic_lane_num].low,
-			core_lgrp->serdes.eye_limits[asic_lane_num].high);
-		if ((eye_lower > core_lgrp->serdes.eye_limits[asic_lane_num].low) &&
-			(eye_lower < core_lgrp->serdes.eye_limits[asic_lane_num].high))
-			break;
+	check_map = lane_map;
+	rtn = sl_core_hw_serdes_lanes_poll(core_link, &check_map, sl_core_hw_serdes_lane_up_eye_upper_check,
+		LANE_UP_QUALITY_CHECK_INTERVAL_MS, LANE_UP_QUALITY_CHECK_INTERVAL_MS, LANE_UP_QUALITY_CHECK_TIMEOUT_MS);
+	if (rtn) {
+		sl_core_log_err_trace(core_link, LOG_NAME,
+			"lanes up quality check eye upper failed (check_map = 0x%02lX) [%d]", check_map, rtn);
+		return rtn;
 	}
-	if (x >= LANE_UP_QUALITY_CHECK_NUM_TRIES)
-		return -EIO;
 
-	SL_CORE_HW_PMI_RD(core_lgrp, core_lgrp->serdes.dt.dev_id, serdes_lane_num, 0,
-		core_lgrp->core_ldev->serdes.addrs[SERDES_RX_MISC_CONFIG],  &data16);
-	sl_core_log_dbg(core_lgrp, LOG_NAME,
-		"lane up quality check (serdes_lane_num = %u, 0x%X = 0x%X)", serdes_lane_num,
-		 core_lgrp->core_ldev->serdes.addrs[SERDES_RX_MISC_CONFIG], data16);
-	SL_CORE_HW_PMI_RD(core_lgrp, core_lgrp->serdes.dt.dev_id, serdes_lane_num, 0,
-		core_lgrp->core_ldev->serdes.addrs[SERDES_TLB_TX_TLB_TX_PAM4_CONFIG_0],  &data16);
-	sl_core_log_dbg(core_lgrp, LOG_NAME,
-		"lane up quality check (serdes_lane_num = %u, 0x%X = 0x%X)",
-		core_lgrp->core_ldev->serdes.addrs[SERDES_TLB_TX_TLB_TX_PAM4_CONFIG_0],
-		serdes_lane_num, data16);
+	check_map = lane_map;
+	rtn = sl_core_hw_serdes_lanes_poll(core_link, &check_map, sl_core_hw_serdes_lane_up_eye_lower_check,
+		LANE_UP_QUALITY_CHECK_INTERVAL_MS, LANE_UP_QUALITY_CHECK_INTERVAL_MS, LANE_UP_QUALITY_CHECK_TIMEOUT_MS);
+	if (rtn) {
+		sl_core_log_err_trace(core_link, LOG_NAME,
+			"lanes up quality check eye lower failed (check_map = 0x%02lX) [%d]", check_map, rtn);
+		return rtn;
+	}
+
+	for_each_set_bit(serdes_lane_num, &lane_map, SL_MAX_SERDES_LANES) {
+		SL_CORE_HW_PMI_RD(core_lgrp, core_lgrp->serdes.dt.dev_id, serdes_lane_num, 0,
+			core_lgrp->core_ldev->serdes.addrs[SERDES_RX_MISC_CONFIG],  &data16);
+		sl_core_log_dbg(core_lgrp, LOG_NAME,
+			"lane up quality check (serdes_lane_num = %u, 0x%X = 0x%X)", serdes_lane_num,
+			 core_lgrp->core_ldev->serdes.addrs[SERDES_RX_MISC_CONFIG], data16);
+		SL_CORE_HW_PMI_RD(core_lgrp, core_lgrp->serdes.dt.dev_id, serdes_lane_num, 0,
+			core_lgrp->core_ldev->serdes.addrs[SERDES_TLB_TX_TLB_TX_PAM4_CONFIG_0],  &data16);
+		sl_core_log_dbg(core_lgrp, LOG_NAME,
+			"lane up quality check (serdes_lane_num = %u, 0x%X = 0x%X)", serdes_lane_num,
+			core_lgrp->core_ldev->serdes.addrs[SERDES_TLB_TX_TLB_TX_PAM4_CONFIG_0], data16);
+	}
 
 	return 0;
 out:
@@ -669,58 +688,105 @@ static void sl_core_hw_pmd_tx_enable(struct sl_core_link *core_link, u8 serdes_l
 	sl_core_lgrp_flush64(core_link->core_lgrp, SS2_PORT_PML_CFG_SERDES_TX(asic_lane_num));
 }
 
-int sl_core_hw_serdes_lanes_up(struct sl_core_link *core_link, bool is_autoneg)
+/*
+ * Each step runs across all lanes before the next step starts. Per lane
+ * ordering is unchanged.
+ */
+static int sl_core_hw_serdes_lanes_up_start(struct sl_core_link *core_link, unsigned long lane_map,
+					    bool is_autoneg)
 {
-	int           rtn;
-	unsigned long lane_map;
-	u8            serdes_lane_num;
-
-	lane_map = core_link->serdes.lane_map;
-
-	sl_core_log_dbg(core_link, LOG_NAME,
-		"lanes up (lane_map = 0x%02lX, is_autoneg = %d)", lane_map, is_autoneg);
+	int rtn;
+	u8  serdes_lane_num;
 
-	/* start */
 	for_each_set_bit(serdes_lane_num, &lane_map, SL_MAX_SERDES_LANES) {
-		sl_core_log_dbg(core_link, LOG_NAME, "lanes up (serdes_lane_num = %u)", serdes_lane_num);
 		rtn = sl_core_hw_serdes_lane_up_rx_setup(core_link, serdes_lane_num);
 		if (rtn) {
 			sl_core_log_err_trace(core_link, LOG_NAME, "lane_up_rx_setup failed [%d]", rtn);
-			sl_core_data_link_last_up_fail_cause_map_set(core_link, SL_LINK_DOWN_CAUSE_SERDES_CONFIG_MAP);
-			goto out;
+			return rtn;
 		}
+	}
+	for_each_set_bit(serdes_lane_num, &lane_map, SL_MAX_SERDES_LANES) {
 		rtn = sl_core_hw_serdes_lane_up_tx_setup(core_link, serdes_lane_num, is_autoneg);
 		if (rtn) {
 			sl_core_log_err_trace(core_link, LOG_NAME, "lane_up_tx_setup failed [%d]", rtn);
-			sl_core_data_link_last_up_fail_cause_map_set(core_link, SL_LINK_DOWN_CAUSE_SERDES_CONFIG_MAP);
-			goto out;
+			return rtn;
 		}
+	}
+	for_each_set_bit(serdes_lane_num, &lane_map, SL_MAX_SERDES_LANES) {
 		rtn = sl_core_hw_serdes_lane_up_rx_config(core_link, serdes_lane_num);
 		if (rtn) {
 			sl_core_log_err_trace(core_link, LOG_NAME, "lane_up_rx_config failed [%d]", rtn);
-			sl_core_data_link_last_up_fail_cause_map_set(core_link, SL_LINK_DOWN_CAUSE_SERDES_CONFIG_MAP);
-			goto out;
+			return rtn;
 		}
+	}
+	for_each_set_bit(serdes_lane_num, &lane_map, SL_MAX_SERDES_LANES) {
 		rtn = sl_core_hw_serdes_lane_up_tx_config(core_link, serdes_lane_num);
 		if (rtn) {
 			sl_core_log_err_trace(core_link, LOG_NAME, "lane_up_tx_config failed [%d]", rtn);
-			sl_core_data_link_last_up_fail_cause_map_set(core_link, SL_LINK_DOWN_CAUSE_SERDES_CONFIG_MAP);
-			goto out;
+			return rtn;
 		}
+	}
+	for_each_set_bit(serdes_lane_num, &lane_map, SL_MAX_SERDES_LANES) {
 		rtn = sl_core_hw_serdes_lane_up_rx_start(core_link, serdes_lane_num);
 		if (rtn) {
 			sl_core_log_err_trace(core_link, LOG_NAME, "lane_up_rx_start failed [%d]", rtn);
-			sl_core_data_link_last_up_fail_cause_map_set(core_link, SL_LINK_DOWN_CAUSE_SERDES_CONFIG_MAP);
-			goto out;
+			return rtn;
 		}
+	}
+	for_each_set_bit(serdes_lane_num, &lane_map, SL_MAX_SERDES_LANES) {
 		rtn = sl_core_hw_serdes_lane_up_tx_start(core_link, serdes_lane_num);
 		if (rtn) {
 			sl_core_log_err_trace(core_link, LOG_NAME, "lane_up_tx_start failed [%d]", rtn);
-			sl_core_data_link_last_up_fail_cause_map_set(core_link, SL_LINK_DOWN_CAUSE_SERDES_CONFIG_MAP);
-			goto out;
+			return rtn;
 		}
 	}
 
+	return 0;
+}
+
+static void sl_core_hw_serdes_lanes_up_phase_end(struct sl_core_link *core_link, u32 phase, ktime_t *phase_start)
+{
+	ktime_t now;
+
+	now = ktime_get();
+
+	spin_lock(&core_link->serdes.data_lock);
+	core_link->serdes.lanes_up_phase_us[phase] = ktime_us_delta(now, *phase_start);
+	spin_unlock(&core_link->serdes.data_lock);
+
+	sl_core_log_dbg(core_link, LOG_NAME, "lanes up phase %s (time = %lldus)",
+		sl_core_serdes_lanes_up_phase_str(phase), ktime_us_delta(now, *phase_start));
+
+	*phase_start = now;
+}
+
+int sl_core_hw_serdes_lanes_up(struct sl_core_link *core_link, bool is_autoneg)
+{
+	int           rtn;
+	unsigned long lane_map;
+	unsigned long check_map;
+	u8            serdes_lane_num;
+	ktime_t       phase_start;
+
+	lane_map = core_link->serdes.lane_map;
+
+	sl_core_log_dbg(core_link, LOG_NAME,
+		"lanes up (lane_map = 0x%02lX, is_autoneg = %d)", lane_map, is_autoneg);
+
+	spin_lock(&core_link->serdes.data_lock);
+	memset(core_link->serdes.lanes_up_phase_us, 0, sizeof(core_link->serdes.lanes_up_phase_us));
+	spin_unlock(&core_link->serdes.data_lock);
+
+	phase_start = ktime_get();
+
+	/* start */
+	rtn = sl_core_hw_serdes_lanes_up_start(core_link, lane_map, is_autoneg);
+	if (rtn) {
+		sl_core_data_link_last_up_fail_cause_map_set(core_link, SL_LINK_DOWN_CAUSE_SERDES_CONFIG_MAP);
+		goto out;
+	}
+	sl_core_hw_serdes_lanes_up_phase_end(core_link, SL_CORE_HW_SERDES_LANES_UP_PHASE_START, &phase_start);
+
 	/* clock align */
 	for_each_set_bit(serdes_lane_num, &lane_map, SL_MAX_SERDES_LANES) {
 		rtn = sl_core_hw_serdes_lane_up_clock_align(core_link->core_lgrp, serdes_lane_num);
@@ -730,6 +796,7 @@ int sl_core_hw_serdes_lanes_up(struct sl_core_link *core_link, bool is_autoneg)
 			goto out;
 		}
 	}
+	sl_core_hw_serdes_lanes_up_phase_end(core_link, SL_CORE_HW_SERDES_LANES_UP_PHASE_CLOCK_ALIGN, &phase_start);
 
 #if 0 // FIXME: removed for now, but leave here just in case.
 	/* link training check */
@@ -749,19 +816,28 @@ int sl_core_hw_serdes_lanes_up(struct sl_core_link *core_link, bool is_autoneg)
 
 		sl_core_data_link_info_map_set(core_link, SL_CORE_INFO_MAP_SERDES_CHECK);
 
-		for_each_set_bit(serdes_lane_num, &lane_map, SL_MAX_SERDES_LANES) {
-			rtn = sl_core_hw_serdes_lane_up_tx_check(core_link, serdes_lane_num);
-			if (rtn) {
-				sl_core_log_err_trace(core_link, LOG_NAME, "lane_up_tx_check failed [%d]", rtn);
-				sl_core_data_link_last_up_fail_cause_map_set(core_link,
-					SL_LINK_DOWN_CAUSE_SERDES_SIGNAL_MAP);
-				goto out;
-			}
+		for_each_set_bit(serdes_lane_num, &lane_map, SL_MAX_SERDES_LANES)
+			sl_core_hw_serdes_tx_lane_state_set(core_link->core_lgrp,
+				sl_core_hw_serdes_tx_asic_lane_num_get(core_link, serdes_lane_num),
+				SL_CORE_HW_SERDES_LANE_STATE_CHECK);
+
+		check_map = lane_map;
+		rtn = sl_core_hw_serdes_lanes_poll(core_link, &check_map, sl_core_hw_serdes_lane_up_tx_check,
+			LANE_UP_POLL_INTERVAL_MIN_MS, LANE_UP_TX_CHECK_INTERVAL_MS, LANE_UP_TX_CHECK_TIMEOUT_MS);
+		if (rtn) {
+			sl_core_log_err_trace(core_link, LOG_NAME,
+				"lane_up_tx_check failed (check_map = 0x%02lX) [%d]", check_map, rtn);
+			sl_core_data_link_last_up_fail_cause_map_set(core_link,
+				SL_LINK_DOWN_CAUSE_SERDES_SIGNAL_MAP);
+			goto out;
 		}
+		sl_core_hw_serdes_lanes_up_phase_end(core_link, SL_CORE_HW_SERDES_LANES_UP_PHASE_TX_CHECK,
+			&phase_start);
 	}
 
 	/* sleep to give last lane time to settle */
 	msleep(20);
+	sl_core_hw_serdes_lanes_up_phase_end(core_link, SL_CORE_HW_SERDES_LANES_UP_PHASE_SETTLE, &phase_start);
 
 	if (!is_autoneg) {
 		sl_core_hw_pcs_tx_start(core_link);
@@ -769,28 +845,36 @@ int sl_core_hw_serdes_lanes_up(struct sl_core_link *core_link, bool is_autoneg)
 		for_each_set_bit(serdes_lane_num, &lane_map, SL_MAX_SERDES_LANES)
 			sl_core_hw_pmd_tx_enable(core_link, serdes_lane_num);
 
-		for_each_set_bit(serdes_lane_num, &lane_map, SL_MAX_SERDES_LANES) {
-			rtn = sl_core_hw_serdes_lane_up_rx_check(core_link, serdes_lane_num);
-			if (rtn) {
-				sl_core_log_err_trace(core_link, LOG_NAME, "lane_up_rx_check failed [%d]", rtn);
-				sl_core_data_link_last_up_fail_cause_map_set(core_link,
-					SL_LINK_DOWN_CAUSE_SERDES_SIGNAL_MAP);
-				goto out;
-			}
+		for_each_set_bit(serdes_lane_num, &lane_map, SL_MAX_SERDES_LANES)
+			sl_core_hw_serdes_rx_lane_state_set(core_link->core_lgrp,
+				sl_core_hw_serdes_rx_asic_lane_num_get(core_link, serdes_lane_num),
+				SL_CORE_HW_SERDES_LANE_STATE_CHECK);
+
+		check_map = lane_map;
+		rtn = sl_core_hw_serdes_lanes_poll(core_link, &check_map, sl_core_hw_serdes_lane_up_rx_check,
+			LANE_UP_POLL_INTERVAL_MIN_MS, LANE_UP_RX_CHECK_INTERVAL_MS, LANE_UP_RX_CHECK_TIMEOUT_MS);
+		if (rtn) {
+			sl_core_log_err_trace(core_link, LOG_NAME,
+				"lane_up_rx_check failed (check_map = 0x%02lX) [%d]", check_map, rtn);
+			sl_core_data_link_last_up_fail_cause_map_set(core_link,
+				SL_LINK_DOWN_CAUSE_SERDES_SIGNAL_MAP);
+			goto out;
 		}
+		sl_core_hw_serdes_lanes_up_phase_end(core_link, SL_CORE_HW_SERDES_LANES_UP_PHASE_RX_CHECK,
+			&phase_start);
 
 		if (!is_flag_set(core_link->core_lgrp->config.options, SL_LGRP_CONFIG_OPT_SERDES_LOOPBACK_ENABLE)) {
 			sl_core_log_dbg(core_link, LOG_NAME, "loopback off so check quality");
-			for_each_set_bit(serdes_lane_num, &lane_map, SL_MAX_SERDES_LANES) {
-				rtn = sl_core_hw_serdes_lane_up_quality_check(core_link, serdes_lane_num);
-				if (rtn) {
-					sl_core_log_err_trace(core_link, LOG_NAME,
-						"lane_up_quality_check failed [%d]", rtn);
-					sl_core_data_link_last_up_fail_cause_map_set(core_link,
-						SL_LINK_DOWN_CAUSE_SERDES_QUALITY_MAP);
-					goto out;
-				}
+			rtn = sl_core_hw_serdes_lanes_up_quality_check(core_link, lane_map);
+			if (rtn) {
+				sl_core_log_err_trace(core_link, LOG_NAME,
+					"lane_up_quality_check failed [%d]", rtn);
+				sl_core_data_link_last_up_fail_cause_map_set(core_link,
+					SL_LINK_DOWN_CAUSE_SERDES_QUALITY_MAP);
+				goto out;
 			}
+			sl_core_hw_serdes_lanes_up_phase_end(core_link,
+				SL_CORE_HW_SERDES_LANES_UP_PHASE_QUALITY_CHECK, &phase_start);
 		}
 
 		sl_core_data_link_info_map_clr(core_link, SL_CORE_INFO_MAP_SERDES_CHECK);
@@ -986,6 +1070,73 @@ out:
 	return rtn;
 }
 
+/* eye upper and lower are adjacent so each lane is read in one sweep */
+int sl_core_hw_serdes_eyes_get(struct sl_core_lgrp *core_lgrp, u8 *eye_upper, u8 *eye_lower)
+{
+	int                             rtn;
+	struct sl_core_hw_uc_ram_region region;
+	u8                              eyes[2];
+	u8                              asic_lane_num;
+	u8                              serdes_lane_num;
+
+	if (!sl_core_ldev_serdes_is_ready(core_lgrp->core_ldev))
+		return -EIO;
+
+	for (asic_lane_num = 0; asic_lane_num < SL_MAX_LANES; ++asic_lane_num) {
+		serdes_lane_num = sl_core_hw_serdes_rx_serdes_lane_num_get(core_lgrp, asic_lane_num);
+
+		region.addr = SL_CORE_HW_SERDES_LANE_ADDR(0x7, serdes_lane_num, core_lgrp);
+		region.size = sizeof(eyes);
+		region.buff = eyes;
+
+		SL_CORE_HW_UC_RAM_RD_REGIONS(core_lgrp, core_lgrp->serdes.dt.dev_addr,
+			core_lgrp->serdes.dt.dev_id, serdes_lane_num, &region, 1);
+
+		eye_upper[asic_lane_num] = eyes[0];
+		eye_lower[asic_lane_num] = eyes[1];
+		sl_core_log_dbg(core_lgrp, LOG_NAME,
+			"eyes get (asic_lane_num = %u, eye_upper = %u, eye_lower = %u)",
+			asic_lane_num, eye_upper[asic_lane_num], eye_lower[asic_lane_num]);
+	}
+
+	rtn = 0;
+
+out:
+	return rtn;
+}
+
+/* samples the eyes of lanes that are up into the lgrp snapshot */
+int sl_core_hw_serdes_eyes_sample(struct sl_core_lgrp *core_lgrp)
+{
+	int rtn;
+	u8  eye_upper[SL_MAX_LANES];
+	u8  eye_lower[SL_MAX_LANES];
+	u8  active_lanes;
+	u8  asic_lane_num;
+	u32 state;
+
+	active_lanes = 0;
+	spin_lock(&core_lgrp->data_lock);
+	for (asic_lane_num = 0; asic_lane_num < SL_MAX_LANES; ++asic_lane_num) {
+		state = core_lgrp->serdes.lane_state[asic_lane_num].rx;
+		if ((state == SL_CORE_HW_SERDES_LANE_STATE_UP) || (state == SL_CORE_HW_SERDES_LANE_STATE_DEGRADED))
+			active_lanes |= BIT(asic_lane_num);
+	}
+	spin_unlock(&core_lgrp->data_lock);
+
+	sl_core_log_dbg(core_lgrp, LOG_NAME, "eyes sample (active_lanes = 0x%X)", active_lanes);
+
+	if (active_lanes) {
+		rtn = sl_core_hw_serdes_eyes_get(core_lgrp, eye_upper, eye_lower);
+		if (rtn)
+			return rtn;
+	}
+
+	sl_core_data_lgrp_eyes_set(core_lgrp, ktime_get_real_ns(), active_lanes, eye_upper, eye_lower);
+
+	return 0;
+}
+
 void sl_core_hw_serdes_tx_lane_state_set(struct sl_core_lgrp *core_lgrp, u8 asic_lane_num, u32 state)
 {
 	sl_core_log_dbg(core_lgrp, LOG_NAME,
@@ -103,6 +103,8 @@ void sl_core_hw_serdes_lane_down_tx_stop(struct sl_core_link *core_link, u8 serd
 
 int  sl_core_hw_serdes_eye_upper_get(struct sl_core_lgrp *core_lgrp, u8 asic_lane_num, u8 *eye_upper);
 int  sl_core_hw_serdes_eye_lower_get(struct sl_core_lgrp *core_lgrp, u8 asic_lane_num, u8 *eye_lower);
+int  sl_core_hw_serdes_eyes_get(struct sl_core_lgrp *core_lgrp, u8 *eye_upper, u8 *eye_lower);
+int  sl_core_hw_serdes_eyes_sample(struct sl_core_lgrp *core_lgrp);
 
 void sl_core_hw_serdes_tx_lane_state_set(struct sl_core_lgrp *core_lgrp, u8 asic_lane_num, u32 state);
 int  sl_core_hw_serdes_tx_lane_state_get(struct sl_core_lgrp *core_lgrp, u8 asic_lane_num, u32 *state);
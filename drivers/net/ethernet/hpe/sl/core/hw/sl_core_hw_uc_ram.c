@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
+#include <linux/atomic.h>
+#include <linux/mutex.h>
 
 #include "sl_core_lgrp.h"
 #include "base/sl_core_log.h"
@@ -9,9 +11,187 @@
 #include "hw/sl_core_hw_pmi.h"
 #include "hw/sl_core_hw_uc_ram.h"
 #include "hw/sl_core_hw_serdes_addrs.h"
+#include "hw/sl_core_hw_serdes.h"
 
 #define LOG_NAME SL_CORE_HW_LOG_NAME
 
+#define SL_CORE_HW_UC_RAM_ADDR_NONE 0xFFFFFFFF
+
+#define SL_CORE_HW_UC_RAM_LOCK(_lgrp) \
+	(&(_lgrp)->core_ldev->serdes.uc_ram_lock[LGRP_TO_SERDES((_lgrp)->num)])
+
+static int sl_core_hw_uc_ram_rd_setup(struct sl_core_lgrp *core_lgrp, u8 dev_addr, u8 dev_id, u8 lane_num)
+{
+	int  rtn;
+	u16 *addrs;
+
+	addrs = core_lgrp->core_ldev->serdes.addrs;
+
+	SL_CORE_HW_SBUS_PMI_WR(core_lgrp, dev_addr, dev_id, lane_num, 0,
+		addrs[SERDES_MICRO_A_COM_AHB_CONTROL0], 0x2000, 0x2000); /* micro_autoinc_rdaddr_en */
+	SL_CORE_HW_SBUS_PMI_WR(core_lgrp, dev_addr, dev_id, lane_num, 0,
+		addrs[SERDES_MICRO_A_COM_AHB_CONTROL0], 0x0010, 0x0030); /* micro_ra_rddatasize */
+
+	rtn = 0;
+out:
+	atomic64_add(2, &core_lgrp->uc_ram.pmi_ops);
+	return rtn;
+}
+
+/* the MSW is only written when it differs from the one in the hardware */
+static int sl_core_hw_uc_ram_rd_addr_set(struct sl_core_lgrp *core_lgrp, u8 dev_id, u8 lane_num,
+					 u32 addr, u32 *cur_msw)
+{
+	int  rtn;
+	u16 *addrs;
+
+	addrs = core_lgrp->core_ldev->serdes.addrs;
+
+	if ((addr >> 16) != *cur_msw) {
+		atomic64_inc(&core_lgrp->uc_ram.pmi_ops);
+		SL_CORE_HW_PMI_WR(core_lgrp, dev_id, lane_num, 0,
+			addrs[SERDES_MICRO_A_COM_AHB_RDADDR_MSW], ((addr >> 16) & 0xFFFF), 0xFFFF); /* micro_ra_rdaddr_msw */
+		*cur_msw = (addr >> 16);
+	}
+
+	atomic64_inc(&core_lgrp->uc_ram.pmi_ops);
+	SL_CORE_HW_PMI_WR(core_lgrp, dev_id, lane_num, 0,
+		addrs[SERDES_MICRO_A_COM_AHB_RDADDR_LSW], (addr & 0xFFFE), 0xFFFF); /* micro_ra_rdaddr_lsw */
+
+	rtn = 0;
+out:
+	return rtn;
+}
+
+static int sl_core_hw_uc_ram_rd_word(struct sl_core_lgrp *core_lgrp, u8 dev_id, u8 lane_num, u16 *data16)
+{
+	int rtn;
+
+	atomic64_inc(&core_lgrp->uc_ram.pmi_ops);
+	SL_CORE_HW_PMI_RD(core_lgrp, dev_id, lane_num, 0,
+		core_lgrp->core_ldev->serdes.addrs[SERDES_MICRO_A_COM_AHB_RDDATA_LSW], data16); /* micro_ra_rddata_lsw */
+
+	rtn = 0;
+out:
+	return rtn;
+}
+
+/* reprograms the address when autoincrement crosses into the next block */
+static int sl_core_hw_uc_ram_rd_next(struct sl_core_lgrp *core_lgrp, u8 dev_id, u8 lane_num,
+				     u32 *next_addr, u32 *cur_msw, bool *is_addr_set, u16 *data16)
+{
+	int rtn;
+
+	if (!*is_addr_set && ((*next_addr % SL_CORE_HW_UC_RAM_BLK_SIZE) == 0)) {
+		rtn = sl_core_hw_uc_ram_rd_addr_set(core_lgrp, dev_id, lane_num, *next_addr, cur_msw);
+		if (rtn)
+			return rtn;
+	}
+
+	rtn = sl_core_hw_uc_ram_rd_word(core_lgrp, dev_id, lane_num, data16);
+	if (rtn)
+		return rtn;
+
+	*next_addr  += 2;
+	*is_addr_set = false;
+
+	return 0;
+}
+
+/*
+ * Reads regions in one autoincrement sweep. Regions must be in ascending
+ * address order. Unaligned starts and ends read the whole word and keep
+ * only the requested bytes.
+ */
+int sl_core_hw_uc_ram_rd_regions(struct sl_core_lgrp *core_lgrp, u8 dev_addr, u8 dev_id, u8 lane_num,
+				 struct sl_core_hw_uc_ram_region *regions, u32 num_regions)
+{
+	int                              rtn;
+	struct sl_core_hw_uc_ram_region *region;
+	u32                              region_num;
+	u32                              next_addr;
+	u32                              addr;
+	u32                              end;
+	u32                              cur_msw;
+	u16                              data16;
+	bool                             is_addr_set;
+
+	sl_core_log_dbg(core_lgrp, LOG_NAME, "uc ram rd regions (num_regions = %u)", num_regions);
+
+	region_num = 0;
+
+	mutex_lock(SL_CORE_HW_UC_RAM_LOCK(core_lgrp));
+
+	rtn = sl_core_hw_uc_ram_rd_setup(core_lgrp, dev_addr, dev_id, lane_num);
+	if (rtn)
+		goto out;
+
+	next_addr   = SL_CORE_HW_UC_RAM_ADDR_NONE;
+	cur_msw     = SL_CORE_HW_UC_RAM_ADDR_NONE;
+	is_addr_set = false;
+	for (region_num = 0; region_num < num_regions; ++region_num) {
+		region = &regions[region_num];
+		if (region->size == 0)
+			continue;
+
+		addr = region->addr & ~1;
+		end  = region->addr + region->size;
+
+		if ((next_addr != SL_CORE_HW_UC_RAM_ADDR_NONE) && (addr >= next_addr) &&
+		    ((addr - next_addr) / 2 <= SL_CORE_HW_UC_RAM_GAP_WORDS_MAX)) {
+			/* read through short gaps */
+			while (next_addr < addr) {
+				rtn = sl_core_hw_uc_ram_rd_next(core_lgrp, dev_id, lane_num,
+					&next_addr, &cur_msw, &is_addr_set, &data16);
+				if (rtn)
+					goto out;
+			}
+		} else if (addr != next_addr) {
+			rtn = sl_core_hw_uc_ram_rd_addr_set(core_lgrp, dev_id, lane_num, addr, &cur_msw);
+			if (rtn)
+				goto out;
+			next_addr   = addr;
+			is_addr_set = true;
+		}
+
+		while (next_addr < end) {
+			rtn = sl_core_hw_uc_ram_rd_next(core_lgrp, dev_id, lane_num,
+				&next_addr, &cur_msw, &is_addr_set, &data16);
+			if (rtn)
+				goto out;
+
+			/* next_addr has moved past the word just read */
+			if (next_addr - 2 >= region->addr)
+				region->buff[next_addr - 2 - region->addr] = (data16 & 0xFF);
+			if (next_addr - 1 < end)
+				region->buff[next_addr - 1 - region->addr] = ((data16 >> 8) & 0xFF);
+		}
+
+		atomic64_add(region->size, &core_lgrp->uc_ram.bytes);
+	}
+
+	rtn = 0;
+out:
+	mutex_unlock(SL_CORE_HW_UC_RAM_LOCK(core_lgrp));
+	if (rtn)
+		sl_core_log_err_trace(core_lgrp, LOG_NAME,
+			"uc ram rd regions failed (region_num = %u) [%d]", region_num, rtn);
+	return rtn;
+}
+
+int sl_core_hw_uc_ram_rd(struct sl_core_lgrp *core_lgrp, u8 dev_addr,
+	u8 dev_id, u8 lane_num, u32 addr, u32 size, u8 *buff)
+{
+	struct sl_core_hw_uc_ram_region region;
+
+	region.addr = addr;
+	region.size = size;
+	region.buff = buff;
+
+	return sl_core_hw_uc_ram_rd_regions(core_lgrp, dev_addr, dev_id, lane_num, &region, 1);
+}
+
+/* single 8 bit read without autoincrement */
 int sl_core_hw_uc_ram_rd8(struct sl_core_lgrp *core_lgrp, u8 dev_addr,
 	u8 dev_id, u8 lane_num, u32 addr, u8 *data)
 {
@@ -19,10 +199,10 @@ int sl_core_hw_uc_ram_rd8(struct sl_core_lgrp *core_lgrp, u8 dev_addr,
 	u16  data16;
 	u16 *addrs;
 
-	sl_core_log_dbg(core_lgrp, LOG_NAME, "uc ram rd");
-
 	addrs = core_lgrp->core_ldev->serdes.addrs;
 
+	mutex_lock(SL_CORE_HW_UC_RAM_LOCK(core_lgrp));
+
 	SL_CORE_HW_SBUS_PMI_WR(core_lgrp, dev_addr, dev_id, lane_num, 0,
 		addrs[SERDES_MICRO_A_COM_AHB_CONTROL0], 0x0000, 0x2000); /* micro_autoinc_rdaddr_en */
 	SL_CORE_HW_SBUS_PMI_WR(core_lgrp, dev_addr, dev_id, lane_num, 0,
@@ -41,46 +221,19 @@ int sl_core_hw_uc_ram_rd8(struct sl_core_lgrp *core_lgrp, u8 dev_addr,
 		"uc ram rd8 (lane_num = %u, addr = 0x%08X, data = 0x%02X)",
 		lane_num, addr, *data);
 
+	atomic64_inc(&core_lgrp->uc_ram.bytes);
+
 	rtn = 0;
 out:
+	mutex_unlock(SL_CORE_HW_UC_RAM_LOCK(core_lgrp));
+	atomic64_add(5, &core_lgrp->uc_ram.pmi_ops);
 	return rtn;
 }
 
 int sl_core_hw_uc_ram_rd_blk(struct sl_core_lgrp *core_lgrp, u8 dev_addr,
 	u8 dev_id, u32 start_addr, u8 rd_size, u8 *rd_buff)
 {
-	int  rtn;
-	u8   idx;
-	u16  data16;
-	u16 *addrs;
-
 	sl_core_log_dbg(core_lgrp, LOG_NAME, "uc ram rd blk");
 
-	addrs = core_lgrp->core_ldev->serdes.addrs;
-
-	SL_CORE_HW_SBUS_PMI_WR(core_lgrp, dev_addr, dev_id, 0xFF, 0,
-		addrs[SERDES_MICRO_A_COM_AHB_CONTROL0], 0x2000, 0x2000); /* micro_autoinc_rdaddr_en */
-	SL_CORE_HW_SBUS_PMI_WR(core_lgrp, dev_addr, dev_id, 0xFF, 0,
-		addrs[SERDES_MICRO_A_COM_AHB_CONTROL0], 0x0010, 0x0030); /* micro_ra_rddatasize */
-	SL_CORE_HW_PMI_WR(core_lgrp, dev_id, 0xFF, 0,
-		addrs[SERDES_MICRO_A_COM_AHB_RDADDR_MSW], ((start_addr >> 16) & 0xFFFF), 0xFFFF); /* micro_ra_rdaddr_msw */
-	SL_CORE_HW_PMI_WR(core_lgrp, dev_id, 0xFF, 0,
-		addrs[SERDES_MICRO_A_COM_AHB_RDADDR_LSW], (start_addr & 0xFFFE), 0xFFFF); /* micro_ra_rdaddr_lsw */
-
-	// FIXME: assume aligned address for now
-	// FIXME: assume from the same block for now
-	idx = 0;
-	while (rd_size > 0) {
-		SL_CORE_HW_PMI_RD(core_lgrp, dev_id, 0xFF, 0,
-			addrs[SERDES_MICRO_A_COM_AHB_RDDATA_LSW], &data16); /* micro_ra_rddata_lsw */
-
-		rd_buff[idx] = (data16 & 0xFF);
-		rd_buff[idx + 1] = ((data16 >> 8) & 0xFF);
-		rd_size -= 2;
-		idx += 2;
-	}
-
-	rtn = 0;
-out:
-	return rtn;
+	return sl_core_hw_uc_ram_rd(core_lgrp, dev_addr, dev_id, 0xFF, start_addr, rd_size, rd_buff);
 }
@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_CORE_HW_UC_RAM_H_
 #define _SL_CORE_HW_UC_RAM_H_
@@ -18,11 +18,38 @@
 			goto out;                                                                           \
 	} while (0)
 
+#define SL_CORE_HW_UC_RAM_RD_REGIONS(_lgrp, _dev_addr, _dev_id, _lane, _regions, _num)                            \
+	do {                                                                                                      \
+		rtn = sl_core_hw_uc_ram_rd_regions((_lgrp), (_dev_addr), (_dev_id), (_lane), (_regions), (_num)); \
+		if (rtn != 0)                                                                                     \
+			goto out;                                                                                 \
+	} while (0)
+
+/*
+ * Block and region reads are 16 bits with the address autoincremented. The
+ * address is reprogrammed when a read crosses into the next 64K block.
+ * Byte reads (rd8) are single 8 bit reads without autoincrement.
+ */
+#define SL_CORE_HW_UC_RAM_BLK_SIZE 0x10000
+
+/* gaps up to this many words are read through instead of readdressing */
+#define SL_CORE_HW_UC_RAM_GAP_WORDS_MAX 2
+
+struct sl_core_hw_uc_ram_region {
+	u32  addr;
+	u32  size;
+	u8  *buff;
+};
+
 struct sl_core_lgrp;
 
 int sl_core_hw_uc_ram_rd8(struct sl_core_lgrp *core_lgrp, u8 dev_addr,
 			  u8 dev_id, u8 lane_num, u32 addr, u8 *data);
 int sl_core_hw_uc_ram_rd_blk(struct sl_core_lgrp *core_lgrp, u8 dev_addr,
 			     u8 dev_id, u32 start_addr, u8 rd_size, u8 *rd_buff);
+int sl_core_hw_uc_ram_rd(struct sl_core_lgrp *core_lgrp, u8 dev_addr,
+			 u8 dev_id, u8 lane_num, u32 addr, u32 size, u8 *buff);
+int sl_core_hw_uc_ram_rd_regions(struct sl_core_lgrp *core_lgrp, u8 dev_addr, u8 dev_id, u8 lane_num,
+				 struct sl_core_hw_uc_ram_region *regions, u32 num_regions);
 
 #endif /* _SL_CORE_HW_UC_RAM_H_ */
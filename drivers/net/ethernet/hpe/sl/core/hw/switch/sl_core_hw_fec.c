@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 
@@ -11,6 +11,7 @@
 #include "hw/sl_core_hw_intr.h"
 #include "hw/sl_core_hw_io.h"
 #include "hw/sl_core_hw_fec.h"
+#include "hw/sl_core_hw_reg_txn.h"
 #include "test/sl_core_test_fec.h"
 
 #define LOG_NAME SL_CORE_HW_FEC_LOG_NAME
@@ -35,79 +36,81 @@
 	SS2_PORT_PML_STS_EVENT_CNTS_OFFSET(BASE_CNTR_IDX_PCS + ROSEVC_PCS_CORRECTED_CW_BIN_00_INDEX + \
 					   ((_link_num * SL_CORE_LINK_FEC_NUM_CCW_BINS) + _bin_num)))
 
-int sl_core_hw_fec_cw_cntrs_get(struct sl_core_link *core_link, struct sl_core_link_fec_cw_cntrs *cw_cntrs)
+static void sl_core_hw_fec_cw_cntrs_queue(struct sl_core_hw_reg_txn *txn, struct sl_core_link *core_link,
+					  struct sl_core_link_fec_cw_cntrs *cw_cntrs)
 {
-// FIXME: investigate doing this differently
-#if defined(SL_TEST)
-	if (core_link->fec.use_test_cntrs) {
-		sl_core_log_warn(core_link, LOG_NAME, "cntrs_get using test fec cntrs");
-		return sl_core_test_fec_cw_cntrs_get(core_link->core_lgrp->core_ldev->num,
-						     core_link->core_lgrp->num, core_link->num, cw_cntrs);
-	}
-#endif
-
-	sl_core_read64(core_link, SL_CORE_UCW_ADDR(core_link->core_lgrp->num, core_link->num), &cw_cntrs->ucw);
-	sl_core_read64(core_link, SL_CORE_CCW_ADDR(core_link->core_lgrp->num, core_link->num), &cw_cntrs->ccw);
-	sl_core_read64(core_link, SL_CORE_GCW_ADDR(core_link->core_lgrp->num, core_link->num), &cw_cntrs->gcw);
-
-	return 0;
+	sl_core_hw_reg_txn_read64(txn, SL_CORE_UCW_ADDR(core_link->core_lgrp->num, core_link->num), &cw_cntrs->ucw);
+	sl_core_hw_reg_txn_read64(txn, SL_CORE_CCW_ADDR(core_link->core_lgrp->num, core_link->num), &cw_cntrs->ccw);
+	sl_core_hw_reg_txn_read64(txn, SL_CORE_GCW_ADDR(core_link->core_lgrp->num, core_link->num), &cw_cntrs->gcw);
 }
 
-int sl_core_hw_fec_lane_cntrs_get(struct sl_core_link *core_link, struct sl_core_link_fec_lane_cntrs *lane_cntrs)
+static void sl_core_hw_fec_lane_cntrs_queue(struct sl_core_hw_reg_txn *txn, struct sl_core_link *core_link,
+					    struct sl_core_link_fec_lane_cntrs *lane_cntrs)
 {
 	int i;
 
-	sl_core_log_dbg(core_link, LOG_NAME, "lane_cntrs_get");
-
 	for (i = 0; i < SL_CORE_LINK_FEC_NUM_LANES; ++i)
-		sl_core_read64(core_link,
+		sl_core_hw_reg_txn_read64(txn,
 			SL_CORE_LANE_ADDR(core_link->core_lgrp->num, core_link->num, i),
 			&lane_cntrs->lanes[i]);
-
-	return 0;
 }
 
-int sl_core_hw_fec_tail_cntrs_get(struct sl_core_link *core_link,
-				  struct sl_core_link_fec_tail_cntrs *tail_cntr)
+static void sl_core_hw_fec_tail_cntrs_queue(struct sl_core_hw_reg_txn *txn, struct sl_core_link *core_link,
+					    struct sl_core_link_fec_tail_cntrs *tail_cntrs)
 {
 	int i;
 
-	sl_core_log_dbg(core_link, LOG_NAME, "tail_cntr_get");
-
 	for (i = 0; i < SL_CORE_LINK_FEC_NUM_CCW_BINS; ++i)
-		sl_core_read64(core_link,
+		sl_core_hw_reg_txn_read64(txn,
 			SL_CORE_CCW_BIN_ADDR(core_link->core_lgrp->num, core_link->num, i),
-			&tail_cntr->ccw_bins[i]);
-
-	return 0;
+			&tail_cntrs->ccw_bins[i]);
 }
 
+/* all the counters go out as read batches through the platform reg_ops */
 int sl_core_hw_fec_data_get(struct sl_core_link *core_link,
 			    struct sl_core_link_fec_cw_cntrs *cw_cntrs,
 			    struct sl_core_link_fec_lane_cntrs *lane_cntrs,
 			    struct sl_core_link_fec_tail_cntrs *tail_cntrs)
 {
-	int rtn;
+	int                       rtn;
+	struct sl_core_hw_reg_txn txn;
+	bool                      is_test_cntrs;
 
 	sl_core_log_dbg(core_link, LOG_NAME, "fec_data_get");
 
-	rtn = sl_core_hw_fec_cw_cntrs_get(core_link, cw_cntrs);
-	if (rtn) {
-		sl_core_log_err_trace(core_link, LOG_NAME, "fec_cw_cntrs_get failed [%d]", rtn);
-		return rtn;
-	}
+	is_test_cntrs = false;
+// FIXME: investigate doing this differently
+#if defined(SL_TEST)
+	is_test_cntrs = core_link->fec.use_test_cntrs;
+#endif
+
+	spin_lock(&core_link->fec.data_txn.lock);
+
+	sl_core_hw_reg_txn_init(&txn, core_link->core_lgrp, core_link->num,
+		core_link->fec.data_txn.ops, core_link->fec.data_txn.reg_ops,
+		ARRAY_SIZE(core_link->fec.data_txn.ops));
+
+	if (!is_test_cntrs)
+		sl_core_hw_fec_cw_cntrs_queue(&txn, core_link, cw_cntrs);
+	sl_core_hw_fec_lane_cntrs_queue(&txn, core_link, lane_cntrs);
+	sl_core_hw_fec_tail_cntrs_queue(&txn, core_link, tail_cntrs);
+
+	rtn = sl_core_hw_reg_txn_commit(&txn);
+
+	spin_unlock(&core_link->fec.data_txn.lock);
 
-	rtn = sl_core_hw_fec_lane_cntrs_get(core_link, lane_cntrs);
 	if (rtn) {
-		sl_core_log_err_trace(core_link, LOG_NAME, "fec_lane_cntrs_get failed [%d]", rtn);
+		sl_core_log_err_trace(core_link, LOG_NAME, "fec_data_get reg_txn_commit failed [%d]", rtn);
 		return rtn;
 	}
 
-	rtn = sl_core_hw_fec_tail_cntrs_get(core_link, tail_cntrs);
-	if (rtn) {
-		sl_core_log_err_trace(core_link, LOG_NAME, "fec_lane_cntrs_get failed [%d]", rtn);
-		return rtn;
+#if defined(SL_TEST)
+	if (is_test_cntrs) {
+		sl_core_log_warn(core_link, LOG_NAME, "cntrs_get using test fec cntrs");
+		return sl_core_test_fec_cw_cntrs_get(core_link->core_lgrp->core_ldev->num,
+						     core_link->core_lgrp->num, core_link->num, cw_cntrs);
 	}
+#endif
 
 	return 0;
 }
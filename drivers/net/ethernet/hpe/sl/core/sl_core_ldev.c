@@ -1,14 +1,18 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2022,2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2022,2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/workqueue.h>
-#include <linux/firmware.h>
+#include <linux/bitmap.h>
+#include <linux/completion.h>
+#include <linux/ktime.h>
+#include <linux/string.h>
 
 #include "sl_asic.h"
-#include "sl_module.h"
+#include "sl_platform.h"
 #include "sl_log.h"
 #include "sl_core_ldev.h"
 #include "sl_core_lgrp.h"
+#include "base/sl_core_serdes_fw_cache.h"
 #include "data/sl_core_data_ldev.h"
 #include "hw/sl_core_hw_serdes.h"
 #include "hw/sl_core_hw_serdes_fw.h"
@@ -18,17 +22,259 @@
 #define LOG_NAME SL_CORE_LDEV_LOG_NAME
 
 int sl_core_ldev_new(u8 ldev_num, struct sl_accessors *accessors,
-	struct sl_ops *ops, struct workqueue_struct *workqueue)
+	struct sl_ops *ops, struct workqueue_struct *workqueue, u32 options)
 {
-	return sl_core_data_ldev_new(ldev_num, accessors, ops, workqueue);
+	return sl_core_data_ldev_new(ldev_num, accessors, ops, workqueue, options);
 }
 
-int sl_core_ldev_serdes_init(u8 ldev_num)
+static const char *sl_core_ldev_serdes_init_phase_str(u32 phase)
 {
-	int                  rtn;
-	int                  lgrp_num;
-	struct sl_core_lgrp *core_lgrp;
-	struct sl_core_ldev *core_ldev;
+	switch (phase) {
+	case SL_CORE_LDEV_SERDES_INIT_PHASE_INIT:
+		return "serdes_init";
+	case SL_CORE_LDEV_SERDES_INIT_PHASE_FW_SETUP:
+		return "serdes_fw_setup";
+	case SL_CORE_LDEV_SERDES_INIT_PHASE_FW_FINISH:
+		return "serdes_fw_finish";
+	case SL_CORE_LDEV_SERDES_INIT_PHASE_CORE_INIT:
+		return "serdes_core_init";
+	case SL_CORE_LDEV_SERDES_INIT_PHASE_SWIZZLES:
+		return "serdes_swizzles";
+	default:
+		return "unknown";
+	}
+}
+
+static int sl_core_ldev_serdes_core_init(struct sl_core_lgrp *core_lgrp)
+{
+	int rtn;
+
+	rtn = sl_core_hw_serdes_fw_info_get(core_lgrp);
+	if (rtn) {
+		sl_core_log_err(core_lgrp, LOG_NAME, "serdes_fw_info_get failed [%d]", rtn);
+		return rtn;
+	}
+	rtn = sl_core_hw_serdes_hw_info_get(core_lgrp);
+	if (rtn) {
+		sl_core_log_err(core_lgrp, LOG_NAME, "serdes_hw_info_get failed [%d]", rtn);
+		return rtn;
+	}
+	rtn = sl_core_hw_serdes_core_init(core_lgrp);
+	if (rtn) {
+		sl_core_log_err(core_lgrp, LOG_NAME, "serdes_core_init failed [%d]", rtn);
+		return rtn;
+	}
+	rtn = sl_core_hw_serdes_core_pll(core_lgrp,
+		SL_CORE_HW_SERDES_CLOCKING_85, SL_CORE_HW_SERDES_TX_PLL_BW_DEFAULT);
+	if (rtn) {
+		sl_core_log_err(core_lgrp, LOG_NAME, "serdes_core_pll failed [%d]", rtn);
+		return rtn;
+	}
+
+	return 0;
+}
+
+static int sl_core_ldev_serdes_init_lgrp(struct sl_core_lgrp *core_lgrp, u32 phase)
+{
+	sl_core_log_dbg(core_lgrp, LOG_NAME, "serdes init lgrp (phase = %s)",
+		sl_core_ldev_serdes_init_phase_str(phase));
+
+	switch (phase) {
+	case SL_CORE_LDEV_SERDES_INIT_PHASE_INIT:
+		return sl_core_hw_serdes_init(core_lgrp);
+	case SL_CORE_LDEV_SERDES_INIT_PHASE_FW_SETUP:
+		return sl_core_hw_serdes_fw_setup(core_lgrp);
+	case SL_CORE_LDEV_SERDES_INIT_PHASE_FW_FINISH:
+		return sl_core_hw_serdes_fw_finish(core_lgrp);
+	case SL_CORE_LDEV_SERDES_INIT_PHASE_CORE_INIT:
+		return sl_core_ldev_serdes_core_init(core_lgrp);
+	case SL_CORE_LDEV_SERDES_INIT_PHASE_SWIZZLES:
+		return sl_core_hw_serdes_swizzles(core_lgrp);
+	default:
+		return -EINVAL;
+	}
+}
+
+/*
+ * The lgrps of a serdes share its SBUS registers, so they run one after the
+ * other in the serdes' work item. The first failure stops the serdes.
+ */
+void sl_core_ldev_serdes_init_work(struct work_struct *work)
+{
+	int                                   rtn;
+	u8                                    x;
+	struct sl_core_ldev_serdes_init_work *init_work;
+	struct sl_core_ldev                  *core_ldev;
+	ktime_t                               start;
+
+	init_work = container_of(work, struct sl_core_ldev_serdes_init_work, work);
+	core_ldev = init_work->core_lgrps[0]->core_ldev;
+	start     = ktime_get();
+
+	rtn = 0;
+	for (x = 0; x < init_work->lgrp_count; ++x) {
+		rtn = sl_core_ldev_serdes_init_lgrp(init_work->core_lgrps[x], init_work->phase);
+		if (rtn) {
+			init_work->lgrp_num = init_work->core_lgrps[x]->num;
+			break;
+		}
+	}
+
+	init_work->rtn = rtn;
+	init_work->us  = ktime_us_delta(ktime_get(), start);
+
+	if (atomic_dec_and_test(&core_ldev->serdes.init_pending))
+		complete(&core_ldev->serdes.init_complete);
+}
+
+/*
+ * Runs one init phase for every lgrp in lgrp_map on the serdes init workqueue
+ * and waits for all of them. Each serdes gets one work item for its lgrps,
+ * so serdes run side by side while the lgrps of a serdes don't. Lgrps on a
+ * serdes that has already failed are skipped. A failure marks the serdes as
+ * failed in serdes_rtn without stopping the other serdes.
+ */
+static void sl_core_ldev_serdes_init_phase(struct sl_core_ldev *core_ldev, u32 phase,
+	unsigned long *lgrp_map, int *serdes_rtn, u64 *serdes_us)
+{
+	u8                                    lgrp_num;
+	u8                                    serdes_num;
+	struct sl_core_ldev_serdes_init_work *init_work;
+
+	sl_core_log_dbg(core_ldev, LOG_NAME, "serdes init phase (phase = %s)",
+		sl_core_ldev_serdes_init_phase_str(phase));
+
+	for (serdes_num = 0; serdes_num < SL_ASIC_MAX_SERDES; ++serdes_num)
+		core_ldev->serdes.init_work[serdes_num].lgrp_count = 0;
+
+	for_each_set_bit(lgrp_num, lgrp_map, SL_ASIC_MAX_LGRPS) {
+		serdes_num = LGRP_TO_SERDES(lgrp_num);
+		if (serdes_rtn[serdes_num]) {
+			clear_bit(lgrp_num, lgrp_map);
+			continue;
+		}
+		init_work = &core_ldev->serdes.init_work[serdes_num];
+		init_work->core_lgrps[init_work->lgrp_count++] = sl_core_lgrp_get(core_ldev->num, lgrp_num);
+	}
+
+	reinit_completion(&core_ldev->serdes.init_complete);
+	atomic_set(&core_ldev->serdes.init_pending, 1);
+
+	for (serdes_num = 0; serdes_num < SL_ASIC_MAX_SERDES; ++serdes_num) {
+		init_work = &core_ldev->serdes.init_work[serdes_num];
+		if (!init_work->lgrp_count)
+			continue;
+		init_work->phase    = phase;
+		init_work->rtn      = 0;
+		init_work->lgrp_num = 0;
+		atomic_inc(&core_ldev->serdes.init_pending);
+		queue_work(core_ldev->serdes.init_workq, &init_work->work);
+	}
+
+	if (!atomic_dec_and_test(&core_ldev->serdes.init_pending))
+		wait_for_completion(&core_ldev->serdes.init_complete);
+
+	for (serdes_num = 0; serdes_num < SL_ASIC_MAX_SERDES; ++serdes_num) {
+		init_work = &core_ldev->serdes.init_work[serdes_num];
+		if (!init_work->lgrp_count)
+			continue;
+		serdes_us[serdes_num] += init_work->us;
+		if (!init_work->rtn)
+			continue;
+		sl_core_log_err(core_ldev, LOG_NAME, "%s (lgrp_num = %u) failed [%d]",
+			sl_core_ldev_serdes_init_phase_str(phase), init_work->lgrp_num, init_work->rtn);
+		serdes_rtn[serdes_num] = init_work->rtn;
+	}
+}
+
+static void sl_core_ldev_serdes_init_stats_update(struct sl_core_ldev *core_ldev, bool *is_attempted,
+	bool *is_fw_skipped, int *serdes_rtn, u64 *serdes_us)
+{
+	struct sl_core_ldev_serdes_init_stats *stats;
+	u8                                     serdes_num;
+
+	spin_lock(&core_ldev->data_lock);
+	for (serdes_num = 0; serdes_num < SL_ASIC_MAX_SERDES; ++serdes_num) {
+		if (!is_attempted[serdes_num])
+			continue;
+		stats = &core_ldev->serdes.init_stats[serdes_num];
+		stats->attempts++;
+		if (serdes_rtn[serdes_num])
+			stats->failures++;
+		if (is_fw_skipped[serdes_num])
+			stats->fw_skips++;
+		else
+			stats->fw_loads++;
+		stats->is_ok     = (serdes_rtn[serdes_num] == 0);
+		stats->rtn_last  = serdes_rtn[serdes_num];
+		stats->us_last   = serdes_us[serdes_num];
+		stats->us_total += serdes_us[serdes_num];
+	}
+	spin_unlock(&core_ldev->data_lock);
+}
+
+/*
+ * The serdes keeps its firmware when the signature and version it reports
+ * are the ones recorded when the cached image was last loaded into it.
+ */
+static bool sl_core_ldev_serdes_fw_is_running(struct sl_core_lgrp *core_lgrp,
+	const struct sl_core_serdes_fw_image *fw_image)
+{
+	int                              rtn;
+	u8                               serdes_num;
+	struct sl_core_serdes_fw_loaded  loaded;
+	struct sl_serdes_fw_info        *fw_info;
+
+	if (!SL_PLATFORM_IS_HARDWARE(core_lgrp->core_ldev))
+		return false;
+
+	serdes_num = LGRP_TO_SERDES(core_lgrp->num);
+
+	if (!sl_core_serdes_fw_cache_loaded_get(core_lgrp->core_ldev->num, serdes_num, &loaded))
+		return false;
+	if (loaded.image_crc != fw_image->crc)
+		return false;
+
+	rtn = sl_core_hw_serdes_fw_info_get(core_lgrp);
+	if (rtn) {
+		sl_core_log_warn(core_lgrp, LOG_NAME, "serdes_fw_info_get failed [%d]", rtn);
+		return false;
+	}
+
+	fw_info = &core_lgrp->core_ldev->serdes.fw_info[serdes_num];
+
+	sl_core_log_dbg(core_lgrp, LOG_NAME,
+		"fw running (signature = 0x%06X, version = 0x%02X, loaded signature = 0x%06X, loaded version = 0x%02X)",
+		fw_info->signature, fw_info->version, loaded.signature, loaded.version);
+
+	return ((fw_info->signature == loaded.signature) && (fw_info->version == loaded.version));
+}
+
+/*
+ * A retry only runs the serdes that did not come up on the previous attempt.
+ * Serdes that are up have PRAM access disabled, so the broadcast firmware
+ * write only lands on the serdes being retried. The same holds for serdes
+ * skipped because they already run the cached image.
+ */
+int sl_core_ldev_serdes_init(u8 ldev_num, bool is_retry)
+{
+	int                                   rtn;
+	int                                   lgrp_num;
+	int                                   serdes_num;
+	int                                   serdes_rtn[SL_ASIC_MAX_SERDES];
+	u64                                   serdes_us[SL_ASIC_MAX_SERDES];
+	bool                                  is_ok[SL_ASIC_MAX_SERDES];
+	bool                                  is_attempted[SL_ASIC_MAX_SERDES];
+	bool                                  is_fw_skipped[SL_ASIC_MAX_SERDES];
+	ktime_t                               start;
+	s64                                   write_us;
+	struct sl_core_lgrp                  *core_lgrp;
+	struct sl_core_ldev                  *core_ldev;
+	const struct sl_core_serdes_fw_image *fw_image;
+
+	DECLARE_BITMAP(lgrp_map, SL_ASIC_MAX_LGRPS);
+	DECLARE_BITMAP(serdes_lgrp_map, SL_ASIC_MAX_LGRPS);
+	DECLARE_BITMAP(fw_lgrp_map, SL_ASIC_MAX_LGRPS);
 
 	core_ldev = sl_core_ldev_get(ldev_num);
 	if (!core_ldev) {
@@ -37,118 +283,139 @@ int sl_core_ldev_serdes_init(u8 ldev_num)
 		return -EIO;
 	}
 
-	sl_core_log_dbg(core_ldev, LOG_NAME, "serdes_init");
+	sl_core_log_dbg(core_ldev, LOG_NAME, "serdes_init (is_retry = %s)", is_retry ? "true" : "false");
 
 	sl_core_ldev_serdes_is_ready_set(core_ldev, false);
 
-	rtn = request_firmware(&(core_ldev->serdes.fw), SL_HW_SERDES_FW_FILE, sl_device_get());
-	if (rtn) {
-		sl_core_log_err(core_ldev, LOG_NAME, "request_firmware failed [%d]", rtn);
-		return -EIO;
+	if (!is_retry) {
+		spin_lock(&core_ldev->data_lock);
+		for (serdes_num = 0; serdes_num < SL_ASIC_MAX_SERDES; ++serdes_num)
+			core_ldev->serdes.init_stats[serdes_num].is_ok = false;
+		spin_unlock(&core_ldev->data_lock);
 	}
 
+	/* every lgrp, and one lgrp per serdes ip for the per serdes phases */
+	bitmap_zero(lgrp_map, SL_ASIC_MAX_LGRPS);
+	bitmap_zero(serdes_lgrp_map, SL_ASIC_MAX_LGRPS);
+	spin_lock(&core_ldev->data_lock);
+	for (serdes_num = 0; serdes_num < SL_ASIC_MAX_SERDES; ++serdes_num) {
+		is_ok[serdes_num]         = core_ldev->serdes.init_stats[serdes_num].is_ok;
+		is_attempted[serdes_num]  = false;
+		is_fw_skipped[serdes_num] = false;
+		serdes_rtn[serdes_num]    = 0;
+		serdes_us[serdes_num]     = 0;
+	}
+	spin_unlock(&core_ldev->data_lock);
 	for (lgrp_num = 0; lgrp_num < SL_ASIC_MAX_LGRPS; ++lgrp_num) {
 		core_lgrp = sl_core_lgrp_get(ldev_num, lgrp_num);
 		if (!core_lgrp)
 			continue;
-		rtn = sl_core_hw_serdes_init(core_lgrp);
-		if (rtn) {
-			sl_core_log_err(core_ldev, LOG_NAME,
-				"serdes_init (lgrp_num = %u) failed [%d]", lgrp_num, rtn);
-			goto out;
-		}
+		serdes_num = LGRP_TO_SERDES(lgrp_num);
+		if (is_ok[serdes_num])
+			continue;
+		set_bit(lgrp_num, lgrp_map);
+		is_attempted[serdes_num] = true;
+		if ((lgrp_num & BIT(0)) && test_bit(lgrp_num - 1, serdes_lgrp_map))
+			continue;
+		set_bit(lgrp_num, serdes_lgrp_map);
 	}
 
-	/* setup for firmware load per serdes ip */
-	for (lgrp_num = 0; lgrp_num < SL_ASIC_MAX_LGRPS; lgrp_num += 2) {
-		core_lgrp = sl_core_lgrp_get(ldev_num, lgrp_num);
-		if (!core_lgrp) {
-			core_lgrp = sl_core_lgrp_get(ldev_num, lgrp_num + 1);
-			if (!core_lgrp)
+	if (bitmap_empty(lgrp_map, SL_ASIC_MAX_LGRPS)) {
+		sl_core_log_dbg(core_ldev, LOG_NAME, "serdes_init - nothing to init");
+		sl_core_ldev_serdes_is_ready_set(core_ldev, true);
+		return 0;
+	}
+
+	rtn = sl_core_serdes_fw_cache_get(&fw_image);
+	if (rtn) {
+		sl_core_log_err(core_ldev, LOG_NAME, "serdes_fw_cache_get failed [%d]", rtn);
+		return -EIO;
+	}
+	core_ldev->serdes.fw_image = fw_image;
+
+	sl_core_ldev_serdes_init_phase(core_ldev, SL_CORE_LDEV_SERDES_INIT_PHASE_INIT,
+		lgrp_map, serdes_rtn, serdes_us);
+
+	/* serdes already running the cached image don't load it again */
+	bitmap_copy(fw_lgrp_map, serdes_lgrp_map, SL_ASIC_MAX_LGRPS);
+	if (core_ldev->options & SL_LDEV_ATTR_OPT_SERDES_FW_RUNNING_SKIP) {
+		for_each_set_bit(lgrp_num, serdes_lgrp_map, SL_ASIC_MAX_LGRPS) {
+			serdes_num = LGRP_TO_SERDES(lgrp_num);
+			if (serdes_rtn[serdes_num])
 				continue;
-		}
-		rtn = sl_core_hw_serdes_fw_setup(core_lgrp);
-		if (rtn) {
-			sl_core_log_err(core_ldev, LOG_NAME,
-				"serdes_fw_setup (lgrp_num = %u) failed [%d]", lgrp_num, rtn);
-			goto out;
+			if (!sl_core_ldev_serdes_fw_is_running(sl_core_lgrp_get(ldev_num, lgrp_num), fw_image))
+				continue;
+			sl_core_log_dbg(core_ldev, LOG_NAME,
+				"serdes_init (serdes_num = %u) fw running - skipping load", serdes_num);
+			clear_bit(lgrp_num, fw_lgrp_map);
+			is_fw_skipped[serdes_num] = true;
 		}
 	}
+	for_each_set_bit(lgrp_num, fw_lgrp_map, SL_ASIC_MAX_LGRPS)
+		sl_core_serdes_fw_cache_loaded_clr(ldev_num, LGRP_TO_SERDES(lgrp_num));
+
+	/* setup for firmware load per serdes ip */
+	sl_core_ldev_serdes_init_phase(core_ldev, SL_CORE_LDEV_SERDES_INIT_PHASE_FW_SETUP,
+		fw_lgrp_map, serdes_rtn, serdes_us);
 
 	/* broadcast write the firmware to all serdes */
-	for (lgrp_num = 0; lgrp_num < SL_ASIC_MAX_LGRPS; lgrp_num += 2) {
-		core_lgrp = sl_core_lgrp_get(ldev_num, lgrp_num);
-		if (!core_lgrp)
-			continue;
-		rtn = sl_core_hw_serdes_fw_write(core_lgrp);
-		if (rtn) {
+	for_each_set_bit(lgrp_num, fw_lgrp_map, SL_ASIC_MAX_LGRPS) {
+		if (!serdes_rtn[LGRP_TO_SERDES(lgrp_num)])
+			break;
+	}
+	if (lgrp_num < SL_ASIC_MAX_LGRPS) {
+		start    = ktime_get();
+		rtn      = sl_core_hw_serdes_fw_write(sl_core_lgrp_get(ldev_num, lgrp_num));
+		write_us = ktime_us_delta(ktime_get(), start);
+		if (rtn)
 			sl_core_log_err(core_ldev, LOG_NAME,
 				"serdes_fw_write (lgrp_num = %u) failed [%d]", lgrp_num, rtn);
-			goto out;
+		else
+			sl_core_ldev_serdes_fw_load_time_set(core_ldev, write_us);
+		for (serdes_num = 0; serdes_num < SL_ASIC_MAX_SERDES; ++serdes_num) {
+			if (!is_attempted[serdes_num] || is_fw_skipped[serdes_num] || serdes_rtn[serdes_num])
+				continue;
+			serdes_us[serdes_num] += write_us;
+			serdes_rtn[serdes_num] = rtn;
 		}
-		break;
 	}
 
-	/* finish firmware load and start the micros per serdes ip */
-	for (lgrp_num = 0; lgrp_num < SL_ASIC_MAX_LGRPS; lgrp_num += 2) {
-		core_lgrp = sl_core_lgrp_get(ldev_num, lgrp_num);
-		if (!core_lgrp) {
-			core_lgrp = sl_core_lgrp_get(ldev_num, lgrp_num + 1);
-			if (!core_lgrp)
-				continue;
-		}
-		rtn = sl_core_hw_serdes_fw_finish(core_lgrp);
-		if (rtn) {
-			sl_core_log_err(core_ldev, LOG_NAME,
-				"serdes_fw_finish (lgrp_num = %u) failed [%d]", lgrp_num, rtn);
-			goto out;
-		}
-		rtn = sl_core_hw_serdes_fw_info_get(core_lgrp);
-		if (rtn) {
-			sl_core_log_err(core_ldev, LOG_NAME,
-				"serdes_fw_info_get (lgrp_num = %u) failed [%d]", lgrp_num, rtn);
-			goto out;
-		}
-		rtn = sl_core_hw_serdes_hw_info_get(core_lgrp);
-		if (rtn) {
-			sl_core_log_err(core_ldev, LOG_NAME,
-				"serdes_hw_info_get (lgrp_num = %u) failed [%d]", lgrp_num, rtn);
-			goto out;
-		}
-		rtn = sl_core_hw_serdes_core_init(core_lgrp);
-		if (rtn) {
-			sl_core_log_err(core_ldev, LOG_NAME,
-				"serdes_core_init (lgrp_num = %u) failed [%d]", lgrp_num, rtn);
-			goto out;
-		}
-		rtn = sl_core_hw_serdes_core_pll(core_lgrp,
-			SL_CORE_HW_SERDES_CLOCKING_85, SL_CORE_HW_SERDES_TX_PLL_BW_DEFAULT);
-		if (rtn) {
-			sl_core_log_err(core_ldev, LOG_NAME,
-				"serdes_core_pll (lgrp_num = %u) failed [%d]", lgrp_num, rtn);
-			goto out;
-		}
+	/* finish firmware load per serdes ip */
+	sl_core_ldev_serdes_init_phase(core_ldev, SL_CORE_LDEV_SERDES_INIT_PHASE_FW_FINISH,
+		fw_lgrp_map, serdes_rtn, serdes_us);
+
+	/* start the micros per serdes ip */
+	sl_core_ldev_serdes_init_phase(core_ldev, SL_CORE_LDEV_SERDES_INIT_PHASE_CORE_INIT,
+		serdes_lgrp_map, serdes_rtn, serdes_us);
+
+	sl_core_ldev_serdes_init_phase(core_ldev, SL_CORE_LDEV_SERDES_INIT_PHASE_SWIZZLES,
+		lgrp_map, serdes_rtn, serdes_us);
+
+	sl_core_ldev_serdes_init_stats_update(core_ldev, is_attempted, is_fw_skipped, serdes_rtn, serdes_us);
+
+	/* record what each freshly loaded serdes now runs */
+	for (serdes_num = 0; serdes_num < SL_ASIC_MAX_SERDES; ++serdes_num) {
+		if (!is_attempted[serdes_num] || is_fw_skipped[serdes_num] || serdes_rtn[serdes_num])
+			continue;
+		sl_core_serdes_fw_cache_loaded_set(ldev_num, serdes_num,
+			core_ldev->serdes.fw_info[serdes_num].signature,
+			core_ldev->serdes.fw_info[serdes_num].version, fw_image->crc);
 	}
 
-	for (lgrp_num = 0; lgrp_num < SL_ASIC_MAX_LGRPS; ++lgrp_num) {
-		core_lgrp = sl_core_lgrp_get(ldev_num, lgrp_num);
-		if (!core_lgrp)
+	rtn = 0;
+	for (serdes_num = 0; serdes_num < SL_ASIC_MAX_SERDES; ++serdes_num) {
+		if (!serdes_rtn[serdes_num])
 			continue;
-		rtn = sl_core_hw_serdes_swizzles(core_lgrp);
-		if (rtn) {
-			sl_core_log_err(core_ldev, LOG_NAME,
-				"serdes_swizzles (lgrp_num = %u) failed [%d]", lgrp_num, rtn);
-			goto out;
-		}
+		sl_core_log_err(core_ldev, LOG_NAME,
+			"serdes_init (serdes_num = %u) failed [%d]", serdes_num, serdes_rtn[serdes_num]);
+		rtn = serdes_rtn[serdes_num];
 	}
+	if (rtn)
+		return rtn;
 
 	sl_core_ldev_serdes_is_ready_set(core_ldev, true);
 
-	rtn = 0;
-out:
-	release_firmware(core_ldev->serdes.fw);
-
-	return rtn;
+	return 0;
 }
 
 void sl_core_ldev_del(u8 ldev_num)
@@ -184,3 +451,32 @@ bool sl_core_ldev_serdes_is_ready(struct sl_core_ldev *core_ldev)
 
 	return is_ready;
 }
+
+void sl_core_ldev_serdes_fw_load_time_set(struct sl_core_ldev *core_ldev, u64 load_time_us)
+{
+	sl_core_log_dbg(core_ldev, LOG_NAME,
+		"set fw_load_time to %lluus", load_time_us);
+
+	spin_lock(&core_ldev->data_lock);
+	core_ldev->serdes.fw_load_time_us = load_time_us;
+	spin_unlock(&core_ldev->data_lock);
+}
+
+u64 sl_core_ldev_serdes_fw_load_time_get(struct sl_core_ldev *core_ldev)
+{
+	u64 load_time_us;
+
+	spin_lock(&core_ldev->data_lock);
+	load_time_us = core_ldev->serdes.fw_load_time_us;
+	spin_unlock(&core_ldev->data_lock);
+
+	return load_time_us;
+}
+
+void sl_core_ldev_serdes_init_stats_get(struct sl_core_ldev *core_ldev, u8 serdes_num,
+					struct sl_core_ldev_serdes_init_stats *stats)
+{
+	spin_lock(&core_ldev->data_lock);
+	*stats = core_ldev->serdes.init_stats[serdes_num];
+	spin_unlock(&core_ldev->data_lock);
+}
@@ -1,18 +1,24 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2021,2022,2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2021,2022,2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_CORE_LDEV_H_
 #define _SL_CORE_LDEV_H_
 
 #include <linux/spinlock.h>
+#include <linux/mutex.h>
 #include <linux/workqueue.h>
+#include <linux/completion.h>
+#include <linux/atomic.h>
 
 #include <linux/hpe/sl/sl_ldev.h>
 
 #include "sl_asic.h"
+#include "base/sl_core_workq.h"
 
 struct sl_accessors;
 struct sl_ops;
+struct sl_core_lgrp;
+struct sl_core_serdes_fw_image;
 
 struct sl_serdes_fw_info {
 	u32 signature;
@@ -35,6 +41,38 @@ struct sl_serdes_hw_info {
 	u8 num_plls;
 };
 
+enum sl_core_ldev_serdes_init_phase {
+	SL_CORE_LDEV_SERDES_INIT_PHASE_INIT,      /* per lgrp   */
+	SL_CORE_LDEV_SERDES_INIT_PHASE_FW_SETUP,  /* per serdes */
+	SL_CORE_LDEV_SERDES_INIT_PHASE_FW_FINISH, /* per serdes */
+	SL_CORE_LDEV_SERDES_INIT_PHASE_CORE_INIT, /* per serdes */
+	SL_CORE_LDEV_SERDES_INIT_PHASE_SWIZZLES,  /* per lgrp   */
+};
+
+#define SL_CORE_LDEV_SERDES_LGRPS 2
+
+/* one per serdes, runs the serdes' lgrps in order */
+struct sl_core_ldev_serdes_init_work {
+	struct work_struct   work;
+	struct sl_core_lgrp *core_lgrps[SL_CORE_LDEV_SERDES_LGRPS];
+	u8                   lgrp_count;
+	u32                  phase;
+	int                  rtn;
+	u8                   lgrp_num;
+	u64                  us;
+};
+
+struct sl_core_ldev_serdes_init_stats {
+	bool is_ok;
+	u32  attempts;
+	u32  failures;
+	int  rtn_last;
+	u64  us_last;
+	u64  us_total;
+	u32  fw_loads;
+	u32  fw_skips;
+};
+
 #define SL_CORE_LDEV_MAGIC 0x73734c44
 struct sl_core_ldev {
 	u32                       magic;
@@ -45,29 +83,49 @@ struct sl_core_ldev {
 
 	struct sl_accessors       accessors;
 	struct sl_ops             ops;
+	u32                       options;
 
 	spinlock_t                data_lock;
 
 	struct {
-		const struct firmware    *fw;
-		struct sl_serdes_hw_info  hw_info[SL_ASIC_MAX_SERDES];
-		struct sl_serdes_fw_info  fw_info[SL_ASIC_MAX_SERDES];
-		bool                      is_ready;
-		u16                      *addrs;
+		const struct sl_core_serdes_fw_image *fw_image;
+		struct sl_serdes_hw_info              hw_info[SL_ASIC_MAX_SERDES];
+		struct sl_serdes_fw_info              fw_info[SL_ASIC_MAX_SERDES];
+		bool                                  is_ready;
+		u16                                  *addrs;
+		u64                                   fw_load_time_us;
+
+		struct workqueue_struct               *init_workq;
+		struct sl_core_ldev_serdes_init_work   init_work[SL_ASIC_MAX_SERDES];
+		atomic_t                               init_pending;
+		struct completion                      init_complete;
+		struct sl_core_ldev_serdes_init_stats  init_stats[SL_ASIC_MAX_SERDES];
+
+		/* the uc ram AHB read sequence is shared by the serdes' lgrps */
+		struct mutex                           uc_ram_lock[SL_ASIC_MAX_SERDES];
 	} serdes;
 
 	struct workqueue_struct  *workqueue;
+	struct sl_core_workq      workqs[SL_CORE_WORKQ_NUM_SHARDS];
 };
 
 int                  sl_core_ldev_new(u8 ldev_num,
 				      struct sl_accessors *assessors,
 				      struct sl_ops *ops,
-				      struct workqueue_struct *workqueue);
-int                  sl_core_ldev_serdes_init(u8 ldev_num);
+				      struct workqueue_struct *workqueue,
+				      u32 options);
+int                  sl_core_ldev_serdes_init(u8 ldev_num, bool is_retry);
+void                 sl_core_ldev_serdes_init_work(struct work_struct *work);
 void                 sl_core_ldev_del(u8 ldev_num);
 struct sl_core_ldev *sl_core_ldev_get(u8 ldev_num);
 
 void sl_core_ldev_serdes_is_ready_set(struct sl_core_ldev *core_ldev, bool ready);
 bool sl_core_ldev_serdes_is_ready(struct sl_core_ldev *core_ldev);
 
+void sl_core_ldev_serdes_fw_load_time_set(struct sl_core_ldev *core_ldev, u64 load_time_us);
+u64  sl_core_ldev_serdes_fw_load_time_get(struct sl_core_ldev *core_ldev);
+
+void sl_core_ldev_serdes_init_stats_get(struct sl_core_ldev *core_ldev, u8 serdes_num,
+					struct sl_core_ldev_serdes_init_stats *stats);
+
 #endif /* _SL_CORE_LDEV_H_ */
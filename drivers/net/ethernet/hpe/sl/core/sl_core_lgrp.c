@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2022,2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2022,2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/spinlock.h>
 
@@ -172,6 +172,21 @@ int sl_core_lgrp_eye_lower_get(struct sl_core_lgrp *core_lgrp, u8 asic_lane_num,
 	return sl_core_hw_serdes_eye_lower_get(core_lgrp, asic_lane_num, eye_lower);
 }
 
+int sl_core_lgrp_eyes_get(struct sl_core_lgrp *core_lgrp, u8 *eye_upper, u8 *eye_lower)
+{
+	return sl_core_hw_serdes_eyes_get(core_lgrp, eye_upper, eye_lower);
+}
+
+int sl_core_lgrp_eyes_sample(struct sl_core_lgrp *core_lgrp)
+{
+	return sl_core_hw_serdes_eyes_sample(core_lgrp);
+}
+
+void sl_core_lgrp_eyes_snapshot_get(struct sl_core_lgrp *core_lgrp, struct sl_core_lgrp_eyes *eyes)
+{
+	sl_core_data_lgrp_eyes_get(core_lgrp, eyes);
+}
+
 /* Shift media lane data based on the table below,
  *
  * | pgrp num | jack type | Swap Nibble |
@@ -249,387 +264,430 @@ int sl_core_lgrp_rx_lane_is_los(u8 ldev_num, u8 lgrp_num, u8 asic_lane_num, bool
 
 int sl_core_lgrp_pmi_rd_addr_get(struct sl_core_lgrp *core_lgrp, u16 *addr)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*addr = core_lgrp->pmi.rd.addr;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_PMI_RD, &rec);
+	*addr = rec.addr;
 
 	return 0;
 }
 
 int sl_core_lgrp_pmi_rd_data_get(struct sl_core_lgrp *core_lgrp, u16 *data)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*data = core_lgrp->pmi.rd.data;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_PMI_RD, &rec);
+	*data = rec.data;
 
 	return 0;
 }
 
 int sl_core_lgrp_pmi_rd_dev_id_get(struct sl_core_lgrp *core_lgrp, u8 *dev_id)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*dev_id = core_lgrp->pmi.rd.dev_id;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_PMI_RD, &rec);
+	*dev_id = rec.dev_id;
 
 	return 0;
 }
 
 int sl_core_lgrp_pmi_rd_lane_get(struct sl_core_lgrp *core_lgrp, u8 *lane)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*lane = core_lgrp->pmi.rd.lane;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_PMI_RD, &rec);
+	*lane = rec.lane;
 
 	return 0;
 }
 
 int sl_core_lgrp_pmi_rd_pll_get(struct sl_core_lgrp *core_lgrp, u8 *pll)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*pll = core_lgrp->pmi.rd.pll;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_PMI_RD, &rec);
+	*pll = rec.pll;
 
 	return 0;
 }
 
 int sl_core_lgrp_pmi_rd_result_get(struct sl_core_lgrp *core_lgrp, int *result)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*result = core_lgrp->pmi.rd.result;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_PMI_RD, &rec);
+	*result = rec.result;
 
 	return 0;
 }
 
 int sl_core_lgrp_pmi_wr_addr_get(struct sl_core_lgrp *core_lgrp, u16 *addr)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*addr = core_lgrp->pmi.wr.addr;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_PMI_WR, &rec);
+	*addr = rec.addr;
 
 	return 0;
 }
 
 int sl_core_lgrp_pmi_wr_data_get(struct sl_core_lgrp *core_lgrp, u16 *data)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*data = core_lgrp->pmi.wr.data;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_PMI_WR, &rec);
+	*data = rec.data;
 
 	return 0;
 }
 
 int sl_core_lgrp_pmi_wr_mask_get(struct sl_core_lgrp *core_lgrp, u16 *mask)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*mask = core_lgrp->pmi.wr.mask;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_PMI_WR, &rec);
+	*mask = rec.mask;
 
 	return 0;
 }
 
 int sl_core_lgrp_pmi_wr_dev_id_get(struct sl_core_lgrp *core_lgrp, u8 *dev_id)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*dev_id = core_lgrp->pmi.wr.dev_id;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_PMI_WR, &rec);
+	*dev_id = rec.dev_id;
 
 	return 0;
 }
 
 int sl_core_lgrp_pmi_wr_lane_get(struct sl_core_lgrp *core_lgrp, u8 *lane)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*lane = core_lgrp->pmi.wr.lane;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_PMI_WR, &rec);
+	*lane = rec.lane;
 
 	return 0;
 }
 
 int sl_core_lgrp_pmi_wr_pll_get(struct sl_core_lgrp *core_lgrp, u8 *pll)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*pll = core_lgrp->pmi.wr.pll;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_PMI_WR, &rec);
+	*pll = rec.pll;
 
 	return 0;
 }
 
 int sl_core_lgrp_pmi_wr_result_get(struct sl_core_lgrp *core_lgrp, int *result)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*result = core_lgrp->pmi.wr.result;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_PMI_WR, &rec);
+	*result = rec.result;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_rd_dev_addr_get(struct sl_core_lgrp *core_lgrp, u8 *dev_addr)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*dev_addr = core_lgrp->sbus.rd.dev_addr;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_RD, &rec);
+	*dev_addr = rec.dev_addr;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_rd_data_get(struct sl_core_lgrp *core_lgrp, u32 *data)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*data = core_lgrp->sbus.rd.data;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_RD, &rec);
+	*data = rec.data;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_rd_mask_get(struct sl_core_lgrp *core_lgrp, u32 *mask)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*mask = core_lgrp->sbus.rd.mask;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_RD, &rec);
+	*mask = rec.mask;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_rd_reg_get(struct sl_core_lgrp *core_lgrp, u8 *reg)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*reg = core_lgrp->sbus.rd.reg;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_RD, &rec);
+	*reg = rec.reg;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_rd_lsb_get(struct sl_core_lgrp *core_lgrp, u8 *lsb)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*lsb = core_lgrp->sbus.rd.lsb;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_RD, &rec);
+	*lsb = rec.lsb;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_rd_result_get(struct sl_core_lgrp *core_lgrp, int *result)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*result = core_lgrp->sbus.rd.result;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_RD, &rec);
+	*result = rec.result;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_wr_dev_addr_get(struct sl_core_lgrp *core_lgrp, u8 *dev_addr)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*dev_addr = core_lgrp->sbus.wr.dev_addr;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_WR, &rec);
+	*dev_addr = rec.dev_addr;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_wr_data_get(struct sl_core_lgrp *core_lgrp, u32 *data)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*data = core_lgrp->sbus.wr.data;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_WR, &rec);
+	*data = rec.data;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_wr_mask_get(struct sl_core_lgrp *core_lgrp, u32 *mask)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*mask = core_lgrp->sbus.wr.mask;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_WR, &rec);
+	*mask = rec.mask;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_wr_reg_get(struct sl_core_lgrp *core_lgrp, u8 *reg)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*reg = core_lgrp->sbus.wr.reg;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_WR, &rec);
+	*reg = rec.reg;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_wr_lsb_get(struct sl_core_lgrp *core_lgrp, u8 *lsb)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*lsb = core_lgrp->sbus.wr.lsb;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_WR, &rec);
+	*lsb = rec.lsb;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_wr_result_get(struct sl_core_lgrp *core_lgrp, int *result)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*result = core_lgrp->sbus.wr.result;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_WR, &rec);
+	*result = rec.result;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_rst_dev_addr_get(struct sl_core_lgrp *core_lgrp, u8 *dev_addr)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*dev_addr = core_lgrp->sbus.rst.dev_addr;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_RST, &rec);
+	*dev_addr = rec.dev_addr;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_rst_result_get(struct sl_core_lgrp *core_lgrp, int *result)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*result = core_lgrp->sbus.rst.result;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_RST, &rec);
+	*result = rec.result;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_pmi_rd_dev_addr_get(struct sl_core_lgrp *core_lgrp, u8 *dev_addr)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*dev_addr = core_lgrp->sbus_pmi.rd.dev_addr;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_RD, &rec);
+	*dev_addr = rec.dev_addr;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_pmi_rd_addr_get(struct sl_core_lgrp *core_lgrp, u16 *addr)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*addr = core_lgrp->sbus_pmi.rd.addr;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_RD, &rec);
+	*addr = rec.addr;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_pmi_rd_data_get(struct sl_core_lgrp *core_lgrp, u16 *data)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*data = core_lgrp->sbus_pmi.rd.data;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_RD, &rec);
+	*data = rec.data;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_pmi_rd_mask_get(struct sl_core_lgrp *core_lgrp, u16 *mask)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*mask = core_lgrp->sbus_pmi.rd.mask;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_RD, &rec);
+	*mask = rec.mask;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_pmi_rd_dev_id_get(struct sl_core_lgrp *core_lgrp, u8 *dev_id)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*dev_id = core_lgrp->sbus_pmi.rd.dev_id;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_RD, &rec);
+	*dev_id = rec.dev_id;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_pmi_rd_lane_get(struct sl_core_lgrp *core_lgrp, u8 *lane)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*lane = core_lgrp->sbus_pmi.rd.lane;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_RD, &rec);
+	*lane = rec.lane;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_pmi_rd_pll_get(struct sl_core_lgrp *core_lgrp, u8 *pll)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*pll = core_lgrp->sbus_pmi.rd.pll;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_RD, &rec);
+	*pll = rec.pll;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_pmi_rd_result_get(struct sl_core_lgrp *core_lgrp, int *result)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*result = core_lgrp->sbus_pmi.rd.result;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_RD, &rec);
+	*result = rec.result;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_pmi_wr_dev_addr_get(struct sl_core_lgrp *core_lgrp, u8 *dev_addr)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*dev_addr = core_lgrp->sbus_pmi.wr.dev_addr;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_WR, &rec);
+	*dev_addr = rec.dev_addr;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_pmi_wr_addr_get(struct sl_core_lgrp *core_lgrp, u16 *addr)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*addr = core_lgrp->sbus_pmi.wr.addr;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_WR, &rec);
+	*addr = rec.addr;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_pmi_wr_data_get(struct sl_core_lgrp *core_lgrp, u16 *data)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*data = core_lgrp->sbus_pmi.wr.data;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_WR, &rec);
+	*data = rec.data;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_pmi_wr_mask_get(struct sl_core_lgrp *core_lgrp, u16 *mask)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*mask = core_lgrp->sbus_pmi.wr.mask;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_WR, &rec);
+	*mask = rec.mask;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_pmi_wr_dev_id_get(struct sl_core_lgrp *core_lgrp, u8 *dev_id)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*dev_id = core_lgrp->sbus_pmi.wr.dev_id;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_WR, &rec);
+	*dev_id = rec.dev_id;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_pmi_wr_lane_get(struct sl_core_lgrp *core_lgrp, u8 *lane)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*lane = core_lgrp->sbus_pmi.wr.lane;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_WR, &rec);
+	*lane = rec.lane;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_pmi_wr_pll_get(struct sl_core_lgrp *core_lgrp, u8 *pll)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*pll = core_lgrp->sbus_pmi.wr.pll;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_WR, &rec);
+	*pll = rec.pll;
 
 	return 0;
 }
 
 int sl_core_lgrp_sbus_pmi_wr_result_get(struct sl_core_lgrp *core_lgrp, int *result)
 {
-	spin_lock(&core_lgrp->data_lock);
-	*result = core_lgrp->sbus_pmi.wr.result;
-	spin_unlock(&core_lgrp->data_lock);
+	struct sl_core_op_hist_rec rec;
+
+	sl_core_op_hist_last_get(core_lgrp, SL_CORE_OP_HIST_OP_SBUS_PMI_WR, &rec);
+	*result = rec.result;
 
 	return 0;
 }
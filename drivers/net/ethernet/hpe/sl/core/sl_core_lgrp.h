@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2021,2022,2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2021,2022,2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_CORE_LGRP_H_
 #define _SL_CORE_LGRP_H_
@@ -10,6 +10,7 @@
 
 #include "sl_asic.h"
 #include "base/sl_core_log.h"
+#include "base/sl_core_op_hist.h"
 #include "sl_core_ldev.h"
 
 enum sl_dt_jack_type {
@@ -21,12 +22,66 @@ enum sl_dt_jack_type {
 	SL_DT_JACK_TYPE_HIGH,
 };
 
+enum sl_core_link_up_phase {
+	SL_CORE_LINK_UP_PHASE_AN = 0,
+	SL_CORE_LINK_UP_PHASE_START,
+	SL_CORE_LINK_UP_PHASE_MEDIA,
+	SL_CORE_LINK_UP_PHASE_SERDES,
+	SL_CORE_LINK_UP_PHASE_PCS_LOCK,
+	SL_CORE_LINK_UP_PHASE_UP_CHECK,
+	SL_CORE_LINK_UP_PHASE_FEC_SETTLE,
+	SL_CORE_LINK_UP_PHASE_FEC_CHECK,
+	SL_CORE_LINK_UP_PHASE_COUNT, /* must be last */
+};
+
+#define SL_CORE_LINK_UP_PHASE_NONE SL_CORE_LINK_UP_PHASE_COUNT
+
+/* bucket 0 is under 1ms, bucket N is [2^(N-1), 2^N) ms, last bucket is open ended */
+#define SL_CORE_LINK_UP_HIST_NUM_BUCKETS 16
+
+struct sl_core_link_up_hist {
+	u32 buckets[SL_CORE_LINK_UP_PHASE_COUNT][SL_CORE_LINK_UP_HIST_NUM_BUCKETS];
+};
+
+enum sl_core_serdes_settle_step {
+	SL_CORE_SERDES_SETTLE_UC_ACTIVE = 0,
+	SL_CORE_SERDES_SETTLE_CLOCK_INIT,
+	SL_CORE_SERDES_SETTLE_PLL_LOCK,
+	SL_CORE_SERDES_SETTLE_COUNT, /* must be last */
+};
+
+/* time from the step's trigger write to the poll that saw it ready */
+struct sl_core_serdes_settle_stats {
+	u32 count;
+	u32 timeouts;
+	u32 polls_last;
+	u32 us_last;
+	u32 us_max;
+	u64 us_sum;
+};
+
+/* history is a ring, the next sample goes in num_samples % SL_CORE_LGRP_EYES_HIST_NUM */
+#define SL_CORE_LGRP_EYES_HIST_NUM 16
+
+struct sl_core_lgrp_eyes {
+	u64     timestamp_ns;
+	u8      active_lanes;
+	struct {
+		u8      upper;
+		u8      lower;
+		u32     num_samples;
+		u8      upper_hist[SL_CORE_LGRP_EYES_HIST_NUM];
+		u8      lower_hist[SL_CORE_LGRP_EYES_HIST_NUM];
+	} lanes[SL_MAX_LANES];
+};
+
 #define SL_CORE_LGRP_MAGIC 0x736c474D
 struct sl_core_lgrp {
 	u32                             magic;
 	u32                             num;
 
 	struct sl_core_ldev            *core_ldev;
+	struct sl_core_workq           *core_workq;
 
 	spinlock_t                      data_lock;
 
@@ -55,70 +110,26 @@ struct sl_core_lgrp {
 	} serdes;
 
 	struct {
-		struct {
-			u16             addr;
-			u16             data;
-			u8              dev_id;
-			u8              lane;
-			u8              pll;
-			int             result;
-		} rd;
-		struct {
-			u16             addr;
-			u16             data;
-			u16             mask;
-			u8              dev_id;
-			u8              lane;
-			u8              pll;
-			int             result;
-		} wr;
-	} pmi;
+		atomic64_t              pmi_ops;
+		atomic64_t              bytes;
+	} uc_ram;
+
+	struct sl_core_op_hist          op_hist;
 
 	struct {
-		struct {
-			u8              dev_addr;
-			u32             data;
-			u32             mask;
-			u8              reg;
-			u8              lsb;
-			int             result;
-		} rd;
-		struct {
-			u8              dev_addr;
-			u32             data;
-			u32             mask;
-			u8              reg;
-			u8              lsb;
-			int             result;
-		} wr;
-		struct {
-			u8              dev_addr;
-			int             result;
-		} rst;
-	} sbus;
+		spinlock_t                  data_lock;
+		struct sl_core_link_up_hist hist;
+	} link_up;
 
 	struct {
-		struct {
-			u8              dev_addr;
-			u16             addr;
-			u16             data;
-			u16             mask;
-			u8              dev_id;
-			u8              lane;
-			u8              pll;
-			int             result;
-		} rd;
-		struct {
-			u8              dev_addr;
-			u16             addr;
-			u16             data;
-			u16             mask;
-			u8              dev_id;
-			u8              lane;
-			u8              pll;
-			int             result;
-		} wr;
-	} sbus_pmi;
+		spinlock_t                  data_lock;
+		struct sl_core_lgrp_eyes    snapshot;
+	} eyes;
+
+	struct {
+		spinlock_t                         data_lock;
+		struct sl_core_serdes_settle_stats stats[SL_CORE_SERDES_SETTLE_COUNT];
+	} serdes_settle;
 
 	// FIXME: for now only enable at the lgrp level
 	bool err_trace_enable;
@@ -147,6 +158,9 @@ int sl_core_lgrp_dfe_get(struct sl_core_lgrp *core_lgrp, u8 asic_lane_num, u8 *w
 int sl_core_lgrp_scramble_dis_get(struct sl_core_lgrp *core_lgrp, u8 asic_lane_num, u8 *scramble_dis);
 int sl_core_lgrp_eye_upper_get(struct sl_core_lgrp *core_lgrp, u8 asic_lane_num, u8 *eye_upper);
 int sl_core_lgrp_eye_lower_get(struct sl_core_lgrp *core_lgrp, u8 asic_lane_num, u8 *eye_lower);
+int sl_core_lgrp_eyes_get(struct sl_core_lgrp *core_lgrp, u8 *eye_upper, u8 *eye_lower);
+int sl_core_lgrp_eyes_sample(struct sl_core_lgrp *core_lgrp);
+void sl_core_lgrp_eyes_snapshot_get(struct sl_core_lgrp *core_lgrp, struct sl_core_lgrp_eyes *eyes);
 
 bool sl_core_lgrp_media_lane_data_swap(u8 ldev_num, u8 lgrp_num);
 u32  sl_core_lgrp_jack_part_get(u8 ldev_num, u8 lgrp_num);
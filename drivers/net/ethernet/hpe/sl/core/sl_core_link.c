@@ -10,6 +10,7 @@
 #include "data/sl_core_data_mac.h"
 #include "data/sl_core_data_llr.h"
 #include "hw/sl_core_hw_link.h"
+#include "sl_trace.h"
 
 #define LOG_NAME SL_CORE_LINK_LOG_NAME
 
@@ -61,6 +62,7 @@ int sl_core_link_up(u8 ldev_num, u8 lgrp_num, u8 link_num,
 		sl_core_log_dbg(core_link, LOG_NAME, "up - going up");
 		core_link->link.state = is_flag_set(core_link->config.flags, SL_LINK_CONFIG_OPT_AUTONEG_ENABLE) ?
 			SL_CORE_LINK_STATE_AN : SL_CORE_LINK_STATE_GOING_UP;
+		trace_sl_core_link_state(core_link, core_link->link.state);
 		link_state = core_link->link.state;
 		spin_unlock(&core_link->link.data_lock);
 		sl_media_jack_led_set(core_link->core_lgrp->core_ldev->num, core_link->core_lgrp->num);
@@ -94,8 +96,8 @@ int sl_core_link_up_fail(struct sl_core_link *core_link)
 	case SL_CORE_LINK_STATE_AN:
 		sl_core_log_dbg(core_link, LOG_NAME, "up fail - going down");
 		core_link->link.state = SL_CORE_LINK_STATE_GOING_DOWN;
-		if (!queue_work(core_link->core_lgrp->core_ldev->workqueue,
-			&(core_link->work[SL_CORE_WORK_LINK_UP_FAIL])))
+		trace_sl_core_link_state(core_link, core_link->link.state);
+		if (!sl_core_work_link_queue(core_link, SL_CORE_WORK_LINK_UP_FAIL))
 			sl_core_log_warn(core_link, LOG_NAME, "already queued (work_num = %u)",
 				SL_CORE_WORK_LINK_UP_FAIL);
 		spin_unlock(&core_link->link.data_lock);
@@ -140,10 +142,10 @@ int sl_core_link_cancel(u8 ldev_num, u8 lgrp_num, u8 link_num,
 		core_link->link.tags.down       = tag;
 		core_link->link.callbacks.down  = callback;
 		core_link->link.state           = SL_CORE_LINK_STATE_CANCELING;
+		trace_sl_core_link_state(core_link, core_link->link.state);
 		spin_unlock(&core_link->link.data_lock);
 		sl_core_data_link_last_up_fail_cause_map_set(core_link, SL_LINK_DOWN_CAUSE_CANCELED_MAP);
-		if (!queue_work(core_link->core_lgrp->core_ldev->workqueue,
-			&(core_link->work[SL_CORE_WORK_LINK_UP_CANCEL])))
+		if (!sl_core_work_link_queue(core_link, SL_CORE_WORK_LINK_UP_CANCEL))
 			sl_core_log_warn(core_link, LOG_NAME, "already queued (work_num = %u)",
 				SL_CORE_WORK_LINK_UP_CANCEL);
 		return 0;
@@ -185,10 +187,10 @@ int sl_core_link_down(u8 ldev_num, u8 lgrp_num, u8 link_num,
 		core_link->link.tags.down      = tag;
 		core_link->link.callbacks.down = callback;
 		core_link->link.state          = SL_CORE_LINK_STATE_GOING_DOWN;
+		trace_sl_core_link_state(core_link, core_link->link.state);
 		spin_unlock(&core_link->link.data_lock);
 		sl_core_data_link_last_down_cause_map_set(core_link, down_cause_map);
-		if (!queue_work(core_link->core_lgrp->core_ldev->workqueue,
-			&(core_link->work[SL_CORE_WORK_LINK_DOWN])))
+		if (!sl_core_work_link_queue(core_link, SL_CORE_WORK_LINK_DOWN))
 			sl_core_log_warn(core_link, LOG_NAME,
 					 "already queued (work_num = %u)", SL_CORE_WORK_LINK_DOWN);
 		sl_media_jack_led_set(core_link->core_lgrp->core_ldev->num, core_link->core_lgrp->num);
@@ -302,6 +304,7 @@ int sl_core_link_config_set(u8 ldev_num, u8 lgrp_num, u8 link_num,
 	case SL_CORE_LINK_STATE_CONFIGURED:
 	case SL_CORE_LINK_STATE_DOWN:
 		core_link->link.state = SL_CORE_LINK_STATE_CONFIGURING;
+		trace_sl_core_link_state(core_link, core_link->link.state);
 		spin_unlock(&core_link->link.data_lock);
 		sl_core_data_link_config_set(core_link, link_config);
 		return 0;
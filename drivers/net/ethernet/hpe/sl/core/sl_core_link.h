@@ -16,6 +16,8 @@
 #include "sl_core_link_an.h"
 #include "sl_core_link_fec.h"
 #include "hw/sl_core_hw_intr.h"
+#include "hw/sl_core_hw_fec.h"
+#include "hw/sl_core_hw_reg_txn.h"
 #include "hw/sl_core_hw_serdes.h"
 #include "hw/sl_core_hw_reset.h"
 #include "base/sl_core_timer_link.h"
@@ -286,6 +288,29 @@ struct sl_core_link_fecl_kobj {
 #define PML_REC_DOWN_CAUSE_LOCAL_FAULT   2
 #define PML_REC_DOWN_CAUSE_REMOTE_FAULT  3
 
+/* recovery success is rechecked this often without holding a worker */
+#define SL_CORE_LINK_PML_REC_POLL_MS 4
+
+/* bucket 0 is under 1ms, bucket N is [2^(N-1), 2^N) ms, last bucket is open ended */
+#define SL_CORE_LINK_PML_REC_HIST_NUM_BUCKETS 16
+
+/* attempt start to the poll that saw success or gave up */
+struct sl_core_link_pml_rec_hist {
+	u64 count;
+	u32 success[SL_CORE_LINK_PML_REC_HIST_NUM_BUCKETS];
+	u32 fail[SL_CORE_LINK_PML_REC_HIST_NUM_BUCKETS];
+};
+
+/* bucket 0 is under 1us, bucket N is [2^(N-1), 2^N) us, last bucket is open ended */
+#define SL_CORE_LINK_INTR_HIST_NUM_BUCKETS 20
+
+/* lat is handler entry to work start, run is work duration */
+struct sl_core_link_intr_hist {
+	u64 count;
+	u32 lat[SL_CORE_LINK_INTR_HIST_NUM_BUCKETS];
+	u32 run[SL_CORE_LINK_INTR_HIST_NUM_BUCKETS];
+};
+
 #define SL_CORE_LINK_MAGIC 0x736c4C4E
 struct sl_core_link {
 	u32                              magic;
@@ -332,17 +357,35 @@ struct sl_core_link {
 
 	struct kobject			     pml_rec_kobj;
 	struct {
-		struct sl_link_pml_rec_info  pml_rec_info;
-		atomic_t                     pml_rec_running;
-		atomic_t                     pml_rec_rate_limit_exceeded;
-		atomic_t                     pml_rec_down_cause_remote_fault;
-		ktime_t                      pml_rec_window_start_time;
-		ktime_t                      pml_rec_attempt_start_time;
-		ktime_t                      pml_rec_attempts_total_time;
-		ktime_t                      pml_rec_poll_start_time;
-		u8                           pml_rec_last_down_cause;
+		struct sl_link_pml_rec_info       pml_rec_info;
+		atomic_t                          pml_rec_running;
+		atomic_t                          pml_rec_rate_limit_exceeded;
+		atomic_t                          pml_rec_down_cause_remote_fault;
+		ktime_t                           pml_rec_window_start_time;
+		ktime_t                           pml_rec_attempt_start_time;
+		ktime_t                           pml_rec_attempts_total_time;
+		ktime_t                           pml_rec_poll_start_time;
+		u8                                pml_rec_last_down_cause;
+		spinlock_t                        data_lock;
+		struct sl_core_link_pml_rec_hist  hist;
 	} pml_rec;
 
+	struct kobject                   up_phase_kobj;
+	struct {
+		spinlock_t                   data_lock;
+		u32                          phase;
+		ktime_t                      phase_start;
+		u32                          last_ms[SL_CORE_LINK_UP_PHASE_COUNT];
+		struct sl_core_link_up_hist  hist;
+	} up_phase;
+
+	struct kobject                   intr_kobj;
+	struct {
+		spinlock_t                     data_lock;
+		u64                            entry_ns[SL_CORE_HW_INTR_COUNT];
+		struct sl_core_link_intr_hist  hist[SL_CORE_HW_INTR_COUNT];
+	} intr_lat;
+
 	struct {
 		spinlock_t                            data_lock;
 		u32                                   link_state;
@@ -393,6 +436,7 @@ struct sl_core_link {
 		bool                             use_test_settings;
 		spinlock_t                       data_lock;
 		u8                               serdes_state;
+		u32                              lanes_up_phase_us[SL_CORE_HW_SERDES_LANES_UP_PHASE_COUNT];
 		struct {
 			/* media settings */
 			s16 pre1;
@@ -446,11 +490,27 @@ struct sl_core_link {
 			struct sl_core_link_fec_lane_cntrs lane;
 			struct sl_core_link_fec_tail_cntrs tail;
 		} down_cntrs_cache;
+		struct sl_core_link_fec_snapshot snapshot;
+
+		/* too big for the stack, one counter read at a time */
+		struct {
+			spinlock_t                   lock;
+			struct sl_core_hw_reg_txn_op ops[SL_CORE_HW_FEC_DATA_TXN_OPS];
+			struct sl_reg_op             reg_ops[SL_CORE_HW_FEC_DATA_TXN_OPS];
+		} data_txn;
 	} fec;
 
 	struct work_struct                            work[SL_CORE_WORK_LINK_COUNT];
+	u64                                           work_queue_ns[SL_CORE_WORK_LINK_COUNT];
 	struct sl_core_timer_link_info                timers[SL_CORE_TIMER_LINK_COUNT];
 	struct sl_core_hw_intr_info                   intrs[SL_CORE_HW_INTR_COUNT];
+
+	/* kept off the stack since the source clear runs in the interrupt handler */
+	struct {
+		spinlock_t                   lock;
+		struct sl_core_hw_reg_txn_op ops[SL_CORE_HW_INTR_CLR_TXN_OPS];
+		struct sl_reg_op             reg_ops[SL_CORE_HW_INTR_CLR_TXN_OPS];
+	} intr_clr_txn;
 };
 
 enum sl_core_link_state {
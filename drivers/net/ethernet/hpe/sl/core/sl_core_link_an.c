@@ -12,6 +12,7 @@
 #include "data/sl_core_data_link.h"
 #include "hw/sl_core_hw_an_lp.h"
 #include "hw/sl_core_hw_an.h"
+#include "sl_trace.h"
 
 #define LOG_NAME SL_CORE_LINK_AN_LOG_NAME
 
@@ -33,6 +34,7 @@ int sl_core_link_an_lp_caps_get(u8 ldev_num, u8 lgrp_num, u8 link_num,
 	case SL_CORE_LINK_STATE_CONFIGURED:
 	case SL_CORE_LINK_STATE_DOWN:
 		core_link->link.state = SL_CORE_LINK_STATE_AN;
+		trace_sl_core_link_state(core_link, core_link->link.state);
 		spin_unlock(&core_link->link.data_lock);
 		sl_core_hw_an_lp_caps_get_cmd(core_link, link_state, callback, tag, caps, timeout_ms, flags);
 		return 0;
@@ -10,120 +10,128 @@
 
 #define LOG_NAME SL_CORE_LINK_FEC_LOG_NAME
 
-static int sl_core_link_fec_cw_cntrs_get(struct sl_core_link *core_link,
-					 struct sl_core_link_fec_cw_cntrs *cw_cntrs)
+static int sl_core_link_fec_snapshot_refresh(struct sl_core_link *core_link,
+					     struct sl_core_link_fec_data_cntrs *data_cntrs)
 {
 	int rtn;
-	u32 link_state;
-
-	sl_core_log_dbg(core_link, LOG_NAME, "fec_cw_cntrs_get");
 
-	spin_lock(&core_link->data_lock);
-	link_state = core_link->link.state;
-	spin_unlock(&core_link->data_lock);
-	switch (link_state) {
-	case SL_CORE_LINK_STATE_UP:
-		rtn = sl_core_hw_fec_cw_cntrs_get(core_link, cw_cntrs);
-		if (rtn) {
-			sl_core_log_err_trace(core_link, LOG_NAME,
-					      "fec_cw_cntrs_get failed (link_state = %u %s) [%d]",
-					      link_state, sl_core_link_state_str(link_state), rtn);
-			return rtn;
-		}
-		sl_core_log_dbg(core_link, LOG_NAME,
-				"fec_cw_cntrs_get (ccw = %llu, ucw = %llu, gcw = %llu)",
-				cw_cntrs->ccw, cw_cntrs->ucw, cw_cntrs->gcw);
-		return 0;
-	default:
-		sl_core_log_err_trace(core_link, LOG_NAME,
-				      "fec_cw_cntrs_get incorrect state (link_state = %u %s)",
-				      link_state, sl_core_link_state_str(link_state));
-		return -ENOLINK;
+	rtn = sl_core_hw_fec_data_get(core_link, &data_cntrs->cw_cntrs,
+				      &data_cntrs->lane_cntrs, &data_cntrs->tail_cntrs);
+	if (rtn) {
+		sl_core_log_err_trace(core_link, LOG_NAME, "snapshot_refresh failed [%d]", rtn);
+		return rtn;
 	}
+
+	spin_lock(&core_link->fec.snapshot.lock);
+	core_link->fec.snapshot.cntrs     = *data_cntrs;
+	core_link->fec.snapshot.timestamp = ktime_get();
+	core_link->fec.snapshot.is_valid  = true;
+	core_link->fec.snapshot.refresh_count++;
+	spin_unlock(&core_link->fec.snapshot.lock);
+
+	return 0;
 }
 
-static int sl_core_link_fec_lane_cntrs_get(struct sl_core_link *core_link,
-					   struct sl_core_link_fec_lane_cntrs *lane_cntrs)
+static int sl_core_link_fec_snapshot_get(struct sl_core_link *core_link,
+					 struct sl_core_link_fec_data_cntrs *data_cntrs)
 {
 	int rtn;
 	u32 link_state;
+	u32 max_age_ms;
 
-	sl_core_log_dbg(core_link, LOG_NAME, "fec_lane_cntrs_get");
+	sl_core_log_dbg(core_link, LOG_NAME, "snapshot_get");
 
 	spin_lock(&core_link->data_lock);
 	link_state = core_link->link.state;
 	spin_unlock(&core_link->data_lock);
-	switch (link_state) {
-	case SL_CORE_LINK_STATE_UP:
-		rtn = sl_core_hw_fec_lane_cntrs_get(core_link, lane_cntrs);
-		if (rtn) {
-			sl_core_log_err_trace(core_link, LOG_NAME,
-					      "fec_lane_cntrs_get failed (link_state = %u %s) [%d]",
-					      link_state, sl_core_link_state_str(link_state), rtn);
-			return rtn;
-		}
-		sl_core_log_dbg(core_link, LOG_NAME,
-				"fec_lane_cntrs_get (lane0 = %llu, lane1 = %llu, lane2 = %llu, lane3 = %llu)",
-				lane_cntrs->lanes[0], lane_cntrs->lanes[1],
-				lane_cntrs->lanes[2], lane_cntrs->lanes[3]);
-		return 0;
-	default:
+	if (link_state != SL_CORE_LINK_STATE_UP) {
 		sl_core_log_err_trace(core_link, LOG_NAME,
-				      "fec_lane_cntrs_get incorrect state (link_state = %u %s)",
+				      "snapshot_get incorrect state (link_state = %u %s)",
 				      link_state, sl_core_link_state_str(link_state));
 		return -ENOLINK;
 	}
+
+	spin_lock(&core_link->fec.snapshot.lock);
+	max_age_ms = core_link->fec.snapshot.max_age_ms;
+// FIXME: investigate doing this differently
+#if defined(SL_TEST)
+	if (core_link->fec.use_test_cntrs)
+		max_age_ms = 0;
+#endif
+	if (core_link->fec.snapshot.is_valid && max_age_ms &&
+	    (ktime_ms_delta(ktime_get(), core_link->fec.snapshot.timestamp) < max_age_ms)) {
+		*data_cntrs = core_link->fec.snapshot.cntrs;
+		core_link->fec.snapshot.hit_count++;
+		spin_unlock(&core_link->fec.snapshot.lock);
+		return 0;
+	}
+	spin_unlock(&core_link->fec.snapshot.lock);
+
+	rtn = sl_core_link_fec_snapshot_refresh(core_link, data_cntrs);
+	if (rtn) {
+		sl_core_log_err_trace(core_link, LOG_NAME,
+				      "snapshot_get failed (link_state = %u %s) [%d]",
+				      link_state, sl_core_link_state_str(link_state), rtn);
+		return rtn;
+	}
+
+	sl_core_log_dbg(core_link, LOG_NAME,
+			"snapshot_get (ccw = %llu, ucw = %llu, gcw = %llu)",
+			data_cntrs->cw_cntrs.ccw, data_cntrs->cw_cntrs.ucw, data_cntrs->cw_cntrs.gcw);
+
+	return 0;
 }
 
-static int sl_core_link_fec_tail_cntrs_get(struct sl_core_link *core_link,
-					   struct sl_core_link_fec_tail_cntrs *tail_cntrs)
+void sl_core_link_fec_snapshot_invalidate(struct sl_core_link *core_link)
 {
-	int rtn;
-	u32 link_state;
+	spin_lock(&core_link->fec.snapshot.lock);
+	core_link->fec.snapshot.is_valid = false;
+	spin_unlock(&core_link->fec.snapshot.lock);
+}
 
-	sl_core_log_dbg(core_link, LOG_NAME, "fec_tail_cntrs_get");
+void sl_core_link_fec_snapshot_max_age_ms_set(struct sl_core_link *core_link, u32 max_age_ms)
+{
+	spin_lock(&core_link->fec.snapshot.lock);
+	core_link->fec.snapshot.max_age_ms = max_age_ms;
+	spin_unlock(&core_link->fec.snapshot.lock);
 
-	spin_lock(&core_link->data_lock);
-	link_state = core_link->link.state;
-	spin_unlock(&core_link->data_lock);
-	switch (link_state) {
-	case SL_CORE_LINK_STATE_UP:
-		rtn = sl_core_hw_fec_tail_cntrs_get(core_link, tail_cntrs);
-		if (rtn) {
-			sl_core_log_err_trace(core_link, LOG_NAME,
-					      "fec_tail_cntrs_get failed (link_state = %u %s) [%d]",
-					      link_state, sl_core_link_state_str(link_state), rtn);
-			return rtn;
-		}
-		sl_core_log_dbg(core_link, LOG_NAME,
-				"fec_tail_cntrs_get (ccw_bin0 = %llu, ccw_bin1 = %llu, ccw_bin2 = %llu, ccw_bin3 = %llu)",
-				tail_cntrs->ccw_bins[0], tail_cntrs->ccw_bins[1],
-				tail_cntrs->ccw_bins[2], tail_cntrs->ccw_bins[3]);
-		sl_core_log_dbg(core_link, LOG_NAME,
-				"fec_tail_cntrs_get (ccw_bin4 = %llu, ccw_bin5 = %llu, ccw_bin6 = %llu, ccw_bin7 = %llu)",
-				tail_cntrs->ccw_bins[4], tail_cntrs->ccw_bins[5],
-				tail_cntrs->ccw_bins[6], tail_cntrs->ccw_bins[7]);
-		return 0;
-	default:
-		sl_core_log_err_trace(core_link, LOG_NAME,
-				      "fec_tail_cntrs_get incorrect state (link_state = %u %s)",
-				      link_state, sl_core_link_state_str(link_state));
-		return -ENOLINK;
-	}
+	sl_core_log_dbg(core_link, LOG_NAME, "snapshot_max_age_ms_set (max_age_ms = %u)", max_age_ms);
+}
+
+u32 sl_core_link_fec_snapshot_max_age_ms_get(struct sl_core_link *core_link)
+{
+	u32 max_age_ms;
+
+	spin_lock(&core_link->fec.snapshot.lock);
+	max_age_ms = core_link->fec.snapshot.max_age_ms;
+	spin_unlock(&core_link->fec.snapshot.lock);
+
+	return max_age_ms;
+}
+
+void sl_core_link_fec_snapshot_stats_get(struct sl_core_link *core_link, s64 *age_ms,
+					 u64 *refresh_count, u64 *hit_count)
+{
+	spin_lock(&core_link->fec.snapshot.lock);
+	*age_ms        = core_link->fec.snapshot.is_valid ?
+		ktime_ms_delta(ktime_get(), core_link->fec.snapshot.timestamp) : -1;
+	*refresh_count = core_link->fec.snapshot.refresh_count;
+	*hit_count     = core_link->fec.snapshot.hit_count;
+	spin_unlock(&core_link->fec.snapshot.lock);
 }
 
 int sl_core_link_fec_ccw_get(struct sl_core_link *core_link, u64 *ccw)
 {
-	int                              rtn;
-	struct sl_core_link_fec_cw_cntrs cw_cntrs;
+	int                                rtn;
+	struct sl_core_link_fec_data_cntrs data_cntrs;
 
-	rtn = sl_core_link_fec_cw_cntrs_get(core_link, &cw_cntrs);
+	rtn = sl_core_link_fec_snapshot_get(core_link, &data_cntrs);
 	if (rtn) {
 		sl_core_log_err_trace(core_link, LOG_NAME, "fec_ccw_get failed [%d]", rtn);
 		return rtn;
 	}
 
-	*ccw = cw_cntrs.ccw;
+	*ccw = data_cntrs.cw_cntrs.ccw;
 
 	sl_core_log_dbg(core_link, LOG_NAME, "fec_ccw_get (ccw = %llu)", *ccw);
 
@@ -132,16 +140,16 @@ int sl_core_link_fec_ccw_get(struct sl_core_link *core_link, u64 *ccw)
 
 int sl_core_link_fec_ucw_get(struct sl_core_link *core_link, u64 *ucw)
 {
-	int                              rtn;
-	struct sl_core_link_fec_cw_cntrs cw_cntrs;
+	int                                rtn;
+	struct sl_core_link_fec_data_cntrs data_cntrs;
 
-	rtn = sl_core_link_fec_cw_cntrs_get(core_link, &cw_cntrs);
+	rtn = sl_core_link_fec_snapshot_get(core_link, &data_cntrs);
 	if (rtn) {
 		sl_core_log_err_trace(core_link, LOG_NAME, "fec_ucw_get failed [%d]", rtn);
 		return rtn;
 	}
 
-	*ucw = cw_cntrs.ucw;
+	*ucw = data_cntrs.cw_cntrs.ucw;
 
 	sl_core_log_dbg(core_link, LOG_NAME, "fec_ucw_get (ucw = %llu)", *ucw);
 
@@ -150,16 +158,16 @@ int sl_core_link_fec_ucw_get(struct sl_core_link *core_link, u64 *ucw)
 
 int sl_core_link_fec_gcw_get(struct sl_core_link *core_link, u64 *gcw)
 {
-	int                              rtn;
-	struct sl_core_link_fec_cw_cntrs cw_cntrs;
+	int                                rtn;
+	struct sl_core_link_fec_data_cntrs data_cntrs;
 
-	rtn = sl_core_link_fec_cw_cntrs_get(core_link, &cw_cntrs);
+	rtn = sl_core_link_fec_snapshot_get(core_link, &data_cntrs);
 	if (rtn) {
 		sl_core_log_err_trace(core_link, LOG_NAME, "fec_gcw_get failed [%d]", rtn);
 		return rtn;
 	}
 
-	*gcw = cw_cntrs.gcw;
+	*gcw = data_cntrs.cw_cntrs.gcw;
 
 	sl_core_log_dbg(core_link, LOG_NAME, "fec_gcw_get (gcw = %llu)", *gcw);
 
@@ -169,15 +177,15 @@ int sl_core_link_fec_gcw_get(struct sl_core_link *core_link, u64 *gcw)
 int sl_core_link_fec_lane_cntr_get(struct sl_core_link *core_link, u8 lane_num, u64 *lane_cntr)
 {
 	int                                rtn;
-	struct sl_core_link_fec_lane_cntrs lane_cntrs;
+	struct sl_core_link_fec_data_cntrs data_cntrs;
 
-	rtn = sl_core_link_fec_lane_cntrs_get(core_link, &lane_cntrs);
+	rtn = sl_core_link_fec_snapshot_get(core_link, &data_cntrs);
 	if (rtn) {
 		sl_core_log_err_trace(core_link, LOG_NAME, "fec_lane_cntr_get failed [%d]", rtn);
 		return rtn;
 	}
 
-	*lane_cntr = lane_cntrs.lanes[lane_num];
+	*lane_cntr = data_cntrs.lane_cntrs.lanes[lane_num];
 
 	sl_core_log_dbg(core_link, LOG_NAME, "fec_lane_cntr_get (lane %u = %llu)", lane_num, *lane_cntr);
 
@@ -186,16 +194,16 @@ int sl_core_link_fec_lane_cntr_get(struct sl_core_link *core_link, u8 lane_num,
 
 int sl_core_link_fec_tail_cntr_get(struct sl_core_link *core_link, u8 tail_cntr_num, u64 *tail_cntr)
 {
-	int                               rtn;
-	struct sl_core_link_fec_tail_cntrs tail_cntrs;
+	int                                rtn;
+	struct sl_core_link_fec_data_cntrs data_cntrs;
 
-	rtn = sl_core_link_fec_tail_cntrs_get(core_link, &tail_cntrs);
+	rtn = sl_core_link_fec_snapshot_get(core_link, &data_cntrs);
 	if (rtn) {
 		sl_core_log_err_trace(core_link, LOG_NAME, "fec_tail_cntr_get failed [%d]", rtn);
 		return rtn;
 	}
 
-	*tail_cntr = tail_cntrs.ccw_bins[tail_cntr_num];
+	*tail_cntr = data_cntrs.tail_cntrs.ccw_bins[tail_cntr_num];
 
 	sl_core_log_dbg(core_link, LOG_NAME,
 			"fec_tail_cntr_get (tail_cntr %u = %llu)", tail_cntr_num, *tail_cntr);
@@ -206,31 +214,22 @@ int sl_core_link_fec_tail_cntr_get(struct sl_core_link *core_link, u8 tail_cntr_
 int sl_core_link_fec_data_get(struct sl_core_link *core_link,
 			      struct sl_core_link_fec_cw_cntrs *cw_cntrs,
 			      struct sl_core_link_fec_lane_cntrs *lane_cntrs,
-			      struct sl_core_link_fec_tail_cntrs *tail_cntr)
+			      struct sl_core_link_fec_tail_cntrs *tail_cntrs)
 {
-	int rtn;
-	u32 link_state;
+	int                                rtn;
+	struct sl_core_link_fec_data_cntrs data_cntrs;
 
 	sl_core_log_dbg(core_link, LOG_NAME, "fec_data_get");
 
-	spin_lock(&core_link->data_lock);
-	link_state = core_link->link.state;
-	spin_unlock(&core_link->data_lock);
-	switch (link_state) {
-	case SL_CORE_LINK_STATE_UP:
-		rtn = sl_core_hw_fec_data_get(core_link, cw_cntrs, lane_cntrs, tail_cntr);
-		if (rtn) {
-			sl_core_log_err_trace(core_link, LOG_NAME,
-					      "fec_data_get failed (link_state = %u %s) [%d]",
-					      link_state, sl_core_link_state_str(link_state), rtn);
-			return rtn;
-		}
-		return 0;
-	default:
-		sl_core_log_err_trace(core_link, LOG_NAME,
-				      "fec_data_get incorrect state (link_state = %u %s)",
-				      link_state, sl_core_link_state_str(link_state));
-		return -ENOLINK;
+	rtn = sl_core_link_fec_snapshot_get(core_link, &data_cntrs);
+	if (rtn) {
+		sl_core_log_err_trace(core_link, LOG_NAME, "fec_data_get failed [%d]", rtn);
+		return rtn;
 	}
-}
 
+	*cw_cntrs   = data_cntrs.cw_cntrs;
+	*lane_cntrs = data_cntrs.lane_cntrs;
+	*tail_cntrs = data_cntrs.tail_cntrs;
+
+	return 0;
+}
@@ -4,6 +4,9 @@
 #ifndef _SL_CORE_LINK_FEC_H_
 #define _SL_CORE_LINK_FEC_H_
 
+#include <linux/spinlock.h>
+#include <linux/ktime.h>
+
 #include <linux/hpe/sl/sl_fec.h>
 
 struct sl_core_link;
@@ -11,6 +14,9 @@ struct sl_core_link;
 #define SL_CORE_LINK_FEC_NUM_LANES    SL_CTRL_NUM_FEC_LANES
 #define SL_CORE_LINK_FEC_NUM_CCW_BINS SL_CTRL_NUM_CCW_BINS
 
+/* snapshot reuse window, 0 reads the hardware every time */
+#define SL_CORE_LINK_FEC_SNAPSHOT_MAX_AGE_MS 100
+
 struct sl_core_link_fec_cw_cntrs {
 	u64 ccw;
 	u64 ucw;
@@ -31,6 +37,17 @@ struct sl_core_link_fec_data_cntrs {
 	struct sl_core_link_fec_tail_cntrs tail_cntrs;
 };
 
+/* coherent copy of all counter families from a single hardware read */
+struct sl_core_link_fec_snapshot {
+	struct sl_core_link_fec_data_cntrs cntrs;
+	ktime_t                            timestamp;
+	bool                               is_valid;
+	u32                                max_age_ms;
+	u64                                refresh_count;
+	u64                                hit_count;
+	spinlock_t                         lock;
+};
+
 int sl_core_link_fec_ccw_get(struct sl_core_link *core_link, u64 *ccw);
 int sl_core_link_fec_ucw_get(struct sl_core_link *core_link, u64 *ucw);
 int sl_core_link_fec_gcw_get(struct sl_core_link *core_link, u64 *gcw);
@@ -42,4 +59,10 @@ int sl_core_link_fec_data_get(struct sl_core_link *core_link,
 			      struct sl_core_link_fec_lane_cntrs *lane_cntrs,
 			      struct sl_core_link_fec_tail_cntrs *tail_cntrs);
 
+void sl_core_link_fec_snapshot_invalidate(struct sl_core_link *core_link);
+void sl_core_link_fec_snapshot_max_age_ms_set(struct sl_core_link *core_link, u32 max_age_ms);
+u32  sl_core_link_fec_snapshot_max_age_ms_get(struct sl_core_link *core_link);
+void sl_core_link_fec_snapshot_stats_get(struct sl_core_link *core_link, s64 *age_ms,
+					 u64 *refresh_count, u64 *hit_count);
+
 #endif /* _SL_CORE_LINK_FEC_H_ */
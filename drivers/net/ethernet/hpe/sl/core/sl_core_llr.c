@@ -12,6 +12,7 @@
 #include "data/sl_core_data_link.h"
 #include "data/sl_core_data_llr.h"
 #include "hw/sl_core_hw_llr.h"
+#include "sl_trace.h"
 
 #define LOG_NAME SL_CORE_LLR_LOG_NAME
 
@@ -53,6 +54,7 @@ int sl_core_llr_config_set(u8 ldev_num, u8 lgrp_num, u8 llr_num, struct sl_llr_c
 			return rtn;
 		}
 		core_llr->state = SL_CORE_LLR_STATE_CONFIGURED;
+		trace_sl_core_llr_state(core_llr, core_llr->state);
 		spin_unlock(&core_llr->data_lock);
 		return 0;
 	default:
@@ -114,6 +116,7 @@ int sl_core_llr_setup(u8 ldev_num, u8 lgrp_num, u8 llr_num,
 	case SL_CORE_LLR_STATE_CONFIGURED:
 		sl_core_log_dbg(core_llr, LOG_NAME, "setup - in configured");
 		core_llr->state = SL_CORE_LLR_STATE_SETTING_UP;
+		trace_sl_core_llr_state(core_llr, core_llr->state);
 		spin_unlock(&core_llr->data_lock);
 		rtn = sl_core_data_llr_settings(core_llr);
 		if (rtn) {
@@ -152,6 +155,7 @@ int sl_core_llr_start(u8 ldev_num, u8 lgrp_num, u8 llr_num,
 	case SL_CORE_LLR_STATE_SETUP:
 		sl_core_log_dbg(core_llr, LOG_NAME, "start - in setup");
 		core_llr->state = SL_CORE_LLR_STATE_STARTING;
+		trace_sl_core_llr_state(core_llr, core_llr->state);
 		spin_unlock(&core_llr->data_lock);
 		sl_core_hw_llr_start_cmd(core_llr, callback, tag, flags);
 		return 0;
@@ -185,6 +189,7 @@ int sl_core_llr_stop(u8 ldev_num, u8 lgrp_num, u8 llr_num)
 	case SL_CORE_LLR_STATE_SETTING_UP:
 		sl_core_log_dbg(core_llr, LOG_NAME, "stop - cancel setting up");
 		core_llr->state = SL_CORE_LLR_STATE_SETUP_CANCELING;
+		trace_sl_core_llr_state(core_llr, core_llr->state);
 		spin_unlock(&core_llr->data_lock);
 		sl_core_data_llr_last_fail_cause_set(core_llr, SL_LLR_FAIL_CAUSE_CANCELED);
 		sl_core_hw_llr_settingup_cancel_cmd(core_llr);
@@ -192,6 +197,7 @@ int sl_core_llr_stop(u8 ldev_num, u8 lgrp_num, u8 llr_num)
 	case SL_CORE_LLR_STATE_SETUP:
 		sl_core_log_dbg(core_llr, LOG_NAME, "stop - in setup");
 		core_llr->state = SL_CORE_LLR_STATE_SETUP_STOPPING;
+		trace_sl_core_llr_state(core_llr, core_llr->state);
 		spin_unlock(&core_llr->data_lock);
 		sl_core_data_llr_last_fail_cause_set(core_llr, SL_LLR_FAIL_CAUSE_COMMAND);
 		sl_core_hw_llr_setup_stop_cmd(core_llr);
@@ -199,6 +205,7 @@ int sl_core_llr_stop(u8 ldev_num, u8 lgrp_num, u8 llr_num)
 	case SL_CORE_LLR_STATE_STARTING:
 		sl_core_log_dbg(core_llr, LOG_NAME, "stop - cancel starting");
 		core_llr->state = SL_CORE_LLR_STATE_START_CANCELING;
+		trace_sl_core_llr_state(core_llr, core_llr->state);
 		spin_unlock(&core_llr->data_lock);
 		sl_core_data_llr_last_fail_cause_set(core_llr, SL_LLR_FAIL_CAUSE_CANCELED);
 		sl_core_hw_llr_starting_cancel_cmd(core_llr);
@@ -206,6 +213,7 @@ int sl_core_llr_stop(u8 ldev_num, u8 lgrp_num, u8 llr_num)
 	case SL_CORE_LLR_STATE_RUNNING:
 		sl_core_log_dbg(core_llr, LOG_NAME, "stop - in running");
 		core_llr->state = SL_CORE_LLR_STATE_STOPPING;
+		trace_sl_core_llr_state(core_llr, core_llr->state);
 		spin_unlock(&core_llr->data_lock);
 		sl_core_data_llr_last_fail_cause_set(core_llr, SL_LLR_FAIL_CAUSE_COMMAND);
 		sl_core_hw_llr_running_stop_cmd(core_llr);
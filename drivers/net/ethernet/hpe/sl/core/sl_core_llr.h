@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_CORE_LLR_H_
 #define _SL_CORE_LLR_H_
@@ -101,6 +101,7 @@ struct sl_core_llr {
 	} settings;
 
 	struct work_struct                         work[SL_CORE_WORK_LLR_COUNT];
+	u64                                        work_queue_ns[SL_CORE_WORK_LLR_COUNT];
 	struct sl_core_timer_llr_info              timers[SL_CORE_TIMER_LLR_COUNT];
 	struct sl_core_hw_intr_llr_info            intrs[SL_CORE_HW_INTR_LLR_FLGS_COUNT];
 	struct completion                          stop_complete;
@@ -266,6 +266,66 @@ const char *sl_core_serdes_lane_width_str(u16 width)
 	}
 }
 
+const char *sl_core_serdes_lanes_up_phase_str(u32 phase)
+{
+	switch (phase) {
+	case SL_CORE_HW_SERDES_LANES_UP_PHASE_START:
+		return "start";
+	case SL_CORE_HW_SERDES_LANES_UP_PHASE_CLOCK_ALIGN:
+		return "clock-align";
+	case SL_CORE_HW_SERDES_LANES_UP_PHASE_TX_CHECK:
+		return "tx-check";
+	case SL_CORE_HW_SERDES_LANES_UP_PHASE_SETTLE:
+		return "settle";
+	case SL_CORE_HW_SERDES_LANES_UP_PHASE_RX_CHECK:
+		return "rx-check";
+	case SL_CORE_HW_SERDES_LANES_UP_PHASE_QUALITY_CHECK:
+		return "quality-check";
+	default:
+		return "unknown";
+	}
+}
+
+const char *sl_core_link_up_phase_str(u32 phase)
+{
+	switch (phase) {
+	case SL_CORE_LINK_UP_PHASE_AN:
+		return "an";
+	case SL_CORE_LINK_UP_PHASE_START:
+		return "start";
+	case SL_CORE_LINK_UP_PHASE_MEDIA:
+		return "media";
+	case SL_CORE_LINK_UP_PHASE_SERDES:
+		return "serdes";
+	case SL_CORE_LINK_UP_PHASE_PCS_LOCK:
+		return "pcs_lock";
+	case SL_CORE_LINK_UP_PHASE_UP_CHECK:
+		return "up_check";
+	case SL_CORE_LINK_UP_PHASE_FEC_SETTLE:
+		return "fec_settle";
+	case SL_CORE_LINK_UP_PHASE_FEC_CHECK:
+		return "fec_check";
+	case SL_CORE_LINK_UP_PHASE_NONE:
+		return "none";
+	default:
+		return "unknown";
+	}
+}
+
+const char *sl_core_serdes_settle_step_str(u32 step)
+{
+	switch (step) {
+	case SL_CORE_SERDES_SETTLE_UC_ACTIVE:
+		return "uc_active";
+	case SL_CORE_SERDES_SETTLE_CLOCK_INIT:
+		return "clock_init";
+	case SL_CORE_SERDES_SETTLE_PLL_LOCK:
+		return "pll_lock";
+	default:
+		return "unknown";
+	}
+}
+
 const char *sl_core_lgrp_dt_jack_part_str(u32 jack_type)
 {
 	switch (jack_type) {
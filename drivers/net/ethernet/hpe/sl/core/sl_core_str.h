@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_CORE_STR_H_
 #define _SL_CORE_STR_H_
@@ -24,5 +24,8 @@ const char *sl_core_serdes_lane_encoding_str(u16 encoding);
 const char *sl_core_serdes_lane_clocking_str(u16 clocking);
 const char *sl_core_serdes_lane_osr_str(u16 osr);
 const char *sl_core_serdes_lane_width_str(u16 width);
+const char *sl_core_serdes_lanes_up_phase_str(u32 phase);
+const char *sl_core_link_up_phase_str(u32 phase);
+const char *sl_core_serdes_settle_step_str(u32 step);
 
 #endif /* _SL_CORE_STR_H_ */
@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/types.h>
+#include <linux/atomic.h>
+#include <linux/ktime.h>
+#include <linux/kernel.h>
+#include <linux/build_bug.h>
+
+#include "sl_asic.h"
+#include "sl_core_lgrp.h"
+#include "base/sl_core_log.h"
+#include "hw/sl_core_hw_serdes_lane.h"
+#include "hw/sl_core_hw_uc_ram.h"
+#include "test/sl_core_test_uc_ram.h"
+
+#define LOG_NAME SL_CORE_TEST_UC_RAM_LOG_NAME
+
+/* first region ends on a 64K boundary, second is past the read through gap */
+#define SL_CORE_TEST_UC_RAM_BLK_END_ADDR (SL_CORE_HW_UC_RAM_BLK_SIZE - 0x10)
+#define SL_CORE_TEST_UC_RAM_BLK_END_SIZE 0x10
+#define SL_CORE_TEST_UC_RAM_NEXT_ADDR    (SL_CORE_HW_UC_RAM_BLK_SIZE + 0x40)
+#define SL_CORE_TEST_UC_RAM_NEXT_SIZE    0x08
+
+/*
+ * Reads a region ending on a 64K boundary then readdresses within the next
+ * block, and checks every byte against the legacy byte read.
+ */
+static int sl_core_test_uc_ram_blk_cross(struct sl_core_lgrp *core_lgrp)
+{
+	int                             rtn;
+	struct sl_core_hw_uc_ram_region regions[2];
+	u8                              blk_end[SL_CORE_TEST_UC_RAM_BLK_END_SIZE];
+	u8                              next[SL_CORE_TEST_UC_RAM_NEXT_SIZE];
+	u32                             region_num;
+	u32                             x;
+	u8                              data;
+
+	BUILD_BUG_ON(((SL_CORE_TEST_UC_RAM_NEXT_ADDR - SL_CORE_HW_UC_RAM_BLK_SIZE) / 2) <=
+		SL_CORE_HW_UC_RAM_GAP_WORDS_MAX);
+
+	regions[0].addr = SL_CORE_TEST_UC_RAM_BLK_END_ADDR;
+	regions[0].size = sizeof(blk_end);
+	regions[0].buff = blk_end;
+	regions[1].addr = SL_CORE_TEST_UC_RAM_NEXT_ADDR;
+	regions[1].size = sizeof(next);
+	regions[1].buff = next;
+
+	rtn = sl_core_hw_uc_ram_rd_regions(core_lgrp, core_lgrp->serdes.dt.dev_addr,
+		core_lgrp->serdes.dt.dev_id, 0xFF, regions, ARRAY_SIZE(regions));
+	if (rtn) {
+		sl_core_log_err_trace(core_lgrp, LOG_NAME, "uc ram blk cross rd regions failed [%d]", rtn);
+		return rtn;
+	}
+
+	for (region_num = 0; region_num < ARRAY_SIZE(regions); ++region_num) {
+		for (x = 0; x < regions[region_num].size; ++x) {
+			rtn = sl_core_hw_uc_ram_rd8(core_lgrp, core_lgrp->serdes.dt.dev_addr,
+				core_lgrp->serdes.dt.dev_id, 0xFF, regions[region_num].addr + x, &data);
+			if (rtn) {
+				sl_core_log_err_trace(core_lgrp, LOG_NAME, "uc ram blk cross rd8 failed [%d]", rtn);
+				return rtn;
+			}
+			if (data != regions[region_num].buff[x]) {
+				sl_core_log_err(core_lgrp, LOG_NAME,
+					"uc ram blk cross mismatch (addr = 0x%08X, rd8 = 0x%02X, region = 0x%02X)",
+					regions[region_num].addr + x, data, regions[region_num].buff[x]);
+				return -EBADE;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Reads the eyes of every lane one byte at a time then in one region sweep
+ * per lane. The byte reads use the legacy 8 bit read without autoincrement,
+ * so they check the autoincrement region reads against an independent path.
+ * Results are compared and the PMI op counts and times of each are logged.
+ * A region read across a 64K block boundary is also checked.
+ */
+int sl_core_test_uc_ram_bench(u8 ldev_num, u8 lgrp_num)
+{
+	int                  rtn;
+	struct sl_core_lgrp *core_lgrp;
+	u8                   eye_upper[SL_MAX_LANES];
+	u8                   eye_lower[SL_MAX_LANES];
+	u8                   eyes_upper[SL_MAX_LANES];
+	u8                   eyes_lower[SL_MAX_LANES];
+	u8                   asic_lane_num;
+	s64                  pmi_ops;
+	u64                  start_ns;
+	s64                  byte_pmi_ops;
+	u64                  byte_ns;
+	s64                  region_pmi_ops;
+	u64                  region_ns;
+
+	core_lgrp = sl_core_lgrp_get(ldev_num, lgrp_num);
+	if (!core_lgrp) {
+		sl_core_log_err(NULL, LOG_NAME,
+			"uc ram bench NULL lgrp (ldev_num = %u, lgrp_num = %u)",
+			ldev_num, lgrp_num);
+		return -EBADRQC;
+	}
+
+	pmi_ops  = atomic64_read(&core_lgrp->uc_ram.pmi_ops);
+	start_ns = ktime_get_ns();
+	for (asic_lane_num = 0; asic_lane_num < SL_MAX_LANES; ++asic_lane_num) {
+		rtn = sl_core_hw_serdes_eye_upper_get(core_lgrp, asic_lane_num, &eye_upper[asic_lane_num]);
+		if (rtn) {
+			sl_core_log_err_trace(core_lgrp, LOG_NAME, "uc ram bench eye upper get failed [%d]", rtn);
+			return rtn;
+		}
+		rtn = sl_core_hw_serdes_eye_lower_get(core_lgrp, asic_lane_num, &eye_lower[asic_lane_num]);
+		if (rtn) {
+			sl_core_log_err_trace(core_lgrp, LOG_NAME, "uc ram bench eye lower get failed [%d]", rtn);
+			return rtn;
+		}
+	}
+	byte_ns      = ktime_get_ns() - start_ns;
+	byte_pmi_ops = atomic64_read(&core_lgrp->uc_ram.pmi_ops) - pmi_ops;
+
+	pmi_ops  = atomic64_read(&core_lgrp->uc_ram.pmi_ops);
+	start_ns = ktime_get_ns();
+	rtn = sl_core_hw_serdes_eyes_get(core_lgrp, eyes_upper, eyes_lower);
+	if (rtn) {
+		sl_core_log_err_trace(core_lgrp, LOG_NAME, "uc ram bench eyes get failed [%d]", rtn);
+		return rtn;
+	}
+	region_ns      = ktime_get_ns() - start_ns;
+	region_pmi_ops = atomic64_read(&core_lgrp->uc_ram.pmi_ops) - pmi_ops;
+
+	sl_core_log_info(core_lgrp, LOG_NAME,
+		"uc ram bench (byte_pmi_ops = %lld, byte_ns = %llu, region_pmi_ops = %lld, region_ns = %llu)",
+		byte_pmi_ops, byte_ns, region_pmi_ops, region_ns);
+
+	for (asic_lane_num = 0; asic_lane_num < SL_MAX_LANES; ++asic_lane_num) {
+		if ((eye_upper[asic_lane_num] != eyes_upper[asic_lane_num]) ||
+		    (eye_lower[asic_lane_num] != eyes_lower[asic_lane_num])) {
+			sl_core_log_err(core_lgrp, LOG_NAME,
+				"uc ram bench mismatch (asic_lane_num = %u, upper = %u %u, lower = %u %u)",
+				asic_lane_num, eye_upper[asic_lane_num], eyes_upper[asic_lane_num],
+				eye_lower[asic_lane_num], eyes_lower[asic_lane_num]);
+			return -EBADE;
+		}
+	}
+
+	return sl_core_test_uc_ram_blk_cross(core_lgrp);
+}
@@ -0,0 +1,9 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#ifndef _SL_CORE_TEST_UC_RAM_H_
+#define _SL_CORE_TEST_UC_RAM_H_
+
+int sl_core_test_uc_ram_bench(u8 ldev_num, u8 lgrp_num);
+
+#endif /* _SL_CORE_TEST_UC_RAM_H_ */
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2021-2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2021-2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/spinlock.h>
 #include <linux/slab.h>
@@ -48,6 +48,9 @@ int sl_ctrl_ldev_new(u8 ldev_num, struct workqueue_struct *workq,
 	init_completion(&ctrl_ldev->del_complete);
 
 	spin_lock_init(&ctrl_ldev->data_lock);
+	sl_ctrl_ldev_stats_init(ctrl_ldev);
+	sl_ctrl_ldev_eyes_init(ctrl_ldev);
+	sl_ctrl_ldev_fec_mon_init(ctrl_ldev);
 
 	if (IS_ERR_OR_NULL(workq)) {
 		ctrl_ldev->workq = alloc_workqueue("%s%u", WQ_MEM_RECLAIM,
@@ -65,25 +68,17 @@ int sl_ctrl_ldev_new(u8 ldev_num, struct workqueue_struct *workq,
 		sl_ctrl_log_dbg(ctrl_ldev, LOG_NAME, "client workqueue (workq = 0x%p)", ctrl_ldev->workq);
 	}
 
-	ctrl_ldev->notif_workq = alloc_workqueue("%s%u-notif", WQ_MEM_RECLAIM,
-						 CONFIG_SL_DEFAULT_WQ_MAX_ACTIVE, "sl-ldev", ldev_num);
-	if (IS_ERR(ctrl_ldev->notif_workq)) {
-		rtn = PTR_ERR(ctrl_ldev->notif_workq);
-		sl_ctrl_log_err(ctrl_ldev, LOG_NAME, "alloc_workqueue notif failed [%d]", rtn);
-		goto out_del_wq;
-	}
-
 	rtn = sl_core_ldev_new(ldev_num, ctrl_ldev->attr.accessors,
-		ctrl_ldev->attr.ops, ctrl_ldev->workq);
+		ctrl_ldev->attr.ops, ctrl_ldev->workq, ctrl_ldev->attr.options);
 	if (rtn) {
 		sl_ctrl_log_err_trace(ctrl_ldev, LOG_NAME, "core_ldev_new failed [%d]", rtn);
-		goto out_del_notif_wq;
+		goto out_del_wq;
 	}
 
 	rtn = sl_media_ldev_new(ldev_num, ctrl_ldev->workq);
 	if (rtn) {
 		sl_ctrl_log_err_trace(ctrl_ldev, LOG_NAME, "media_ldev_new failed [%d]", rtn);
-		goto out_del_notif_wq;
+		goto out_del_wq;
 	}
 
 	spin_lock(&ctrl_ldevs_lock);
@@ -94,9 +89,6 @@ int sl_ctrl_ldev_new(u8 ldev_num, struct workqueue_struct *workq,
 
 	return 0;
 
-out_del_notif_wq:
-	destroy_workqueue(ctrl_ldev->notif_workq);
-
 out_del_wq:
 	if (ctrl_ldev->create_workq)
 		destroy_workqueue(ctrl_ldev->workq);
@@ -127,15 +119,19 @@ int sl_ctrl_ldev_serdes_init(u8 ldev_num)
 		return -EBADRQC;
 	}
 
-	tries = SERDES_INIT_MAX_TRIES;
+	/* retries only redo the serdes that failed */
+	tries = 0;
 	do {
-		rtn = sl_core_ldev_serdes_init(ldev_num);
+		rtn = sl_core_ldev_serdes_init(ldev_num, (tries != 0));
 		if (rtn == 0)
 			goto out;
-		tries--;
-		if (tries)
+		tries++;
+		if (tries < SERDES_INIT_MAX_TRIES) {
+			sl_ctrl_log_warn(ctrl_ldev, LOG_NAME,
+				"serdes init failed - retrying failed serdes (tries = %d) [%d]", tries, rtn);
 			msleep(SERDES_INIT_DELAY_MS);
-	} while (tries);
+		}
+	} while (tries < SERDES_INIT_MAX_TRIES);
 
 out:
 	if (sl_ctrl_ldev_put(ctrl_ldev))
@@ -155,17 +151,21 @@ static void sl_ctrl_ldev_release(struct kref *ref)
 
 	sl_ctrl_log_dbg(ctrl_ldev, LOG_NAME, "release (ldev = 0x%p)", ctrl_ldev);
 
+	/* Eye sampler and FEC monitor must stop before the lgrps go away */
+	sl_ctrl_ldev_eyes_stop(ctrl_ldev);
+	sl_ctrl_ldev_fec_mon_stop(ctrl_ldev);
+
 	for (lgrp_num = 0; lgrp_num < SL_ASIC_MAX_LGRPS; ++lgrp_num)
 		sl_ctrl_lgrp_del(ldev_num, lgrp_num);
 
 	/* Must delete sysfs first to guarantee nobody is reading */
 	sl_sysfs_ldev_delete(ctrl_ldev);
+	sl_ctrl_ldev_stats_del(ctrl_ldev);
+	sl_ctrl_ldev_eyes_del(ctrl_ldev);
 
 	sl_core_ldev_del(ldev_num);
 	sl_media_ldev_del(ldev_num);
 
-	destroy_workqueue(ctrl_ldev->notif_workq);
-
 	if (ctrl_ldev->create_workq)
 		destroy_workqueue(ctrl_ldev->workq);
 
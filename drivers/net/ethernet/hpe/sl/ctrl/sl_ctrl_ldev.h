@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_CTRL_LDEV_H_
 #define _SL_CTRL_LDEV_H_
@@ -12,6 +12,10 @@
 #include <linux/hpe/sl/sl_media.h>
 
 #include "data/sl_media_data_cable_db.h"
+#include "sl_media_ldev.h"
+#include "sl_ctrl_ldev_stats.h"
+#include "sl_ctrl_ldev_eyes.h"
+#include "sl_ctrl_ldev_fec_mon.h"
 
 #define SL_CTRL_LDEV_MAGIC 0x736c6382
 #define SL_CTRL_LDEV_VER   2
@@ -46,6 +50,12 @@ struct sl_ctrl_ldev_cable_hpe_pn_kobj {
 	struct kobject       kobj;
 };
 
+struct sl_ctrl_ldev_media_shift_vendor_kobj {
+	struct sl_ctrl_ldev *ctrl_ldev;
+	u32                  vendor;
+	struct kobject       kobj;
+};
+
 struct sl_ctrl_ldev {
 	u32                       magic;
 	u32                       ver;
@@ -54,16 +64,22 @@ struct sl_ctrl_ldev {
 
 	struct sl_ldev_attr       attr;
 	struct workqueue_struct  *workq;
-	struct workqueue_struct  *notif_workq;
 	bool                      create_workq;
 	u64                       lgrp_map;
 
 	struct kobject           *parent_kobj;
 	bool                      is_sysfs_ok;
 	struct kobject            sl_info_kobj;
+	struct kobject            fec_mon_kobj;
+	struct kobject            media_shift_kobj;
+	struct sl_ctrl_ldev_media_shift_vendor_kobj media_shift_vendors_kobj[SL_MEDIA_JACK_SHIFT_VENDORS_NUM];
 
 	spinlock_t                data_lock;
 
+	struct sl_ctrl_ldev_stats   stats;
+	struct sl_ctrl_ldev_eyes    eyes;
+	struct sl_ctrl_ldev_fec_mon fec_mon[SL_CORE_WORKQ_NUM_SHARDS];
+
 	struct kobject            supported_cables_kobj;
 	struct kobject            cable_types_kobj[SL_CABLE_TYPES_NUM];
 	struct kobject            cable_vendors_kobj[SL_CABLE_TYPES_NUM][SL_CABLE_VENDORS_NUM];
@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/slab.h>
+#include <linux/mm.h>
+#include <linux/ktime.h>
+#include <linux/fs.h>
+
+#include "sl_asic.h"
+#include "base/sl_ctrl_log.h"
+#include "sl_ctrl_ldev.h"
+#include "sl_ctrl_ldev_eyes.h"
+#include "sl_ctrl_lgrp.h"
+#include "sl_core_lgrp.h"
+
+#define LOG_NAME SL_CTRL_LDEV_LOG_NAME
+
+size_t sl_ctrl_ldev_eyes_size_max(void)
+{
+	return sizeof(struct sl_ldev_eyes_hdr) +
+		(SL_ASIC_MAX_LGRPS * sizeof(struct sl_ldev_eyes_lgrp)) +
+		sizeof(struct sl_ldev_eyes_trailer);
+}
+
+static void sl_ctrl_ldev_eyes_sample(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	int                  rtn;
+	struct sl_ctrl_lgrp *ctrl_lgrp;
+	struct sl_core_lgrp *core_lgrp;
+	u8                   lgrp_num;
+
+	for (lgrp_num = 0; lgrp_num < SL_ASIC_MAX_LGRPS; ++lgrp_num) {
+		ctrl_lgrp = sl_ctrl_lgrp_get(ctrl_ldev->num, lgrp_num);
+		if (!ctrl_lgrp || !sl_ctrl_lgrp_kref_get_unless_zero(ctrl_lgrp))
+			continue;
+
+		core_lgrp = sl_core_lgrp_get(ctrl_ldev->num, lgrp_num);
+		if (core_lgrp) {
+			rtn = sl_core_lgrp_eyes_sample(core_lgrp);
+			if (rtn && (rtn != -EIO))
+				sl_ctrl_log_warn(ctrl_ldev, LOG_NAME,
+					"eyes sample failed (lgrp_num = %u) [%d]", lgrp_num, rtn);
+		}
+
+		if (sl_ctrl_lgrp_put(ctrl_lgrp))
+			sl_ctrl_log_dbg(ctrl_ldev, LOG_NAME, "eyes sample - lgrp removed (lgrp_num = %u)", lgrp_num);
+	}
+}
+
+/* next sample is one period after this one started */
+static void sl_ctrl_ldev_eyes_delayed_work(struct work_struct *work)
+{
+	struct sl_ctrl_ldev *ctrl_ldev;
+	ktime_t              sample_start;
+	s64                  sample_ms;
+	u32                  period_ms;
+
+	ctrl_ldev = container_of(to_delayed_work(work), struct sl_ctrl_ldev, eyes.delayed_work);
+
+	sl_ctrl_log_dbg(ctrl_ldev, LOG_NAME, "eyes delayed work");
+
+	sample_start = ktime_get();
+	sl_ctrl_ldev_eyes_sample(ctrl_ldev);
+	sample_ms = ktime_ms_delta(ktime_get(), sample_start);
+
+	spin_lock(&ctrl_ldev->eyes.lock);
+	period_ms = ctrl_ldev->eyes.is_stopped ? 0 : ctrl_ldev->eyes.period_ms;
+	if (period_ms)
+		queue_delayed_work(ctrl_ldev->workq, &ctrl_ldev->eyes.delayed_work,
+				   msecs_to_jiffies(period_ms - min_t(s64, sample_ms, period_ms)));
+	spin_unlock(&ctrl_ldev->eyes.lock);
+}
+
+void sl_ctrl_ldev_eyes_init(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	BUILD_BUG_ON(SL_MAX_LANES != SL_LDEV_EYES_LANES_MAX);
+	BUILD_BUG_ON(SL_CORE_LGRP_EYES_HIST_NUM != SL_LDEV_EYES_HIST_MAX);
+
+	spin_lock_init(&ctrl_ldev->eyes.lock);
+	INIT_DELAYED_WORK(&ctrl_ldev->eyes.delayed_work, sl_ctrl_ldev_eyes_delayed_work);
+	ctrl_ldev->eyes.period_ms  = 0;
+	ctrl_ldev->eyes.is_stopped = false;
+	ctrl_ldev->eyes.buf        = NULL;
+	ctrl_ldev->eyes.len        = 0;
+	ctrl_ldev->eyes.seq        = 0;
+}
+
+/* must be called before the lgrps are deleted */
+void sl_ctrl_ldev_eyes_stop(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	sl_ctrl_log_dbg(ctrl_ldev, LOG_NAME, "eyes stop");
+
+	spin_lock(&ctrl_ldev->eyes.lock);
+	ctrl_ldev->eyes.is_stopped = true;
+	spin_unlock(&ctrl_ldev->eyes.lock);
+
+	cancel_delayed_work_sync(&ctrl_ldev->eyes.delayed_work);
+}
+
+/* must be called after sl_ctrl_ldev_eyes_stop */
+void sl_ctrl_ldev_eyes_del(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	void *buf;
+
+	sl_ctrl_log_dbg(ctrl_ldev, LOG_NAME, "eyes del");
+
+	spin_lock(&ctrl_ldev->eyes.lock);
+	buf = ctrl_ldev->eyes.buf;
+	ctrl_ldev->eyes.buf = NULL;
+	ctrl_ldev->eyes.len = 0;
+	spin_unlock(&ctrl_ldev->eyes.lock);
+
+	kvfree(buf);
+}
+
+int sl_ctrl_ldev_eyes_period_set(struct sl_ctrl_ldev *ctrl_ldev, u32 period_ms)
+{
+	if (period_ms && (period_ms < SL_CTRL_LDEV_EYES_PERIOD_MS_MIN)) {
+		sl_ctrl_log_err(ctrl_ldev, LOG_NAME,
+			"eyes period too small (period_ms = %u, min = %u)",
+			period_ms, SL_CTRL_LDEV_EYES_PERIOD_MS_MIN);
+		return -EINVAL;
+	}
+
+	sl_ctrl_log_dbg(ctrl_ldev, LOG_NAME, "eyes period set (period_ms = %u)", period_ms);
+
+	spin_lock(&ctrl_ldev->eyes.lock);
+	if (ctrl_ldev->eyes.is_stopped) {
+		spin_unlock(&ctrl_ldev->eyes.lock);
+		return -EBADRQC;
+	}
+	ctrl_ldev->eyes.period_ms = period_ms;
+	if (period_ms)
+		mod_delayed_work(ctrl_ldev->workq, &ctrl_ldev->eyes.delayed_work, 0);
+	spin_unlock(&ctrl_ldev->eyes.lock);
+
+	if (!period_ms)
+		cancel_delayed_work_sync(&ctrl_ldev->eyes.delayed_work);
+
+	return 0;
+}
+
+u32 sl_ctrl_ldev_eyes_period_get(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	u32 period_ms;
+
+	spin_lock(&ctrl_ldev->eyes.lock);
+	period_ms = ctrl_ldev->eyes.period_ms;
+	spin_unlock(&ctrl_ldev->eyes.lock);
+
+	return period_ms;
+}
+
+static void sl_ctrl_ldev_eyes_lane_fill(struct sl_ldev_eyes_lane *lane, u8 upper, u8 lower,
+					u32 num_samples, u8 *upper_hist, u8 *lower_hist)
+{
+	u32 upper_sum;
+	u32 lower_sum;
+	u32 num_hist;
+	u32 idx;
+	u32 x;
+
+	lane->upper       = upper;
+	lane->lower       = lower;
+	lane->num_samples = num_samples;
+
+	num_hist = min_t(u32, num_samples, SL_CORE_LGRP_EYES_HIST_NUM);
+	if (!num_hist)
+		return;
+
+	lane->upper_min = U8_MAX;
+	lane->lower_min = U8_MAX;
+	upper_sum       = 0;
+	lower_sum       = 0;
+
+	/* oldest entry is at num_samples once the ring has wrapped */
+	for (x = 0; x < num_hist; ++x) {
+		idx = (num_samples - num_hist + x) % SL_CORE_LGRP_EYES_HIST_NUM;
+
+		lane->upper_hist[x] = upper_hist[idx];
+		lane->lower_hist[x] = lower_hist[idx];
+
+		lane->upper_min = min(lane->upper_min, upper_hist[idx]);
+		lane->upper_max = max(lane->upper_max, upper_hist[idx]);
+		lane->lower_min = min(lane->lower_min, lower_hist[idx]);
+		lane->lower_max = max(lane->lower_max, lower_hist[idx]);
+
+		upper_sum += upper_hist[idx];
+		lower_sum += lower_hist[idx];
+	}
+
+	lane->upper_mean = DIV_ROUND_CLOSEST(upper_sum, num_hist);
+	lane->lower_mean = DIV_ROUND_CLOSEST(lower_sum, num_hist);
+	lane->num_hist   = num_hist;
+}
+
+int sl_ctrl_ldev_eyes_snapshot(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	void                        *buf;
+	void                        *old_buf;
+	struct sl_ldev_eyes_hdr     *hdr;
+	struct sl_ldev_eyes_lgrp    *eyes_lgrp;
+	struct sl_ldev_eyes_trailer *trailer;
+	struct sl_ctrl_lgrp         *ctrl_lgrp;
+	struct sl_core_lgrp         *core_lgrp;
+	struct sl_core_lgrp_eyes     eyes;
+	u8                           lgrp_num;
+	u8                           asic_lane_num;
+	u32                          num_lgrps;
+	u64                          seq;
+
+	buf = kvzalloc(sl_ctrl_ldev_eyes_size_max(), GFP_KERNEL);
+	if (!buf)
+		return -ENOMEM;
+
+	hdr       = buf;
+	eyes_lgrp = buf + sizeof(*hdr);
+	num_lgrps = 0;
+
+	hdr->timestamp_ns = ktime_get_real_ns();
+
+	for (lgrp_num = 0; lgrp_num < SL_ASIC_MAX_LGRPS; ++lgrp_num) {
+		ctrl_lgrp = sl_ctrl_lgrp_get(ctrl_ldev->num, lgrp_num);
+		if (!ctrl_lgrp || !sl_ctrl_lgrp_kref_get_unless_zero(ctrl_lgrp))
+			continue;
+
+		core_lgrp = sl_core_lgrp_get(ctrl_ldev->num, lgrp_num);
+		if (core_lgrp)
+			sl_core_lgrp_eyes_snapshot_get(core_lgrp, &eyes);
+
+		if (sl_ctrl_lgrp_put(ctrl_lgrp))
+			sl_ctrl_log_dbg(ctrl_ldev, LOG_NAME, "eyes snapshot - lgrp removed (lgrp_num = %u)", lgrp_num);
+
+		if (!core_lgrp)
+			continue;
+
+		eyes_lgrp->lgrp_num     = lgrp_num;
+		eyes_lgrp->active_lanes = eyes.active_lanes;
+		eyes_lgrp->timestamp_ns = eyes.timestamp_ns;
+		for (asic_lane_num = 0; asic_lane_num < SL_MAX_LANES; ++asic_lane_num)
+			sl_ctrl_ldev_eyes_lane_fill(&eyes_lgrp->lanes[asic_lane_num],
+				eyes.lanes[asic_lane_num].upper, eyes.lanes[asic_lane_num].lower,
+				eyes.lanes[asic_lane_num].num_samples,
+				eyes.lanes[asic_lane_num].upper_hist, eyes.lanes[asic_lane_num].lower_hist);
+
+		eyes_lgrp++;
+		num_lgrps++;
+	}
+
+	hdr->magic     = SL_LDEV_EYES_MAGIC;
+	hdr->ver       = SL_LDEV_EYES_VER;
+	hdr->hdr_size  = sizeof(*hdr);
+	hdr->lgrp_size = sizeof(*eyes_lgrp);
+	hdr->ldev_num  = ctrl_ldev->num;
+	hdr->num_lanes = SL_MAX_LANES;
+	hdr->hist_max  = SL_CORE_LGRP_EYES_HIST_NUM;
+	hdr->period_ms = sl_ctrl_ldev_eyes_period_get(ctrl_ldev);
+	hdr->num_lgrps = num_lgrps;
+
+	trailer = (struct sl_ldev_eyes_trailer *)eyes_lgrp;
+
+	spin_lock(&ctrl_ldev->eyes.lock);
+	seq          = ++ctrl_ldev->eyes.seq;
+	hdr->seq     = seq;
+	trailer->seq = seq;
+	old_buf              = ctrl_ldev->eyes.buf;
+	ctrl_ldev->eyes.buf  = buf;
+	ctrl_ldev->eyes.len  = (void *)(trailer + 1) - buf;
+	spin_unlock(&ctrl_ldev->eyes.lock);
+
+	kvfree(old_buf);
+
+	sl_ctrl_log_dbg(ctrl_ldev, LOG_NAME, "eyes snapshot (seq = %llu, num_lgrps = %u)", seq, num_lgrps);
+
+	return 0;
+}
+
+ssize_t sl_ctrl_ldev_eyes_read(struct sl_ctrl_ldev *ctrl_ldev, char *buf, loff_t off, size_t count)
+{
+	ssize_t len;
+
+	spin_lock(&ctrl_ldev->eyes.lock);
+	if (!ctrl_ldev->eyes.buf) {
+		spin_unlock(&ctrl_ldev->eyes.lock);
+		return 0;
+	}
+	len = memory_read_from_buffer(buf, count, &off, ctrl_ldev->eyes.buf, ctrl_ldev->eyes.len);
+	spin_unlock(&ctrl_ldev->eyes.lock);
+
+	return len;
+}
@@ -0,0 +1,36 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#ifndef _SL_CTRL_LDEV_EYES_H_
+#define _SL_CTRL_LDEV_EYES_H_
+
+#include <linux/types.h>
+#include <linux/spinlock.h>
+#include <linux/workqueue.h>
+
+#include <linux/hpe/sl/sl_ldev_eyes.h>
+
+struct sl_ctrl_ldev;
+
+#define SL_CTRL_LDEV_EYES_PERIOD_MS_MIN 1000
+
+struct sl_ctrl_ldev_eyes {
+	struct delayed_work  delayed_work;
+	u32                  period_ms;
+	bool                 is_stopped;
+	void                *buf;
+	size_t               len;
+	u64                  seq;
+	spinlock_t           lock;
+};
+
+size_t  sl_ctrl_ldev_eyes_size_max(void);
+void    sl_ctrl_ldev_eyes_init(struct sl_ctrl_ldev *ctrl_ldev);
+void    sl_ctrl_ldev_eyes_stop(struct sl_ctrl_ldev *ctrl_ldev);
+void    sl_ctrl_ldev_eyes_del(struct sl_ctrl_ldev *ctrl_ldev);
+int     sl_ctrl_ldev_eyes_period_set(struct sl_ctrl_ldev *ctrl_ldev, u32 period_ms);
+u32     sl_ctrl_ldev_eyes_period_get(struct sl_ctrl_ldev *ctrl_ldev);
+int     sl_ctrl_ldev_eyes_snapshot(struct sl_ctrl_ldev *ctrl_ldev);
+ssize_t sl_ctrl_ldev_eyes_read(struct sl_ctrl_ldev *ctrl_ldev, char *buf, loff_t off, size_t count);
+
+#endif /* _SL_CTRL_LDEV_EYES_H_ */
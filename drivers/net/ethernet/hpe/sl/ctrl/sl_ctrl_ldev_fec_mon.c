@@ -0,0 +1,316 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/list.h>
+#include <linux/string.h>
+#include <linux/jiffies.h>
+#include <linux/ktime.h>
+#include <linux/sched.h>
+#include <linux/wait_bit.h>
+
+#include "sl_asic.h"
+#include "base/sl_ctrl_log.h"
+#include "sl_ctrl_ldev.h"
+#include "sl_ctrl_ldev_fec_mon.h"
+#include "sl_ctrl_lgrp.h"
+#include "sl_ctrl_link.h"
+#include "sl_ctrl_link_fec_priv.h"
+
+#define LOG_NAME SL_CTRL_LDEV_LOG_NAME
+
+#define SL_CTRL_LDEV_FEC_MON(_ctrl_ldev, _ctrl_link) \
+	(&(_ctrl_ldev)->fec_mon[SL_CORE_WORKQ_SHARD((_ctrl_link)->ctrl_lgrp->num)])
+
+/*
+ * Links sit on a grid of tick sized slots within their period. The first
+ * check lands between half a period and one and a half periods after the
+ * start.
+ */
+static unsigned long sl_ctrl_ldev_fec_mon_first_due(struct sl_ctrl_link *ctrl_link, unsigned long period)
+{
+	unsigned long tick;
+	unsigned long slots;
+	unsigned long phase;
+	unsigned long due;
+
+	tick  = msecs_to_jiffies(SL_CTRL_LDEV_FEC_MON_TICK_MS);
+	slots = max(period / tick, 1UL);
+	phase = (((ctrl_link->ctrl_lgrp->num * SL_ASIC_MAX_LINKS) + ctrl_link->num) % slots) * tick;
+	due   = jiffies + (period / 2);
+
+	return due + ((phase + period - (due % period)) % period);
+}
+
+static bool sl_ctrl_ldev_fec_mon_is_busy(struct sl_ctrl_ldev_fec_mon *fec_mon, struct sl_ctrl_link *ctrl_link)
+{
+	bool is_busy;
+
+	spin_lock(&fec_mon->lock);
+	is_busy = (fec_mon->busy_link == ctrl_link);
+	spin_unlock(&fec_mon->lock);
+
+	return is_busy;
+}
+
+static void sl_ctrl_ldev_fec_mon_stats_update(struct sl_ctrl_ldev_fec_mon *fec_mon, u64 tick_start_ns,
+					      u32 tick_links, u64 tick_ns, u64 late_ns)
+{
+	fec_mon->stats.tick_start_ns    = tick_start_ns;
+	fec_mon->stats.ticks++;
+	fec_mon->stats.checks          += tick_links;
+	fec_mon->stats.tick_links_last  = tick_links;
+	fec_mon->stats.tick_links_max   = max(fec_mon->stats.tick_links_max, tick_links);
+	fec_mon->stats.tick_ns_last     = tick_ns;
+	fec_mon->stats.tick_ns_max      = max(fec_mon->stats.tick_ns_max, tick_ns);
+	fec_mon->stats.tick_ns_sum     += tick_ns;
+	fec_mon->stats.late_ns_last     = late_ns;
+	fec_mon->stats.late_ns_max      = max(fec_mon->stats.late_ns_max, late_ns);
+	fec_mon->stats.late_ns_sum     += late_ns;
+}
+
+static void sl_ctrl_ldev_fec_mon_delayed_work(struct work_struct *work)
+{
+	struct sl_ctrl_ldev_fec_mon *fec_mon;
+	struct sl_ctrl_ldev         *ctrl_ldev;
+	struct sl_ctrl_link         *ctrl_link;
+	struct sl_ctrl_link         *tmp;
+	ktime_t                      tick_start;
+	unsigned long                now;
+	unsigned long                tick;
+	unsigned long                period;
+	u64                          start_ns;
+	u64                          late_ns;
+	u32                          period_ms;
+	u32                          tick_links;
+
+	fec_mon   = container_of(to_delayed_work(work), struct sl_ctrl_ldev_fec_mon, delayed_work);
+	ctrl_ldev = fec_mon->ctrl_ldev;
+
+	start_ns = sl_core_workq_work_start(fec_mon->core_workq, READ_ONCE(fec_mon->queue_ns));
+
+	tick_start = ktime_get();
+	now        = jiffies;
+	tick       = msecs_to_jiffies(SL_CTRL_LDEV_FEC_MON_TICK_MS);
+	tick_links = 0;
+
+	/* everything due goes in this pass */
+	spin_lock(&fec_mon->lock);
+	late_ns = time_after(now, fec_mon->tick_due) ? jiffies_to_nsecs(now - fec_mon->tick_due) : 0;
+	list_for_each_entry_safe(ctrl_link, tmp, &fec_mon->links, fec_mon_list) {
+		if (time_after_eq(now, ctrl_link->fec_mon_due))
+			list_move_tail(&ctrl_link->fec_mon_list, &fec_mon->batch);
+	}
+	spin_unlock(&fec_mon->lock);
+
+	for (;;) {
+		spin_lock(&fec_mon->lock);
+		ctrl_link = list_first_entry_or_null(&fec_mon->batch, struct sl_ctrl_link, fec_mon_list);
+		if (ctrl_link)
+			list_move_tail(&ctrl_link->fec_mon_list, &fec_mon->links);
+		fec_mon->busy_link = ctrl_link;
+		fec_mon->busy_task = ctrl_link ? current : NULL;
+		spin_unlock(&fec_mon->lock);
+
+		if (!ctrl_link)
+			break;
+
+		period_ms = sl_ctrl_link_fec_mon_check(ctrl_link);
+		tick_links++;
+
+		spin_lock(&fec_mon->lock);
+		fec_mon->busy_link = NULL;
+		fec_mon->busy_task = NULL;
+		/* not on the list when stopped during the check */
+		if (!list_empty(&ctrl_link->fec_mon_list)) {
+			if (period_ms) {
+				period = msecs_to_jiffies(period_ms);
+				ctrl_link->fec_mon_due += period;
+				if (time_before_eq(ctrl_link->fec_mon_due, now))
+					ctrl_link->fec_mon_due = sl_ctrl_ldev_fec_mon_first_due(ctrl_link, period);
+			} else {
+				list_del_init(&ctrl_link->fec_mon_list);
+				fec_mon->link_count--;
+			}
+		}
+		spin_unlock(&fec_mon->lock);
+
+		wake_up_var(&fec_mon->busy_link);
+	}
+
+	spin_lock(&fec_mon->lock);
+	sl_ctrl_ldev_fec_mon_stats_update(fec_mon, ktime_to_ns(tick_start), tick_links,
+		ktime_to_ns(ktime_sub(ktime_get(), tick_start)), late_ns);
+	if (!fec_mon->is_stopped && fec_mon->link_count) {
+		fec_mon->tick_due += tick;
+		if (time_before_eq(fec_mon->tick_due, jiffies))
+			fec_mon->tick_due = jiffies + tick;
+		sl_core_workq_delayed_queue(fec_mon->core_workq, &fec_mon->delayed_work,
+			fec_mon->tick_due - jiffies, &fec_mon->queue_ns);
+	}
+	spin_unlock(&fec_mon->lock);
+
+	sl_core_workq_work_end(fec_mon->core_workq, start_ns);
+
+	sl_ctrl_log_dbg(ctrl_ldev, LOG_NAME,
+		"fec mon tick (shard_num = %u, links = %u, late_ns = %llu)", fec_mon->shard_num, tick_links, late_ns);
+}
+
+void sl_ctrl_ldev_fec_mon_init(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	struct sl_ctrl_ldev_fec_mon *fec_mon;
+	u8                           shard_num;
+
+	for (shard_num = 0; shard_num < SL_CORE_WORKQ_NUM_SHARDS; ++shard_num) {
+		fec_mon = &ctrl_ldev->fec_mon[shard_num];
+
+		spin_lock_init(&fec_mon->lock);
+		INIT_DELAYED_WORK(&fec_mon->delayed_work, sl_ctrl_ldev_fec_mon_delayed_work);
+		INIT_LIST_HEAD(&fec_mon->links);
+		INIT_LIST_HEAD(&fec_mon->batch);
+		fec_mon->ctrl_ldev  = ctrl_ldev;
+		fec_mon->shard_num  = shard_num;
+		fec_mon->core_workq = NULL;
+		fec_mon->queue_ns   = 0;
+		fec_mon->link_count = 0;
+		fec_mon->busy_link  = NULL;
+		fec_mon->busy_task  = NULL;
+		fec_mon->is_stopped = false;
+		memset(&fec_mon->stats, 0, sizeof(fec_mon->stats));
+	}
+}
+
+/* must be called before the lgrps are deleted */
+void sl_ctrl_ldev_fec_mon_stop(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	struct sl_ctrl_ldev_fec_mon *fec_mon;
+	u8                           shard_num;
+
+	sl_ctrl_log_dbg(ctrl_ldev, LOG_NAME, "fec mon stop");
+
+	for (shard_num = 0; shard_num < SL_CORE_WORKQ_NUM_SHARDS; ++shard_num) {
+		fec_mon = &ctrl_ldev->fec_mon[shard_num];
+
+		spin_lock(&fec_mon->lock);
+		fec_mon->is_stopped = true;
+		spin_unlock(&fec_mon->lock);
+
+		/* never queued when no link was added */
+		if (fec_mon->core_workq)
+			sl_core_workq_delayed_cancel(fec_mon->core_workq, &fec_mon->delayed_work);
+	}
+}
+
+/* also restarts the phase of a link already being monitored */
+void sl_ctrl_ldev_fec_mon_link_add(struct sl_ctrl_ldev *ctrl_ldev, struct sl_ctrl_link *ctrl_link, u32 period_ms)
+{
+	struct sl_ctrl_ldev_fec_mon *fec_mon;
+	unsigned long                tick;
+
+	fec_mon = SL_CTRL_LDEV_FEC_MON(ctrl_ldev, ctrl_link);
+	tick    = msecs_to_jiffies(SL_CTRL_LDEV_FEC_MON_TICK_MS);
+
+	spin_lock(&fec_mon->lock);
+	if (fec_mon->is_stopped) {
+		spin_unlock(&fec_mon->lock);
+		sl_ctrl_log_dbg(ctrl_link, LOG_NAME, "fec mon link add - stopped");
+		return;
+	}
+	/* every lgrp of the shard has the same core workq */
+	fec_mon->core_workq    = ctrl_link->ctrl_lgrp->core_workq;
+	ctrl_link->fec_mon_due = sl_ctrl_ldev_fec_mon_first_due(ctrl_link, msecs_to_jiffies(period_ms));
+	if (list_empty(&ctrl_link->fec_mon_list)) {
+		list_add_tail(&ctrl_link->fec_mon_list, &fec_mon->links);
+		fec_mon->link_count++;
+	}
+	if (!delayed_work_pending(&fec_mon->delayed_work)) {
+		fec_mon->tick_due = jiffies + tick;
+		sl_core_workq_delayed_queue(fec_mon->core_workq, &fec_mon->delayed_work,
+			tick, &fec_mon->queue_ns);
+	}
+	spin_unlock(&fec_mon->lock);
+
+	sl_ctrl_log_dbg(ctrl_link, LOG_NAME,
+		"fec mon link add (period = %ums, due_ms = %u)", period_ms,
+		jiffies_to_msecs(ctrl_link->fec_mon_due - jiffies));
+}
+
+/* on return the engine is not checking the link */
+void sl_ctrl_ldev_fec_mon_link_del(struct sl_ctrl_ldev *ctrl_ldev, struct sl_ctrl_link *ctrl_link)
+{
+	struct sl_ctrl_ldev_fec_mon *fec_mon;
+	bool                         is_self;
+
+	fec_mon = SL_CTRL_LDEV_FEC_MON(ctrl_ldev, ctrl_link);
+
+	spin_lock(&fec_mon->lock);
+	if (!list_empty(&ctrl_link->fec_mon_list)) {
+		list_del_init(&ctrl_link->fec_mon_list);
+		fec_mon->link_count--;
+	}
+	is_self = (fec_mon->busy_task == current);
+	spin_unlock(&fec_mon->lock);
+
+	sl_ctrl_log_dbg(ctrl_link, LOG_NAME, "fec mon link del (is_self = %u)", is_self);
+
+	/* deleted from inside its own check */
+	if (is_self)
+		return;
+
+	wait_var_event(&fec_mon->busy_link, !sl_ctrl_ldev_fec_mon_is_busy(fec_mon, ctrl_link));
+}
+
+u32 sl_ctrl_ldev_fec_mon_link_count_get(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	u32 link_count;
+	u8  shard_num;
+
+	link_count = 0;
+	for (shard_num = 0; shard_num < SL_CORE_WORKQ_NUM_SHARDS; ++shard_num) {
+		spin_lock(&ctrl_ldev->fec_mon[shard_num].lock);
+		link_count += ctrl_ldev->fec_mon[shard_num].link_count;
+		spin_unlock(&ctrl_ldev->fec_mon[shard_num].lock);
+	}
+
+	return link_count;
+}
+
+/* totals and maxes over the shards, last values from the latest tick */
+void sl_ctrl_ldev_fec_mon_stats_get(struct sl_ctrl_ldev *ctrl_ldev, struct sl_ctrl_ldev_fec_mon_stats *stats)
+{
+	struct sl_ctrl_ldev_fec_mon_stats shard_stats;
+	u8                                shard_num;
+
+	memset(stats, 0, sizeof(*stats));
+
+	for (shard_num = 0; shard_num < SL_CORE_WORKQ_NUM_SHARDS; ++shard_num) {
+		spin_lock(&ctrl_ldev->fec_mon[shard_num].lock);
+		shard_stats = ctrl_ldev->fec_mon[shard_num].stats;
+		spin_unlock(&ctrl_ldev->fec_mon[shard_num].lock);
+
+		if (shard_stats.ticks && (shard_stats.tick_start_ns >= stats->tick_start_ns)) {
+			stats->tick_start_ns   = shard_stats.tick_start_ns;
+			stats->tick_links_last = shard_stats.tick_links_last;
+			stats->tick_ns_last    = shard_stats.tick_ns_last;
+			stats->late_ns_last    = shard_stats.late_ns_last;
+		}
+
+		stats->ticks          += shard_stats.ticks;
+		stats->checks         += shard_stats.checks;
+		stats->tick_links_max  = max(stats->tick_links_max, shard_stats.tick_links_max);
+		stats->tick_ns_max     = max(stats->tick_ns_max, shard_stats.tick_ns_max);
+		stats->tick_ns_sum    += shard_stats.tick_ns_sum;
+		stats->late_ns_max     = max(stats->late_ns_max, shard_stats.late_ns_max);
+		stats->late_ns_sum    += shard_stats.late_ns_sum;
+	}
+}
+
+void sl_ctrl_ldev_fec_mon_stats_clr(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	u8 shard_num;
+
+	for (shard_num = 0; shard_num < SL_CORE_WORKQ_NUM_SHARDS; ++shard_num) {
+		spin_lock(&ctrl_ldev->fec_mon[shard_num].lock);
+		memset(&ctrl_ldev->fec_mon[shard_num].stats, 0, sizeof(ctrl_ldev->fec_mon[shard_num].stats));
+		spin_unlock(&ctrl_ldev->fec_mon[shard_num].lock);
+	}
+}
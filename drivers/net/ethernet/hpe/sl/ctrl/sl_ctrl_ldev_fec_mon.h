@@ -0,0 +1,69 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#ifndef _SL_CTRL_LDEV_FEC_MON_H_
+#define _SL_CTRL_LDEV_FEC_MON_H_
+
+#include <linux/types.h>
+#include <linux/list.h>
+#include <linux/spinlock.h>
+#include <linux/workqueue.h>
+
+#include "base/sl_core_workq.h"
+
+struct sl_ctrl_ldev;
+struct sl_ctrl_link;
+struct sl_core_workq;
+struct task_struct;
+
+/*
+ * FEC monitor engine.
+ *
+ * One delayed work per workq shard ticks on that shard's workqueue while
+ * any of its links is monitored. Each tick checks every link of the shard
+ * that is due in a single pass. Links are placed on a fixed phase within
+ * their period so the checks spread evenly over the ticks instead of
+ * bunching up on the link up times. Stats are summed over the shards.
+ */
+#define SL_CTRL_LDEV_FEC_MON_TICK_MS 50
+
+struct sl_ctrl_ldev_fec_mon_stats {
+	u64 tick_start_ns;
+	u64 ticks;
+	u64 checks;
+	u32 tick_links_last;
+	u32 tick_links_max;
+	u64 tick_ns_last;
+	u64 tick_ns_max;
+	u64 tick_ns_sum;
+	u64 late_ns_last;
+	u64 late_ns_max;
+	u64 late_ns_sum;
+};
+
+struct sl_ctrl_ldev_fec_mon {
+	struct sl_ctrl_ldev               *ctrl_ldev;
+	u8                                 shard_num;
+	struct sl_core_workq              *core_workq;
+	struct delayed_work                delayed_work;
+	u64                                queue_ns;
+	struct list_head                   links;
+	struct list_head                   batch;
+	u32                                link_count;
+	struct sl_ctrl_link               *busy_link;
+	struct task_struct                *busy_task;
+	unsigned long                      tick_due;
+	bool                               is_stopped;
+	struct sl_ctrl_ldev_fec_mon_stats  stats;
+	spinlock_t                         lock;
+};
+
+void sl_ctrl_ldev_fec_mon_init(struct sl_ctrl_ldev *ctrl_ldev);
+void sl_ctrl_ldev_fec_mon_stop(struct sl_ctrl_ldev *ctrl_ldev);
+void sl_ctrl_ldev_fec_mon_link_add(struct sl_ctrl_ldev *ctrl_ldev, struct sl_ctrl_link *ctrl_link, u32 period_ms);
+void sl_ctrl_ldev_fec_mon_link_del(struct sl_ctrl_ldev *ctrl_ldev, struct sl_ctrl_link *ctrl_link);
+u32  sl_ctrl_ldev_fec_mon_link_count_get(struct sl_ctrl_ldev *ctrl_ldev);
+void sl_ctrl_ldev_fec_mon_stats_get(struct sl_ctrl_ldev *ctrl_ldev, struct sl_ctrl_ldev_fec_mon_stats *stats);
+void sl_ctrl_ldev_fec_mon_stats_clr(struct sl_ctrl_ldev *ctrl_ldev);
+
+#endif /* _SL_CTRL_LDEV_FEC_MON_H_ */
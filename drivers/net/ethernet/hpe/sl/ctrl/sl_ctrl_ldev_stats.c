@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/slab.h>
+#include <linux/mm.h>
+#include <linux/ktime.h>
+#include <linux/fs.h>
+
+#include "sl_asic.h"
+#include "base/sl_ctrl_log.h"
+#include "sl_ctrl_ldev.h"
+#include "sl_ctrl_ldev_stats.h"
+#include "sl_ctrl_lgrp.h"
+#include "sl_ctrl_link.h"
+#include "sl_ctrl_link_counters.h"
+#include "sl_ctrl_link_fec_priv.h"
+#include "sl_ctrl_mac.h"
+#include "sl_ctrl_mac_counters.h"
+#include "data/sl_ctrl_data_link.h"
+
+#define LOG_NAME SL_CTRL_LDEV_LOG_NAME
+
+#define SL_CTRL_LDEV_STATS_NUM_LINKS (SL_ASIC_MAX_LGRPS * SL_ASIC_MAX_LINKS)
+
+size_t sl_ctrl_ldev_stats_size_max(void)
+{
+	return sizeof(struct sl_ldev_stats_hdr) +
+		(SL_CTRL_LDEV_STATS_NUM_LINKS * sizeof(struct sl_ldev_stats_link)) +
+		sizeof(struct sl_ldev_stats_trailer);
+}
+
+void sl_ctrl_ldev_stats_init(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	BUILD_BUG_ON(SL_CTRL_LINK_COUNTERS_COUNT > SL_LDEV_STATS_LINK_CNTRS_MAX);
+	BUILD_BUG_ON(SL_CTRL_LINK_CAUSE_COUNTERS_COUNT > SL_LDEV_STATS_CAUSE_CNTRS_MAX);
+	BUILD_BUG_ON(SL_CTRL_LINK_AN_CAUSE_COUNTERS_COUNT > SL_LDEV_STATS_AN_CAUSE_CNTRS_MAX);
+	BUILD_BUG_ON(SL_CTRL_MAC_COUNTERS_COUNT > SL_LDEV_STATS_MAC_CNTRS_MAX);
+
+	spin_lock_init(&ctrl_ldev->stats.lock);
+	ctrl_ldev->stats.buf = NULL;
+	ctrl_ldev->stats.len = 0;
+	ctrl_ldev->stats.seq = 0;
+}
+
+void sl_ctrl_ldev_stats_del(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	void *buf;
+
+	spin_lock(&ctrl_ldev->stats.lock);
+	buf = ctrl_ldev->stats.buf;
+	ctrl_ldev->stats.buf = NULL;
+	ctrl_ldev->stats.len = 0;
+	spin_unlock(&ctrl_ldev->stats.lock);
+
+	kvfree(buf);
+}
+
+static bool sl_ctrl_ldev_stats_link_fill(struct sl_ctrl_ldev *ctrl_ldev, u8 lgrp_num, u8 link_num,
+					 struct sl_ldev_stats_link *stats_link)
+{
+	struct sl_ctrl_link *ctrl_link;
+	struct sl_ctrl_mac  *ctrl_mac;
+	struct sl_fec_info   fec_info;
+	u32                  link_state;
+	int                  x;
+
+	stats_link->lgrp_num = lgrp_num;
+	stats_link->link_num = link_num;
+
+	ctrl_link = sl_ctrl_link_get(ctrl_ldev->num, lgrp_num, link_num);
+	if (ctrl_link && sl_ctrl_link_kref_get_unless_zero(ctrl_link)) {
+		if (!sl_ctrl_data_link_state_get(ctrl_link, &link_state))
+			stats_link->link_state = link_state;
+
+		for (x = 0; x < SL_CTRL_LINK_COUNTERS_COUNT; ++x)
+			stats_link->link_cntrs[x] = atomic_read(&ctrl_link->counters[x].count);
+		for (x = 0; x < SL_CTRL_LINK_CAUSE_COUNTERS_COUNT; ++x)
+			stats_link->cause_cntrs[x] = atomic_read(&ctrl_link->cause_counters[x].count);
+		for (x = 0; x < SL_CTRL_LINK_AN_CAUSE_COUNTERS_COUNT; ++x)
+			stats_link->an_cause_cntrs[x] = atomic_read(&ctrl_link->an_cause_counters[x].count);
+
+		fec_info = sl_ctrl_link_fec_data_info_get(ctrl_link);
+		stats_link->fec.ucw       = fec_info.ucw;
+		stats_link->fec.ccw       = fec_info.ccw;
+		stats_link->fec.gcw       = fec_info.gcw;
+		stats_link->fec.period_ms = fec_info.period_ms;
+
+		stats_link->flags |= SL_LDEV_STATS_LINK_FLAG_LINK;
+
+		if (sl_ctrl_link_put(ctrl_link))
+			sl_ctrl_log_dbg(ctrl_ldev, LOG_NAME, "stats - link removed (link_num = %u)", link_num);
+	}
+
+	ctrl_mac = sl_ctrl_mac_get(ctrl_ldev->num, lgrp_num, link_num);
+	if (ctrl_mac && sl_ctrl_mac_kref_get_unless_zero(ctrl_mac)) {
+		for (x = 0; x < SL_CTRL_MAC_COUNTERS_COUNT; ++x)
+			stats_link->mac_cntrs[x] = atomic_read(&ctrl_mac->counters[x].count);
+
+		stats_link->flags |= SL_LDEV_STATS_LINK_FLAG_MAC;
+
+		if (sl_ctrl_mac_put(ctrl_mac))
+			sl_ctrl_log_dbg(ctrl_ldev, LOG_NAME, "stats - mac removed (mac_num = %u)", link_num);
+	}
+
+	return (stats_link->flags != 0);
+}
+
+int sl_ctrl_ldev_stats_snapshot(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	void                         *buf;
+	void                         *old_buf;
+	struct sl_ldev_stats_hdr     *hdr;
+	struct sl_ldev_stats_link    *stats_link;
+	struct sl_ldev_stats_trailer *trailer;
+	u8                            lgrp_num;
+	u8                            link_num;
+	u32                           num_links;
+	u64                           seq;
+
+	buf = kvzalloc(sl_ctrl_ldev_stats_size_max(), GFP_KERNEL);
+	if (!buf)
+		return -ENOMEM;
+
+	hdr        = buf;
+	stats_link = buf + sizeof(*hdr);
+	num_links  = 0;
+
+	hdr->timestamp_ns = ktime_get_real_ns();
+
+	for (lgrp_num = 0; lgrp_num < SL_ASIC_MAX_LGRPS; ++lgrp_num) {
+		if (!sl_ctrl_lgrp_get(ctrl_ldev->num, lgrp_num))
+			continue;
+		for (link_num = 0; link_num < SL_ASIC_MAX_LINKS; ++link_num) {
+			if (!sl_ctrl_ldev_stats_link_fill(ctrl_ldev, lgrp_num, link_num, stats_link)) {
+				memset(stats_link, 0, sizeof(*stats_link));
+				continue;
+			}
+			stats_link++;
+			num_links++;
+		}
+	}
+
+	hdr->magic              = SL_LDEV_STATS_MAGIC;
+	hdr->ver                = SL_LDEV_STATS_VER;
+	hdr->hdr_size           = sizeof(*hdr);
+	hdr->link_size          = sizeof(*stats_link);
+	hdr->ldev_num           = ctrl_ldev->num;
+	hdr->num_links          = num_links;
+	hdr->num_link_cntrs     = SL_CTRL_LINK_COUNTERS_COUNT;
+	hdr->num_cause_cntrs    = SL_CTRL_LINK_CAUSE_COUNTERS_COUNT;
+	hdr->num_an_cause_cntrs = SL_CTRL_LINK_AN_CAUSE_COUNTERS_COUNT;
+	hdr->num_mac_cntrs      = SL_CTRL_MAC_COUNTERS_COUNT;
+
+	trailer = (struct sl_ldev_stats_trailer *)stats_link;
+
+	spin_lock(&ctrl_ldev->stats.lock);
+	seq          = ++ctrl_ldev->stats.seq;
+	hdr->seq     = seq;
+	trailer->seq = seq;
+	old_buf               = ctrl_ldev->stats.buf;
+	ctrl_ldev->stats.buf  = buf;
+	ctrl_ldev->stats.len  = (void *)(trailer + 1) - buf;
+	spin_unlock(&ctrl_ldev->stats.lock);
+
+	kvfree(old_buf);
+
+	sl_ctrl_log_dbg(ctrl_ldev, LOG_NAME, "stats snapshot (seq = %llu, num_links = %u)", seq, num_links);
+
+	return 0;
+}
+
+ssize_t sl_ctrl_ldev_stats_read(struct sl_ctrl_ldev *ctrl_ldev, char *buf, loff_t off, size_t count)
+{
+	ssize_t len;
+
+	spin_lock(&ctrl_ldev->stats.lock);
+	if (!ctrl_ldev->stats.buf) {
+		spin_unlock(&ctrl_ldev->stats.lock);
+		return 0;
+	}
+	len = memory_read_from_buffer(buf, count, &off, ctrl_ldev->stats.buf, ctrl_ldev->stats.len);
+	spin_unlock(&ctrl_ldev->stats.lock);
+
+	return len;
+}
@@ -0,0 +1,27 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#ifndef _SL_CTRL_LDEV_STATS_H_
+#define _SL_CTRL_LDEV_STATS_H_
+
+#include <linux/types.h>
+#include <linux/spinlock.h>
+
+#include <linux/hpe/sl/sl_ldev_stats.h>
+
+struct sl_ctrl_ldev;
+
+struct sl_ctrl_ldev_stats {
+	void       *buf;
+	size_t      len;
+	u64         seq;
+	spinlock_t  lock;
+};
+
+size_t  sl_ctrl_ldev_stats_size_max(void);
+void    sl_ctrl_ldev_stats_init(struct sl_ctrl_ldev *ctrl_ldev);
+void    sl_ctrl_ldev_stats_del(struct sl_ctrl_ldev *ctrl_ldev);
+int     sl_ctrl_ldev_stats_snapshot(struct sl_ctrl_ldev *ctrl_ldev);
+ssize_t sl_ctrl_ldev_stats_read(struct sl_ctrl_ldev *ctrl_ldev, char *buf, loff_t off, size_t count);
+
+#endif /* _SL_CTRL_LDEV_STATS_H_ */
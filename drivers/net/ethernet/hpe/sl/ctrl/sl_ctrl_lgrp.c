@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2021-2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2021-2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/kobject.h>
 #include <linux/spinlock.h>
@@ -24,7 +24,7 @@
 static struct sl_ctrl_lgrp *ctrl_lgrps[SL_ASIC_MAX_LDEVS][SL_ASIC_MAX_LGRPS];
 static DEFINE_SPINLOCK(ctrl_lgrps_lock);
 
-int sl_ctrl_lgrp_new(u8 ldev_num, u8 lgrp_num, struct kobject *sysfs_parent)
+int sl_ctrl_lgrp_new(u8 ldev_num, u8 lgrp_num, struct kobject *sysfs_parent, u32 notif_depth)
 {
 	int                  rtn;
 	struct sl_ctrl_ldev *ctrl_ldev;
@@ -63,11 +63,9 @@ int sl_ctrl_lgrp_new(u8 ldev_num, u8 lgrp_num, struct kobject *sysfs_parent)
 
 	spin_lock_init(&(ctrl_lgrp->ctrl_notif.lock));
 
-	rtn = kfifo_alloc(&ctrl_lgrp->ctrl_notif.fifo,
-			  SL_CTRL_LGRP_NOTIF_MSG_COUNT * sizeof(struct sl_lgrp_notif_msg),
-			  GFP_KERNEL);
+	rtn = sl_ctrl_lgrp_notif_ring_alloc(ctrl_lgrp, notif_depth);
 	if (rtn) {
-		sl_ctrl_log_err(ctrl_lgrp, LOG_NAME, "create notif fifo failed");
+		sl_ctrl_log_err(ctrl_lgrp, LOG_NAME, "create notif ring failed");
 		rtn = -ENOMEM;
 		goto out_free;
 	}
@@ -76,8 +74,9 @@ int sl_ctrl_lgrp_new(u8 ldev_num, u8 lgrp_num, struct kobject *sysfs_parent)
 	rtn = sl_core_lgrp_new(ldev_num, lgrp_num);
 	if (rtn) {
 		sl_ctrl_log_err_trace(ctrl_lgrp, LOG_NAME, "core_lgrp_new failed [%d]", rtn);
-		goto out_kfifo_free;
+		goto out_notif_ring_free;
 	}
+	ctrl_lgrp->core_workq = sl_core_workq_get(ldev_num, lgrp_num);
 
 	rtn = sl_media_lgrp_new(ldev_num, lgrp_num);
 	if (rtn) {
@@ -106,8 +105,8 @@ int sl_ctrl_lgrp_new(u8 ldev_num, u8 lgrp_num, struct kobject *sysfs_parent)
 
 out_core_lgrp:
 	sl_core_lgrp_del(ldev_num, lgrp_num);
-out_kfifo_free:
-	kfifo_free(&ctrl_lgrp->ctrl_notif.fifo);
+out_notif_ring_free:
+	sl_ctrl_lgrp_notif_ring_free(ctrl_lgrp);
 out_free:
 	kfree(ctrl_lgrp);
 
@@ -146,8 +145,8 @@ static void sl_ctrl_lgrp_release(struct kref *ref)
 	sl_core_lgrp_del(ldev_num, lgrp_num);
 	sl_media_lgrp_del(ldev_num, lgrp_num);
 
-	cancel_work_sync(&ctrl_lgrp->notif_work);
-	kfifo_free(&ctrl_lgrp->ctrl_notif.fifo);
+	sl_core_workq_cancel(ctrl_lgrp->core_workq, &ctrl_lgrp->notif_work);
+	sl_ctrl_lgrp_notif_ring_free(ctrl_lgrp);
 
 	spin_lock(&ctrl_lgrps_lock);
 	ctrl_lgrps[ldev_num][lgrp_num] = NULL;
@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_CTRL_LGRP_H_
 #define _SL_CTRL_LGRP_H_
@@ -15,6 +15,7 @@
 #include "sl_ctrl_lgrp_notif.h"
 
 struct sl_ctrl_ldev;
+struct sl_core_workq;
 struct sl_lgrp_config;
 struct sl_lgrp_policy;
 
@@ -40,11 +41,16 @@ struct sl_ctrl_lgrp {
 	spinlock_t                       log_lock;
 
 	struct sl_ctrl_ldev             *ctrl_ldev;
+	struct sl_core_workq            *core_workq;
 
 	struct sl_ctrl_lgrp_notif        ctrl_notif;
 	struct work_struct               notif_work;
+	u64                              notif_queue_ns;
 
 	struct kobject                  *parent_kobj;
+	struct kobject                   notif_kobj;
+	struct kobject                   link_up_phase_kobj;
+	struct kobject                   workq_kobj;
 	struct kobject                   pmi_kobj;
 	struct kobject                   pmi_rd_kobj;
 	struct kobject                   pmi_wr_kobj;
@@ -77,7 +83,7 @@ struct sl_ctrl_lgrp {
 	struct completion                del_complete;
 };
 
-int		     sl_ctrl_lgrp_new(u8 ldev_num, u8 lgrp_num, struct kobject *sysfs_parent);
+int		     sl_ctrl_lgrp_new(u8 ldev_num, u8 lgrp_num, struct kobject *sysfs_parent, u32 notif_depth);
 int		     sl_ctrl_lgrp_del(u8 ldev_num, u8 lgrp_num);
 bool		     sl_ctrl_lgrp_kref_get_unless_zero(struct sl_ctrl_lgrp *ctrl_lgrp);
 int		     sl_ctrl_lgrp_put(struct sl_ctrl_lgrp *ctrl_lgrp);
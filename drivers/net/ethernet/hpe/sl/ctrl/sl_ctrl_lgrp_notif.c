@@ -5,12 +5,16 @@
 #include <linux/delay.h>
 #include <linux/slab.h>
 #include <linux/err.h>
+#include <linux/log2.h>
+#include <linux/bitops.h>
 
 #include "base/sl_ctrl_log.h"
 #include "sl_ctrl_ldev.h"
 #include "sl_ctrl_lgrp.h"
 #include "sl_ctrl_lgrp_notif.h"
 #include "sl_media_lgrp.h"
+#include "base/sl_core_workq.h"
+#include "sl_trace.h"
 
 #define LOG_NAME SL_CTRL_LGRP_NOTIF_LOG_NAME
 
@@ -28,6 +32,63 @@ static int sl_ctrl_lgrp_notif_list_state_get(struct sl_ctrl_lgrp *ctrl_lgrp)
 	return notif_list_state;
 }
 
+static u32 sl_ctrl_lgrp_notif_type_idx(u32 type)
+{
+	if (!type)
+		return 0;
+
+	return __ffs(type);
+}
+
+int sl_ctrl_lgrp_notif_ring_alloc(struct sl_ctrl_lgrp *ctrl_lgrp, u32 depth)
+{
+	struct sl_lgrp_notif_msg *ring;
+
+	if (!depth)
+		depth = SL_LGRP_NOTIF_DEPTH_DEFAULT;
+	depth = roundup_pow_of_two(depth);
+
+	ring = kcalloc(depth, sizeof(*ring), GFP_KERNEL);
+	if (!ring)
+		return -ENOMEM;
+
+	spin_lock(&ctrl_lgrp->ctrl_notif.lock);
+	ctrl_lgrp->ctrl_notif.ring           = ring;
+	ctrl_lgrp->ctrl_notif.depth          = depth;
+	ctrl_lgrp->ctrl_notif.head           = 0;
+	ctrl_lgrp->ctrl_notif.tail           = 0;
+	ctrl_lgrp->ctrl_notif.high_watermark = 0;
+	spin_unlock(&ctrl_lgrp->ctrl_notif.lock);
+
+	sl_ctrl_log_dbg(ctrl_lgrp, LOG_NAME, "notif ring alloc (depth = %u)", depth);
+
+	return 0;
+}
+
+void sl_ctrl_lgrp_notif_ring_free(struct sl_ctrl_lgrp *ctrl_lgrp)
+{
+	struct sl_lgrp_notif_msg *ring;
+
+	spin_lock(&ctrl_lgrp->ctrl_notif.lock);
+	ring = ctrl_lgrp->ctrl_notif.ring;
+	ctrl_lgrp->ctrl_notif.ring  = NULL;
+	ctrl_lgrp->ctrl_notif.depth = 0;
+	spin_unlock(&ctrl_lgrp->ctrl_notif.lock);
+
+	kfree(ring);
+}
+
+void sl_ctrl_lgrp_notif_stats_get(struct sl_ctrl_lgrp *ctrl_lgrp, struct sl_ctrl_lgrp_notif_stats *stats)
+{
+	spin_lock(&ctrl_lgrp->ctrl_notif.lock);
+	stats->depth          = ctrl_lgrp->ctrl_notif.depth;
+	stats->count          = ctrl_lgrp->ctrl_notif.tail - ctrl_lgrp->ctrl_notif.head;
+	stats->high_watermark = ctrl_lgrp->ctrl_notif.high_watermark;
+	memcpy(stats->dropped, ctrl_lgrp->ctrl_notif.dropped, sizeof(stats->dropped));
+	memcpy(stats->coalesced, ctrl_lgrp->ctrl_notif.coalesced, sizeof(stats->coalesced));
+	spin_unlock(&ctrl_lgrp->ctrl_notif.lock);
+}
+
 int sl_ctrl_lgrp_notif_callback_reg(u8 ldev_num, u8 lgrp_num, sl_lgrp_notif_t callback,
 				   u32 types, void *tag)
 {
@@ -170,11 +231,32 @@ out:
 	return rtn;
 }
 
+/* Caller holds ctrl_notif.lock */
+static bool sl_ctrl_lgrp_notif_coalesce(struct sl_ctrl_lgrp *ctrl_lgrp, struct sl_lgrp_notif_msg *notif_msg)
+{
+	struct sl_lgrp_notif_msg *last_msg;
+
+	if (ctrl_lgrp->ctrl_notif.tail == ctrl_lgrp->ctrl_notif.head)
+		return false;
+
+	/* only the newest pending message, so ordering between types is kept */
+	last_msg = &ctrl_lgrp->ctrl_notif.ring[(ctrl_lgrp->ctrl_notif.tail - 1) &
+					       (ctrl_lgrp->ctrl_notif.depth - 1)];
+	if ((last_msg->type != notif_msg->type) || (last_msg->link_num != notif_msg->link_num))
+		return false;
+
+	last_msg->info     = notif_msg->info;
+	last_msg->info_map = notif_msg->info_map;
+
+	return true;
+}
+
 int sl_ctrl_lgrp_notif_enqueue(struct sl_ctrl_lgrp *ctrl_lgrp, u8 link_num,
 			       u32 type, union sl_lgrp_notif_info *info, u64 info_map)
 {
 	struct sl_lgrp_notif_msg notif_msg;
-	int                      rtn;
+	u32                      type_idx;
+	u32                      count;
 
 	if (!ctrl_lgrp)
 		return 0;
@@ -182,14 +264,6 @@ int sl_ctrl_lgrp_notif_enqueue(struct sl_ctrl_lgrp *ctrl_lgrp, u8 link_num,
 	sl_ctrl_log_dbg(ctrl_lgrp, LOG_NAME,
 		"notif enqueue (link_num = %d, type = 0x%X)", link_num, type);
 
-	spin_lock(&ctrl_lgrp->ctrl_notif.lock);
-	if (kfifo_is_full(&ctrl_lgrp->ctrl_notif.fifo)) {
-		spin_unlock(&ctrl_lgrp->ctrl_notif.lock);
-		sl_ctrl_log_err(ctrl_lgrp, LOG_NAME, "notification fifo is full");
-		return -ENOSPC;
-	}
-	spin_unlock(&ctrl_lgrp->ctrl_notif.lock);
-
 	if (info)
 		notif_msg.info = *info;
 	else
@@ -201,56 +275,95 @@ int sl_ctrl_lgrp_notif_enqueue(struct sl_ctrl_lgrp *ctrl_lgrp, u8 link_num,
 	notif_msg.type     = type;
 	notif_msg.info_map = info_map;
 
-	rtn = kfifo_in_spinlocked(&ctrl_lgrp->ctrl_notif.fifo, &notif_msg, sizeof(notif_msg),
-				  &ctrl_lgrp->ctrl_notif.lock);
-	if (rtn != sizeof(notif_msg)) {
-		sl_ctrl_log_err(ctrl_lgrp, LOG_NAME, "write to kfifo failed");
-		return -EFAULT;
+	type_idx = sl_ctrl_lgrp_notif_type_idx(type);
+
+	spin_lock(&ctrl_lgrp->ctrl_notif.lock);
+	if (!ctrl_lgrp->ctrl_notif.ring) {
+		spin_unlock(&ctrl_lgrp->ctrl_notif.lock);
+		sl_ctrl_log_err(ctrl_lgrp, LOG_NAME, "notification ring missing");
+		return -EBADRQC;
+	}
+	if (sl_ctrl_lgrp_notif_coalesce(ctrl_lgrp, &notif_msg)) {
+		ctrl_lgrp->ctrl_notif.coalesced[type_idx]++;
+		spin_unlock(&ctrl_lgrp->ctrl_notif.lock);
+		trace_sl_ctrl_lgrp_notif_enqueue(&notif_msg, SL_TRACE_NOTIF_ENQUEUE_COALESCED);
+		sl_ctrl_log_dbg(ctrl_lgrp, LOG_NAME,
+			"notif coalesced (link_num = %d, type = 0x%X)", link_num, type);
+		goto out;
 	}
+	count = ctrl_lgrp->ctrl_notif.tail - ctrl_lgrp->ctrl_notif.head;
+	if (count >= ctrl_lgrp->ctrl_notif.depth) {
+		ctrl_lgrp->ctrl_notif.dropped[type_idx]++;
+		spin_unlock(&ctrl_lgrp->ctrl_notif.lock);
+		trace_sl_ctrl_lgrp_notif_enqueue(&notif_msg, SL_TRACE_NOTIF_ENQUEUE_DROPPED);
+		sl_ctrl_log_err(ctrl_lgrp, LOG_NAME,
+			"notification ring is full (link_num = %d, type = 0x%X %s)",
+			link_num, type, sl_lgrp_notif_str(type));
+		return -ENOSPC;
+	}
+	ctrl_lgrp->ctrl_notif.ring[ctrl_lgrp->ctrl_notif.tail & (ctrl_lgrp->ctrl_notif.depth - 1)] = notif_msg;
+	ctrl_lgrp->ctrl_notif.tail++;
+	if (count + 1 > ctrl_lgrp->ctrl_notif.high_watermark)
+		ctrl_lgrp->ctrl_notif.high_watermark = count + 1;
+	spin_unlock(&ctrl_lgrp->ctrl_notif.lock);
 
+	trace_sl_ctrl_lgrp_notif_enqueue(&notif_msg, SL_TRACE_NOTIF_ENQUEUE_QUEUED);
+
+out:
 	/* Don't catch the return as it might already be running.  This is ok */
-	queue_work(ctrl_lgrp->ctrl_ldev->notif_workq, &ctrl_lgrp->notif_work);
+	sl_core_workq_notif_queue(ctrl_lgrp->core_workq, &ctrl_lgrp->notif_work, &ctrl_lgrp->notif_queue_ns);
 
 	return 0;
 }
 
+static bool sl_ctrl_lgrp_notif_dequeue(struct sl_ctrl_lgrp *ctrl_lgrp, struct sl_lgrp_notif_msg *notif_msg)
+{
+	spin_lock(&ctrl_lgrp->ctrl_notif.lock);
+	if (!ctrl_lgrp->ctrl_notif.ring || (ctrl_lgrp->ctrl_notif.tail == ctrl_lgrp->ctrl_notif.head)) {
+		spin_unlock(&ctrl_lgrp->ctrl_notif.lock);
+		return false;
+	}
+	*notif_msg = ctrl_lgrp->ctrl_notif.ring[ctrl_lgrp->ctrl_notif.head & (ctrl_lgrp->ctrl_notif.depth - 1)];
+	ctrl_lgrp->ctrl_notif.head++;
+	spin_unlock(&ctrl_lgrp->ctrl_notif.lock);
+
+	return true;
+}
+
 void sl_ctrl_lgrp_notif_work(struct work_struct *notif_work)
 {
 	struct sl_ctrl_lgrp      *ctrl_lgrp;
 	struct sl_lgrp_notif_msg  notif_msg;
 	u8                        reg_idx;
-	int                       rtn;
-	bool                      is_empty;
+	u32                       callback_count;
+	u64                       start_ns;
 
 	ctrl_lgrp = container_of(notif_work, struct sl_ctrl_lgrp, notif_work);
 
+	start_ns = sl_core_workq_work_start(ctrl_lgrp->core_workq, ctrl_lgrp->notif_queue_ns);
+
 	sl_ctrl_log_dbg(ctrl_lgrp, LOG_NAME, "notif work");
 
 	spin_lock(&ctrl_lgrp->ctrl_notif.lock);
 	ctrl_lgrp->ctrl_notif.list_state = SL_CTRL_LGRP_NOTIF_LIST_STATE_SENDING;
 	spin_unlock(&ctrl_lgrp->ctrl_notif.lock);
 
-	do {
-		// FIXME: add cancel here
-		rtn = kfifo_out_spinlocked(&ctrl_lgrp->ctrl_notif.fifo,
-					   &notif_msg, sizeof(notif_msg),
-					   &ctrl_lgrp->ctrl_notif.lock);
-		if (rtn != sizeof(notif_msg)) {
-			sl_ctrl_log_err(ctrl_lgrp, LOG_NAME, "read from kfifo failed");
-			goto out;
-		}
+	// FIXME: add cancel here
+	while (sl_ctrl_lgrp_notif_dequeue(ctrl_lgrp, &notif_msg)) {
+		callback_count = 0;
 		for (reg_idx = 0; reg_idx < SL_CTRL_LGRP_NOTIF_REG_COUNT; ++reg_idx) {
-			if (notif_msg.type & ctrl_lgrp->ctrl_notif.reg_entry[reg_idx].types)
+			if (notif_msg.type & ctrl_lgrp->ctrl_notif.reg_entry[reg_idx].types) {
 				(ctrl_lgrp->ctrl_notif.reg_entry[reg_idx].callback)
 				(ctrl_lgrp->ctrl_notif.reg_entry[reg_idx].tag, &notif_msg);
+				callback_count++;
+			}
 		}
-		spin_lock(&ctrl_lgrp->ctrl_notif.lock);
-		is_empty = kfifo_is_empty(&ctrl_lgrp->ctrl_notif.fifo);
-		spin_unlock(&ctrl_lgrp->ctrl_notif.lock);
-	} while (!is_empty);
+		trace_sl_ctrl_lgrp_notif_deliver(&notif_msg, callback_count);
+	}
 
-out:
 	spin_lock(&ctrl_lgrp->ctrl_notif.lock);
 	ctrl_lgrp->ctrl_notif.list_state = SL_CTRL_LGRP_NOTIF_LIST_STATE_IDLE;
 	spin_unlock(&ctrl_lgrp->ctrl_notif.lock);
+
+	sl_core_workq_work_end(ctrl_lgrp->core_workq, start_ns);
 }
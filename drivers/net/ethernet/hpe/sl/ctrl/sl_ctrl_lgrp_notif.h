@@ -4,7 +4,8 @@
 #ifndef _SL_CTRL_LGRP_NOTIF_H_
 #define _SL_CTRL_LGRP_NOTIF_H_
 
-#include <linux/kfifo.h>
+#include <linux/spinlock.h>
+#include <linux/workqueue.h>
 
 #include <linux/hpe/sl/sl_lgrp.h>
 #include <linux/hpe/sl/sl_llr.h>
@@ -17,16 +18,38 @@ struct sl_ctrl_lgrp_notif_reg_entry {
 	u32              types;
 };
 
-#define SL_CTRL_LGRP_NOTIF_MSG_COUNT  8
-#define SL_CTRL_LGRP_NOTIF_REG_COUNT 16
+#define SL_CTRL_LGRP_NOTIF_REG_COUNT  16
+#define SL_CTRL_LGRP_NOTIF_TYPE_COUNT 32
+
+struct sl_ctrl_lgrp_notif_stats {
+	u32 depth;
+	u32 count;
+	u32 high_watermark;
+	u64 dropped[SL_CTRL_LGRP_NOTIF_TYPE_COUNT];
+	u64 coalesced[SL_CTRL_LGRP_NOTIF_TYPE_COUNT];
+};
 
 struct sl_ctrl_lgrp_notif {
 	u8                                  list_state;
 	struct sl_ctrl_lgrp_notif_reg_entry reg_entry[SL_CTRL_LGRP_NOTIF_REG_COUNT];
-	struct kfifo                        fifo;
+
+	/* ring of depth (power of 2) messages, head and tail free run */
+	struct sl_lgrp_notif_msg           *ring;
+	u32                                 depth;
+	u32                                 head;
+	u32                                 tail;
+
+	u32                                 high_watermark;
+	u64                                 dropped[SL_CTRL_LGRP_NOTIF_TYPE_COUNT];
+	u64                                 coalesced[SL_CTRL_LGRP_NOTIF_TYPE_COUNT];
+
 	spinlock_t                          lock;
 };
 
+int  sl_ctrl_lgrp_notif_ring_alloc(struct sl_ctrl_lgrp *ctrl_lgrp, u32 depth);
+void sl_ctrl_lgrp_notif_ring_free(struct sl_ctrl_lgrp *ctrl_lgrp);
+void sl_ctrl_lgrp_notif_stats_get(struct sl_ctrl_lgrp *ctrl_lgrp, struct sl_ctrl_lgrp_notif_stats *stats);
+
 int  sl_ctrl_lgrp_notif_callback_reg(u8 ldev_num, u8 lgrp_num, sl_lgrp_notif_t callback,
 				     u32 types, void *tag);
 int  sl_ctrl_lgrp_notif_callback_unreg(u8 ldev_num, u8 lgrp_num, sl_lgrp_notif_t callback,
@@ -93,11 +93,10 @@ int sl_ctrl_link_new(u8 ldev_num, u8 lgrp_num, u8 link_num, struct kobject *sysf
 	spin_lock_init(&ctrl_link->up_clock.lock);
 
 	spin_lock_init(&ctrl_link->fec_data.lock);
-	timer_setup(&ctrl_link->fec_mon_timer, sl_ctrl_link_fec_mon_timer, 0);
-	spin_lock_init(&ctrl_link->fec_mon_timer_lock);
+	spin_lock_init(&ctrl_link->fec_mon_lock);
+	INIT_LIST_HEAD(&ctrl_link->fec_mon_list);
 	ctrl_link->fec_data.curr_ptr = &ctrl_link->fec_data.cntrs[0];
 	ctrl_link->fec_data.prev_ptr = &ctrl_link->fec_data.cntrs[1];
-	INIT_WORK(&ctrl_link->fec_mon_timer_work, sl_ctrl_link_fec_mon_timer_work);
 
 	spin_lock_init(&ctrl_link->fec_up_cache.lock);
 	spin_lock_init(&ctrl_link->fec_down_cache.lock);
@@ -146,7 +145,6 @@ static int sl_ctrl_link_down_cmd(struct sl_ctrl_link *ctrl_link)
 	sl_ctrl_link_up_clock_reset(ctrl_link);
 
 	sl_ctrl_link_fec_mon_stop(ctrl_link);
-	cancel_work_sync(&ctrl_link->fec_mon_timer_work);
 
 	rtn = sl_core_link_an_lp_caps_stop(ctrl_link->ctrl_lgrp->ctrl_ldev->num,
 					   ctrl_link->ctrl_lgrp->num, ctrl_link->num);
@@ -174,7 +172,6 @@ static int sl_ctrl_link_cancel_cmd(struct sl_ctrl_link *ctrl_link)
 	SL_CTRL_LINK_COUNTER_INC(ctrl_link, LINK_UP_CANCEL_CMD);
 
 	sl_ctrl_link_fec_mon_stop(ctrl_link);
-	cancel_work_sync(&ctrl_link->fec_mon_timer_work);
 
 	rtn = sl_core_link_an_lp_caps_stop(ctrl_link->ctrl_lgrp->ctrl_ldev->num,
 					   ctrl_link->ctrl_lgrp->num, ctrl_link->num);
@@ -841,7 +838,6 @@ static int sl_ctrl_link_reset_cmd(struct sl_ctrl_link *ctrl_link)
 	sl_ctrl_link_up_clock_reset(ctrl_link);
 
 	sl_ctrl_link_fec_mon_stop(ctrl_link);
-	cancel_work_sync(&ctrl_link->fec_mon_timer_work);
 
 	ldev_num = ctrl_link->ctrl_lgrp->ctrl_ldev->num;
 	lgrp_num = ctrl_link->ctrl_lgrp->num;
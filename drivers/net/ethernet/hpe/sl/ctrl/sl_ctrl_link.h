@@ -5,6 +5,7 @@
 #define _SL_CTRL_LINK_H_
 
 #include <linux/spinlock.h>
+#include <linux/list.h>
 #include <linux/timer.h>
 #include <linux/workqueue.h>
 #include <linux/kobject.h>
@@ -71,10 +72,9 @@ struct sl_ctrl_link {
 
 	struct sl_ctrl_link_fec_data  fec_data;
 	u32                           fec_mon_state;
-	struct timer_list             fec_mon_timer;
-	bool                          fec_mon_timer_stop;
-	spinlock_t                    fec_mon_timer_lock;
-	struct work_struct            fec_mon_timer_work;
+	spinlock_t                    fec_mon_lock;
+	struct list_head              fec_mon_list;
+	unsigned long                 fec_mon_due;
 	struct sl_ctrl_link_fec_cache fec_up_cache;
 	struct sl_ctrl_link_fec_cache fec_down_cache;
 	u8                            fec_ucw_chance;
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include "base/sl_ctrl_log.h"
 #include "sl_ctrl_lgrp.h"
@@ -66,9 +66,9 @@ int sl_ctrl_link_fec_data_get(u8 ldev_num, u8 lgrp_num, u8 link_num,
 
 int sl_ctrl_link_fec_mon_state_get(struct sl_ctrl_link *ctrl_link, u32 *state)
 {
-	spin_lock(&ctrl_link->fec_mon_timer_lock);
+	spin_lock(&ctrl_link->fec_mon_lock);
 	*state = ctrl_link->fec_mon_state;
-	spin_unlock(&ctrl_link->fec_mon_timer_lock);
+	spin_unlock(&ctrl_link->fec_mon_lock);
 
 	sl_ctrl_log_dbg(ctrl_link, LOG_NAME, "fec monitor (state = %u, %s)", *state,
 			sl_ctrl_link_fec_mon_state_str(*state));
@@ -4,10 +4,10 @@
 #include <linux/string.h>
 #include <linux/spinlock.h>
 #include <linux/time.h>
-#include <linux/workqueue.h>
 
 #include "base/sl_ctrl_log.h"
 #include "sl_ctrl_ldev.h"
+#include "sl_ctrl_ldev_fec_mon.h"
 #include "sl_ctrl_lgrp.h"
 #include "sl_ctrl_lgrp_notif.h"
 #include "sl_ctrl_link.h"
@@ -177,17 +177,16 @@ void sl_ctrl_link_fec_mon_start(struct sl_ctrl_link *ctrl_link)
 	spin_unlock(&ctrl_link->fec_data.lock);
 	if (!period) {
 		sl_ctrl_link_fec_mon_stop(ctrl_link);
-		cancel_work_sync(&ctrl_link->fec_mon_timer_work);
 		return;
 	}
 
-	spin_lock(&ctrl_link->fec_mon_timer_lock);
-	ctrl_link->fec_mon_timer_stop = false;
+	spin_lock(&ctrl_link->fec_mon_lock);
 	ctrl_link->fec_mon_state = SL_CTRL_LINK_FEC_MON_ON;
-	mod_timer(&ctrl_link->fec_mon_timer, jiffies + msecs_to_jiffies(period));
-	spin_unlock(&ctrl_link->fec_mon_timer_lock);
+	spin_unlock(&ctrl_link->fec_mon_lock);
 
-	sl_ctrl_log_dbg(ctrl_link, LOG_NAME, "monitor timer started (period = %ums)", period);
+	sl_ctrl_ldev_fec_mon_link_add(ctrl_link->ctrl_lgrp->ctrl_ldev, ctrl_link, period);
+
+	sl_ctrl_log_dbg(ctrl_link, LOG_NAME, "monitor started (period = %ums)", period);
 }
 
 void sl_ctrl_link_fec_data_calc(struct sl_ctrl_link *ctrl_link)
@@ -381,40 +380,54 @@ int sl_ctrl_link_fec_data_check(struct sl_ctrl_link *ctrl_link)
 	return 0;
 }
 
-void sl_ctrl_link_fec_mon_timer_work(struct work_struct *work)
+static bool sl_ctrl_link_fec_mon_is_on(struct sl_ctrl_link *ctrl_link)
+{
+	u32 state;
+
+	spin_lock(&ctrl_link->fec_mon_lock);
+	state = ctrl_link->fec_mon_state;
+	spin_unlock(&ctrl_link->fec_mon_lock);
+
+	return state == SL_CTRL_LINK_FEC_MON_ON;
+}
+
+static u32 sl_ctrl_link_fec_mon_period_get(struct sl_ctrl_link *ctrl_link)
+{
+	u32 period;
+
+	spin_lock(&ctrl_link->fec_data.lock);
+	period = ctrl_link->fec_data.info.monitor.period_ms;
+	spin_unlock(&ctrl_link->fec_data.lock);
+
+	return period;
+}
+
+/* called by the ldev FEC monitor, returns the next period or 0 to stop monitoring */
+u32 sl_ctrl_link_fec_mon_check(struct sl_ctrl_link *ctrl_link)
 {
 	int                                  rtn;
-	struct sl_ctrl_link                 *ctrl_link;
 	u32                                  period;
-	bool                                 stop;
 	struct sl_core_link_fec_cw_cntrs     cw_cntrs;
 	struct sl_core_link_fec_lane_cntrs   lane_cntrs;
 	struct sl_core_link_fec_tail_cntrs   tail_cntrs;
 
-	ctrl_link = container_of(work, struct sl_ctrl_link, fec_mon_timer_work);
-
-	sl_ctrl_log_dbg(ctrl_link, LOG_NAME, "monitor timer work");
+	sl_ctrl_log_dbg(ctrl_link, LOG_NAME, "monitor check");
 
-	spin_lock(&ctrl_link->fec_data.lock);
-	period = ctrl_link->fec_data.info.monitor.period_ms;
-	spin_unlock(&ctrl_link->fec_data.lock);
+	period = sl_ctrl_link_fec_mon_period_get(ctrl_link);
 	if (!period) {
 		sl_ctrl_log_dbg(ctrl_link, LOG_NAME, "monitor period zero");
-		return;
+		return 0;
 	}
 
 	if (sl_core_link_is_pml_recovery_running(sl_core_link_get(ctrl_link->ctrl_lgrp->ctrl_ldev->num,
 	    ctrl_link->ctrl_lgrp->num, ctrl_link->num))) {
 		sl_ctrl_log_warn_trace(ctrl_link, LOG_NAME, "fec monitor skipped due to pml recovery running");
-		goto start_mon;
+		return period;
 	}
 
-	spin_lock(&ctrl_link->fec_mon_timer_lock);
-	stop = ctrl_link->fec_mon_timer_stop;
-	spin_unlock(&ctrl_link->fec_mon_timer_lock);
-	if (stop) {
+	if (!sl_ctrl_link_fec_mon_is_on(ctrl_link)) {
 		sl_ctrl_log_dbg(ctrl_link, LOG_NAME, "monitor stopped");
-		return;
+		return 0;
 	}
 
 	rtn = sl_ctrl_link_fec_data_get(ctrl_link->ctrl_lgrp->ctrl_ldev->num,
@@ -423,7 +436,7 @@ void sl_ctrl_link_fec_mon_timer_work(struct work_struct *work)
 	if (rtn) {
 		sl_ctrl_log_err_trace(ctrl_link, LOG_NAME,
 			"core_link_fec_tail_cntrs_get failed [%d]", rtn);
-		goto start_mon;
+		return period;
 	}
 
 	sl_ctrl_link_fec_data_store(ctrl_link, &cw_cntrs, &lane_cntrs, &tail_cntrs);
@@ -433,60 +446,39 @@ void sl_ctrl_link_fec_mon_timer_work(struct work_struct *work)
 	rtn = sl_ctrl_link_fec_data_check(ctrl_link);
 	if (rtn) {
 		sl_ctrl_log_err_trace(ctrl_link, LOG_NAME, "check failed [%d]", rtn);
-		return;
+		return 0;
 	}
 
-	spin_lock(&ctrl_link->fec_data.lock);
-	period = ctrl_link->fec_data.info.monitor.period_ms;
-	spin_unlock(&ctrl_link->fec_data.lock);
+	period = sl_ctrl_link_fec_mon_period_get(ctrl_link);
 	if (!period) {
 		sl_ctrl_log_dbg(ctrl_link, LOG_NAME, "monitor period zero");
-		return;
+		return 0;
 	}
 
-	spin_lock(&ctrl_link->fec_mon_timer_lock);
-	stop = ctrl_link->fec_mon_timer_stop;
-	spin_unlock(&ctrl_link->fec_mon_timer_lock);
-	if (stop) {
+	if (!sl_ctrl_link_fec_mon_is_on(ctrl_link)) {
 		sl_ctrl_log_dbg(ctrl_link, LOG_NAME, "monitor stopped");
-		return;
+		return 0;
 	}
 
-start_mon:
-	mod_timer(&ctrl_link->fec_mon_timer, jiffies + msecs_to_jiffies(period));
-	sl_ctrl_log_dbg(ctrl_link, LOG_NAME, "monitor started");
-}
-
-void sl_ctrl_link_fec_mon_timer(struct timer_list *timer)
-{
-	struct sl_ctrl_link *ctrl_link;
-
-	ctrl_link = timer_container_of(ctrl_link, timer, fec_mon_timer);
-
-	sl_ctrl_log_dbg(ctrl_link, LOG_NAME, "monitor timer");
-
-	if (!queue_work(ctrl_link->ctrl_lgrp->ctrl_ldev->workq, &(ctrl_link->fec_mon_timer_work)))
-		sl_ctrl_log_warn(ctrl_link, LOG_NAME, "fec mon timer work already queued");
+	return period;
 }
 
+/* on return the ldev FEC monitor is not checking the link */
 void sl_ctrl_link_fec_mon_stop(struct sl_ctrl_link *ctrl_link)
 {
-	bool stop;
+	u32 state;
 
 	sl_ctrl_log_dbg(ctrl_link, LOG_NAME, "monitor stop");
 
-	spin_lock(&ctrl_link->fec_mon_timer_lock);
-	stop = ctrl_link->fec_mon_timer_stop;
-	ctrl_link->fec_mon_timer_stop = true;
+	spin_lock(&ctrl_link->fec_mon_lock);
+	state = ctrl_link->fec_mon_state;
 	ctrl_link->fec_mon_state = SL_CTRL_LINK_FEC_MON_OFF;
-	spin_unlock(&ctrl_link->fec_mon_timer_lock);
+	spin_unlock(&ctrl_link->fec_mon_lock);
 
-	if (stop) {
+	if (state == SL_CTRL_LINK_FEC_MON_OFF)
 		sl_ctrl_log_dbg(ctrl_link, LOG_NAME, "monitor already stopped");
-		return;
-	}
 
-	timer_delete_sync(&ctrl_link->fec_mon_timer);
+	sl_ctrl_ldev_fec_mon_link_del(ctrl_link->ctrl_lgrp->ctrl_ldev, ctrl_link);
 }
 
 #define SL_CTRL_LINK_FEC_LIMIT_25   25781250000ULL
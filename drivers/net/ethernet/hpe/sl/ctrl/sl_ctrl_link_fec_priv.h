@@ -1,12 +1,10 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_CTRL_LINK_FEC_PRIV_H_
 #define _SL_CTRL_LINK_FEC_PRIV_H_
 
-#include <linux/timer.h>
 #include <linux/spinlock.h>
-#include <linux/workqueue.h>
 
 #include "sl_core_link_fec.h"
 
@@ -85,8 +83,7 @@ int sl_ctrl_link_fec_down_cache_tail_cntrs_get(struct sl_ctrl_link *ctrl_link,
 					       struct sl_core_link_fec_tail_cntrs *tail_cntrs);
 
 void sl_ctrl_link_fec_mon_start(struct sl_ctrl_link *ctrl_link);
-void sl_ctrl_link_fec_mon_timer_work(struct work_struct *work);
-void sl_ctrl_link_fec_mon_timer(struct timer_list *timer);
+u32  sl_ctrl_link_fec_mon_check(struct sl_ctrl_link *ctrl_link);
 void sl_ctrl_link_fec_mon_stop(struct sl_ctrl_link *ctrl_link);
 
 u32 sl_ctrl_link_fec_limit_calc(struct sl_ctrl_link *ctrl_link, u32 mant, int exp);
@@ -457,7 +457,6 @@ int sl_ctrl_link_fault_start_callback(u8 ldev_num, u8 lgrp_num, u8 link_num)
 	sl_ctrl_link_state_set(ctrl_link, SL_LINK_STATE_STOPPING);
 
 	sl_ctrl_link_fec_mon_stop(ctrl_link);
-	cancel_work_sync(&ctrl_link->fec_mon_timer_work);
 
 	return 0;
 }
@@ -486,7 +485,6 @@ int sl_ctrl_link_fault_callback(void *tag, u32 core_state, u64 core_cause_map, u
 		SL_CTRL_LINK_COUNTER_INC(ctrl_link, LINK_DOWN);
 
 		sl_ctrl_link_fec_mon_stop(ctrl_link);
-		cancel_work_sync(&ctrl_link->fec_mon_timer_work);
 
 		flush_work(&ctrl_link->ctrl_lgrp->notif_work);
 		sl_ctrl_link_state_set(ctrl_link, SL_LINK_STATE_DOWN);
@@ -579,7 +577,6 @@ int sl_ctrl_link_down_callback(void *tag, u32 core_state, u64 core_cause_map, u6
 			SL_CTRL_LINK_COUNTER_INC(ctrl_link, LINK_UP_CANCELED);
 
 		sl_ctrl_link_fec_mon_stop(ctrl_link);
-		cancel_work_sync(&ctrl_link->fec_mon_timer_work);
 
 		flush_work(&ctrl_link->ctrl_lgrp->notif_work);
 		sl_ctrl_link_state_set(ctrl_link, SL_LINK_STATE_DOWN);
@@ -625,7 +622,6 @@ static int sl_ctrl_link_async_down_callback(void *tag, u32 core_state, u64 core_
 		SL_CTRL_LINK_COUNTER_INC(ctrl_link, LINK_DOWN);
 
 		sl_ctrl_link_fec_mon_stop(ctrl_link);
-		cancel_work_sync(&ctrl_link->fec_mon_timer_work);
 
 		flush_work(&ctrl_link->ctrl_lgrp->notif_work);
 		sl_ctrl_link_state_set(ctrl_link, SL_LINK_STATE_DOWN);
@@ -113,7 +113,7 @@ static void sl_ctrl_mac_release(struct kref *kref)
 	kfree(ctrl_mac);
 }
 
-static int sl_ctrl_mac_put(struct sl_ctrl_mac *ctrl_mac)
+int sl_ctrl_mac_put(struct sl_ctrl_mac *ctrl_mac)
 {
 	return kref_put(&ctrl_mac->ref_cnt, sl_ctrl_mac_release);
 }
@@ -149,7 +149,7 @@ int sl_ctrl_mac_del(u8 ldev_num, u8 lgrp_num, u8 mac_num)
 	return 0;
 }
 
-static bool sl_ctrl_mac_kref_get_unless_zero(struct sl_ctrl_mac *ctrl_mac)
+bool sl_ctrl_mac_kref_get_unless_zero(struct sl_ctrl_mac *ctrl_mac)
 {
 	bool incremented;
 
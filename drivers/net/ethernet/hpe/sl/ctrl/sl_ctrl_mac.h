@@ -34,6 +34,8 @@ struct sl_ctrl_mac {
 int		    sl_ctrl_mac_new(u8 ldev_num, u8 lgrp_num, u8 mac_num, struct kobject *sysfs_parent);
 int		    sl_ctrl_mac_del(u8 ldev_num, u8 lgrp_num, u8 mac_num);
 struct sl_ctrl_mac *sl_ctrl_mac_get(u8 ldev_num, u8 lgrp_num, u8 mac_num);
+bool		    sl_ctrl_mac_kref_get_unless_zero(struct sl_ctrl_mac *ctrl_mac);
+int		    sl_ctrl_mac_put(struct sl_ctrl_mac *ctrl_mac);
 
 int sl_ctrl_mac_tx_start(u8 ldev_num, u8 lgrp_num, u8 mac_num);
 int sl_ctrl_mac_tx_stop(u8 ldev_num, u8 lgrp_num, u8 mac_num);
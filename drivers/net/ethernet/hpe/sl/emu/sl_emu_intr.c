@@ -0,0 +1,489 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/slab.h>
+#include <linux/list.h>
+#include <linux/random.h>
+#include <linux/bitops.h>
+
+#include "sl_log.h"
+#include "sl_emu_ldev.h"
+#include "sl_core_hw_intr_flgs.h"
+#include "hw/sl_core_hw_an.h"
+
+#define LOG_BLOCK SL_LOG_BLOCK
+#define LOG_NAME  SL_LOG_EMU_LOG_NAME
+
+/* same as core/hw/sl_core_hw_an.c */
+#define SL_EMU_AN_STATE_COMPLETE_ACK 5
+
+static bool sl_emu_intr_flgs_match(u64 *flgs, u64 *err_flgs)
+{
+	int x;
+
+	if (!flgs)
+		return false;
+
+	for (x = 0; x < SL_CORE_HW_INTR_FLGS_COUNT; ++x) {
+		if (flgs[x] != err_flgs[x])
+			return false;
+	}
+
+	return true;
+}
+
+static void sl_emu_intr_classify(struct sl_emu_intr *emu_intr)
+{
+	int intr_num;
+	u8  link_num;
+
+	emu_intr->intr_num = -1;
+
+	for (intr_num = 0; intr_num < SL_CORE_HW_INTR_COUNT; ++intr_num) {
+		for (link_num = 0; link_num < SL_ASIC_MAX_LINKS; ++link_num) {
+			if (sl_emu_intr_flgs_match(sl_core_hw_intr_flgs[intr_num][link_num],
+				emu_intr->err_flgs)) {
+				emu_intr->intr_num = intr_num;
+				emu_intr->link_num = link_num;
+				return;
+			}
+		}
+	}
+}
+
+static struct sl_emu_intr *sl_emu_intr_find(struct sl_emu_lgrp *emu_lgrp,
+					    u64 *err_flgs, sl_intr_handler_t handler)
+{
+	struct sl_emu_intr *emu_intr;
+
+	list_for_each_entry(emu_intr, &emu_lgrp->intrs, list) {
+		if ((emu_intr->err_flgs == err_flgs) && (emu_intr->handler == handler))
+			return emu_intr;
+	}
+
+	return NULL;
+}
+
+static struct sl_emu_intr *sl_emu_intr_link_find(struct sl_emu_lgrp *emu_lgrp,
+						 u8 link_num, int intr_num)
+{
+	struct sl_emu_intr *emu_intr;
+
+	list_for_each_entry(emu_intr, &emu_lgrp->intrs, list) {
+		if ((emu_intr->intr_num == intr_num) && (emu_intr->link_num == link_num))
+			return emu_intr;
+	}
+
+	return NULL;
+}
+
+static void sl_emu_intr_raise(struct sl_emu_link *emu_link, int intr_num)
+{
+	struct sl_emu_ldev *emu_ldev;
+	unsigned long       irq_flags;
+
+	emu_ldev = emu_link->emu_lgrp->emu_ldev;
+
+	sl_log_dbg(NULL, LOG_BLOCK, LOG_NAME,
+		"raise (lgrp_num = %u, link_num = %u, intr = %d)",
+		emu_link->emu_lgrp->num, emu_link->num, intr_num);
+
+	spin_lock_irqsave(&emu_ldev->intr_lock, irq_flags);
+	set_bit(intr_num, &emu_link->intr_raised);
+	spin_unlock_irqrestore(&emu_ldev->intr_lock, irq_flags);
+
+	queue_work(emu_ldev->workq, &emu_link->intr_work);
+}
+
+/*
+ * Deliver raised interrupts that are enabled. Raised interrupts that are
+ * disabled stay latched until enabled or cleared through ERR_CLR.
+ */
+static void sl_emu_intr_work(struct work_struct *work)
+{
+	struct sl_emu_link *emu_link;
+	struct sl_emu_ldev *emu_ldev;
+	struct sl_emu_intr *emu_intr;
+	unsigned long       irq_flags;
+	int                 intr_num;
+	u64                *err_flgs;
+	sl_intr_handler_t   handler;
+	void               *data;
+
+	emu_link = container_of(work, struct sl_emu_link, intr_work);
+	emu_ldev = emu_link->emu_lgrp->emu_ldev;
+
+	for (intr_num = 0; intr_num < SL_CORE_HW_INTR_COUNT; ++intr_num) {
+		spin_lock_irqsave(&emu_ldev->intr_lock, irq_flags);
+		if (!test_bit(intr_num, &emu_link->intr_raised)) {
+			spin_unlock_irqrestore(&emu_ldev->intr_lock, irq_flags);
+			continue;
+		}
+		emu_intr = sl_emu_intr_link_find(emu_link->emu_lgrp, emu_link->num, intr_num);
+		if (!emu_intr || !emu_intr->is_enabled) {
+			spin_unlock_irqrestore(&emu_ldev->intr_lock, irq_flags);
+			continue;
+		}
+		clear_bit(intr_num, &emu_link->intr_raised);
+		err_flgs = emu_intr->err_flgs;
+		handler  = emu_intr->handler;
+		data     = emu_intr->data;
+		spin_unlock_irqrestore(&emu_ldev->intr_lock, irq_flags);
+
+		sl_log_dbg(NULL, LOG_BLOCK, LOG_NAME,
+			"intr work deliver (lgrp_num = %u, link_num = %u, intr = %d)",
+			emu_link->emu_lgrp->num, emu_link->num, intr_num);
+
+		handler(err_flgs, SL_CORE_HW_INTR_FLGS_COUNT, data);
+	}
+}
+
+static void sl_emu_intr_link_up_work(struct work_struct *work)
+{
+	struct sl_emu_link   *emu_link;
+	struct sl_emu_ldev   *emu_ldev;
+	struct sl_emu_config  config;
+	unsigned long         irq_flags;
+	bool                  is_lock_enabled;
+	u32                   roll;
+
+	emu_link = container_of(to_delayed_work(work), struct sl_emu_link, link_up_work);
+	emu_ldev = emu_link->emu_lgrp->emu_ldev;
+
+	spin_lock_irqsave(&emu_ldev->regs_lock, irq_flags);
+	is_lock_enabled = emu_link->pcs.is_lock_enabled;
+	spin_unlock_irqrestore(&emu_ldev->regs_lock, irq_flags);
+
+	/* lock was disabled while training */
+	if (!is_lock_enabled)
+		return;
+
+	sl_emu_ldev_config_get(emu_ldev, &config);
+
+	roll = get_random_u32() % 100;
+
+	if (roll < config.link_up_timeout_pct) {
+		sl_log_dbg(NULL, LOG_BLOCK, LOG_NAME,
+			"link up work inject timeout (lgrp_num = %u, link_num = %u)",
+			emu_link->emu_lgrp->num, emu_link->num);
+		return;
+	}
+
+	if (roll < config.link_up_timeout_pct + config.link_up_fault_pct) {
+		sl_log_dbg(NULL, LOG_BLOCK, LOG_NAME,
+			"link up work inject fault (lgrp_num = %u, link_num = %u)",
+			emu_link->emu_lgrp->num, emu_link->num);
+		sl_emu_io_pcs_sts_set(emu_link, true, true);
+		sl_emu_intr_raise(emu_link, SL_CORE_HW_INTR_LINK_UP);
+		return;
+	}
+
+	sl_log_dbg(NULL, LOG_BLOCK, LOG_NAME,
+		"link up work (lgrp_num = %u, link_num = %u)",
+		emu_link->emu_lgrp->num, emu_link->num);
+
+	sl_emu_io_pcs_sts_set(emu_link, true, false);
+	sl_emu_io_fec_start(emu_link);
+	sl_emu_intr_raise(emu_link, SL_CORE_HW_INTR_LINK_UP);
+}
+
+/*
+ * The emulated link partner is a loopback, every page written is received
+ * back. Autoneg completes on the first page without the NP bit set.
+ */
+static void sl_emu_intr_an_work(struct work_struct *work)
+{
+	struct sl_emu_link *emu_link;
+	struct sl_emu_ldev *emu_ldev;
+	unsigned long       irq_flags;
+	u64                 page;
+	bool                is_base;
+	bool                is_complete;
+	u32                 port;
+	u64                 data64;
+
+	emu_link = container_of(to_delayed_work(work), struct sl_emu_link, an_work);
+	emu_ldev = emu_link->emu_lgrp->emu_ldev;
+	port     = emu_link->emu_lgrp->num;
+
+	spin_lock_irqsave(&emu_ldev->regs_lock, irq_flags);
+	page    = emu_link->an.page;
+	is_base = emu_link->an.is_base;
+	spin_unlock_irqrestore(&emu_ldev->regs_lock, irq_flags);
+
+	if (is_base) {
+		is_complete = !test_bit(SL_CORE_HW_AN_BP_BIT_NP, (unsigned long *)&page);
+		data64 = SS2_PORT_PML_STS_PCS_AUTONEG_BASE_PAGE_STATE_SET(SL_EMU_AN_STATE_COMPLETE_ACK) |
+			SS2_PORT_PML_STS_PCS_AUTONEG_BASE_PAGE_LP_ABILITY_SET(1)                        |
+			SS2_PORT_PML_STS_PCS_AUTONEG_BASE_PAGE_BASE_PAGE_SET(1)                         |
+			SS2_PORT_PML_STS_PCS_AUTONEG_BASE_PAGE_LP_BASE_PAGE_SET(page)                   |
+			SS2_PORT_PML_STS_PCS_AUTONEG_BASE_PAGE_COMPLETE_SET(is_complete ? 1 : 0);
+		sl_emu_io_write64(emu_ldev, SS2_PORT_PML_STS_PCS_AUTONEG_BASE_PAGE(emu_link->num), data64);
+	} else {
+		is_complete = !test_bit(SL_CORE_HW_AN_NP_BIT_NP, (unsigned long *)&page);
+		data64 = SS2_PORT_PML_STS_PCS_AUTONEG_NEXT_PAGE_STATE_SET(SL_EMU_AN_STATE_COMPLETE_ACK) |
+			SS2_PORT_PML_STS_PCS_AUTONEG_NEXT_PAGE_LP_NEXT_PAGE_SET(page)                   |
+			SS2_PORT_PML_STS_PCS_AUTONEG_NEXT_PAGE_COMPLETE_SET(is_complete ? 1 : 0);
+		sl_emu_io_write64(emu_ldev, SS2_PORT_PML_STS_PCS_AUTONEG_NEXT_PAGE(emu_link->num), data64);
+	}
+
+	sl_log_dbg(NULL, LOG_BLOCK, LOG_NAME,
+		"an work (lgrp_num = %u, link_num = %u, base = %d, page = 0x%016llX, complete = %d)",
+		emu_link->emu_lgrp->num, emu_link->num, is_base, page, is_complete);
+
+	sl_emu_intr_raise(emu_link, SL_CORE_HW_INTR_AN_PAGE_RECV);
+}
+
+void sl_emu_intr_an_page_send(struct sl_emu_link *emu_link)
+{
+	struct sl_emu_config config;
+
+	sl_emu_ldev_config_get(emu_link->emu_lgrp->emu_ldev, &config);
+
+	mod_delayed_work(emu_link->emu_lgrp->emu_ldev->workq, &emu_link->an_work,
+		msecs_to_jiffies(config.an_page_ms));
+}
+
+void sl_emu_intr_link_up_start(struct sl_emu_link *emu_link)
+{
+	struct sl_emu_config config;
+	u32                  delay_ms;
+
+	sl_emu_ldev_config_get(emu_link->emu_lgrp->emu_ldev, &config);
+
+	delay_ms = config.link_up_ms;
+	if (config.link_up_jitter_ms)
+		delay_ms += get_random_u32() % (config.link_up_jitter_ms + 1);
+
+	sl_log_dbg(NULL, LOG_BLOCK, LOG_NAME,
+		"link up start (lgrp_num = %u, link_num = %u, delay_ms = %u)",
+		emu_link->emu_lgrp->num, emu_link->num, delay_ms);
+
+	sl_emu_io_fec_stop(emu_link);
+	sl_emu_io_pcs_sts_set(emu_link, false, false);
+
+	mod_delayed_work(emu_link->emu_lgrp->emu_ldev->workq, &emu_link->link_up_work,
+		msecs_to_jiffies(delay_ms));
+}
+
+void sl_emu_intr_link_down(struct sl_emu_link *emu_link)
+{
+	sl_log_dbg(NULL, LOG_BLOCK, LOG_NAME,
+		"link down (lgrp_num = %u, link_num = %u)",
+		emu_link->emu_lgrp->num, emu_link->num);
+
+	cancel_delayed_work(&emu_link->link_up_work);
+
+	sl_emu_io_fec_stop(emu_link);
+	sl_emu_io_pcs_sts_set(emu_link, false, false);
+}
+
+void sl_emu_intr_clr(struct sl_emu_lgrp *emu_lgrp, u8 word, u64 data)
+{
+	struct sl_emu_ldev *emu_ldev;
+	unsigned long       irq_flags;
+	int                 intr_num;
+	u8                  link_num;
+	u64                *flgs;
+
+	emu_ldev = emu_lgrp->emu_ldev;
+
+	spin_lock_irqsave(&emu_ldev->intr_lock, irq_flags);
+	for (link_num = 0; link_num < SL_ASIC_MAX_LINKS; ++link_num) {
+		for (intr_num = 0; intr_num < SL_CORE_HW_INTR_COUNT; ++intr_num) {
+			flgs = sl_core_hw_intr_flgs[intr_num][link_num];
+			if (flgs && (flgs[word] & data))
+				clear_bit(intr_num, &emu_lgrp->links[link_num].intr_raised);
+		}
+	}
+	spin_unlock_irqrestore(&emu_ldev->intr_lock, irq_flags);
+}
+
+int sl_emu_intr_register(void *intr_accessor, u32 lgrp_num, char *tag,
+			 u64 *err_flgs, sl_intr_handler_t handler, void *data)
+{
+	struct sl_emu_ldev *emu_ldev;
+	struct sl_emu_lgrp *emu_lgrp;
+	struct sl_emu_intr *emu_intr;
+	unsigned long       irq_flags;
+
+	emu_ldev = intr_accessor;
+	if (lgrp_num >= SL_ASIC_MAX_LGRPS)
+		return -EINVAL;
+	emu_lgrp = &emu_ldev->lgrps[lgrp_num];
+
+	emu_intr = kzalloc(sizeof(*emu_intr), GFP_KERNEL);
+	if (!emu_intr)
+		return -ENOMEM;
+
+	emu_intr->err_flgs = err_flgs;
+	emu_intr->handler  = handler;
+	emu_intr->data     = data;
+	sl_emu_intr_classify(emu_intr);
+
+	sl_log_dbg(NULL, LOG_BLOCK, LOG_NAME,
+		"register (lgrp_num = %u, tag = %s, intr = %d, link_num = %u)",
+		lgrp_num, tag, emu_intr->intr_num, emu_intr->link_num);
+
+	spin_lock_irqsave(&emu_ldev->intr_lock, irq_flags);
+	if (sl_emu_intr_find(emu_lgrp, err_flgs, handler)) {
+		spin_unlock_irqrestore(&emu_ldev->intr_lock, irq_flags);
+		kfree(emu_intr);
+		return -EEXIST;
+	}
+	list_add_tail(&emu_intr->list, &emu_lgrp->intrs);
+	spin_unlock_irqrestore(&emu_ldev->intr_lock, irq_flags);
+
+	return 0;
+}
+
+int sl_emu_intr_unregister(void *intr_accessor, u32 lgrp_num,
+			   u64 *err_flgs, sl_intr_handler_t handler)
+{
+	struct sl_emu_ldev *emu_ldev;
+	struct sl_emu_lgrp *emu_lgrp;
+	struct sl_emu_intr *emu_intr;
+	unsigned long       irq_flags;
+	int                 intr_num;
+	u8                  link_num;
+
+	emu_ldev = intr_accessor;
+	if (lgrp_num >= SL_ASIC_MAX_LGRPS)
+		return -EINVAL;
+	emu_lgrp = &emu_ldev->lgrps[lgrp_num];
+
+	spin_lock_irqsave(&emu_ldev->intr_lock, irq_flags);
+	emu_intr = sl_emu_intr_find(emu_lgrp, err_flgs, handler);
+	if (!emu_intr) {
+		spin_unlock_irqrestore(&emu_ldev->intr_lock, irq_flags);
+		return -ENOENT;
+	}
+	list_del(&emu_intr->list);
+	spin_unlock_irqrestore(&emu_ldev->intr_lock, irq_flags);
+
+	intr_num = emu_intr->intr_num;
+	link_num = emu_intr->link_num;
+	kfree(emu_intr);
+
+	if (intr_num < 0)
+		return 0;
+
+	if (intr_num == SL_CORE_HW_INTR_LINK_UP)
+		cancel_delayed_work_sync(&emu_lgrp->links[link_num].link_up_work);
+	if (intr_num == SL_CORE_HW_INTR_AN_PAGE_RECV)
+		cancel_delayed_work_sync(&emu_lgrp->links[link_num].an_work);
+	cancel_work_sync(&emu_lgrp->links[link_num].intr_work);
+
+	return 0;
+}
+
+int sl_emu_intr_enable(void *intr_accessor, u32 lgrp_num,
+		       u64 *err_flgs, sl_intr_handler_t handler)
+{
+	struct sl_emu_ldev *emu_ldev;
+	struct sl_emu_lgrp *emu_lgrp;
+	struct sl_emu_intr *emu_intr;
+	unsigned long       irq_flags;
+	int                 intr_num;
+	u8                  link_num;
+	bool                is_raised;
+
+	emu_ldev = intr_accessor;
+	if (lgrp_num >= SL_ASIC_MAX_LGRPS)
+		return -EINVAL;
+	emu_lgrp = &emu_ldev->lgrps[lgrp_num];
+
+	spin_lock_irqsave(&emu_ldev->intr_lock, irq_flags);
+	emu_intr = sl_emu_intr_find(emu_lgrp, err_flgs, handler);
+	if (!emu_intr) {
+		spin_unlock_irqrestore(&emu_ldev->intr_lock, irq_flags);
+		return -ENOENT;
+	}
+	emu_intr->is_enabled = true;
+	intr_num  = emu_intr->intr_num;
+	link_num  = emu_intr->link_num;
+	is_raised = (intr_num >= 0) && test_bit(intr_num, &emu_lgrp->links[link_num].intr_raised);
+	spin_unlock_irqrestore(&emu_ldev->intr_lock, irq_flags);
+
+	if (intr_num < 0)
+		return 0;
+
+	if (is_raised)
+		queue_work(emu_ldev->workq, &emu_lgrp->links[link_num].intr_work);
+
+	return 0;
+}
+
+int sl_emu_intr_disable(void *intr_accessor, u32 lgrp_num,
+			u64 *err_flgs, sl_intr_handler_t handler)
+{
+	struct sl_emu_ldev *emu_ldev;
+	struct sl_emu_lgrp *emu_lgrp;
+	struct sl_emu_intr *emu_intr;
+	unsigned long       irq_flags;
+
+	emu_ldev = intr_accessor;
+	if (lgrp_num >= SL_ASIC_MAX_LGRPS)
+		return -EINVAL;
+	emu_lgrp = &emu_ldev->lgrps[lgrp_num];
+
+	spin_lock_irqsave(&emu_ldev->intr_lock, irq_flags);
+	emu_intr = sl_emu_intr_find(emu_lgrp, err_flgs, handler);
+	if (!emu_intr) {
+		spin_unlock_irqrestore(&emu_ldev->intr_lock, irq_flags);
+		return -ENOENT;
+	}
+	emu_intr->is_enabled = false;
+	spin_unlock_irqrestore(&emu_ldev->intr_lock, irq_flags);
+
+	return 0;
+}
+
+void sl_emu_intr_init(struct sl_emu_ldev *emu_ldev)
+{
+	struct sl_emu_lgrp *emu_lgrp;
+	struct sl_emu_link *emu_link;
+	u8                  lgrp_num;
+	u8                  link_num;
+
+	spin_lock_init(&emu_ldev->intr_lock);
+
+	for (lgrp_num = 0; lgrp_num < SL_ASIC_MAX_LGRPS; ++lgrp_num) {
+		emu_lgrp           = &emu_ldev->lgrps[lgrp_num];
+		emu_lgrp->num      = lgrp_num;
+		emu_lgrp->emu_ldev = emu_ldev;
+		INIT_LIST_HEAD(&emu_lgrp->intrs);
+		for (link_num = 0; link_num < SL_ASIC_MAX_LINKS; ++link_num) {
+			emu_link           = &emu_lgrp->links[link_num];
+			emu_link->num      = link_num;
+			emu_link->emu_lgrp = emu_lgrp;
+			INIT_DELAYED_WORK(&emu_link->link_up_work, sl_emu_intr_link_up_work);
+			INIT_DELAYED_WORK(&emu_link->an_work, sl_emu_intr_an_work);
+			INIT_WORK(&emu_link->intr_work, sl_emu_intr_work);
+		}
+	}
+}
+
+void sl_emu_intr_exit(struct sl_emu_ldev *emu_ldev)
+{
+	struct sl_emu_lgrp *emu_lgrp;
+	struct sl_emu_link *emu_link;
+	struct sl_emu_intr *emu_intr;
+	struct sl_emu_intr *tmp;
+	u8                  lgrp_num;
+	u8                  link_num;
+
+	for (lgrp_num = 0; lgrp_num < SL_ASIC_MAX_LGRPS; ++lgrp_num) {
+		emu_lgrp = &emu_ldev->lgrps[lgrp_num];
+		for (link_num = 0; link_num < SL_ASIC_MAX_LINKS; ++link_num) {
+			emu_link = &emu_lgrp->links[link_num];
+			cancel_delayed_work_sync(&emu_link->link_up_work);
+			cancel_delayed_work_sync(&emu_link->an_work);
+			cancel_work_sync(&emu_link->intr_work);
+		}
+		list_for_each_entry_safe(emu_intr, tmp, &emu_lgrp->intrs, list) {
+			list_del(&emu_intr->list);
+			kfree(emu_intr);
+		}
+	}
+}
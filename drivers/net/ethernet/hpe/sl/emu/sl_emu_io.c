@@ -0,0 +1,452 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/slab.h>
+#include <linux/hashtable.h>
+#include <linux/math64.h>
+
+#include <linux/hpe/sl/sl_lgrp.h>
+
+#include "sl_log.h"
+#include "sl_emu_ldev.h"
+
+#define LOG_BLOCK SL_LOG_BLOCK
+#define LOG_NAME  SL_LOG_EMU_LOG_NAME
+
+/* FEC Cntrs - same addresses as core/hw/switch/sl_core_hw_fec.c */
+#define SL_EMU_UCW_ADDR(_lgrp_num, _link_num) (R2_PF_PML_BASE(_lgrp_num) + \
+	SS2_PORT_PML_STS_EVENT_CNTS_OFFSET(BASE_CNTR_IDX_PCS + ROSEVC_PCS_UNCORRECTED_CW_00_INDEX + _link_num))
+
+#define SL_EMU_CCW_ADDR(_lgrp_num, _link_num) (R2_PF_PML_BASE(_lgrp_num) + \
+	SS2_PORT_PML_STS_EVENT_CNTS_OFFSET(BASE_CNTR_IDX_PCS + ROSEVC_PCS_CORRECTED_CW_00_INDEX + _link_num))
+
+#define SL_EMU_GCW_ADDR(_lgrp_num, _link_num) (R2_PF_PML_BASE(_lgrp_num) + \
+	SS2_PORT_PML_STS_EVENT_CNTS_OFFSET(BASE_CNTR_IDX_PCS + ROSEVC_PCS_GOOD_CW_00_INDEX + _link_num))
+
+#define SL_EMU_SBUS_KEY(_ring, _dev_addr, _reg) \
+	(((u64)(_ring) << 16) | ((u64)(_dev_addr) << 8) | (u64)(_reg))
+#define SL_EMU_SBUS_DEV_MASK 0xFFFF00ULL
+
+#define SL_EMU_PMI_KEY(_lgrp_num, _addr) \
+	(((u64)(_lgrp_num) << 32) | (u64)(_addr))
+#define SL_EMU_PMI_LGRP_MASK 0xFF00000000ULL
+
+static struct sl_emu_reg *sl_emu_io_reg_find(struct hlist_head *table, u32 bits, u64 addr)
+{
+	struct sl_emu_reg *reg;
+
+	hlist_for_each_entry(reg, &table[hash_64(addr, bits)], node) {
+		if (reg->addr == addr)
+			return reg;
+	}
+
+	return NULL;
+}
+
+#define sl_emu_io_find(_table, _addr) \
+	sl_emu_io_reg_find((_table), HASH_BITS(_table), (_addr))
+
+static struct sl_emu_reg *sl_emu_io_add(struct hlist_head *table, u32 bits, u64 addr, gfp_t gfp)
+{
+	struct sl_emu_reg *reg;
+
+	reg = kzalloc(sizeof(*reg), gfp);
+	if (!reg)
+		return NULL;
+
+	reg->addr = addr;
+	reg->kind = SL_EMU_REG_KIND_PLAIN;
+	hlist_add_head(&reg->node, &table[hash_64(addr, bits)]);
+
+	return reg;
+}
+
+static void sl_emu_io_free(struct hlist_head *table, u32 size)
+{
+	struct sl_emu_reg *reg;
+	struct hlist_node *tmp;
+	u32                bkt;
+
+	for (bkt = 0; bkt < size; ++bkt) {
+		hlist_for_each_entry_safe(reg, tmp, &table[bkt], node) {
+			hlist_del(&reg->node);
+			kfree(reg);
+		}
+	}
+}
+
+static int sl_emu_io_special_add(struct sl_emu_ldev *emu_ldev, u64 addr, u8 kind,
+				 u8 lgrp_num, u8 link_num, u8 word)
+{
+	struct sl_emu_reg *reg;
+
+	reg = sl_emu_io_find(emu_ldev->regs, addr);
+	if (!reg) {
+		reg = sl_emu_io_add(emu_ldev->regs, HASH_BITS(emu_ldev->regs), addr, GFP_KERNEL);
+		if (!reg)
+			return -ENOMEM;
+	}
+
+	reg->kind     = kind;
+	reg->lgrp_num = lgrp_num;
+	reg->link_num = link_num;
+	reg->word     = word;
+
+	return 0;
+}
+
+int sl_emu_io_init(struct sl_emu_ldev *emu_ldev)
+{
+	int rtn;
+	u32 port;
+	u8  lgrp_num;
+	u8  link_num;
+	u8  word;
+
+	sl_log_dbg(NULL, LOG_BLOCK, LOG_NAME, "io init (ldev_num = %u)", emu_ldev->num);
+
+	spin_lock_init(&emu_ldev->regs_lock);
+	hash_init(emu_ldev->regs);
+	hash_init(emu_ldev->sbus);
+	hash_init(emu_ldev->pmi);
+
+	for (lgrp_num = 0; lgrp_num < SL_ASIC_MAX_LGRPS; ++lgrp_num) {
+		port = lgrp_num;
+		for (word = 0; word < SL_CORE_HW_INTR_FLGS_COUNT; ++word) {
+			rtn = sl_emu_io_special_add(emu_ldev, SS2_PORT_PML_ERR_CLR + (word * 8),
+				SL_EMU_REG_KIND_ERR_CLR, lgrp_num, 0, word);
+			if (rtn)
+				goto out;
+		}
+		for (link_num = 0; link_num < SL_ASIC_MAX_LINKS; ++link_num) {
+			rtn = sl_emu_io_special_add(emu_ldev, SS2_PORT_PML_CFG_PCS_AUTONEG_BASE_PAGE(link_num),
+				SL_EMU_REG_KIND_AN_BP, lgrp_num, link_num, 0);
+			if (rtn)
+				goto out;
+			rtn = sl_emu_io_special_add(emu_ldev, SS2_PORT_PML_CFG_PCS_AUTONEG_NEXT_PAGE(link_num),
+				SL_EMU_REG_KIND_AN_NP, lgrp_num, link_num, 0);
+			if (rtn)
+				goto out;
+			rtn = sl_emu_io_special_add(emu_ldev, SL_EMU_GCW_ADDR(lgrp_num, link_num),
+				SL_EMU_REG_KIND_FEC_GCW, lgrp_num, link_num, 0);
+			if (rtn)
+				goto out;
+			rtn = sl_emu_io_special_add(emu_ldev, SL_EMU_CCW_ADDR(lgrp_num, link_num),
+				SL_EMU_REG_KIND_FEC_CCW, lgrp_num, link_num, 0);
+			if (rtn)
+				goto out;
+			rtn = sl_emu_io_special_add(emu_ldev, SL_EMU_UCW_ADDR(lgrp_num, link_num),
+				SL_EMU_REG_KIND_FEC_UCW, lgrp_num, link_num, 0);
+			if (rtn)
+				goto out;
+			rtn = sl_emu_io_special_add(emu_ldev, SS2_PORT_PML_CFG_RX_PCS_SUBPORT(link_num),
+				SL_EMU_REG_KIND_PCS_RX, lgrp_num, link_num, 0);
+			if (rtn)
+				goto out;
+		}
+	}
+
+	return 0;
+
+out:
+	sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "io init special add failed [%d]", rtn);
+	sl_emu_io_exit(emu_ldev);
+	return rtn;
+}
+
+void sl_emu_io_exit(struct sl_emu_ldev *emu_ldev)
+{
+	sl_log_dbg(NULL, LOG_BLOCK, LOG_NAME, "io exit (ldev_num = %u)", emu_ldev->num);
+
+	sl_emu_io_free(emu_ldev->regs, HASH_SIZE(emu_ldev->regs));
+	sl_emu_io_free(emu_ldev->sbus, HASH_SIZE(emu_ldev->sbus));
+	sl_emu_io_free(emu_ldev->pmi, HASH_SIZE(emu_ldev->pmi));
+}
+
+static u64 sl_emu_io_fec_cntr(struct sl_emu_ldev *emu_ldev, u8 kind, ktime_t start)
+{
+	struct sl_emu_config config;
+	u64                  rate;
+	s64                  elapsed_ms;
+
+	sl_emu_ldev_config_get(emu_ldev, &config);
+
+	switch (kind) {
+	case SL_EMU_REG_KIND_FEC_GCW:
+		rate = config.fec_gcw_per_sec;
+		break;
+	case SL_EMU_REG_KIND_FEC_CCW:
+		rate = config.fec_ccw_per_sec;
+		break;
+	default:
+		rate = config.fec_ucw_per_sec;
+		break;
+	}
+
+	elapsed_ms = ktime_ms_delta(ktime_get(), start);
+	if (elapsed_ms <= 0)
+		return 0;
+
+	return div_u64(rate * elapsed_ms, MSEC_PER_SEC);
+}
+
+u64 sl_emu_io_read64(void *pci_accessor, long addr)
+{
+	struct sl_emu_ldev *emu_ldev;
+	struct sl_emu_reg  *reg;
+	struct sl_emu_link *emu_link;
+	unsigned long       irq_flags;
+	u64                 data;
+	u8                  kind;
+	bool                is_running;
+	ktime_t             start;
+
+	emu_ldev = pci_accessor;
+
+	spin_lock_irqsave(&emu_ldev->regs_lock, irq_flags);
+	reg = sl_emu_io_find(emu_ldev->regs, addr);
+	if (!reg) {
+		spin_unlock_irqrestore(&emu_ldev->regs_lock, irq_flags);
+		return 0;
+	}
+	data = reg->data;
+	kind = reg->kind;
+	if ((kind != SL_EMU_REG_KIND_FEC_GCW) &&
+		(kind != SL_EMU_REG_KIND_FEC_CCW) &&
+		(kind != SL_EMU_REG_KIND_FEC_UCW)) {
+		spin_unlock_irqrestore(&emu_ldev->regs_lock, irq_flags);
+		return data;
+	}
+	emu_link   = &emu_ldev->lgrps[reg->lgrp_num].links[reg->link_num];
+	is_running = emu_link->fec.is_running;
+	start      = emu_link->fec.start;
+	spin_unlock_irqrestore(&emu_ldev->regs_lock, irq_flags);
+
+	if (!is_running)
+		return 0;
+
+	return sl_emu_io_fec_cntr(emu_ldev, kind, start);
+}
+
+void sl_emu_io_write64(void *pci_accessor, long addr, u64 data)
+{
+	struct sl_emu_ldev *emu_ldev;
+	struct sl_emu_reg  *reg;
+	struct sl_emu_lgrp *emu_lgrp;
+	struct sl_emu_link *emu_link;
+	unsigned long       irq_flags;
+	u8                  kind;
+	u8                  link_num;
+	u8                  word;
+	bool                was_lock_enabled;
+	bool                is_lock_enabled;
+
+	emu_ldev = pci_accessor;
+
+	spin_lock_irqsave(&emu_ldev->regs_lock, irq_flags);
+	reg = sl_emu_io_find(emu_ldev->regs, addr);
+	if (!reg) {
+		reg = sl_emu_io_add(emu_ldev->regs, HASH_BITS(emu_ldev->regs), addr, GFP_ATOMIC);
+		if (!reg) {
+			spin_unlock_irqrestore(&emu_ldev->regs_lock, irq_flags);
+			sl_log_err(NULL, LOG_BLOCK, LOG_NAME,
+				"write64 alloc failed (addr = 0x%016lX)", addr);
+			return;
+		}
+	}
+
+	kind     = reg->kind;
+	emu_lgrp = &emu_ldev->lgrps[reg->lgrp_num];
+	link_num = reg->link_num;
+	word     = reg->word;
+	emu_link = &emu_lgrp->links[link_num];
+
+	was_lock_enabled = false;
+	is_lock_enabled  = false;
+
+	switch (kind) {
+	case SL_EMU_REG_KIND_FEC_GCW:
+	case SL_EMU_REG_KIND_FEC_CCW:
+	case SL_EMU_REG_KIND_FEC_UCW:
+		/* counters are read only */
+		break;
+	case SL_EMU_REG_KIND_AN_BP:
+	case SL_EMU_REG_KIND_AN_NP:
+		reg->data = data;
+		emu_lgrp->links[link_num].an.page    = data;
+		emu_lgrp->links[link_num].an.is_base = (kind == SL_EMU_REG_KIND_AN_BP);
+		break;
+	case SL_EMU_REG_KIND_PCS_RX:
+		reg->data = data;
+		was_lock_enabled = emu_link->pcs.is_lock_enabled;
+		is_lock_enabled  = SS2_PORT_PML_CFG_RX_PCS_SUBPORT_ENABLE_LOCK_GET(data);
+		emu_link->pcs.is_lock_enabled = is_lock_enabled;
+		break;
+	default:
+		reg->data = data;
+		break;
+	}
+	spin_unlock_irqrestore(&emu_ldev->regs_lock, irq_flags);
+
+	switch (kind) {
+	case SL_EMU_REG_KIND_ERR_CLR:
+		sl_emu_intr_clr(emu_lgrp, word, data);
+		break;
+	case SL_EMU_REG_KIND_AN_BP:
+	case SL_EMU_REG_KIND_AN_NP:
+		sl_emu_intr_an_page_send(&emu_lgrp->links[link_num]);
+		break;
+	case SL_EMU_REG_KIND_PCS_RX:
+		/* PCS trains from the point lock is enabled */
+		if (!was_lock_enabled && is_lock_enabled)
+			sl_emu_intr_link_up_start(emu_link);
+		else if (was_lock_enabled && !is_lock_enabled)
+			sl_emu_intr_link_down(emu_link);
+		break;
+	}
+}
+
+int sl_emu_io_reg_ops(void *pci_accessor, struct sl_reg_op *ops, u32 count)
+{
+	u32 x;
+
+	for (x = 0; x < count; ++x) {
+		switch (ops[x].op) {
+		case SL_REG_OP_RD64:
+			ops[x].data = sl_emu_io_read64(pci_accessor, ops[x].addr);
+			break;
+		case SL_REG_OP_WR64:
+			sl_emu_io_write64(pci_accessor, ops[x].addr, ops[x].data);
+			break;
+		default:
+			sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "reg ops invalid (op = %u)", ops[x].op);
+			return -EINVAL;
+		}
+	}
+
+	return 0;
+}
+
+void sl_emu_io_pcs_sts_set(struct sl_emu_link *emu_link, bool is_aligned, bool is_faulted)
+{
+	u32 port;
+	u64 data64;
+
+	port = emu_link->emu_lgrp->num;
+
+	data64 = SS2_PORT_PML_STS_RX_PCS_SUBPORT_ALIGN_STATUS_SET(is_aligned ? 1 : 0) |
+		SS2_PORT_PML_STS_RX_PCS_SUBPORT_FAULT_SET(is_faulted ? 1 : 0)         |
+		SS2_PORT_PML_STS_RX_PCS_SUBPORT_LOCAL_FAULT_SET(is_faulted ? 1 : 0);
+
+	sl_emu_io_write64(emu_link->emu_lgrp->emu_ldev,
+		SS2_PORT_PML_STS_RX_PCS_SUBPORT(emu_link->num), data64);
+}
+
+void sl_emu_io_fec_start(struct sl_emu_link *emu_link)
+{
+	unsigned long irq_flags;
+
+	spin_lock_irqsave(&emu_link->emu_lgrp->emu_ldev->regs_lock, irq_flags);
+	emu_link->fec.is_running = true;
+	emu_link->fec.start      = ktime_get();
+	spin_unlock_irqrestore(&emu_link->emu_lgrp->emu_ldev->regs_lock, irq_flags);
+}
+
+void sl_emu_io_fec_stop(struct sl_emu_link *emu_link)
+{
+	unsigned long irq_flags;
+
+	spin_lock_irqsave(&emu_link->emu_lgrp->emu_ldev->regs_lock, irq_flags);
+	emu_link->fec.is_running = false;
+	spin_unlock_irqrestore(&emu_link->emu_lgrp->emu_ldev->regs_lock, irq_flags);
+}
+
+static int sl_emu_io_op(struct sl_emu_ldev *emu_ldev, struct hlist_head *table, u32 bits,
+			u64 key, u64 rst_mask, u8 op, u64 *rd_data, u64 wr_data, u64 wr_mask)
+{
+	struct sl_emu_reg *reg;
+	struct hlist_node *tmp;
+	unsigned long      irq_flags;
+	u32                bkt;
+
+	spin_lock_irqsave(&emu_ldev->regs_lock, irq_flags);
+	switch (op) {
+	case SL_SBUS_OP_RST:
+		for (bkt = 0; bkt < (1U << bits); ++bkt) {
+			hlist_for_each_entry_safe(reg, tmp, &table[bkt], node) {
+				if ((reg->addr & rst_mask) != (key & rst_mask))
+					continue;
+				hlist_del(&reg->node);
+				kfree(reg);
+			}
+		}
+		break;
+	case SL_SBUS_OP_RD:
+		reg = sl_emu_io_reg_find(table, bits, key);
+		*rd_data = reg ? reg->data : 0;
+		break;
+	case SL_SBUS_OP_WR:
+		reg = sl_emu_io_reg_find(table, bits, key);
+		if (!reg) {
+			reg = sl_emu_io_add(table, bits, key, GFP_ATOMIC);
+			if (!reg) {
+				spin_unlock_irqrestore(&emu_ldev->regs_lock, irq_flags);
+				return -ENOMEM;
+			}
+		}
+		reg->data = (reg->data & ~wr_mask) | (wr_data & wr_mask);
+		break;
+	default:
+		spin_unlock_irqrestore(&emu_ldev->regs_lock, irq_flags);
+		return -EINVAL;
+	}
+	spin_unlock_irqrestore(&emu_ldev->regs_lock, irq_flags);
+
+	return 0;
+}
+
+int sl_emu_io_sbus_op(void *sbus_accessor, u8 op, u8 ring, u8 dev_addr, u8 reg,
+		      u32 *rd_data, u32 wr_data)
+{
+	int rtn;
+	u64 data;
+
+	rtn = sl_emu_io_op(sbus_accessor, ((struct sl_emu_ldev *)sbus_accessor)->sbus,
+		SL_EMU_SBUS_HASH_BITS, SL_EMU_SBUS_KEY(ring, dev_addr, reg), SL_EMU_SBUS_DEV_MASK,
+		op, &data, wr_data, U32_MAX);
+	if (rtn)
+		return rtn;
+
+	if ((op == SL_SBUS_OP_RD) && rd_data)
+		*rd_data = data;
+
+	return 0;
+}
+
+int sl_emu_io_pmi_op(void *pmi_accessor, u8 lgrp_num, u8 op, u32 addr,
+		     u16 *rd_data, u16 wr_data, u16 wr_data_mask)
+{
+	int rtn;
+	u64 data;
+
+	/* PMI op values match the SBUS op values */
+	rtn = sl_emu_io_op(pmi_accessor, ((struct sl_emu_ldev *)pmi_accessor)->pmi,
+		SL_EMU_PMI_HASH_BITS, SL_EMU_PMI_KEY(lgrp_num, addr), SL_EMU_PMI_LGRP_MASK,
+		op, &data, wr_data, wr_data_mask);
+	if (rtn)
+		return rtn;
+
+	if ((op == SL_PMI_OP_RD) && rd_data)
+		*rd_data = data;
+
+	return 0;
+}
+
+int sl_emu_io_mb_info_get(void *mb_accessor, u8 *platform, u16 *revision, u16 *proto)
+{
+	*platform = PLATFORM_NETSIM;
+	*revision = 0;
+	*proto    = 0;
+
+	return 0;
+}
@@ -0,0 +1,251 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/module.h>
+#include <linux/slab.h>
+#include <linux/mm.h>
+#include <linux/err.h>
+
+#include "sl_log.h"
+#include "sl_emu_ldev.h"
+
+#define LOG_BLOCK SL_LOG_BLOCK
+#define LOG_NAME  SL_LOG_EMU_LOG_NAME
+
+#define SL_EMU_LINK_UP_MS         50
+#define SL_EMU_LINK_UP_JITTER_MS  20
+#define SL_EMU_AN_PAGE_MS         5
+#define SL_EMU_FEC_GCW_PER_SEC    1000000000ULL
+
+static struct sl_emu_ldev *emu_ldevs[SL_ASIC_MAX_LDEVS];
+static DEFINE_SPINLOCK(emu_ldevs_lock);
+
+static const struct sl_emu_config sl_emu_config_dflt = {
+	.magic               = SL_EMU_CONFIG_MAGIC,
+	.ver                 = SL_EMU_CONFIG_VER,
+	.size                = sizeof(struct sl_emu_config),
+	.link_up_ms          = SL_EMU_LINK_UP_MS,
+	.link_up_jitter_ms   = SL_EMU_LINK_UP_JITTER_MS,
+	.link_up_fault_pct   = 0,
+	.link_up_timeout_pct = 0,
+	.an_page_ms          = SL_EMU_AN_PAGE_MS,
+	.fec_gcw_per_sec     = SL_EMU_FEC_GCW_PER_SEC,
+	.fec_ccw_per_sec     = 0,
+	.fec_ucw_per_sec     = 0,
+};
+
+static int sl_emu_config_check(struct sl_emu_config *config)
+{
+	if (config->magic != SL_EMU_CONFIG_MAGIC) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "bad config magic");
+		return -EINVAL;
+	}
+	if (config->ver != SL_EMU_CONFIG_VER) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "bad config version");
+		return -EINVAL;
+	}
+	if (config->link_up_fault_pct + config->link_up_timeout_pct > 100) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME,
+			"invalid (link_up_fault_pct = %u, link_up_timeout_pct = %u)",
+			config->link_up_fault_pct, config->link_up_timeout_pct);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static struct sl_emu_ldev *sl_emu_ldev_get(u8 ldev_num)
+{
+	struct sl_emu_ldev *emu_ldev;
+
+	if (ldev_num >= SL_ASIC_MAX_LDEVS)
+		return NULL;
+
+	spin_lock(&emu_ldevs_lock);
+	emu_ldev = emu_ldevs[ldev_num];
+	spin_unlock(&emu_ldevs_lock);
+
+	return emu_ldev;
+}
+
+void sl_emu_ldev_config_get(struct sl_emu_ldev *emu_ldev, struct sl_emu_config *config)
+{
+	unsigned long irq_flags;
+
+	spin_lock_irqsave(&emu_ldev->config_lock, irq_flags);
+	*config = emu_ldev->config;
+	spin_unlock_irqrestore(&emu_ldev->config_lock, irq_flags);
+}
+
+struct sl_ldev *sl_emu_ldev_new(u8 ldev_num, struct sl_emu_config *config)
+{
+	int                 rtn;
+	struct sl_emu_ldev *emu_ldev;
+	struct sl_ldev_attr ldev_attr;
+	struct sl_ldev     *ldev;
+
+	if (ldev_num >= SL_ASIC_MAX_LDEVS) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "invalid (ldev_num = %u)", ldev_num);
+		return ERR_PTR(-EINVAL);
+	}
+	if (config) {
+		rtn = sl_emu_config_check(config);
+		if (rtn)
+			return ERR_PTR(rtn);
+	}
+
+	if (sl_emu_ldev_get(ldev_num)) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "exists (ldev_num = %u)", ldev_num);
+		return ERR_PTR(-EBADRQC);
+	}
+
+	sl_log_dbg(NULL, LOG_BLOCK, LOG_NAME, "new (ldev_num = %u)", ldev_num);
+
+	/* per link works make this too big for kzalloc */
+	emu_ldev = kvzalloc(sizeof(*emu_ldev), GFP_KERNEL);
+	if (!emu_ldev)
+		return ERR_PTR(-ENOMEM);
+
+	emu_ldev->num = ldev_num;
+	spin_lock_init(&emu_ldev->config_lock);
+	emu_ldev->config = config ? *config : sl_emu_config_dflt;
+
+	emu_ldev->workq = alloc_workqueue("sl-emu%u", WQ_UNBOUND, 0, ldev_num);
+	if (!emu_ldev->workq) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "alloc_workqueue failed");
+		rtn = -ENOMEM;
+		goto out_free;
+	}
+
+	rtn = sl_emu_io_init(emu_ldev);
+	if (rtn)
+		goto out_workq;
+
+	sl_emu_intr_init(emu_ldev);
+
+	emu_ldev->ops.read64              = sl_emu_io_read64;
+	emu_ldev->ops.write64             = sl_emu_io_write64;
+	emu_ldev->ops.reg_ops             = sl_emu_io_reg_ops;
+	emu_ldev->ops.sbus_op             = sl_emu_io_sbus_op;
+	emu_ldev->ops.pmi_op              = sl_emu_io_pmi_op;
+	emu_ldev->ops.pml_intr_register   = sl_emu_intr_register;
+	emu_ldev->ops.pml_intr_unregister = sl_emu_intr_unregister;
+	emu_ldev->ops.pml_intr_enable     = sl_emu_intr_enable;
+	emu_ldev->ops.pml_intr_disable    = sl_emu_intr_disable;
+	emu_ldev->ops.mb_info_get         = sl_emu_io_mb_info_get;
+
+	emu_ldev->accessors.pci  = emu_ldev;
+	emu_ldev->accessors.sbus = emu_ldev;
+	emu_ldev->accessors.pmi  = emu_ldev;
+	emu_ldev->accessors.intr = emu_ldev;
+	emu_ldev->accessors.dt   = emu_ldev;
+	emu_ldev->accessors.mb   = emu_ldev;
+
+	ldev_attr.magic     = SL_LDEV_ATTR_MAGIC;
+	ldev_attr.ver       = SL_LDEV_ATTR_VER;
+	ldev_attr.size      = sizeof(ldev_attr);
+	ldev_attr.ops       = &emu_ldev->ops;
+	ldev_attr.accessors = &emu_ldev->accessors;
+	ldev_attr.options   = SL_LDEV_ATTR_OPT_AN_EMU;
+
+	spin_lock(&emu_ldevs_lock);
+	emu_ldevs[ldev_num] = emu_ldev;
+	spin_unlock(&emu_ldevs_lock);
+
+	ldev = sl_ldev_new(ldev_num, emu_ldev->workq, &ldev_attr);
+	if (IS_ERR(ldev)) {
+		rtn = PTR_ERR(ldev);
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "sl_ldev_new failed [%d]", rtn);
+		goto out_ldevs;
+	}
+	emu_ldev->ldev = ldev;
+
+	return ldev;
+
+out_ldevs:
+	spin_lock(&emu_ldevs_lock);
+	emu_ldevs[ldev_num] = NULL;
+	spin_unlock(&emu_ldevs_lock);
+	sl_emu_intr_exit(emu_ldev);
+	sl_emu_io_exit(emu_ldev);
+out_workq:
+	destroy_workqueue(emu_ldev->workq);
+out_free:
+	kvfree(emu_ldev);
+
+	return ERR_PTR(rtn);
+}
+EXPORT_SYMBOL(sl_emu_ldev_new);
+
+int sl_emu_ldev_del(u8 ldev_num)
+{
+	int                 rtn;
+	struct sl_emu_ldev *emu_ldev;
+
+	emu_ldev = sl_emu_ldev_get(ldev_num);
+	if (!emu_ldev) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "not found (ldev_num = %u)", ldev_num);
+		return -ENOENT;
+	}
+
+	sl_log_dbg(NULL, LOG_BLOCK, LOG_NAME, "del (ldev_num = %u)", ldev_num);
+
+	rtn = sl_ldev_del(emu_ldev->ldev);
+	if (rtn)
+		sl_log_warn(NULL, LOG_BLOCK, LOG_NAME, "sl_ldev_del failed [%d]", rtn);
+
+	spin_lock(&emu_ldevs_lock);
+	emu_ldevs[ldev_num] = NULL;
+	spin_unlock(&emu_ldevs_lock);
+
+	sl_emu_intr_exit(emu_ldev);
+	destroy_workqueue(emu_ldev->workq);
+	sl_emu_io_exit(emu_ldev);
+	kvfree(emu_ldev);
+
+	return 0;
+}
+EXPORT_SYMBOL(sl_emu_ldev_del);
+
+int sl_emu_config_set(u8 ldev_num, struct sl_emu_config *config)
+{
+	int                 rtn;
+	struct sl_emu_ldev *emu_ldev;
+	unsigned long       irq_flags;
+
+	if (!config)
+		return -EINVAL;
+	rtn = sl_emu_config_check(config);
+	if (rtn)
+		return rtn;
+
+	emu_ldev = sl_emu_ldev_get(ldev_num);
+	if (!emu_ldev)
+		return -ENOENT;
+
+	spin_lock_irqsave(&emu_ldev->config_lock, irq_flags);
+	emu_ldev->config = *config;
+	spin_unlock_irqrestore(&emu_ldev->config_lock, irq_flags);
+
+	return 0;
+}
+EXPORT_SYMBOL(sl_emu_config_set);
+
+int sl_emu_config_get(u8 ldev_num, struct sl_emu_config *config)
+{
+	struct sl_emu_ldev *emu_ldev;
+
+	if (!config)
+		return -EINVAL;
+
+	emu_ldev = sl_emu_ldev_get(ldev_num);
+	if (!emu_ldev) {
+		*config = sl_emu_config_dflt;
+		return -ENOENT;
+	}
+
+	sl_emu_ldev_config_get(emu_ldev, config);
+
+	return 0;
+}
+EXPORT_SYMBOL(sl_emu_config_get);
@@ -0,0 +1,144 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#ifndef _SL_EMU_LDEV_H_
+#define _SL_EMU_LDEV_H_
+
+#include <linux/spinlock.h>
+#include <linux/hashtable.h>
+#include <linux/workqueue.h>
+#include <linux/ktime.h>
+
+#include <linux/hpe/sl/sl_ldev.h>
+#include <linux/hpe/sl/sl_emu.h>
+
+#include "sl_asic.h"
+#include "hw/sl_core_hw_intr.h"
+
+#define SL_EMU_REGS_HASH_BITS 10
+#define SL_EMU_SBUS_HASH_BITS 8
+#define SL_EMU_PMI_HASH_BITS  8
+
+enum sl_emu_reg_kind {
+	SL_EMU_REG_KIND_PLAIN = 0,
+	SL_EMU_REG_KIND_ERR_CLR,
+	SL_EMU_REG_KIND_AN_BP,
+	SL_EMU_REG_KIND_AN_NP,
+	SL_EMU_REG_KIND_FEC_GCW,
+	SL_EMU_REG_KIND_FEC_CCW,
+	SL_EMU_REG_KIND_FEC_UCW,
+	SL_EMU_REG_KIND_PCS_RX,
+};
+
+struct sl_emu_reg {
+	struct hlist_node node;
+	u64               addr;
+	u64               data;
+	u8                kind;
+	u8                lgrp_num;
+	u8                link_num;
+	u8                word;
+};
+
+struct sl_emu_intr {
+	struct list_head  list;
+	u64              *err_flgs;
+	sl_intr_handler_t handler;
+	void             *data;
+	int               intr_num;   /* -1 when not a link intr */
+	u8                link_num;
+	bool              is_enabled;
+};
+
+struct sl_emu_ldev;
+struct sl_emu_lgrp;
+
+struct sl_emu_link {
+	u8                  num;
+	struct sl_emu_lgrp *emu_lgrp;
+
+	struct delayed_work link_up_work;
+	struct delayed_work an_work;
+	struct work_struct  intr_work;
+
+	/* intr_lock */
+	unsigned long       intr_raised;
+
+	/* regs_lock */
+	struct {
+		u64  page;
+		bool is_base;
+	} an;
+	struct {
+		bool    is_running;
+		ktime_t start;
+	} fec;
+	struct {
+		bool is_lock_enabled;
+	} pcs;
+};
+
+struct sl_emu_lgrp {
+	u8                  num;
+	struct sl_emu_ldev *emu_ldev;
+
+	struct list_head    intrs;
+	struct sl_emu_link  links[SL_ASIC_MAX_LINKS];
+};
+
+struct sl_emu_ldev {
+	u8                       num;
+	struct sl_ldev          *ldev;
+	struct workqueue_struct *workq;
+
+	struct sl_ops            ops;
+	struct sl_accessors      accessors;
+
+	spinlock_t               config_lock;
+	struct sl_emu_config     config;
+
+	spinlock_t               regs_lock;
+	DECLARE_HASHTABLE(regs, SL_EMU_REGS_HASH_BITS);
+	DECLARE_HASHTABLE(sbus, SL_EMU_SBUS_HASH_BITS);
+	DECLARE_HASHTABLE(pmi,  SL_EMU_PMI_HASH_BITS);
+
+	spinlock_t               intr_lock;
+	struct sl_emu_lgrp       lgrps[SL_ASIC_MAX_LGRPS];
+};
+
+void sl_emu_ldev_config_get(struct sl_emu_ldev *emu_ldev, struct sl_emu_config *config);
+
+int  sl_emu_io_init(struct sl_emu_ldev *emu_ldev);
+void sl_emu_io_exit(struct sl_emu_ldev *emu_ldev);
+
+u64  sl_emu_io_read64(void *pci_accessor, long addr);
+void sl_emu_io_write64(void *pci_accessor, long addr, u64 data);
+int  sl_emu_io_reg_ops(void *pci_accessor, struct sl_reg_op *ops, u32 count);
+int  sl_emu_io_sbus_op(void *sbus_accessor, u8 op, u8 ring, u8 dev_addr, u8 reg,
+		       u32 *rd_data, u32 wr_data);
+int  sl_emu_io_pmi_op(void *pmi_accessor, u8 lgrp_num, u8 op, u32 addr,
+		      u16 *rd_data, u16 wr_data, u16 wr_data_mask);
+int  sl_emu_io_mb_info_get(void *mb_accessor, u8 *platform, u16 *revision, u16 *proto);
+
+void sl_emu_io_pcs_sts_set(struct sl_emu_link *emu_link, bool is_aligned, bool is_faulted);
+void sl_emu_io_fec_start(struct sl_emu_link *emu_link);
+void sl_emu_io_fec_stop(struct sl_emu_link *emu_link);
+
+void sl_emu_intr_init(struct sl_emu_ldev *emu_ldev);
+void sl_emu_intr_exit(struct sl_emu_ldev *emu_ldev);
+
+int  sl_emu_intr_register(void *intr_accessor, u32 lgrp_num, char *tag,
+			  u64 *err_flgs, sl_intr_handler_t handler, void *data);
+int  sl_emu_intr_unregister(void *intr_accessor, u32 lgrp_num,
+			    u64 *err_flgs, sl_intr_handler_t handler);
+int  sl_emu_intr_enable(void *intr_accessor, u32 lgrp_num,
+			u64 *err_flgs, sl_intr_handler_t handler);
+int  sl_emu_intr_disable(void *intr_accessor, u32 lgrp_num,
+			 u64 *err_flgs, sl_intr_handler_t handler);
+
+void sl_emu_intr_clr(struct sl_emu_lgrp *emu_lgrp, u8 word, u64 data);
+void sl_emu_intr_an_page_send(struct sl_emu_link *emu_link);
+void sl_emu_intr_link_up_start(struct sl_emu_link *emu_link);
+void sl_emu_intr_link_down(struct sl_emu_link *emu_link);
+
+#endif /* _SL_EMU_LDEV_H_ */
@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2022,2023,2024 Hewlett Packard Enterprise Development LP */
+/* Copyright 2022,2023,2024,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_LOG_H_
 #define _SL_LOG_H_
@@ -20,6 +20,7 @@
 #define SL_LOG_SYSFS_LOG_NAME    "sysfs"
 #define SL_LOG_DEBUGFS_LOG_NAME  "debugfs"
 #define SL_LOG_TEST_LOG_NAME     "test"
+#define SL_LOG_EMU_LOG_NAME      "emu"
 
 void sl_log(void *ptr, const char *level, const char *block,
 	const char *name, const char *text, ...) __printf(5, 6);
@@ -1,13 +0,0 @@
-/* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2025 Hewlett Packard Enterprise Development LP */
-
-#ifndef _SL_MEDIA_WORK_H_
-#define _SL_MEDIA_WORK_H_
-
-enum {
-	SL_MEDIA_WORK_CABLE_MON_TEMP = 0,
-
-	SL_MEDIA_WORK_COUNT      /* must be last */
-};
-
-#endif /* _SL_MEDIA_WORK_H_ */
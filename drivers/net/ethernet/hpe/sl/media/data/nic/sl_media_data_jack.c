@@ -10,6 +10,7 @@
 #include "sl_media_io.h"
 #include "sl_media_jack.h"
 #include "data/sl_media_data_jack.h"
+#include "data/sl_media_data_jack_shift.h"
 #include "sl_core_link.h"
 
 #define LOG_NAME SL_MEDIA_DATA_JACK_LOG_NAME
@@ -74,7 +75,7 @@ int sl_media_data_jack_cable_downshift(struct sl_media_jack *media_jack)
 		sl_media_log_err_trace(media_jack, LOG_NAME, "data path deinit = 0xFF - write failed [%d]", rtn);
 		return rtn;
 	}
-	msleep(500);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_DEINIT, SL_MEDIA_JACK_SHIFT_LANE_MAP_4);
 
 	/*
 	 * enable low power mode
@@ -85,7 +86,7 @@ int sl_media_data_jack_cable_downshift(struct sl_media_jack *media_jack)
 		sl_media_log_err_trace(media_jack, LOG_NAME, "low power mode - write failed [%d]", rtn);
 		return rtn;
 	}
-	msleep(500);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_LOW_POWER, SL_MEDIA_JACK_SHIFT_LANE_MAP_4);
 
 	/*
 	 * Staged Control Set 0, Data Path Configuration bytes @ page 0x10 bytes 145-148
@@ -101,7 +102,6 @@ int sl_media_data_jack_cable_downshift(struct sl_media_jack *media_jack)
 			return rtn;
 		}
 	}
-	msleep(100);
 
 	/*
 	 * ApplyDPInitLane8-1
@@ -112,7 +112,7 @@ int sl_media_data_jack_cable_downshift(struct sl_media_jack *media_jack)
 		sl_media_log_err_trace(media_jack, LOG_NAME, "apply dpinit = 0xFF - write failed [%d]", rtn);
 		return rtn;
 	}
-	msleep(500);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_APPLY, SL_MEDIA_JACK_SHIFT_LANE_MAP_4);
 
 	/*
 	 * enable high power mode
@@ -123,7 +123,7 @@ int sl_media_data_jack_cable_downshift(struct sl_media_jack *media_jack)
 		sl_media_log_err_trace(media_jack, LOG_NAME, "high power mode - write failed [%d]", rtn);
 		return rtn;
 	}
-	msleep(8000);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_HIGH_POWER, SL_MEDIA_JACK_SHIFT_LANE_MAP_4);
 
 	/*
 	 * (Re)Init all lanes (DataPathDeinit @ page 0x10 byte 128)
@@ -138,7 +138,7 @@ int sl_media_data_jack_cable_downshift(struct sl_media_jack *media_jack)
 	/*
 	 * waiting for firmware reload
 	 */
-	msleep(3000);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_REINIT, SL_MEDIA_JACK_SHIFT_LANE_MAP_4);
 
 	return 0;
 }
@@ -200,7 +200,7 @@ int sl_media_data_jack_cable_upshift(struct sl_media_jack *media_jack)
 		sl_media_log_err_trace(media_jack, LOG_NAME, "data path deinit = 0xFF - write failed [%d]", rtn);
 		return rtn;
 	}
-	msleep(500);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_DEINIT, SL_MEDIA_JACK_SHIFT_LANE_MAP_4);
 
 	/*
 	 * enable low power mode
@@ -211,7 +211,7 @@ int sl_media_data_jack_cable_upshift(struct sl_media_jack *media_jack)
 		sl_media_log_err_trace(media_jack, LOG_NAME, "low power mode - write failed [%d]", rtn);
 		return rtn;
 	}
-	msleep(500);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_LOW_POWER, SL_MEDIA_JACK_SHIFT_LANE_MAP_4);
 
 	/*
 	 * Staged Control Set 0, Data Path Configuration bytes @ page 0x10 bytes 145-148
@@ -227,7 +227,6 @@ int sl_media_data_jack_cable_upshift(struct sl_media_jack *media_jack)
 			return rtn;
 		}
 	}
-	msleep(100);
 
 	/*
 	 * ApplyDPInitLane8-1
@@ -238,7 +237,7 @@ int sl_media_data_jack_cable_upshift(struct sl_media_jack *media_jack)
 		sl_media_log_err_trace(media_jack, LOG_NAME, "apply dpinit = 0xFF - write failed [%d]", rtn);
 		return rtn;
 	}
-	msleep(500);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_APPLY, SL_MEDIA_JACK_SHIFT_LANE_MAP_4);
 
 	/*
 	 * enable high power mode
@@ -249,7 +248,7 @@ int sl_media_data_jack_cable_upshift(struct sl_media_jack *media_jack)
 		sl_media_log_err_trace(media_jack, LOG_NAME, "high power mode - write failed [%d]", rtn);
 		return rtn;
 	}
-	msleep(8000);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_HIGH_POWER, SL_MEDIA_JACK_SHIFT_LANE_MAP_4);
 
 	/*
 	 * (Re)Init all lanes (DataPathDeinit @ page 0x10 byte 128)
@@ -264,7 +263,7 @@ int sl_media_data_jack_cable_upshift(struct sl_media_jack *media_jack)
 	/*
 	 * waiting for firmware reload
 	 */
-	msleep(3000);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_REINIT, SL_MEDIA_JACK_SHIFT_LANE_MAP_4);
 
 	return 0;
 }
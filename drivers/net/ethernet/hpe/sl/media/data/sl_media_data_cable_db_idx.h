@@ -0,0 +1,190 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+/* This file is auto-generated through script and should not be modified */
+
+#ifndef _SL_MEDIA_DATA_CABLE_DB_IDX_H_
+#define _SL_MEDIA_DATA_CABLE_DB_IDX_H_
+
+#define SL_MEDIA_DATA_CABLE_DB_IDX_BITS    10
+#define SL_MEDIA_DATA_CABLE_DB_IDX_MULT    0x61C88647
+#define SL_MEDIA_DATA_CABLE_DB_IDX_NUM_ROWS 327
+
+/* rows of bucket b are cable_db_idx_rows[cable_db_idx_buckets[b]] up to cable_db_idx_buckets[b + 1] */
+static const u16 cable_db_idx_buckets[(1 << SL_MEDIA_DATA_CABLE_DB_IDX_BITS) + 1] = {
+	    0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     0,     0,     0,     0,     0,     0,
+	    0,     0,     3,     3,     3,     3,     3,     3,
+	    3,     3,     3,     3,     5,     5,     5,     5,
+	    5,     5,     5,     5,     5,     5,     5,     5,
+	    5,     5,    10,    10,    10,    10,    10,    10,
+	   10,    10,    10,    10,    10,    13,    13,    13,
+	   13,    13,    13,    13,    13,    13,    19,    19,
+	   19,    19,    19,    21,    21,    21,    21,    21,
+	   21,    21,    21,    21,    21,    27,    27,    27,
+	   27,    27,    27,    27,    27,    27,    27,    27,
+	   30,    30,    32,    32,    32,    32,    32,    32,
+	   32,    32,    32,    32,    32,    32,    32,    32,
+	   32,    32,    32,    32,    32,    32,    32,    35,
+	   37,    37,    37,    37,    37,    37,    37,    37,
+	   37,    37,    37,    40,    40,    40,    40,    41,
+	   41,    41,    41,    41,    44,    44,    44,    44,
+	   44,    46,    46,    46,    46,    46,    46,    46,
+	   46,    46,    46,    48,    48,    48,    48,    48,
+	   48,    48,    53,    53,    53,    56,    56,    58,
+	   60,    60,    60,    60,    60,    60,    60,    60,
+	   60,    60,    60,    60,    60,    60,    60,    60,
+	   60,    60,    60,    60,    60,    62,    62,    64,
+	   64,    64,    64,    64,    64,    64,    64,    64,
+	   67,    67,    67,    67,    67,    67,    67,    67,
+	   67,    67,    67,    67,    67,    67,    69,    69,
+	   69,    70,    70,    73,    73,    73,    73,    73,
+	   75,    75,    75,    75,    75,    75,    75,    75,
+	   75,    75,    75,    78,    78,    78,    78,    78,
+	   78,    78,    78,    78,    78,    78,    78,    78,
+	   80,    82,    82,    82,    82,    82,    82,    82,
+	   82,    82,    82,    85,    85,    85,    85,    85,
+	   85,    85,    85,    85,    85,    85,    88,    88,
+	   88,    88,    92,    92,    92,    93,    93,    93,
+	   93,    93,    93,    93,    95,    95,    95,    95,
+	   95,    95,    95,    95,    95,    95,   101,   101,
+	  101,   101,   101,   101,   101,   101,   101,   101,
+	  101,   101,   101,   101,   101,   101,   101,   104,
+	  105,   105,   105,   105,   105,   107,   107,   109,
+	  109,   109,   109,   109,   109,   109,   109,   111,
+	  111,   115,   115,   115,   115,   115,   115,   115,
+	  116,   116,   116,   116,   118,   118,   118,   118,
+	  118,   118,   118,   118,   118,   118,   118,   118,
+	  118,   120,   120,   120,   120,   120,   120,   120,
+	  120,   120,   120,   124,   124,   124,   124,   124,
+	  124,   124,   124,   125,   125,   125,   125,   125,
+	  125,   125,   128,   128,   128,   128,   128,   128,
+	  128,   128,   130,   130,   132,   132,   132,   132,
+	  132,   132,   132,   132,   132,   132,   134,   134,
+	  134,   134,   134,   136,   136,   136,   136,   136,
+	  136,   138,   138,   138,   138,   141,   141,   141,
+	  141,   141,   141,   143,   143,   143,   143,   149,
+	  149,   149,   149,   149,   149,   149,   149,   149,
+	  149,   151,   151,   151,   151,   151,   151,   151,
+	  151,   151,   151,   151,   151,   151,   151,   151,
+	  154,   154,   154,   154,   154,   154,   154,   154,
+	  154,   154,   158,   159,   159,   162,   162,   162,
+	  162,   162,   162,   164,   166,   166,   166,   166,
+	  166,   166,   166,   166,   166,   166,   166,   166,
+	  166,   166,   166,   168,   168,   168,   168,   168,
+	  168,   170,   170,   170,   170,   172,   172,   172,
+	  172,   172,   172,   172,   172,   172,   172,   174,
+	  174,   174,   174,   174,   174,   174,   174,   174,
+	  174,   174,   174,   174,   174,   176,   176,   176,
+	  179,   179,   179,   179,   179,   179,   179,   179,
+	  179,   179,   179,   179,   179,   179,   179,   181,
+	  183,   185,   185,   185,   185,   185,   185,   185,
+	  185,   185,   185,   185,   185,   185,   185,   185,
+	  187,   192,   192,   195,   195,   195,   195,   197,
+	  197,   197,   197,   197,   197,   197,   197,   197,
+	  197,   197,   197,   197,   201,   201,   201,   201,
+	  201,   201,   201,   201,   201,   201,   203,   203,
+	  203,   203,   203,   203,   203,   203,   203,   203,
+	  203,   203,   203,   203,   203,   203,   203,   203,
+	  203,   203,   203,   203,   203,   203,   203,   205,
+	  205,   205,   208,   208,   208,   208,   208,   208,
+	  208,   208,   208,   208,   208,   208,   208,   208,
+	  208,   210,   210,   210,   212,   212,   212,   212,
+	  212,   212,   212,   212,   212,   212,   212,   212,
+	  212,   212,   214,   214,   214,   214,   214,   214,
+	  214,   214,   214,   214,   214,   214,   214,   217,
+	  217,   217,   217,   217,   217,   219,   219,   219,
+	  219,   219,   219,   219,   219,   219,   219,   219,
+	  219,   219,   219,   219,   219,   221,   221,   221,
+	  221,   221,   221,   221,   221,   223,   223,   223,
+	  223,   223,   223,   223,   223,   223,   223,   226,
+	  226,   226,   229,   229,   229,   229,   229,   232,
+	  232,   232,   232,   232,   234,   234,   234,   238,
+	  238,   238,   238,   238,   238,   240,   240,   240,
+	  240,   240,   240,   240,   240,   240,   240,   240,
+	  240,   240,   240,   242,   242,   242,   242,   242,
+	  242,   242,   242,   242,   242,   242,   242,   242,
+	  242,   242,   246,   246,   246,   246,   246,   246,
+	  246,   246,   246,   246,   246,   246,   246,   246,
+	  246,   246,   246,   246,   246,   246,   246,   246,
+	  246,   246,   246,   246,   246,   246,   246,   246,
+	  246,   246,   248,   248,   248,   252,   252,   252,
+	  252,   252,   252,   252,   252,   252,   252,   252,
+	  252,   252,   254,   254,   254,   254,   257,   258,
+	  258,   260,   260,   260,   260,   260,   260,   260,
+	  260,   260,   260,   260,   260,   260,   260,   260,
+	  262,   262,   262,   262,   262,   262,   262,   264,
+	  264,   264,   264,   264,   264,   264,   264,   267,
+	  267,   267,   267,   267,   267,   270,   270,   270,
+	  270,   270,   270,   270,   270,   270,   270,   270,
+	  270,   270,   271,   273,   276,   276,   276,   276,
+	  276,   276,   278,   278,   278,   278,   278,   278,
+	  278,   282,   282,   282,   282,   282,   282,   282,
+	  282,   282,   282,   282,   282,   282,   282,   282,
+	  284,   284,   284,   284,   284,   284,   286,   286,
+	  286,   286,   286,   286,   286,   286,   286,   286,
+	  286,   286,   286,   286,   289,   289,   292,   292,
+	  292,   292,   292,   292,   292,   292,   292,   292,
+	  292,   292,   292,   292,   292,   292,   292,   292,
+	  294,   294,   294,   296,   296,   296,   296,   298,
+	  298,   298,   298,   298,   298,   298,   298,   301,
+	  301,   301,   301,   301,   301,   301,   301,   301,
+	  306,   306,   306,   306,   306,   306,   311,   311,
+	  311,   311,   311,   311,   311,   311,   315,   315,
+	  315,   315,   315,   315,   315,   315,   315,   315,
+	  315,   315,   318,   318,   318,   320,   320,   320,
+	  320,   320,   320,   320,   320,   320,   320,   320,
+	  320,   320,   320,   320,   320,   320,   320,   320,
+	  320,   320,   320,   320,   320,   320,   320,   320,
+	  320,   320,   320,   320,   320,   323,   323,   323,
+	  323,   323,   323,   323,   323,   323,   323,   323,
+	  323,   323,   323,   325,   325,   325,   325,   325,
+	  325,   327,   327,   327,   327,   327,   327,   327,
+	  327,
+};
+
+static const u16 cable_db_idx_rows[SL_MEDIA_DATA_CABLE_DB_IDX_NUM_ROWS] = {
+	  293,   294,   295,    14,    15,    83,    84,    85,
+	  320,   321,   290,   291,   292,    11,    12,    13,
+	  253,   254,   255,   195,   196,    80,    81,    82,
+	  317,   318,   319,   287,   288,   289,   220,   221,
+	  314,   315,   316,    78,    79,   284,   285,   286,
+	  325,     8,     9,    10,   171,   172,    76,    77,
+	  232,   233,   238,   239,   240,   281,   282,   283,
+	    0,     1,   185,   186,    74,    75,   210,   211,
+	  278,   279,   280,   312,   313,   207,   262,   263,
+	  264,    72,    73,   275,   276,   277,   226,   227,
+	  310,   311,     2,    70,    71,   272,   273,   274,
+	  119,   120,   121,   122,   154,   308,   309,    66,
+	   67,    68,    69,   177,   178,   247,   248,   249,
+	  153,   191,   192,   306,   307,   203,   204,    62,
+	   63,    64,    65,     4,   216,   217,   304,   305,
+	   58,    59,    60,    61,     3,   116,   117,   118,
+	  167,   168,   302,   303,    56,    57,   228,   229,
+	  181,   182,   113,   114,   115,   201,   202,   134,
+	  135,   136,   137,   300,   301,    54,    55,   110,
+	  111,   112,   132,   133,   298,   299,   205,   256,
+	  257,   258,   197,   198,    52,    53,   108,   109,
+	  222,   223,   296,   297,    50,    51,   106,   107,
+	  150,   151,   152,     6,     7,   173,   174,    48,
+	   49,   104,   105,   234,   235,   241,   242,   243,
+	  147,   148,   149,   187,   188,    44,    45,    46,
+	   47,   212,   213,    42,    43,   265,   266,   267,
+	  270,   271,   163,   164,    40,    41,   322,   323,
+	  324,   158,   159,    38,    39,   179,   180,   155,
+	  156,   157,   141,   142,   143,   250,   251,   252,
+	  193,   194,    34,    35,    36,    37,   268,   269,
+	  218,   219,    30,    31,    32,    33,   169,   170,
+	   26,    27,    28,    29,   230,   231,   144,   145,
+	  146,     5,   183,   184,    24,    25,   208,   209,
+	  101,   102,   103,   138,   139,   140,   206,    22,
+	   23,   259,   260,   261,   199,   200,    98,    99,
+	  100,   326,   224,   225,    20,    21,    95,    96,
+	   97,   160,   161,   162,    18,    19,   130,   131,
+	  175,   176,    92,    93,    94,   236,   237,   244,
+	  245,   246,   123,   124,   125,   189,   190,   126,
+	  127,   128,   129,    89,    90,    91,   214,   215,
+	   86,    87,    88,   165,   166,    16,    17,
+};
+
+#endif /* _SL_MEDIA_DATA_CABLE_DB_IDX_H_ */
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/slab.h>
 #include <linux/kernel.h>
@@ -9,6 +9,7 @@
 #include "sl_asic.h"
 #include "sl_media_jack.h"
 #include "data/sl_media_data_cable_db.h"
+#include "data/sl_media_data_cable_db_idx.h"
 #include "data/sl_media_data_cable_db_ops.h"
 #include "base/sl_media_log.h"
 
@@ -16,9 +17,66 @@
 
 #define SL_MEDIA_TYPE_SERDES 1
 
+static u32 sl_media_data_cable_db_idx_bucket(u32 hpe_pn)
+{
+	BUILD_BUG_ON(ARRAY_SIZE(cable_db) != SL_MEDIA_DATA_CABLE_DB_IDX_NUM_ROWS);
+
+	return (u32)(hpe_pn * SL_MEDIA_DATA_CABLE_DB_IDX_MULT) >> (32 - SL_MEDIA_DATA_CABLE_DB_IDX_BITS);
+}
+
+/*
+ * Rows within a bucket are in cable_db order, so the first match is the
+ * same row a linear search of cable_db would find.
+ */
+int sl_media_data_cable_db_ops_find(u32 hpe_pn, u32 vendor, u32 type,
+				    const struct sl_media_cable_attr **cable_attr)
+{
+	u32 bucket;
+	u16 x;
+	u16 row;
+
+	bucket = sl_media_data_cable_db_idx_bucket(hpe_pn);
+
+	for (x = cable_db_idx_buckets[bucket]; x < cable_db_idx_buckets[bucket + 1]; ++x) {
+		row = cable_db_idx_rows[x];
+		if (cable_db[row].hpe_pn == hpe_pn &&
+		    cable_db[row].vendor == vendor &&
+		    cable_db[row].type   == type) {
+			if (cable_attr)
+				*cable_attr = &cable_db[row];
+			return row;
+		}
+	}
+
+	return -ENOENT;
+}
+
+int sl_media_data_cable_db_ops_pn_str_find(u32 hpe_pn, const char *vendor_pn_str,
+					   const struct sl_media_cable_attr **cable_attr)
+{
+	u32 bucket;
+	u16 x;
+	u16 row;
+
+	bucket = sl_media_data_cable_db_idx_bucket(hpe_pn);
+
+	for (x = cable_db_idx_buckets[bucket]; x < cable_db_idx_buckets[bucket + 1]; ++x) {
+		row = cable_db_idx_rows[x];
+		if (cable_db[row].hpe_pn == hpe_pn &&
+		    !strncmp(cable_db[row].vendor_pn_str, vendor_pn_str, SL_MEDIA_VENDOR_PN_SIZE)) {
+			if (cable_attr)
+				*cable_attr = &cable_db[row];
+			return row;
+		}
+	}
+
+	return -ENOENT;
+}
+
 int sl_media_data_cable_db_ops_cable_validate(struct sl_media_attr *media_attr, struct sl_media_jack *media_jack)
 {
-	int indexer;
+	int                               row;
+	const struct sl_media_cable_attr *cable_attr;
 
 	sl_media_log_dbg(NULL, LOG_NAME, "cable validate");
 
@@ -39,22 +97,16 @@ int sl_media_data_cable_db_ops_cable_validate(struct sl_media_attr *media_attr,
 		return 0;
 	}
 
-	/*
-	 * Linear search through the cable_db array
-	 */
-	for (indexer = 0; indexer < ARRAY_SIZE(cable_db); ++indexer) {
-		if (cable_db[indexer].hpe_pn == media_attr->hpe_pn &&
-		    cable_db[indexer].vendor == media_attr->vendor &&
-		    cable_db[indexer].type   == media_attr->type) {
-			media_attr->shape                    = cable_db[indexer].shape;
-			media_attr->max_speed                = cable_db[indexer].max_speed;
-			media_jack->is_supported_ss200_cable = cable_db[indexer].is_supported_ss200_cable;
-			media_jack->cable_db_idx             = indexer;
-			return 0;
-		}
-	}
+	row = sl_media_data_cable_db_ops_find(media_attr->hpe_pn, media_attr->vendor, media_attr->type, &cable_attr);
+	if (row < 0)
+		return row;
 
-	return -ENOENT;
+	media_attr->shape                    = cable_attr->shape;
+	media_attr->max_speed                = cable_attr->max_speed;
+	media_jack->is_supported_ss200_cable = cable_attr->is_supported_ss200_cable;
+	media_jack->cable_db_idx             = row;
+
+	return 0;
 }
 
 int sl_media_data_cable_db_ops_serdes_settings_get(struct sl_media_jack *media_jack, u32 media_type, u32 flags)
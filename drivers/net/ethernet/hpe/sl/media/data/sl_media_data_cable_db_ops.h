@@ -1,12 +1,17 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_MEDIA_DATA_CABLE_DB_OPS_H_
 #define _SL_MEDIA_DATA_CABLE_DB_OPS_H_
 
 struct sl_media_attr;
 struct sl_media_jack;
+struct sl_media_cable_attr;
 
+int sl_media_data_cable_db_ops_find(u32 hpe_pn, u32 vendor, u32 type,
+				    const struct sl_media_cable_attr **cable_attr);
+int sl_media_data_cable_db_ops_pn_str_find(u32 hpe_pn, const char *vendor_pn_str,
+					   const struct sl_media_cable_attr **cable_attr);
 int sl_media_data_cable_db_ops_cable_validate(struct sl_media_attr *media_attr, struct sl_media_jack *media_jack);
 int sl_media_data_cable_db_ops_serdes_settings_get(struct sl_media_jack *media_jack, u32 media_type, u32 flags);
 
@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/types.h>
+#include <linux/delay.h>
+#include <linux/jiffies.h>
+#include <linux/ktime.h>
+
+#include "base/sl_media_log.h"
+#include "sl_media_ldev.h"
+#include "sl_media_jack.h"
+#include "sl_media_io.h"
+#include "data/sl_media_data_ldev.h"
+#include "data/sl_media_data_jack_shift.h"
+
+#define LOG_NAME SL_MEDIA_DATA_JACK_LOG_NAME
+
+/* CMIS module state @ page 0x00 byte 3 bits 3-1 */
+#define CMIS_MODULE_STATE_PAGE         0x00
+#define CMIS_MODULE_STATE_OFFSET       3
+#define CMIS_MODULE_STATE_GET(_byte)   (((_byte) >> 1) & 0x7)
+#define CMIS_MODULE_STATE_LOW_PWR      0x1
+#define CMIS_MODULE_STATE_READY        0x3
+
+/* CMIS lane states @ page 0x11, one nibble per lane, lane 1 in the low nibble */
+#define CMIS_LANE_STATE_PAGE           0x11
+#define CMIS_LANE_STATE_SIZE           4
+#define CMIS_DATA_PATH_STATE_OFFSET    128
+#define CMIS_DATA_PATH_DEACTIVATED     0x1
+#define CMIS_DATA_PATH_ACTIVATED       0x4
+#define CMIS_CONFIG_STATUS_OFFSET      202
+#define CMIS_CONFIG_STATUS_ACCEPTED    0x1
+
+/* the fixed sleeps each step used to take */
+static const u32 sl_media_jack_shift_step_budget_ms[SL_MEDIA_JACK_SHIFT_STEP_COUNT] = {
+	[SL_MEDIA_JACK_SHIFT_STEP_DEINIT]     = 500,
+	[SL_MEDIA_JACK_SHIFT_STEP_LOW_POWER]  = 500,
+	[SL_MEDIA_JACK_SHIFT_STEP_APPLY]      = 600,
+	[SL_MEDIA_JACK_SHIFT_STEP_HIGH_POWER] = 8000,
+	[SL_MEDIA_JACK_SHIFT_STEP_REINIT]     = 3000,
+};
+
+const char *sl_media_jack_shift_step_str(u32 step)
+{
+	switch (step) {
+	case SL_MEDIA_JACK_SHIFT_STEP_DEINIT:
+		return "deinit";
+	case SL_MEDIA_JACK_SHIFT_STEP_LOW_POWER:
+		return "low_power";
+	case SL_MEDIA_JACK_SHIFT_STEP_APPLY:
+		return "apply";
+	case SL_MEDIA_JACK_SHIFT_STEP_HIGH_POWER:
+		return "high_power";
+	case SL_MEDIA_JACK_SHIFT_STEP_REINIT:
+		return "reinit";
+	default:
+		return "unknown";
+	}
+}
+
+static int sl_media_data_jack_shift_module_state_is(struct sl_media_jack *media_jack, u8 state, bool *is_state)
+{
+	int rtn;
+	u8  data;
+
+	rtn = sl_media_io_read8(media_jack, CMIS_MODULE_STATE_PAGE, CMIS_MODULE_STATE_OFFSET, &data);
+	if (rtn)
+		return rtn;
+
+	*is_state = (CMIS_MODULE_STATE_GET(data) == state);
+
+	return 0;
+}
+
+static int sl_media_data_jack_shift_lanes_are(struct sl_media_jack *media_jack, u8 offset,
+					      u8 lane_map, u8 state, bool *is_state)
+{
+	int rtn;
+	u8  data[CMIS_LANE_STATE_SIZE];
+	u8  lane_num;
+
+	rtn = sl_media_io_read(media_jack, CMIS_LANE_STATE_PAGE, offset, data, sizeof(data));
+	if (rtn)
+		return rtn;
+
+	*is_state = true;
+	for (lane_num = 0; lane_num < 2 * CMIS_LANE_STATE_SIZE; ++lane_num) {
+		if (!(lane_map & BIT(lane_num)))
+			continue;
+		if (((data[lane_num / 2] >> (4 * (lane_num % 2))) & 0xF) != state) {
+			*is_state = false;
+			break;
+		}
+	}
+
+	return 0;
+}
+
+static int sl_media_data_jack_shift_step_is_done(struct sl_media_jack *media_jack, u32 step,
+						 u8 lane_map, bool *is_done)
+{
+	switch (step) {
+	case SL_MEDIA_JACK_SHIFT_STEP_DEINIT:
+		return sl_media_data_jack_shift_lanes_are(media_jack, CMIS_DATA_PATH_STATE_OFFSET,
+			lane_map, CMIS_DATA_PATH_DEACTIVATED, is_done);
+	case SL_MEDIA_JACK_SHIFT_STEP_LOW_POWER:
+		return sl_media_data_jack_shift_module_state_is(media_jack, CMIS_MODULE_STATE_LOW_PWR, is_done);
+	case SL_MEDIA_JACK_SHIFT_STEP_APPLY:
+		return sl_media_data_jack_shift_lanes_are(media_jack, CMIS_CONFIG_STATUS_OFFSET,
+			lane_map, CMIS_CONFIG_STATUS_ACCEPTED, is_done);
+	case SL_MEDIA_JACK_SHIFT_STEP_HIGH_POWER:
+		return sl_media_data_jack_shift_module_state_is(media_jack, CMIS_MODULE_STATE_READY, is_done);
+	case SL_MEDIA_JACK_SHIFT_STEP_REINIT:
+		return sl_media_data_jack_shift_lanes_are(media_jack, CMIS_DATA_PATH_STATE_OFFSET,
+			lane_map, CMIS_DATA_PATH_ACTIVATED, is_done);
+	default:
+		*is_done = true;
+		return 0;
+	}
+}
+
+/*
+ * Read failures count as not done. The module may not answer while it
+ * reloads firmware, so only the budget ends the wait.
+ */
+void sl_media_data_jack_shift_step_wait(struct sl_media_jack *media_jack, u32 step, u8 lane_map)
+{
+	int           rtn;
+	ktime_t       start;
+	unsigned long timeout;
+	bool          is_done;
+	u32           polls;
+	s64           ms;
+
+	if (step >= SL_MEDIA_JACK_SHIFT_STEP_COUNT)
+		return;
+
+	start   = ktime_get();
+	timeout = jiffies + msecs_to_jiffies(sl_media_jack_shift_step_budget_ms[step]);
+	is_done = false;
+	polls   = 0;
+
+	/* config status holds the last result until the module picks up the apply */
+	if (step == SL_MEDIA_JACK_SHIFT_STEP_APPLY)
+		msleep(SL_MEDIA_JACK_SHIFT_POLL_MS);
+
+	for (;;) {
+		polls++;
+		rtn = sl_media_data_jack_shift_step_is_done(media_jack, step, lane_map, &is_done);
+		if (rtn) {
+			sl_media_log_dbg(media_jack, LOG_NAME,
+				"shift step %s read failed [%d]", sl_media_jack_shift_step_str(step), rtn);
+			is_done = false;
+		}
+		if (is_done || time_after(jiffies, timeout))
+			break;
+		msleep(SL_MEDIA_JACK_SHIFT_POLL_MS);
+	}
+
+	ms = ktime_ms_delta(ktime_get(), start);
+
+	sl_media_data_ldev_jack_shift_stats_add(media_jack->media_ldev,
+		media_jack->cable_info[0].media_attr.vendor, step, !is_done, ms);
+
+	if (!is_done) {
+		sl_media_log_warn(media_jack, LOG_NAME,
+			"shift step %s timeout (polls = %u, ms = %lld)",
+			sl_media_jack_shift_step_str(step), polls, ms);
+		return;
+	}
+
+	sl_media_log_dbg(media_jack, LOG_NAME,
+		"shift step %s done (polls = %u, ms = %lld)",
+		sl_media_jack_shift_step_str(step), polls, ms);
+}
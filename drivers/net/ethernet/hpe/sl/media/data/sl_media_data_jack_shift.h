@@ -0,0 +1,27 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#ifndef _SL_MEDIA_DATA_JACK_SHIFT_H_
+#define _SL_MEDIA_DATA_JACK_SHIFT_H_
+
+#include <linux/types.h>
+
+struct sl_media_jack;
+
+/*
+ * Media shift step wait.
+ *
+ * Each downshift/upshift step polls the module's CMIS state until the step
+ * is done or its budget runs out. The budgets are the fixed sleeps the steps
+ * used to take, so a timeout is logged and the shift carries on as before.
+ */
+#define SL_MEDIA_JACK_SHIFT_POLL_MS 20
+
+#define SL_MEDIA_JACK_SHIFT_LANE_MAP_4 0x0F
+#define SL_MEDIA_JACK_SHIFT_LANE_MAP_8 0xFF
+
+const char *sl_media_jack_shift_step_str(u32 step);
+
+void sl_media_data_jack_shift_step_wait(struct sl_media_jack *media_jack, u32 step, u8 lane_map);
+
+#endif /* _SL_MEDIA_DATA_JACK_SHIFT_H_ */
@@ -1,8 +1,9 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/spinlock.h>
 #include <linux/slab.h>
+#include <linux/string.h>
 
 #include <linux/hpe/sl/sl_media.h>
 
@@ -40,6 +41,8 @@ int sl_media_data_ldev_new(u8 ldev_num, struct workqueue_struct *workqueue)
 	media_ldev->num       = ldev_num;
 	media_ldev->workqueue = workqueue;
 
+	spin_lock_init(&media_ldev->jack_shift.lock);
+
 	for (jack_num = 0; jack_num < SL_MEDIA_MAX_JACK_NUM; ++jack_num) {
 		rtn = sl_media_data_jack_new(media_ldev, jack_num);
 		if (rtn) {
@@ -112,3 +115,60 @@ struct sl_media_ldev *sl_media_data_ldev_get(u8 ldev_num)
 
 	return media_ldev;
 }
+
+void sl_media_data_ldev_jack_shift_stats_add(struct sl_media_ldev *media_ldev, u32 vendor, u32 step,
+					     bool is_timeout, s64 ms)
+{
+	struct sl_media_jack_shift_stats *stats;
+
+	if (step >= SL_MEDIA_JACK_SHIFT_STEP_COUNT)
+		return;
+	if ((vendor == 0) || (vendor >= SL_MEDIA_JACK_SHIFT_VENDORS_NUM))
+		vendor = SL_MEDIA_VENDOR_UNKNOWN;
+	if (ms < 0)
+		ms = 0;
+
+	spin_lock(&media_ldev->jack_shift.lock);
+	stats = &media_ldev->jack_shift.stats[vendor][step];
+	stats->count++;
+	if (is_timeout)
+		stats->timeouts++;
+	stats->ms_last  = ms;
+	stats->ms_max   = max_t(u32, stats->ms_max, ms);
+	stats->ms_sum  += ms;
+	spin_unlock(&media_ldev->jack_shift.lock);
+}
+
+int sl_media_data_ldev_jack_shift_stats_get(u8 ldev_num, u32 vendor, u32 step,
+					    struct sl_media_jack_shift_stats *stats)
+{
+	struct sl_media_ldev *media_ldev;
+
+	if ((vendor >= SL_MEDIA_JACK_SHIFT_VENDORS_NUM) || (step >= SL_MEDIA_JACK_SHIFT_STEP_COUNT))
+		return -EINVAL;
+
+	media_ldev = sl_media_data_ldev_get(ldev_num);
+	if (!media_ldev)
+		return -EBADRQC;
+
+	spin_lock(&media_ldev->jack_shift.lock);
+	*stats = media_ldev->jack_shift.stats[vendor][step];
+	spin_unlock(&media_ldev->jack_shift.lock);
+
+	return 0;
+}
+
+int sl_media_data_ldev_jack_shift_stats_clr(u8 ldev_num)
+{
+	struct sl_media_ldev *media_ldev;
+
+	media_ldev = sl_media_data_ldev_get(ldev_num);
+	if (!media_ldev)
+		return -EBADRQC;
+
+	spin_lock(&media_ldev->jack_shift.lock);
+	memset(media_ldev->jack_shift.stats, 0, sizeof(media_ldev->jack_shift.stats));
+	spin_unlock(&media_ldev->jack_shift.lock);
+
+	return 0;
+}
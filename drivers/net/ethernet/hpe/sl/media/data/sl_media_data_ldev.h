@@ -1,5 +1,5 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_MEDIA_DATA_LDEV_H_
 #define _SL_MEDIA_DATA_LDEV_H_
@@ -7,6 +7,7 @@
 #include <linux/types.h>
 
 struct sl_media_ldev;
+struct sl_media_jack_shift_stats;
 struct sl_uc_ops;
 struct sl_uc_accessor;
 
@@ -17,4 +18,10 @@ struct sl_media_ldev *sl_media_data_ldev_get(u8 ldev_num);
 int sl_media_data_ldev_uc_ops_set(u8 ldev_num, struct sl_uc_ops *uc_ops,
 				  struct sl_uc_accessor *uc_accessor);
 
+void sl_media_data_ldev_jack_shift_stats_add(struct sl_media_ldev *media_ldev, u32 vendor, u32 step,
+					     bool is_timeout, s64 ms);
+int  sl_media_data_ldev_jack_shift_stats_get(u8 ldev_num, u32 vendor, u32 step,
+					     struct sl_media_jack_shift_stats *stats);
+int  sl_media_data_ldev_jack_shift_stats_clr(u8 ldev_num);
+
 #endif /* _SL_MEDIA_DATA_LDEV_H_ */
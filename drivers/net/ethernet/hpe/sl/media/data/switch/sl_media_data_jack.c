@@ -15,6 +15,7 @@
 #include "sl_media_jack.h"
 #include "sl_media_io.h"
 #include "data/sl_media_data_jack.h"
+#include "data/sl_media_data_jack_shift.h"
 #include "data/sl_media_data_ldev.h"
 #include "data/sl_media_data_lgrp.h"
 #include "data/sl_media_data_cable_db_ops.h"
@@ -838,7 +839,7 @@ int sl_media_data_jack_cable_downshift(struct sl_media_jack *media_jack)
 		sl_media_data_jack_headshell_busy_set(media_jack, SL_MEDIA_JACK_HEADSHELL_IDLE);
 		return rtn;
 	}
-	msleep(500);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_DEINIT, SL_MEDIA_JACK_SHIFT_LANE_MAP_8);
 
 	/*
 	 * enable low power mode
@@ -850,7 +851,7 @@ int sl_media_data_jack_cable_downshift(struct sl_media_jack *media_jack)
 		sl_media_data_jack_headshell_busy_set(media_jack, SL_MEDIA_JACK_HEADSHELL_IDLE);
 		return rtn;
 	}
-	msleep(500);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_LOW_POWER, SL_MEDIA_JACK_SHIFT_LANE_MAP_8);
 
 	/*
 	 * Staged Control Set 0, Data Path Configuration bytes @ page 0x10 bytes 145-152
@@ -873,7 +874,6 @@ int sl_media_data_jack_cable_downshift(struct sl_media_jack *media_jack)
 		sl_media_data_jack_headshell_busy_set(media_jack, SL_MEDIA_JACK_HEADSHELL_IDLE);
 		return rtn;
 	}
-	msleep(100);
 
 	/*
 	 * Config lanes 5 to 8
@@ -895,7 +895,6 @@ int sl_media_data_jack_cable_downshift(struct sl_media_jack *media_jack)
 		sl_media_data_jack_headshell_busy_set(media_jack, SL_MEDIA_JACK_HEADSHELL_IDLE);
 		return rtn;
 	}
-	msleep(100);
 
 	/*
 	 * ApplyDPInitLane8-1
@@ -913,7 +912,7 @@ int sl_media_data_jack_cable_downshift(struct sl_media_jack *media_jack)
 		sl_media_data_jack_headshell_busy_set(media_jack, SL_MEDIA_JACK_HEADSHELL_IDLE);
 		return rtn;
 	}
-	msleep(500);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_APPLY, SL_MEDIA_JACK_SHIFT_LANE_MAP_8);
 
 	/*
 	 * enable high power mode
@@ -925,7 +924,7 @@ int sl_media_data_jack_cable_downshift(struct sl_media_jack *media_jack)
 		sl_media_data_jack_headshell_busy_set(media_jack, SL_MEDIA_JACK_HEADSHELL_IDLE);
 		return rtn;
 	}
-	msleep(8000);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_HIGH_POWER, SL_MEDIA_JACK_SHIFT_LANE_MAP_8);
 
 	/*
 	 * (Re)Init all lanes (DataPathDeinit @ page 0x10 byte 128)
@@ -947,7 +946,7 @@ int sl_media_data_jack_cable_downshift(struct sl_media_jack *media_jack)
 	/*
 	 * waiting for firmware reload
 	 */
-	msleep(3000);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_REINIT, SL_MEDIA_JACK_SHIFT_LANE_MAP_8);
 
 	sl_media_data_jack_headshell_busy_set(media_jack, SL_MEDIA_JACK_HEADSHELL_IDLE);
 
@@ -1053,7 +1052,7 @@ int sl_media_data_jack_cable_upshift(struct sl_media_jack *media_jack)
 		sl_media_data_jack_headshell_busy_set(media_jack, SL_MEDIA_JACK_HEADSHELL_IDLE);
 		return rtn;
 	}
-	msleep(500);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_DEINIT, SL_MEDIA_JACK_SHIFT_LANE_MAP_8);
 
 	/*
 	 * enable low power mode
@@ -1065,7 +1064,7 @@ int sl_media_data_jack_cable_upshift(struct sl_media_jack *media_jack)
 		sl_media_data_jack_headshell_busy_set(media_jack, SL_MEDIA_JACK_HEADSHELL_IDLE);
 		return rtn;
 	}
-	msleep(500);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_LOW_POWER, SL_MEDIA_JACK_SHIFT_LANE_MAP_8);
 
 	/*
 	 * Staged Control Set 0, Data Path Configuration bytes @ page 0x10 bytes 145-152
@@ -1088,7 +1087,6 @@ int sl_media_data_jack_cable_upshift(struct sl_media_jack *media_jack)
 		sl_media_data_jack_headshell_busy_set(media_jack, SL_MEDIA_JACK_HEADSHELL_IDLE);
 		return rtn;
 	}
-	msleep(100);
 
 	/*
 	 * Config lanes 5 to 8
@@ -1110,7 +1108,6 @@ int sl_media_data_jack_cable_upshift(struct sl_media_jack *media_jack)
 		sl_media_data_jack_headshell_busy_set(media_jack, SL_MEDIA_JACK_HEADSHELL_IDLE);
 		return rtn;
 	}
-	msleep(100);
 
 	/*
 	 * ApplyDPInitLane8-1
@@ -1128,7 +1125,7 @@ int sl_media_data_jack_cable_upshift(struct sl_media_jack *media_jack)
 		sl_media_data_jack_headshell_busy_set(media_jack, SL_MEDIA_JACK_HEADSHELL_IDLE);
 		return rtn;
 	}
-	msleep(500);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_APPLY, SL_MEDIA_JACK_SHIFT_LANE_MAP_8);
 
 	/*
 	 * enable high power mode
@@ -1140,7 +1137,7 @@ int sl_media_data_jack_cable_upshift(struct sl_media_jack *media_jack)
 		sl_media_data_jack_headshell_busy_set(media_jack, SL_MEDIA_JACK_HEADSHELL_IDLE);
 		return rtn;
 	}
-	msleep(8000);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_HIGH_POWER, SL_MEDIA_JACK_SHIFT_LANE_MAP_8);
 
 	/*
 	 * (Re)Init all lanes (DataPathDeinit @ page 0x10 byte 128)
@@ -1162,7 +1159,7 @@ int sl_media_data_jack_cable_upshift(struct sl_media_jack *media_jack)
 	/*
 	 * waiting for firmware reload
 	 */
-	msleep(3000);
+	sl_media_data_jack_shift_step_wait(media_jack, SL_MEDIA_JACK_SHIFT_STEP_REINIT, SL_MEDIA_JACK_SHIFT_LANE_MAP_8);
 
 	sl_media_data_jack_headshell_busy_set(media_jack, SL_MEDIA_JACK_HEADSHELL_IDLE);
 
@@ -1400,123 +1397,155 @@ static int sl_media_data_jack_cable_hot_link_down(struct sl_media_jack *media_ja
 	return 0;
 }
 
-#define SL_MEDIA_TEMP_MONITOR_TIME_MS 15000
-static void sl_media_data_jack_cable_monitor_temp_delayed_work(struct work_struct *work)
-{
-	int                   rtn;
-	u8                    jack_num;
-	u8                    prev_temp_state;
-	u8                    curr_temp_state;
-	struct sl_media_jack *media_jack;
-	struct sl_media_ldev *media_ldev;
-	struct delayed_work  *delayed_work_ptr;
+#define SL_MEDIA_TEMP_MONITOR_TIME_MS    15000
+#define SL_MEDIA_TEMP_MONITOR_SLOT_MS    (SL_MEDIA_TEMP_MONITOR_TIME_MS / SL_MEDIA_MAX_JACK_NUM)
+#define SL_MEDIA_TEMP_MONITOR_MAX_ACTIVE 8
 
-	delayed_work_ptr  = container_of(work, struct delayed_work, work);
-	media_ldev = container_of(delayed_work_ptr, struct sl_media_ldev,
-				  delayed_work[SL_MEDIA_WORK_CABLE_MON_TEMP]);
+static void sl_media_data_jack_cable_temp_sample_update(struct sl_media_jack *media_jack, ktime_t read_start)
+{
+	ktime_t now;
+	u32     read_latency_us;
 
-	sl_media_log_dbg(media_ldev, LOG_NAME, "cable monitor temp delayed work (ldev = 0x%p)", media_ldev);
+	now             = ktime_get();
+	read_latency_us = ktime_us_delta(now, read_start);
 
-	for (jack_num = 0; jack_num < SL_MEDIA_MAX_JACK_NUM; ++jack_num) {
-		media_jack = sl_media_data_jack_get(media_ldev->num, jack_num);
-		if (!media_jack)
-			continue;
+	spin_lock(&media_jack->data_lock);
+	media_jack->temp_mon.read_latency_us = read_latency_us;
+	if (read_latency_us > media_jack->temp_mon.read_latency_max_us)
+		media_jack->temp_mon.read_latency_max_us = read_latency_us;
+	if (media_jack->temperature_value_c >= 0)
+		media_jack->temp_mon.sample_time = now;
+	spin_unlock(&media_jack->data_lock);
 
-		if (sl_media_data_jack_is_headshell_busy(media_jack))
-			continue;
+	sl_media_log_dbg(media_jack, LOG_NAME, "temp sample update (latency = %uus)", read_latency_us);
+}
 
-		if (!sl_media_lgrp_get(media_jack->cable_info[0].ldev_num, media_jack->cable_info[0].lgrp_num))
-			continue;
+static void sl_media_data_jack_cable_monitor_temp_check(struct sl_media_jack *media_jack)
+{
+	int     rtn;
+	u8      prev_temp_state;
+	u8      curr_temp_state;
+	ktime_t read_start;
 
-		if (!SL_MEDIA_LGRP_MEDIA_TYPE_IS_ACTIVE(media_jack->cable_info[0].media_attr.type)) {
-			sl_media_log_dbg(media_ldev, LOG_NAME, "not active cable (jack_num = %u)", jack_num);
-			continue;
-		}
+	sl_media_log_dbg(media_jack, LOG_NAME, "cable monitor temp check");
 
-		rtn = sl_media_data_jack_cable_temp_state_get(media_jack, &prev_temp_state);
-		if (rtn) {
-			sl_media_log_warn_trace(media_jack, LOG_NAME, "cable_temp_state_get failed [%d]", rtn);
-			continue;
-		}
+	if (sl_media_data_jack_is_headshell_busy(media_jack))
+		return;
 
-		curr_temp_state = sl_media_data_jack_cable_temp_hw_check(media_jack);
+	if (!sl_media_lgrp_get(media_jack->cable_info[0].ldev_num, media_jack->cable_info[0].lgrp_num))
+		return;
 
-		if (curr_temp_state == SL_MEDIA_JACK_TEMP_STATE_COLD) {
-			if (prev_temp_state == SL_MEDIA_JACK_TEMP_STATE_COLD) {
-				sl_media_data_jack_cable_cold_notif_send(media_jack);
-				continue;
-			}
+	if (!SL_MEDIA_LGRP_MEDIA_TYPE_IS_ACTIVE(media_jack->cable_info[0].media_attr.type)) {
+		sl_media_log_dbg(media_jack, LOG_NAME, "not active cable");
+		return;
+	}
 
-			if (!sl_media_jack_is_high_powered(media_jack)) {
-				rtn = sl_media_jack_cable_high_power_set(media_jack->media_ldev->num, media_jack->num);
-				if (rtn) {
-					sl_media_log_err_trace(media_jack, LOG_NAME, "high power set failed [%d]", rtn);
-					sl_media_jack_state_set(media_jack, SL_MEDIA_JACK_CABLE_ERROR);
-
-					spin_lock(&media_jack->data_lock);
-					media_jack->cable_info[0].media_attr.errors |=
-					SL_MEDIA_ERROR_CABLE_HEADSHELL_FAULT;
-					spin_unlock(&media_jack->data_lock);
-
-					rtn = sl_media_jack_cable_attr_set(media_jack, media_jack->media_ldev->num,
-									   &media_jack->cable_info[0].media_attr);
-					if (rtn)
-						sl_media_log_err_trace(media_jack, LOG_NAME,
-								       "cable attr set failed [%d]", rtn);
-				}
-			}
+	rtn = sl_media_data_jack_cable_temp_state_get(media_jack, &prev_temp_state);
+	if (rtn) {
+		sl_media_log_warn_trace(media_jack, LOG_NAME, "cable_temp_state_get failed [%d]", rtn);
+		return;
+	}
 
-			sl_media_log_warn(media_jack, LOG_NAME,
-					  "cable cold alert (temperature = %dc, down_limit = %dc)",
-					  media_jack->temperature_value_c, media_jack->temperature_down_limit_c);
+	read_start      = ktime_get();
+	curr_temp_state = sl_media_data_jack_cable_temp_hw_check(media_jack);
+	sl_media_data_jack_cable_temp_sample_update(media_jack, read_start);
 
-			sl_media_jack_fault_cause_set(media_jack, SL_MEDIA_FAULT_CAUSE_NONE);
+	if (curr_temp_state == SL_MEDIA_JACK_TEMP_STATE_COLD) {
+		if (prev_temp_state == SL_MEDIA_JACK_TEMP_STATE_COLD) {
 			sl_media_data_jack_cable_cold_notif_send(media_jack);
-			sl_media_data_jack_cable_temp_state_set(media_jack, SL_MEDIA_JACK_TEMP_STATE_COLD);
-			continue;
+			return;
 		}
 
-		if (curr_temp_state == SL_MEDIA_JACK_TEMP_STATE_WARM) {
-			if (prev_temp_state == SL_MEDIA_JACK_TEMP_STATE_WARM) {
-				sl_media_data_jack_cable_warm_notif_send(media_jack);
-				continue;
+		if (!sl_media_jack_is_high_powered(media_jack)) {
+			rtn = sl_media_jack_cable_high_power_set(media_jack->media_ldev->num, media_jack->num);
+			if (rtn) {
+				sl_media_log_err_trace(media_jack, LOG_NAME, "high power set failed [%d]", rtn);
+				sl_media_jack_state_set(media_jack, SL_MEDIA_JACK_CABLE_ERROR);
+
+				spin_lock(&media_jack->data_lock);
+				media_jack->cable_info[0].media_attr.errors |=
+				SL_MEDIA_ERROR_CABLE_HEADSHELL_FAULT;
+				spin_unlock(&media_jack->data_lock);
+
+				rtn = sl_media_jack_cable_attr_set(media_jack, media_jack->media_ldev->num,
+								   &media_jack->cable_info[0].media_attr);
+				if (rtn)
+					sl_media_log_err_trace(media_jack, LOG_NAME,
+							       "cable attr set failed [%d]", rtn);
 			}
+		}
 
-			sl_media_log_warn(media_jack, LOG_NAME,
-					  "cable warm alert (temperature = %dc, limit = %dc)",
-					  media_jack->temperature_value_c, media_jack->temperature_warn_limit_c);
+		sl_media_log_warn(media_jack, LOG_NAME,
+				  "cable cold alert (temperature = %dc, down_limit = %dc)",
+				  media_jack->temperature_value_c, media_jack->temperature_down_limit_c);
+
+		sl_media_jack_fault_cause_set(media_jack, SL_MEDIA_FAULT_CAUSE_NONE);
+		sl_media_data_jack_cable_cold_notif_send(media_jack);
+		sl_media_data_jack_cable_temp_state_set(media_jack, SL_MEDIA_JACK_TEMP_STATE_COLD);
+		return;
+	}
 
+	if (curr_temp_state == SL_MEDIA_JACK_TEMP_STATE_WARM) {
+		if (prev_temp_state == SL_MEDIA_JACK_TEMP_STATE_WARM) {
 			sl_media_data_jack_cable_warm_notif_send(media_jack);
-			sl_media_data_jack_cable_temp_state_set(media_jack, SL_MEDIA_JACK_TEMP_STATE_WARM);
-			continue;
+			return;
 		}
 
-		if (curr_temp_state == SL_MEDIA_JACK_TEMP_STATE_HOT) {
-			if (prev_temp_state == SL_MEDIA_JACK_TEMP_STATE_HOT) {
-				sl_media_data_jack_cable_hot_notif_send(media_jack);
-				continue;
-			}
+		sl_media_log_warn(media_jack, LOG_NAME,
+				  "cable warm alert (temperature = %dc, limit = %dc)",
+				  media_jack->temperature_value_c, media_jack->temperature_warn_limit_c);
 
-			sl_media_log_warn(media_jack, LOG_NAME,
-					  "cable hot alert (temperature = %dc, limit = %dc)",
-					  media_jack->temperature_value_c, media_jack->temperature_down_limit_c);
+		sl_media_data_jack_cable_warm_notif_send(media_jack);
+		sl_media_data_jack_cable_temp_state_set(media_jack, SL_MEDIA_JACK_TEMP_STATE_WARM);
+		return;
+	}
 
-			sl_media_jack_fault_cause_set(media_jack, SL_MEDIA_FAULT_CAUSE_HOT);
+	if (curr_temp_state == SL_MEDIA_JACK_TEMP_STATE_HOT) {
+		if (prev_temp_state == SL_MEDIA_JACK_TEMP_STATE_HOT) {
 			sl_media_data_jack_cable_hot_notif_send(media_jack);
-			sl_media_data_jack_cable_temp_state_set(media_jack, SL_MEDIA_JACK_TEMP_STATE_HOT);
-
-			rtn = sl_media_data_jack_cable_hot_link_down(media_jack);
-			if (rtn)
-				sl_media_log_err_trace(media_ldev, LOG_NAME,
-						       "cable monitor hot link_down is failed [%d]", rtn);
-			continue;
+			return;
 		}
 
-		sl_media_data_jack_cable_temp_state_set(media_jack, SL_MEDIA_JACK_TEMP_STATE_UNKNOWN);
+		sl_media_log_warn(media_jack, LOG_NAME,
+				  "cable hot alert (temperature = %dc, limit = %dc)",
+				  media_jack->temperature_value_c, media_jack->temperature_down_limit_c);
+
+		sl_media_jack_fault_cause_set(media_jack, SL_MEDIA_FAULT_CAUSE_HOT);
+		sl_media_data_jack_cable_hot_notif_send(media_jack);
+		sl_media_data_jack_cable_temp_state_set(media_jack, SL_MEDIA_JACK_TEMP_STATE_HOT);
+
+		rtn = sl_media_data_jack_cable_hot_link_down(media_jack);
+		if (rtn)
+			sl_media_log_err_trace(media_jack, LOG_NAME,
+					       "cable monitor hot link_down is failed [%d]", rtn);
+		return;
 	}
 
-	queue_delayed_work(media_ldev->workqueue, &media_ldev->delayed_work[SL_MEDIA_WORK_CABLE_MON_TEMP],
-			   msecs_to_jiffies(SL_MEDIA_TEMP_MONITOR_TIME_MS));
+	sl_media_data_jack_cable_temp_state_set(media_jack, SL_MEDIA_JACK_TEMP_STATE_UNKNOWN);
+}
+
+/*
+ * Each jack has its own work item so a slow or retrying module only delays
+ * its own check. The first checks are staggered across the period to spread
+ * the i2c reads, after which each jack is rechecked one period after its
+ * previous check started.
+ */
+static void sl_media_data_jack_cable_monitor_temp_delayed_work(struct work_struct *work)
+{
+	struct sl_media_jack *media_jack;
+	ktime_t               check_start;
+	s64                   check_ms;
+
+	media_jack = container_of(to_delayed_work(work), struct sl_media_jack, temp_mon.delayed_work);
+
+	sl_media_log_dbg(media_jack, LOG_NAME, "cable monitor temp delayed work");
+
+	check_start = ktime_get();
+	sl_media_data_jack_cable_monitor_temp_check(media_jack);
+	check_ms = min_t(s64, ktime_ms_delta(ktime_get(), check_start), SL_MEDIA_TEMP_MONITOR_TIME_MS);
+
+	queue_delayed_work(media_jack->media_ldev->temp_mon_workqueue, &media_jack->temp_mon.delayed_work,
+			   msecs_to_jiffies(SL_MEDIA_TEMP_MONITOR_TIME_MS - check_ms));
 }
 
 bool sl_media_data_jack_cable_is_hot_client_ready(struct sl_media_jack *media_jack,
@@ -1831,14 +1860,44 @@ void sl_media_data_jack_cable_cold_notif_sent_set(struct sl_media_jack *media_ja
 
 void sl_media_data_jack_cable_temp_monitor_start(struct sl_media_ldev *media_ldev)
 {
-	INIT_DELAYED_WORK(&media_ldev->delayed_work[SL_MEDIA_WORK_CABLE_MON_TEMP],
-			  sl_media_data_jack_cable_monitor_temp_delayed_work);
+	u8                    jack_num;
+	struct sl_media_jack *media_jack;
+
+	media_ldev->temp_mon_workqueue = alloc_workqueue("%s%u-temp", WQ_UNBOUND,
+							 SL_MEDIA_TEMP_MONITOR_MAX_ACTIVE, "sl-media", media_ldev->num);
+	if (!media_ldev->temp_mon_workqueue) {
+		sl_media_log_warn(media_ldev, LOG_NAME, "alloc_workqueue temp monitor failed, using ldev workqueue");
+		media_ldev->temp_mon_workqueue = media_ldev->workqueue;
+	}
+
+	for (jack_num = 0; jack_num < SL_MEDIA_MAX_JACK_NUM; ++jack_num) {
+		media_jack = sl_media_data_jack_get(media_ldev->num, jack_num);
+		if (!media_jack)
+			continue;
+
+		INIT_DELAYED_WORK(&media_jack->temp_mon.delayed_work,
+				  sl_media_data_jack_cable_monitor_temp_delayed_work);
 
-	queue_delayed_work(media_ldev->workqueue, &media_ldev->delayed_work[SL_MEDIA_WORK_CABLE_MON_TEMP],
-			   msecs_to_jiffies(SL_MEDIA_TEMP_MONITOR_TIME_MS));
+		queue_delayed_work(media_ldev->temp_mon_workqueue, &media_jack->temp_mon.delayed_work,
+				   msecs_to_jiffies(SL_MEDIA_TEMP_MONITOR_TIME_MS +
+						    jack_num * SL_MEDIA_TEMP_MONITOR_SLOT_MS));
+	}
 }
 
 void sl_media_data_jack_cable_temp_monitor_stop(struct sl_media_ldev *media_ldev)
 {
-	cancel_delayed_work_sync(&media_ldev->delayed_work[SL_MEDIA_WORK_CABLE_MON_TEMP]);
+	u8                    jack_num;
+	struct sl_media_jack *media_jack;
+
+	for (jack_num = 0; jack_num < SL_MEDIA_MAX_JACK_NUM; ++jack_num) {
+		media_jack = sl_media_data_jack_get(media_ldev->num, jack_num);
+		if (!media_jack)
+			continue;
+
+		cancel_delayed_work_sync(&media_jack->temp_mon.delayed_work);
+	}
+
+	if (media_ldev->temp_mon_workqueue != media_ldev->workqueue)
+		destroy_workqueue(media_ldev->temp_mon_workqueue);
+	media_ldev->temp_mon_workqueue = NULL;
 }
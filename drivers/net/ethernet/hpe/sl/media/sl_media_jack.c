@@ -972,6 +972,32 @@ int sl_media_jack_signal_cache_time_s_get(u8 ldev_num, u8 lgrp_num, time64_t *ca
 	return cached ? 0 : -ENOENT;
 }
 
+int sl_media_jack_cable_temp_sample_get(u8 ldev_num, u8 lgrp_num, s64 *age_ms,
+					u32 *read_latency_us, u32 *read_latency_max_us)
+{
+	ktime_t               sample_time;
+	struct sl_media_jack *media_jack;
+
+	media_jack = sl_media_lgrp_get(ldev_num, lgrp_num)->media_jack;
+
+	spin_lock(&media_jack->data_lock);
+	sample_time          = media_jack->temp_mon.sample_time;
+	*read_latency_us     = media_jack->temp_mon.read_latency_us;
+	*read_latency_max_us = media_jack->temp_mon.read_latency_max_us;
+	spin_unlock(&media_jack->data_lock);
+
+	if (!sample_time)
+		return -ENOENT;
+
+	*age_ms = ktime_ms_delta(ktime_get(), sample_time);
+
+	sl_media_log_dbg(media_jack, LOG_NAME,
+			 "cable temp sample get (age = %lldms, latency = %uus, latency_max = %uus)",
+			 *age_ms, *read_latency_us, *read_latency_max_us);
+
+	return 0;
+}
+
 int sl_media_jack_attr_error_map_str(unsigned long error_map, char *error_str, unsigned int error_str_size)
 {
 	int rtn;
@@ -8,6 +8,8 @@
 #include <linux/spinlock.h>
 #include <linux/time64.h>
 #include <linux/atomic.h>
+#include <linux/ktime.h>
+#include <linux/workqueue.h>
 
 #include <linux/hpe/sl/sl_media.h>
 
@@ -221,6 +223,13 @@ struct sl_media_jack {
 	int                             temperature_warn_limit_c;
 	int                             temperature_down_limit_c;
 
+	struct {
+		struct delayed_work delayed_work;
+		ktime_t             sample_time;        /* last successful read */
+		u32                 read_latency_us;    /* last read            */
+		u32                 read_latency_max_us;
+	} temp_mon;
+
 	struct sl_ctrl_media_counter   *cause_counters;
 };
 
@@ -308,6 +317,8 @@ void sl_media_jack_fake_cable_remove(u8 ldev_num, u8 lgrp_num);
 
 int sl_media_jack_signal_get(u8 ldev_num, u8 lgrp_num, u8 serdes_lane_map, struct sl_media_jack_signal *media_signal);
 int sl_media_jack_signal_cache_time_s_get(u8 ldev_num, u8 lgrp_num, time64_t *cache_time);
+int sl_media_jack_cable_temp_sample_get(u8 ldev_num, u8 lgrp_num, s64 *age_ms,
+					u32 *read_latency_us, u32 *read_latency_max_us);
 int sl_media_jack_signal_cache_get(u8 ldev_num, u8 lgrp_num, u8 serdes_lane_map,
 				   struct sl_media_jack_signal *media_signal);
 
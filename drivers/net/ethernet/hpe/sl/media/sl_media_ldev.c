@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2024 Hewlett Packard Enterprise Development LP */
+/* Copyright 2024,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 
@@ -20,3 +20,14 @@ struct sl_media_ldev *sl_media_ldev_get(u8 ldev_num)
 {
 	return sl_media_data_ldev_get(ldev_num);
 }
+
+int sl_media_ldev_jack_shift_stats_get(u8 ldev_num, u32 vendor, u32 step,
+				       struct sl_media_jack_shift_stats *stats)
+{
+	return sl_media_data_ldev_jack_shift_stats_get(ldev_num, vendor, step, stats);
+}
+
+int sl_media_ldev_jack_shift_stats_clr(u8 ldev_num)
+{
+	return sl_media_data_ldev_jack_shift_stats_clr(ldev_num);
+}
@@ -1,26 +1,51 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_MEDIA_LDEV_H_
 #define _SL_MEDIA_LDEV_H_
 
 #include <linux/types.h>
+#include <linux/spinlock.h>
 #include <linux/workqueue.h>
 
-#include "base/sl_media_work.h"
+#include <linux/hpe/sl/sl_media.h>
 
 #define SL_MEDIA_LDEV_MAGIC 0x736c4D44
 
 struct sl_uc_ops;
 struct sl_uc_accessor;
 
+enum sl_media_jack_shift_step {
+	SL_MEDIA_JACK_SHIFT_STEP_DEINIT = 0,
+	SL_MEDIA_JACK_SHIFT_STEP_LOW_POWER,
+	SL_MEDIA_JACK_SHIFT_STEP_APPLY,
+	SL_MEDIA_JACK_SHIFT_STEP_HIGH_POWER,
+	SL_MEDIA_JACK_SHIFT_STEP_REINIT,
+	SL_MEDIA_JACK_SHIFT_STEP_COUNT,
+};
+
+#define SL_MEDIA_JACK_SHIFT_VENDORS_NUM (SL_MEDIA_VENDOR_UNKNOWN + 1)
+
+struct sl_media_jack_shift_stats {
+	u32 count;
+	u32 timeouts;
+	u32 ms_last;
+	u32 ms_max;
+	u64 ms_sum;
+};
+
 struct sl_media_ldev {
 	u32                      magic;
 	u8                       num;
-	struct delayed_work      delayed_work[SL_MEDIA_WORK_COUNT];
 	struct sl_uc_ops        *uc_ops;
 	struct sl_uc_accessor   *uc_accessor;
 	struct workqueue_struct *workqueue;
+	struct workqueue_struct *temp_mon_workqueue;
+
+	struct {
+		spinlock_t                       lock;
+		struct sl_media_jack_shift_stats stats[SL_MEDIA_JACK_SHIFT_VENDORS_NUM][SL_MEDIA_JACK_SHIFT_STEP_COUNT];
+	} jack_shift;
 };
 
 int                   sl_media_ldev_new(u8 ldev_num, struct workqueue_struct *workqueue);
@@ -30,4 +55,8 @@ struct sl_media_ldev *sl_media_ldev_get(u8 ldev_num);
 int sl_media_ldev_uc_ops_set(u8 ldev_num, struct sl_uc_ops *uc_ops,
 			     struct sl_uc_accessor *uc_accessor);
 
+int sl_media_ldev_jack_shift_stats_get(u8 ldev_num, u32 vendor, u32 step,
+				       struct sl_media_jack_shift_stats *stats);
+int sl_media_ldev_jack_shift_stats_clr(u8 ldev_num);
+
 #endif /* _SL_MEDIA_LDEV_H_ */
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/types.h>
+#include <linux/string.h>
+
+#include <linux/hpe/sl/sl_media.h>
+
+#include "sl_media_jack.h"
+#include "base/sl_media_log.h"
+#include "data/sl_media_data_cable_db.h"
+#include "data/sl_media_data_cable_db_ops.h"
+
+#include "sl_media_test_cable_db.h"
+
+#define LOG_NAME SL_MEDIA_CABLE_LOG_NAME
+
+static int sl_media_test_cable_db_linear_find(u32 hpe_pn, u32 vendor, u32 type)
+{
+	int row;
+
+	for (row = 0; row < ARRAY_SIZE(cable_db); ++row) {
+		if (cable_db[row].hpe_pn == hpe_pn &&
+		    cable_db[row].vendor == vendor &&
+		    cable_db[row].type   == type)
+			return row;
+	}
+
+	return -ENOENT;
+}
+
+static int sl_media_test_cable_db_linear_pn_str_find(u32 hpe_pn, const char *vendor_pn_str)
+{
+	int row;
+
+	for (row = 0; row < ARRAY_SIZE(cable_db); ++row) {
+		if (cable_db[row].hpe_pn == hpe_pn &&
+		    !strncmp(cable_db[row].vendor_pn_str, vendor_pn_str, SL_MEDIA_VENDOR_PN_SIZE))
+			return row;
+	}
+
+	return -ENOENT;
+}
+
+/*
+ * Check the hashed index returns the same row as a linear search for every
+ * cable_db entry. cable_db is static, so rows are compared by value.
+ */
+int sl_media_test_cable_db_idx_check(void)
+{
+	int                               row;
+	int                               expected;
+	int                               found;
+	const struct sl_media_cable_attr *cable_attr;
+
+	for (row = 0; row < ARRAY_SIZE(cable_db); ++row) {
+		expected = sl_media_test_cable_db_linear_find(cable_db[row].hpe_pn,
+			cable_db[row].vendor, cable_db[row].type);
+		found = sl_media_data_cable_db_ops_find(cable_db[row].hpe_pn,
+			cable_db[row].vendor, cable_db[row].type, &cable_attr);
+		if (found != expected) {
+			sl_media_log_err(NULL, LOG_NAME,
+				"idx check find mismatch (row = %d, expected = %d, found = %d)",
+				row, expected, found);
+			return -EBADE;
+		}
+		if (memcmp(cable_attr, &cable_db[expected], sizeof(*cable_attr))) {
+			sl_media_log_err(NULL, LOG_NAME,
+				"idx check find attr mismatch (row = %d)", row);
+			return -EBADE;
+		}
+
+		expected = sl_media_test_cable_db_linear_pn_str_find(cable_db[row].hpe_pn,
+			cable_db[row].vendor_pn_str);
+		found = sl_media_data_cable_db_ops_pn_str_find(cable_db[row].hpe_pn,
+			cable_db[row].vendor_pn_str, &cable_attr);
+		if (found != expected) {
+			sl_media_log_err(NULL, LOG_NAME,
+				"idx check pn_str find mismatch (row = %d, expected = %d, found = %d)",
+				row, expected, found);
+			return -EBADE;
+		}
+		if (memcmp(cable_attr, &cable_db[expected], sizeof(*cable_attr))) {
+			sl_media_log_err(NULL, LOG_NAME,
+				"idx check pn_str find attr mismatch (row = %d)", row);
+			return -EBADE;
+		}
+	}
+
+	found = sl_media_data_cable_db_ops_find(0, 0, 0, NULL);
+	if (found != -ENOENT) {
+		sl_media_log_err(NULL, LOG_NAME,
+			"idx check unknown cable found (row = %d)", found);
+		return -EBADE;
+	}
+
+	found = sl_media_data_cable_db_ops_pn_str_find(cable_db[0].hpe_pn, "", NULL);
+	if (found != -ENOENT) {
+		sl_media_log_err(NULL, LOG_NAME,
+			"idx check empty pn_str found (row = %d)", found);
+		return -EBADE;
+	}
+
+	sl_media_log_dbg(NULL, LOG_NAME, "idx check passed (rows = %zu)", ARRAY_SIZE(cable_db));
+
+	return 0;
+}
@@ -0,0 +1,9 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#ifndef _SL_MEDIA_TEST_CABLE_DB_H_
+#define _SL_MEDIA_TEST_CABLE_DB_H_
+
+int sl_media_test_cable_db_idx_check(void);
+
+#endif /* _SL_MEDIA_TEST_CABLE_DB_H_ */
@@ -128,7 +128,41 @@ int sl_lgrp_hw_attr_set(struct sl_lgrp *lgrp, struct sl_hw_attr *hw_attr)
 }
 EXPORT_SYMBOL(sl_lgrp_hw_attr_set);
 
-struct sl_lgrp *sl_lgrp_new(struct sl_ldev *ldev, u8 lgrp_num, struct kobject *sysfs_parent)
+static int sl_lgrp_attr_check(struct sl_lgrp_attr *lgrp_attr)
+{
+	if (!lgrp_attr) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "NULL lgrp_attr");
+		return -EINVAL;
+	}
+	if (IS_ERR(lgrp_attr)) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "lgrp_attr pointer error");
+		return -EINVAL;
+	}
+	if (lgrp_attr->magic != SL_LGRP_ATTR_MAGIC) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "bad lgrp_attr magic");
+		return -EINVAL;
+	}
+	if (lgrp_attr->ver != SL_LGRP_ATTR_VER) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "bad lgrp_attr version");
+		return -EINVAL;
+	}
+	if (lgrp_attr->size != sizeof(struct sl_lgrp_attr)) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME,
+			   "bad lgrp_attr size (size = %u, expected = %zu)",
+			   lgrp_attr->size, sizeof(struct sl_lgrp_attr));
+		return -EINVAL;
+	}
+	if (lgrp_attr->notif_depth > SL_LGRP_NOTIF_DEPTH_MAX) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME,
+			   "invalid (notif_depth = %u)", lgrp_attr->notif_depth);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+struct sl_lgrp *sl_lgrp_new_attr(struct sl_ldev *ldev, u8 lgrp_num, struct kobject *sysfs_parent,
+				 struct sl_lgrp_attr *lgrp_attr)
 {
 	int rtn;
 
@@ -141,8 +175,13 @@ struct sl_lgrp *sl_lgrp_new(struct sl_ldev *ldev, u8 lgrp_num, struct kobject *s
 		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "invalid (lgrp_num = %u)", lgrp_num);
 		return ERR_PTR(-EINVAL);
 	}
+	rtn = sl_lgrp_attr_check(lgrp_attr);
+	if (rtn) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "new fail");
+		return ERR_PTR(rtn);
+	}
 
-	rtn = sl_ctrl_lgrp_new(ldev->num, lgrp_num, sysfs_parent);
+	rtn = sl_ctrl_lgrp_new(ldev->num, lgrp_num, sysfs_parent, lgrp_attr->notif_depth);
 	if (rtn) {
 		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "new fail");
 		return ERR_PTR(-EINVAL);
@@ -150,6 +189,19 @@ struct sl_lgrp *sl_lgrp_new(struct sl_ldev *ldev, u8 lgrp_num, struct kobject *s
 
 	return &lgrps[ldev->num][lgrp_num];
 }
+EXPORT_SYMBOL(sl_lgrp_new_attr);
+
+struct sl_lgrp *sl_lgrp_new(struct sl_ldev *ldev, u8 lgrp_num, struct kobject *sysfs_parent)
+{
+	struct sl_lgrp_attr lgrp_attr = {
+		.magic       = SL_LGRP_ATTR_MAGIC,
+		.ver         = SL_LGRP_ATTR_VER,
+		.size        = sizeof(lgrp_attr),
+		.notif_depth = SL_LGRP_NOTIF_DEPTH_DEFAULT,
+	};
+
+	return sl_lgrp_new_attr(ldev, lgrp_num, sysfs_parent, &lgrp_attr);
+}
 EXPORT_SYMBOL(sl_lgrp_new);
 
 int sl_lgrp_del(struct sl_lgrp *lgrp)
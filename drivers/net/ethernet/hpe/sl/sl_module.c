@@ -1,11 +1,12 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/module.h>
 #include <linux/init.h>
 #include <linux/device.h>
 #include <linux/cdev.h>
 #include <linux/fs.h>
+#include <linux/debugfs.h>
 #include <linux/version.h>
 
 #include "sl_module.h"
@@ -17,7 +18,12 @@
 #include "sl_llr.h"
 #include "sl_mac.h"
 
-#define SL_DEVICE_NAME "sl"
+#include "base/sl_core_io_trace.h"
+#include "base/sl_core_op_hist.h"
+#include "base/sl_core_serdes_fw_cache.h"
+
+#define SL_DEVICE_NAME      "sl"
+#define SL_DEBUGFS_DIR_NAME "sl_core"
 
 #define tostr(x)             #x
 #define version_str(a, b, c) tostr(a.b.c)
@@ -50,6 +56,7 @@ EXPORT_SYMBOL(sl_git_hash_str_get);
 static dev_t          sl_dev;
 static struct class  *sl_class;
 static struct device *sl_device;
+static struct dentry *sl_debugfs_dir;
 
 static int __init sl_init(void)
 {
@@ -88,6 +95,16 @@ static int __init sl_init(void)
 	sl_llr_init();
 	sl_mac_init();
 
+	sl_debugfs_dir = debugfs_create_dir(SL_DEBUGFS_DIR_NAME, NULL);
+	if (IS_ERR(sl_debugfs_dir)) {
+		pr_warn("debugfs_create_dir failed [%ld]", PTR_ERR(sl_debugfs_dir));
+		sl_debugfs_dir = NULL;
+	}
+
+	sl_core_io_trace_init();
+	sl_core_op_hist_init();
+	sl_core_serdes_fw_cache_init();
+
 	return 0;
 
 out_class:
@@ -104,6 +121,11 @@ struct device *sl_device_get(void)
 	return sl_device;
 }
 
+struct dentry *sl_debugfs_dir_get(void)
+{
+	return sl_debugfs_dir;
+}
+
 static void __exit sl_exit(void)
 {
 	pr_info("%s: exit\n", module_name(THIS_MODULE));
@@ -113,6 +135,13 @@ static void __exit sl_exit(void)
 	unregister_chrdev_region(sl_dev, 1);
 
 	sl_ldev_exit();
+
+	sl_core_io_trace_exit();
+	sl_core_op_hist_exit();
+	sl_core_serdes_fw_cache_exit();
+
+	debugfs_remove_recursive(sl_debugfs_dir);
+	sl_debugfs_dir = NULL;
 }
 module_exit(sl_exit);
 
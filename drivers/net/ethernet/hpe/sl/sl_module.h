@@ -1,12 +1,14 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _SL_MODULE_COMMON_H_
 #define _SL_MODULE_COMMON_H_
 
 struct device;
+struct dentry;
 
 char          *sl_version_str_get(void);
 struct device *sl_device_get(void);
+struct dentry *sl_debugfs_dir_get(void);
 
 #endif /* _SL_MODULE_COMMON_H_ */
@@ -20,5 +20,10 @@
 #if LINUX_VERSION_CODE < KERNEL_VERSION(6, 15, 0)
 #define timer_delete_sync del_timer_sync
 #endif
+#if LINUX_VERSION_CODE < KERNEL_VERSION(6, 16, 0)
+#define SL_PLATFORM_BIN_ATTR_CONST
+#else
+#define SL_PLATFORM_BIN_ATTR_CONST const
+#endif
 
 #endif /* _SL_PLATFORM_H_ */
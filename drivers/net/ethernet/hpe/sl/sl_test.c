@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/module.h>
 
@@ -20,7 +20,9 @@
 
 #include "test/sl_core_test_an.h"
 #include "test/sl_core_test_fec.h"
+#include "test/sl_core_test_uc_ram.h"
 #include "test/sl_media_test_str.h"
+#include "test/sl_media_test_cable_db.h"
 
 int sl_test_an_fake_caps_set(struct sl_link *link, struct sl_link_caps *caps)
 {
@@ -62,3 +64,21 @@ int sl_test_fec_cntrs_set(struct sl_link *link, u64 ucw, u64 ccw, u64 gcw)
 	return sl_core_test_fec_cw_cntrs_set(link->ldev_num, link->lgrp_num, link->num, &cw_cntrs);
 }
 EXPORT_SYMBOL(sl_test_fec_cntrs_set);
+
+int sl_test_media_cable_db_check(void)
+{
+	return sl_media_test_cable_db_idx_check();
+}
+EXPORT_SYMBOL(sl_test_media_cable_db_check);
+
+int sl_test_uc_ram_bench(struct sl_lgrp *lgrp)
+{
+	int rtn;
+
+	rtn = sl_lgrp_check(lgrp);
+	if (rtn)
+		return rtn;
+
+	return sl_core_test_uc_ram_bench(lgrp->ldev_num, lgrp->num);
+}
+EXPORT_SYMBOL(sl_test_uc_ram_bench);
@@ -0,0 +1,305 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#undef TRACE_SYSTEM
+#define TRACE_SYSTEM sl
+
+#if !defined(_SL_TRACE_H_) || defined(TRACE_HEADER_MULTI_READ)
+#define _SL_TRACE_H_
+
+#include <linux/tracepoint.h>
+
+#include <linux/hpe/sl/sl_lgrp.h>
+
+#include "sl_core_ldev.h"
+#include "sl_core_lgrp.h"
+#include "sl_core_link.h"
+#include "sl_core_llr.h"
+
+/*
+ * Link and LLR state machine events.
+ *
+ * Work numbers are the SL_CORE_WORK_LINK_* and SL_CORE_WORK_LLR_* values,
+ * timer numbers the SL_CORE_TIMER_LINK_* and SL_CORE_TIMER_LLR_* values.
+ * Pair intr or timer_fire with work_queue and work_start on the same
+ * ldev/lgrp/link/work to get the interrupt to work scheduling latency.
+ */
+
+TRACE_DEFINE_ENUM(SL_CORE_LINK_STATE_INVALID);
+TRACE_DEFINE_ENUM(SL_CORE_LINK_STATE_UNCONFIGURED);
+TRACE_DEFINE_ENUM(SL_CORE_LINK_STATE_CONFIGURING);
+TRACE_DEFINE_ENUM(SL_CORE_LINK_STATE_CONFIGURED);
+TRACE_DEFINE_ENUM(SL_CORE_LINK_STATE_DOWN);
+TRACE_DEFINE_ENUM(SL_CORE_LINK_STATE_AN);
+TRACE_DEFINE_ENUM(SL_CORE_LINK_STATE_GOING_UP);
+TRACE_DEFINE_ENUM(SL_CORE_LINK_STATE_UP);
+TRACE_DEFINE_ENUM(SL_CORE_LINK_STATE_CANCELING);
+TRACE_DEFINE_ENUM(SL_CORE_LINK_STATE_GOING_DOWN);
+TRACE_DEFINE_ENUM(SL_CORE_LINK_STATE_TIMEOUT);
+
+#define SL_TRACE_LINK_STATE_NAMES                                   \
+	{ SL_CORE_LINK_STATE_INVALID,      "invalid"      },        \
+	{ SL_CORE_LINK_STATE_UNCONFIGURED, "unconfigured" },        \
+	{ SL_CORE_LINK_STATE_CONFIGURING,  "configuring"  },        \
+	{ SL_CORE_LINK_STATE_CONFIGURED,   "configured"   },        \
+	{ SL_CORE_LINK_STATE_DOWN,         "down"         },        \
+	{ SL_CORE_LINK_STATE_AN,           "an"           },        \
+	{ SL_CORE_LINK_STATE_GOING_UP,     "going-up"     },        \
+	{ SL_CORE_LINK_STATE_UP,           "up"           },        \
+	{ SL_CORE_LINK_STATE_CANCELING,    "canceling"    },        \
+	{ SL_CORE_LINK_STATE_GOING_DOWN,   "going-down"   },        \
+	{ SL_CORE_LINK_STATE_TIMEOUT,      "timeout"      }
+
+TRACE_DEFINE_ENUM(SL_CORE_LLR_STATE_INVALID);
+TRACE_DEFINE_ENUM(SL_CORE_LLR_STATE_NEW);
+TRACE_DEFINE_ENUM(SL_CORE_LLR_STATE_CONFIGURED);
+TRACE_DEFINE_ENUM(SL_CORE_LLR_STATE_SETTING_UP);
+TRACE_DEFINE_ENUM(SL_CORE_LLR_STATE_SETUP_TIMEOUT);
+TRACE_DEFINE_ENUM(SL_CORE_LLR_STATE_SETUP_CANCELING);
+TRACE_DEFINE_ENUM(SL_CORE_LLR_STATE_SETUP_STOPPING);
+TRACE_DEFINE_ENUM(SL_CORE_LLR_STATE_SETUP);
+TRACE_DEFINE_ENUM(SL_CORE_LLR_STATE_STARTING);
+TRACE_DEFINE_ENUM(SL_CORE_LLR_STATE_START_TIMEOUT);
+TRACE_DEFINE_ENUM(SL_CORE_LLR_STATE_START_CANCELING);
+TRACE_DEFINE_ENUM(SL_CORE_LLR_STATE_RUNNING);
+TRACE_DEFINE_ENUM(SL_CORE_LLR_STATE_STOPPING);
+
+#define SL_TRACE_LLR_STATE_NAMES                                       \
+	{ SL_CORE_LLR_STATE_INVALID,         "invalid"         },      \
+	{ SL_CORE_LLR_STATE_NEW,             "new"             },      \
+	{ SL_CORE_LLR_STATE_CONFIGURED,      "configured"      },      \
+	{ SL_CORE_LLR_STATE_SETTING_UP,      "setting-up"      },      \
+	{ SL_CORE_LLR_STATE_SETUP_TIMEOUT,   "setup-timeout"   },      \
+	{ SL_CORE_LLR_STATE_SETUP_CANCELING, "setup-canceling" },      \
+	{ SL_CORE_LLR_STATE_SETUP_STOPPING,  "setup-stopping"  },      \
+	{ SL_CORE_LLR_STATE_SETUP,           "setup"           },      \
+	{ SL_CORE_LLR_STATE_STARTING,        "starting"        },      \
+	{ SL_CORE_LLR_STATE_START_TIMEOUT,   "start-timeout"   },      \
+	{ SL_CORE_LLR_STATE_START_CANCELING, "start-canceling" },      \
+	{ SL_CORE_LLR_STATE_RUNNING,         "running"         },      \
+	{ SL_CORE_LLR_STATE_STOPPING,        "stopping"        }
+
+/* ----- link ----- */
+
+DECLARE_EVENT_CLASS(sl_core_link_class,
+	TP_PROTO(struct sl_core_link *core_link, u32 val),
+	TP_ARGS(core_link, val),
+	TP_STRUCT__entry(
+		__field(u8,  ldev_num)
+		__field(u8,  lgrp_num)
+		__field(u8,  link_num)
+		__field(u32, val)
+	),
+	TP_fast_assign(
+		__entry->ldev_num = core_link->core_lgrp->core_ldev->num;
+		__entry->lgrp_num = core_link->core_lgrp->num;
+		__entry->link_num = core_link->num;
+		__entry->val      = val;
+	),
+	TP_printk("ldev%u lgrp%02u link%u val=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->link_num, __entry->val)
+);
+
+DEFINE_EVENT_PRINT(sl_core_link_class, sl_core_link_state,
+	TP_PROTO(struct sl_core_link *core_link, u32 state),
+	TP_ARGS(core_link, state),
+	TP_printk("ldev%u lgrp%02u link%u state=%s",
+		__entry->ldev_num, __entry->lgrp_num, __entry->link_num,
+		__print_symbolic(__entry->val, SL_TRACE_LINK_STATE_NAMES))
+);
+
+DEFINE_EVENT_PRINT(sl_core_link_class, sl_core_link_an_lp_caps_state,
+	TP_PROTO(struct sl_core_link *core_link, u32 lp_caps_state),
+	TP_ARGS(core_link, lp_caps_state),
+	TP_printk("ldev%u lgrp%02u link%u lp_caps_state=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->link_num, __entry->val)
+);
+
+DEFINE_EVENT_PRINT(sl_core_link_class, sl_core_link_work_queue,
+	TP_PROTO(struct sl_core_link *core_link, u32 work_num),
+	TP_ARGS(core_link, work_num),
+	TP_printk("ldev%u lgrp%02u link%u work=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->link_num, __entry->val)
+);
+
+DEFINE_EVENT_PRINT(sl_core_link_class, sl_core_link_work_start,
+	TP_PROTO(struct sl_core_link *core_link, u32 work_num),
+	TP_ARGS(core_link, work_num),
+	TP_printk("ldev%u lgrp%02u link%u work=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->link_num, __entry->val)
+);
+
+DEFINE_EVENT_PRINT(sl_core_link_class, sl_core_link_work_end,
+	TP_PROTO(struct sl_core_link *core_link, u32 work_num),
+	TP_ARGS(core_link, work_num),
+	TP_printk("ldev%u lgrp%02u link%u work=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->link_num, __entry->val)
+);
+
+DEFINE_EVENT_PRINT(sl_core_link_class, sl_core_link_timer_arm,
+	TP_PROTO(struct sl_core_link *core_link, u32 timer_num),
+	TP_ARGS(core_link, timer_num),
+	TP_printk("ldev%u lgrp%02u link%u timer=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->link_num, __entry->val)
+);
+
+DEFINE_EVENT_PRINT(sl_core_link_class, sl_core_link_timer_fire,
+	TP_PROTO(struct sl_core_link *core_link, u32 timer_num),
+	TP_ARGS(core_link, timer_num),
+	TP_printk("ldev%u lgrp%02u link%u timer=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->link_num, __entry->val)
+);
+
+DEFINE_EVENT_PRINT(sl_core_link_class, sl_core_link_timer_end,
+	TP_PROTO(struct sl_core_link *core_link, u32 timer_num),
+	TP_ARGS(core_link, timer_num),
+	TP_printk("ldev%u lgrp%02u link%u timer=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->link_num, __entry->val)
+);
+
+DEFINE_EVENT_PRINT(sl_core_link_class, sl_core_link_intr,
+	TP_PROTO(struct sl_core_link *core_link, u32 intr_num),
+	TP_ARGS(core_link, intr_num),
+	TP_printk("ldev%u lgrp%02u link%u intr=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->link_num, __entry->val)
+);
+
+/* ----- llr ----- */
+
+DECLARE_EVENT_CLASS(sl_core_llr_class,
+	TP_PROTO(struct sl_core_llr *core_llr, u32 val),
+	TP_ARGS(core_llr, val),
+	TP_STRUCT__entry(
+		__field(u8,  ldev_num)
+		__field(u8,  lgrp_num)
+		__field(u8,  llr_num)
+		__field(u32, val)
+	),
+	TP_fast_assign(
+		__entry->ldev_num = core_llr->core_lgrp->core_ldev->num;
+		__entry->lgrp_num = core_llr->core_lgrp->num;
+		__entry->llr_num  = core_llr->num;
+		__entry->val      = val;
+	),
+	TP_printk("ldev%u lgrp%02u llr%u val=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->llr_num, __entry->val)
+);
+
+DEFINE_EVENT_PRINT(sl_core_llr_class, sl_core_llr_state,
+	TP_PROTO(struct sl_core_llr *core_llr, u32 state),
+	TP_ARGS(core_llr, state),
+	TP_printk("ldev%u lgrp%02u llr%u state=%s",
+		__entry->ldev_num, __entry->lgrp_num, __entry->llr_num,
+		__print_symbolic(__entry->val, SL_TRACE_LLR_STATE_NAMES))
+);
+
+DEFINE_EVENT_PRINT(sl_core_llr_class, sl_core_llr_work_queue,
+	TP_PROTO(struct sl_core_llr *core_llr, u32 work_num),
+	TP_ARGS(core_llr, work_num),
+	TP_printk("ldev%u lgrp%02u llr%u work=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->llr_num, __entry->val)
+);
+
+DEFINE_EVENT_PRINT(sl_core_llr_class, sl_core_llr_work_start,
+	TP_PROTO(struct sl_core_llr *core_llr, u32 work_num),
+	TP_ARGS(core_llr, work_num),
+	TP_printk("ldev%u lgrp%02u llr%u work=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->llr_num, __entry->val)
+);
+
+DEFINE_EVENT_PRINT(sl_core_llr_class, sl_core_llr_work_end,
+	TP_PROTO(struct sl_core_llr *core_llr, u32 work_num),
+	TP_ARGS(core_llr, work_num),
+	TP_printk("ldev%u lgrp%02u llr%u work=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->llr_num, __entry->val)
+);
+
+DEFINE_EVENT_PRINT(sl_core_llr_class, sl_core_llr_timer_arm,
+	TP_PROTO(struct sl_core_llr *core_llr, u32 timer_num),
+	TP_ARGS(core_llr, timer_num),
+	TP_printk("ldev%u lgrp%02u llr%u timer=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->llr_num, __entry->val)
+);
+
+DEFINE_EVENT_PRINT(sl_core_llr_class, sl_core_llr_timer_fire,
+	TP_PROTO(struct sl_core_llr *core_llr, u32 timer_num),
+	TP_ARGS(core_llr, timer_num),
+	TP_printk("ldev%u lgrp%02u llr%u timer=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->llr_num, __entry->val)
+);
+
+DEFINE_EVENT_PRINT(sl_core_llr_class, sl_core_llr_timer_end,
+	TP_PROTO(struct sl_core_llr *core_llr, u32 timer_num),
+	TP_ARGS(core_llr, timer_num),
+	TP_printk("ldev%u lgrp%02u llr%u timer=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->llr_num, __entry->val)
+);
+
+DEFINE_EVENT_PRINT(sl_core_llr_class, sl_core_llr_intr,
+	TP_PROTO(struct sl_core_llr *core_llr, u32 intr_num),
+	TP_ARGS(core_llr, intr_num),
+	TP_printk("ldev%u lgrp%02u llr%u intr=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->llr_num, __entry->val)
+);
+
+/* ----- lgrp notifications ----- */
+
+#define SL_TRACE_NOTIF_ENQUEUE_QUEUED    0
+#define SL_TRACE_NOTIF_ENQUEUE_COALESCED 1
+#define SL_TRACE_NOTIF_ENQUEUE_DROPPED   2
+
+TRACE_EVENT(sl_ctrl_lgrp_notif_enqueue,
+	TP_PROTO(struct sl_lgrp_notif_msg *notif_msg, u32 result),
+	TP_ARGS(notif_msg, result),
+	TP_STRUCT__entry(
+		__field(u8,  ldev_num)
+		__field(u8,  lgrp_num)
+		__field(u8,  link_num)
+		__field(u32, type)
+		__field(u32, result)
+	),
+	TP_fast_assign(
+		__entry->ldev_num = notif_msg->ldev_num;
+		__entry->lgrp_num = notif_msg->lgrp_num;
+		__entry->link_num = notif_msg->link_num;
+		__entry->type     = notif_msg->type;
+		__entry->result   = result;
+	),
+	TP_printk("ldev%u lgrp%02u link%u type=0x%X %s",
+		__entry->ldev_num, __entry->lgrp_num, __entry->link_num, __entry->type,
+		__print_symbolic(__entry->result,
+			{ SL_TRACE_NOTIF_ENQUEUE_QUEUED,    "queued"    },
+			{ SL_TRACE_NOTIF_ENQUEUE_COALESCED, "coalesced" },
+			{ SL_TRACE_NOTIF_ENQUEUE_DROPPED,   "dropped"   }))
+);
+
+TRACE_EVENT(sl_ctrl_lgrp_notif_deliver,
+	TP_PROTO(struct sl_lgrp_notif_msg *notif_msg, u32 callback_count),
+	TP_ARGS(notif_msg, callback_count),
+	TP_STRUCT__entry(
+		__field(u8,  ldev_num)
+		__field(u8,  lgrp_num)
+		__field(u8,  link_num)
+		__field(u32, type)
+		__field(u32, callback_count)
+	),
+	TP_fast_assign(
+		__entry->ldev_num       = notif_msg->ldev_num;
+		__entry->lgrp_num       = notif_msg->lgrp_num;
+		__entry->link_num       = notif_msg->link_num;
+		__entry->type           = notif_msg->type;
+		__entry->callback_count = callback_count;
+	),
+	TP_printk("ldev%u lgrp%02u link%u type=0x%X callbacks=%u",
+		__entry->ldev_num, __entry->lgrp_num, __entry->link_num,
+		__entry->type, __entry->callback_count)
+);
+
+#endif /* _SL_TRACE_H_ */
+
+/* must be outside the multi-read guard */
+#undef TRACE_INCLUDE_PATH
+#define TRACE_INCLUDE_PATH .
+#undef TRACE_INCLUDE_FILE
+#define TRACE_INCLUDE_FILE sl_trace
+#include <trace/define_trace.h>
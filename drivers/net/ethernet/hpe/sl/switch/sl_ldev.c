@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/module.h>
 
@@ -62,10 +62,6 @@ int sl_ldev_attr_check(struct sl_ldev_attr *ldev_attr)
 		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "NULL ops pml_intr_disable");
 		return -EINVAL;
 	}
-	if (!ldev_attr->ops->dt_info_get) {
-		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "NULL ops dt_info_get");
-		return -EINVAL;
-	}
 	if (!ldev_attr->ops->mb_info_get) {
 		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "NULL ops mb_info_get");
 		return -EINVAL;
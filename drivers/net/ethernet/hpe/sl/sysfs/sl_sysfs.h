@@ -19,6 +19,12 @@ u8 lane_num_to_link_num(struct sl_ctrl_lgrp *ctrl_lgrp, u8 lane_num);
 int  sl_sysfs_ldev_create(u8 ldev_num, struct kobject *parent_kobj);
 void sl_sysfs_ldev_delete(struct sl_ctrl_ldev *ctrl_ldev);
 
+int  sl_sysfs_ldev_fec_mon_create(struct sl_ctrl_ldev *ctrl_ldev);
+void sl_sysfs_ldev_fec_mon_delete(struct sl_ctrl_ldev *ctrl_ldev);
+
+int  sl_sysfs_ldev_media_shift_create(struct sl_ctrl_ldev *ctrl_ldev);
+void sl_sysfs_ldev_media_shift_delete(struct sl_ctrl_ldev *ctrl_ldev);
+
 int  sl_sysfs_lgrp_create(struct sl_ctrl_lgrp *ctrl_lgrp);
 void sl_sysfs_lgrp_delete(struct sl_ctrl_lgrp *ctrl_lgrp);
 
@@ -35,6 +41,15 @@ int  sl_sysfs_media_create(struct sl_ctrl_lgrp *ctrl_lgrp);
 void sl_sysfs_media_delete(struct sl_ctrl_lgrp *ctrl_lgrp);
 int  sl_sysfs_media_speeds_create(u8 ldev_num, u8 lgrp_num);
 
+int  sl_sysfs_lgrp_notif_create(struct sl_ctrl_lgrp *ctrl_lgrp);
+void sl_sysfs_lgrp_notif_delete(struct sl_ctrl_lgrp *ctrl_lgrp);
+
+int  sl_sysfs_lgrp_link_up_phase_create(struct sl_ctrl_lgrp *ctrl_lgrp);
+void sl_sysfs_lgrp_link_up_phase_delete(struct sl_ctrl_lgrp *ctrl_lgrp);
+
+int  sl_sysfs_lgrp_workq_create(struct sl_ctrl_lgrp *ctrl_lgrp);
+void sl_sysfs_lgrp_workq_delete(struct sl_ctrl_lgrp *ctrl_lgrp);
+
 int  sl_sysfs_pmi_create(struct sl_ctrl_lgrp *ctrl_lgrp);
 void sl_sysfs_pmi_delete(struct sl_ctrl_lgrp *ctrl_lgrp);
 
@@ -80,6 +95,12 @@ void sl_sysfs_link_degrade_delete(struct sl_core_link *core_link);
 int  sl_sysfs_link_pml_rec_create(struct sl_core_link *core_link, struct kobject *parent_kobj);
 void sl_sysfs_link_pml_rec_delete(struct sl_core_link *core_link);
 
+int     sl_sysfs_link_up_phase_create(struct sl_core_link *core_link, struct kobject *parent_kobj);
+void    sl_sysfs_link_up_phase_delete(struct sl_core_link *core_link);
+int     sl_sysfs_link_intr_create(struct sl_core_link *core_link, struct kobject *parent_kobj);
+void    sl_sysfs_link_intr_delete(struct sl_core_link *core_link);
+ssize_t sl_sysfs_link_up_hist_show(char *buf, u32 *buckets);
+
 int  sl_sysfs_link_fec_create(struct sl_ctrl_link *ctrl_link);
 void sl_sysfs_link_fec_delete(struct sl_ctrl_link *ctrl_link);
 
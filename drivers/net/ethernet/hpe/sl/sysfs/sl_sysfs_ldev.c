@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/kobject.h>
 
@@ -9,7 +9,9 @@
 #include "sl_log.h"
 #include "sl_sysfs.h"
 #include "sl_ctrl_ldev.h"
+#include "sl_core_ldev.h"
 #include "sl_module.h"
+#include "sl_platform.h"
 
 #define LOG_BLOCK SL_LOG_BLOCK
 #define LOG_NAME  SL_LOG_SYSFS_LOG_NAME
@@ -54,12 +56,133 @@ static ssize_t mod_hash_show(struct kobject *kobj, struct kobj_attribute *kattr,
 	return scnprintf(buf, PAGE_SIZE, "%s\n", sl_git_hash_str_get());
 }
 
-static struct kobj_attribute mod_ver  = __ATTR_RO(mod_ver);
-static struct kobj_attribute mod_hash = __ATTR_RO(mod_hash);
+static ssize_t serdes_fw_load_time_us_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_ldev *ctrl_ldev;
+	struct sl_core_ldev *core_ldev;
+	u64                  load_time_us;
+
+	ctrl_ldev = container_of(kobj, struct sl_ctrl_ldev, sl_info_kobj);
+	core_ldev = sl_core_ldev_get(ctrl_ldev->num);
+	if (!core_ldev)
+		return scnprintf(buf, PAGE_SIZE, "error\n");
+
+	load_time_us = sl_core_ldev_serdes_fw_load_time_get(core_ldev);
+
+	sl_log_dbg(ctrl_ldev, LOG_BLOCK, LOG_NAME,
+		   "serdes fw load time show (ldev = 0x%p, load_time = %lluus)", ctrl_ldev, load_time_us);
+
+	return scnprintf(buf, PAGE_SIZE, "%llu\n", load_time_us);
+}
+
+/* snapshot is taken when read from the start, later offsets read the same snapshot */
+static ssize_t link_stats_read(struct file *filp, struct kobject *kobj,
+			       SL_PLATFORM_BIN_ATTR_CONST struct bin_attribute *bin_attr,
+			       char *buf, loff_t off, size_t count)
+{
+	int                  rtn;
+	struct sl_ctrl_ldev *ctrl_ldev;
+
+	ctrl_ldev = container_of(kobj, struct sl_ctrl_ldev, sl_info_kobj);
+
+	if (off == 0) {
+		rtn = sl_ctrl_ldev_stats_snapshot(ctrl_ldev);
+		if (rtn) {
+			sl_log_err(ctrl_ldev, LOG_BLOCK, LOG_NAME, "link stats snapshot failed [%d]", rtn);
+			return rtn;
+		}
+	}
+
+	sl_log_dbg(ctrl_ldev, LOG_BLOCK, LOG_NAME,
+		   "link stats read (off = %lld, count = %zu)", off, count);
+
+	return sl_ctrl_ldev_stats_read(ctrl_ldev, buf, off, count);
+}
+
+static struct bin_attribute link_stats = {
+	.attr = { .name = "link_stats", .mode = 0444 },
+	.read = link_stats_read,
+};
+
+/* built from the eye sampler snapshots, the SerDes are not read */
+static ssize_t eyes_read(struct file *filp, struct kobject *kobj,
+			 SL_PLATFORM_BIN_ATTR_CONST struct bin_attribute *bin_attr,
+			 char *buf, loff_t off, size_t count)
+{
+	int                  rtn;
+	struct sl_ctrl_ldev *ctrl_ldev;
+
+	ctrl_ldev = container_of(kobj, struct sl_ctrl_ldev, sl_info_kobj);
+
+	if (off == 0) {
+		rtn = sl_ctrl_ldev_eyes_snapshot(ctrl_ldev);
+		if (rtn) {
+			sl_log_err(ctrl_ldev, LOG_BLOCK, LOG_NAME, "eyes snapshot failed [%d]", rtn);
+			return rtn;
+		}
+	}
+
+	sl_log_dbg(ctrl_ldev, LOG_BLOCK, LOG_NAME,
+		   "eyes read (off = %lld, count = %zu)", off, count);
+
+	return sl_ctrl_ldev_eyes_read(ctrl_ldev, buf, off, count);
+}
+
+static struct bin_attribute eyes = {
+	.attr = { .name = "eyes", .mode = 0444 },
+	.read = eyes_read,
+};
+
+static ssize_t eye_sample_period_ms_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_ldev *ctrl_ldev;
+	u32                  period_ms;
+
+	ctrl_ldev = container_of(kobj, struct sl_ctrl_ldev, sl_info_kobj);
+
+	period_ms = sl_ctrl_ldev_eyes_period_get(ctrl_ldev);
+
+	sl_log_dbg(ctrl_ldev, LOG_BLOCK, LOG_NAME,
+		   "eye sample period show (period_ms = %u)", period_ms);
+
+	return scnprintf(buf, PAGE_SIZE, "%u\n", period_ms);
+}
+
+static ssize_t eye_sample_period_ms_store(struct kobject *kobj, struct kobj_attribute *kattr,
+					  const char *buf, size_t count)
+{
+	int                  rtn;
+	struct sl_ctrl_ldev *ctrl_ldev;
+	u32                  period_ms;
+
+	ctrl_ldev = container_of(kobj, struct sl_ctrl_ldev, sl_info_kobj);
+
+	rtn = kstrtou32(buf, 0, &period_ms);
+	if (rtn) {
+		sl_log_err(ctrl_ldev, LOG_BLOCK, LOG_NAME, "eye sample period kstrtou32 failed [%d]", rtn);
+		return count;
+	}
+
+	sl_log_dbg(ctrl_ldev, LOG_BLOCK, LOG_NAME,
+		   "eye sample period store (period_ms = %u)", period_ms);
+
+	rtn = sl_ctrl_ldev_eyes_period_set(ctrl_ldev, period_ms);
+	if (rtn)
+		return rtn;
+
+	return count;
+}
+
+static struct kobj_attribute mod_ver                = __ATTR_RO(mod_ver);
+static struct kobj_attribute mod_hash               = __ATTR_RO(mod_hash);
+static struct kobj_attribute serdes_fw_load_time_us = __ATTR_RO(serdes_fw_load_time_us);
+static struct kobj_attribute eye_sample_period_ms   = __ATTR_RW(eye_sample_period_ms);
 
 static struct attribute *ldev_attrs[] = {
 	&mod_ver.attr,
 	&mod_hash.attr,
+	&serdes_fw_load_time_us.attr,
+	&eye_sample_period_ms.attr,
 	NULL
 };
 ATTRIBUTE_GROUPS(ldev);
@@ -365,9 +488,49 @@ int sl_sysfs_ldev_create(u8 ldev_num, struct kobject *parent)
 		goto out;
 	}
 
+	link_stats.size = sl_ctrl_ldev_stats_size_max();
+	rtn = sysfs_create_bin_file(&ctrl_ldev->sl_info_kobj, &link_stats);
+	if (rtn) {
+		sl_log_err(ctrl_ldev, LOG_BLOCK, LOG_NAME, "link stats create failed [%d]", rtn);
+		kobject_put(&ctrl_ldev->sl_info_kobj);
+		goto out;
+	}
+
+	eyes.size = sl_ctrl_ldev_eyes_size_max();
+	rtn = sysfs_create_bin_file(&ctrl_ldev->sl_info_kobj, &eyes);
+	if (rtn) {
+		sl_log_err(ctrl_ldev, LOG_BLOCK, LOG_NAME, "eyes create failed [%d]", rtn);
+		sysfs_remove_bin_file(&ctrl_ldev->sl_info_kobj, &link_stats);
+		kobject_put(&ctrl_ldev->sl_info_kobj);
+		goto out;
+	}
+
+	rtn = sl_sysfs_ldev_fec_mon_create(ctrl_ldev);
+	if (rtn) {
+		sl_log_err(ctrl_ldev, LOG_BLOCK, LOG_NAME, "fec mon create failed [%d]", rtn);
+		sysfs_remove_bin_file(&ctrl_ldev->sl_info_kobj, &eyes);
+		sysfs_remove_bin_file(&ctrl_ldev->sl_info_kobj, &link_stats);
+		kobject_put(&ctrl_ldev->sl_info_kobj);
+		goto out;
+	}
+
+	rtn = sl_sysfs_ldev_media_shift_create(ctrl_ldev);
+	if (rtn) {
+		sl_log_err(ctrl_ldev, LOG_BLOCK, LOG_NAME, "media shift create failed [%d]", rtn);
+		sl_sysfs_ldev_fec_mon_delete(ctrl_ldev);
+		sysfs_remove_bin_file(&ctrl_ldev->sl_info_kobj, &eyes);
+		sysfs_remove_bin_file(&ctrl_ldev->sl_info_kobj, &link_stats);
+		kobject_put(&ctrl_ldev->sl_info_kobj);
+		goto out;
+	}
+
 	rtn = sl_sysfs_cable_info_create(ctrl_ldev);
 	if (rtn) {
 		sl_log_err(ctrl_ldev, LOG_BLOCK, LOG_NAME, "cable info create failed [%d]", rtn);
+		sl_sysfs_ldev_media_shift_delete(ctrl_ldev);
+		sl_sysfs_ldev_fec_mon_delete(ctrl_ldev);
+		sysfs_remove_bin_file(&ctrl_ldev->sl_info_kobj, &eyes);
+		sysfs_remove_bin_file(&ctrl_ldev->sl_info_kobj, &link_stats);
 		kobject_put(&ctrl_ldev->sl_info_kobj);
 		goto out;
 	}
@@ -396,5 +559,9 @@ void sl_sysfs_ldev_delete(struct sl_ctrl_ldev *ctrl_ldev)
 	sl_sysfs_cable_types_delete(ctrl_ldev, SL_CABLE_TYPES_NUM);
 
 	kobject_put(&ctrl_ldev->supported_cables_kobj);
+	sl_sysfs_ldev_media_shift_delete(ctrl_ldev);
+	sl_sysfs_ldev_fec_mon_delete(ctrl_ldev);
+	sysfs_remove_bin_file(&ctrl_ldev->sl_info_kobj, &eyes);
+	sysfs_remove_bin_file(&ctrl_ldev->sl_info_kobj, &link_stats);
 	kobject_put(&ctrl_ldev->sl_info_kobj);
 }
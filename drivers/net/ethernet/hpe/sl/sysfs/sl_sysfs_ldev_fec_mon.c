@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/kobject.h>
+#include <linux/kernel.h>
+#include <linux/math64.h>
+
+#include "sl_log.h"
+#include "sl_sysfs.h"
+#include "sl_ctrl_ldev.h"
+#include "sl_ctrl_ldev_fec_mon.h"
+
+#define LOG_BLOCK SL_LOG_BLOCK
+#define LOG_NAME  SL_LOG_SYSFS_LOG_NAME
+
+static ssize_t tick_ms_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_ldev *ctrl_ldev;
+
+	ctrl_ldev = container_of(kobj, struct sl_ctrl_ldev, fec_mon_kobj);
+
+	sl_log_dbg(ctrl_ldev, LOG_BLOCK, LOG_NAME, "fec mon tick ms show (tick_ms = %u)",
+		   SL_CTRL_LDEV_FEC_MON_TICK_MS);
+
+	return scnprintf(buf, PAGE_SIZE, "%u\n", SL_CTRL_LDEV_FEC_MON_TICK_MS);
+}
+
+static ssize_t links_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_ldev *ctrl_ldev;
+	u32                  link_count;
+
+	ctrl_ldev = container_of(kobj, struct sl_ctrl_ldev, fec_mon_kobj);
+
+	link_count = sl_ctrl_ldev_fec_mon_link_count_get(ctrl_ldev);
+
+	sl_log_dbg(ctrl_ldev, LOG_BLOCK, LOG_NAME, "fec mon links show (links = %u)", link_count);
+
+	return scnprintf(buf, PAGE_SIZE, "%u\n", link_count);
+}
+
+#define ldev_fec_mon_stat(_name, _expr)                                                                             \
+	static ssize_t _name##_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)                  \
+	{                                                                                                           \
+		struct sl_ctrl_ldev               *ctrl_ldev;                                                       \
+		struct sl_ctrl_ldev_fec_mon_stats  stats;                                                           \
+		u64                                val;                                                             \
+		                                                                                                    \
+		ctrl_ldev = container_of(kobj, struct sl_ctrl_ldev, fec_mon_kobj);                                  \
+		sl_ctrl_ldev_fec_mon_stats_get(ctrl_ldev, &stats);                                                  \
+		val = (_expr);                                                                                      \
+		sl_log_dbg(ctrl_ldev, LOG_BLOCK, LOG_NAME, "fec mon " #_name " show (" #_name " = %llu)", val);     \
+		return scnprintf(buf, PAGE_SIZE, "%llu\n", val);                                                    \
+	}                                                                                                           \
+	static struct kobj_attribute ldev_fec_mon_##_name = __ATTR_RO(_name)
+
+ldev_fec_mon_stat(ticks,            stats.ticks);
+ldev_fec_mon_stat(checks,           stats.checks);
+ldev_fec_mon_stat(tick_links_last,  stats.tick_links_last);
+ldev_fec_mon_stat(tick_links_max,   stats.tick_links_max);
+ldev_fec_mon_stat(tick_run_us,      div64_u64(stats.tick_ns_last, NSEC_PER_USEC));
+ldev_fec_mon_stat(tick_run_avg_us,  stats.ticks ? div64_u64(stats.tick_ns_sum, stats.ticks * NSEC_PER_USEC) : 0);
+ldev_fec_mon_stat(tick_run_max_us,  div64_u64(stats.tick_ns_max, NSEC_PER_USEC));
+ldev_fec_mon_stat(tick_late_us,     div64_u64(stats.late_ns_last, NSEC_PER_USEC));
+ldev_fec_mon_stat(tick_late_avg_us, stats.ticks ? div64_u64(stats.late_ns_sum, stats.ticks * NSEC_PER_USEC) : 0);
+ldev_fec_mon_stat(tick_late_max_us, div64_u64(stats.late_ns_max, NSEC_PER_USEC));
+
+static ssize_t stats_reset_store(struct kobject *kobj, struct kobj_attribute *kattr, const char *buf, size_t count)
+{
+	struct sl_ctrl_ldev *ctrl_ldev;
+	bool                 reset;
+	int                  rtn;
+
+	ctrl_ldev = container_of(kobj, struct sl_ctrl_ldev, fec_mon_kobj);
+
+	rtn = kstrtobool(buf, &reset);
+	if (rtn) {
+		sl_log_err(ctrl_ldev, LOG_BLOCK, LOG_NAME, "fec mon stats reset kstrtobool failed [%d]", rtn);
+		return count;
+	}
+
+	if (reset)
+		sl_ctrl_ldev_fec_mon_stats_clr(ctrl_ldev);
+
+	return count;
+}
+
+static struct kobj_attribute ldev_fec_mon_tick_ms     = __ATTR_RO(tick_ms);
+static struct kobj_attribute ldev_fec_mon_links       = __ATTR_RO(links);
+static struct kobj_attribute ldev_fec_mon_stats_reset = __ATTR_WO(stats_reset);
+
+static struct attribute *ldev_fec_mon_attrs[] = {
+	&ldev_fec_mon_tick_ms.attr,
+	&ldev_fec_mon_links.attr,
+	&ldev_fec_mon_ticks.attr,
+	&ldev_fec_mon_checks.attr,
+	&ldev_fec_mon_tick_links_last.attr,
+	&ldev_fec_mon_tick_links_max.attr,
+	&ldev_fec_mon_tick_run_us.attr,
+	&ldev_fec_mon_tick_run_avg_us.attr,
+	&ldev_fec_mon_tick_run_max_us.attr,
+	&ldev_fec_mon_tick_late_us.attr,
+	&ldev_fec_mon_tick_late_avg_us.attr,
+	&ldev_fec_mon_tick_late_max_us.attr,
+	&ldev_fec_mon_stats_reset.attr,
+	NULL,
+};
+ATTRIBUTE_GROUPS(ldev_fec_mon);
+
+static struct kobj_type ldev_fec_mon_info = {
+	.sysfs_ops      = &kobj_sysfs_ops,
+	.default_groups = ldev_fec_mon_groups,
+};
+
+int sl_sysfs_ldev_fec_mon_create(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	int rtn;
+
+	sl_log_dbg(ctrl_ldev, LOG_BLOCK, LOG_NAME, "fec mon create (ldev = 0x%p)", ctrl_ldev);
+
+	rtn = kobject_init_and_add(&ctrl_ldev->fec_mon_kobj, &ldev_fec_mon_info,
+				   &ctrl_ldev->sl_info_kobj, "fec_mon");
+	if (rtn) {
+		sl_log_err(ctrl_ldev, LOG_BLOCK, LOG_NAME,
+			   "fec mon create kobject_init_and_add failed [%d]", rtn);
+		kobject_put(&ctrl_ldev->fec_mon_kobj);
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+
+void sl_sysfs_ldev_fec_mon_delete(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	sl_log_dbg(ctrl_ldev, LOG_BLOCK, LOG_NAME, "fec mon delete (ldev = 0x%p)", ctrl_ldev);
+
+	kobject_put(&ctrl_ldev->fec_mon_kobj);
+}
@@ -0,0 +1,237 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/kobject.h>
+#include <linux/kernel.h>
+#include <linux/math64.h>
+
+#include <linux/hpe/sl/sl_media.h>
+
+#include "sl_log.h"
+#include "sl_sysfs.h"
+#include "sl_ctrl_ldev.h"
+#include "sl_media_ldev.h"
+#include "data/sl_media_data_jack_shift.h"
+
+#define LOG_BLOCK SL_LOG_BLOCK
+#define LOG_NAME  SL_LOG_SYSFS_LOG_NAME
+
+enum {
+	MEDIA_SHIFT_COUNT,
+	MEDIA_SHIFT_TIMEOUTS,
+	MEDIA_SHIFT_MS_LAST,
+	MEDIA_SHIFT_MS_MAX,
+	MEDIA_SHIFT_MS_AVG,
+};
+
+static ssize_t poll_ms_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_ldev *ctrl_ldev;
+
+	ctrl_ldev = container_of(kobj, struct sl_ctrl_ldev, media_shift_kobj);
+
+	sl_log_dbg(ctrl_ldev, LOG_BLOCK, LOG_NAME, "media shift poll ms show (poll_ms = %u)",
+		   SL_MEDIA_JACK_SHIFT_POLL_MS);
+
+	return scnprintf(buf, PAGE_SIZE, "%u\n", SL_MEDIA_JACK_SHIFT_POLL_MS);
+}
+
+static ssize_t stats_reset_store(struct kobject *kobj, struct kobj_attribute *kattr, const char *buf, size_t count)
+{
+	struct sl_ctrl_ldev *ctrl_ldev;
+	bool                 reset;
+	int                  rtn;
+
+	ctrl_ldev = container_of(kobj, struct sl_ctrl_ldev, media_shift_kobj);
+
+	rtn = kstrtobool(buf, &reset);
+	if (rtn) {
+		sl_log_err(ctrl_ldev, LOG_BLOCK, LOG_NAME, "media shift stats reset kstrtobool failed [%d]", rtn);
+		return count;
+	}
+
+	if (reset) {
+		rtn = sl_media_ldev_jack_shift_stats_clr(ctrl_ldev->num);
+		if (rtn) {
+			sl_log_err(ctrl_ldev, LOG_BLOCK, LOG_NAME, "media shift stats clr failed [%d]", rtn);
+			return rtn;
+		}
+	}
+
+	return count;
+}
+
+static struct kobj_attribute ldev_media_shift_poll_ms     = __ATTR_RO(poll_ms);
+static struct kobj_attribute ldev_media_shift_stats_reset = __ATTR_WO(stats_reset);
+
+static struct attribute *ldev_media_shift_attrs[] = {
+	&ldev_media_shift_poll_ms.attr,
+	&ldev_media_shift_stats_reset.attr,
+	NULL,
+};
+ATTRIBUTE_GROUPS(ldev_media_shift);
+
+static struct kobj_type ldev_media_shift_info = {
+	.sysfs_ops      = &kobj_sysfs_ops,
+	.default_groups = ldev_media_shift_groups,
+};
+
+static ssize_t media_shift_show(struct kobject *kobj, char *buf, u32 step, u32 field)
+{
+	struct sl_ctrl_ldev_media_shift_vendor_kobj *vendor_kobj;
+	struct sl_media_jack_shift_stats             stats;
+	int                                          rtn;
+	u64                                          value;
+
+	vendor_kobj = container_of(kobj, struct sl_ctrl_ldev_media_shift_vendor_kobj, kobj);
+
+	rtn = sl_media_ldev_jack_shift_stats_get(vendor_kobj->ctrl_ldev->num, vendor_kobj->vendor, step, &stats);
+	if (rtn)
+		return scnprintf(buf, PAGE_SIZE, "error\n");
+
+	switch (field) {
+	case MEDIA_SHIFT_COUNT:
+		value = stats.count;
+		break;
+	case MEDIA_SHIFT_TIMEOUTS:
+		value = stats.timeouts;
+		break;
+	case MEDIA_SHIFT_MS_LAST:
+		value = stats.ms_last;
+		break;
+	case MEDIA_SHIFT_MS_MAX:
+		value = stats.ms_max;
+		break;
+	case MEDIA_SHIFT_MS_AVG:
+		value = stats.count ? div_u64(stats.ms_sum, stats.count) : 0;
+		break;
+	default:
+		return scnprintf(buf, PAGE_SIZE, "error\n");
+	}
+
+	sl_log_dbg(vendor_kobj->ctrl_ldev, LOG_BLOCK, LOG_NAME,
+		   "media shift show (vendor = %s, step = %s, field = %u, value = %llu)",
+		   sl_media_vendor_str(vendor_kobj->vendor), sl_media_jack_shift_step_str(step), field, value);
+
+	return scnprintf(buf, PAGE_SIZE, "%llu\n", value);
+}
+
+#define media_shift(_name, _step)                                                                           \
+	static ssize_t _name##_count_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)    \
+	{                                                                                                   \
+		return media_shift_show(kobj, buf, (_step), MEDIA_SHIFT_COUNT);                             \
+	}                                                                                                   \
+	static ssize_t _name##_timeouts_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf) \
+	{                                                                                                   \
+		return media_shift_show(kobj, buf, (_step), MEDIA_SHIFT_TIMEOUTS);                          \
+	}                                                                                                   \
+	static ssize_t _name##_ms_last_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)  \
+	{                                                                                                   \
+		return media_shift_show(kobj, buf, (_step), MEDIA_SHIFT_MS_LAST);                           \
+	}                                                                                                   \
+	static ssize_t _name##_ms_max_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)   \
+	{                                                                                                   \
+		return media_shift_show(kobj, buf, (_step), MEDIA_SHIFT_MS_MAX);                            \
+	}                                                                                                   \
+	static ssize_t _name##_ms_avg_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)   \
+	{                                                                                                   \
+		return media_shift_show(kobj, buf, (_step), MEDIA_SHIFT_MS_AVG);                            \
+	}                                                                                                   \
+	static struct kobj_attribute _name##_count    = __ATTR_RO(_name##_count);                           \
+	static struct kobj_attribute _name##_timeouts = __ATTR_RO(_name##_timeouts);                        \
+	static struct kobj_attribute _name##_ms_last  = __ATTR_RO(_name##_ms_last);                         \
+	static struct kobj_attribute _name##_ms_max   = __ATTR_RO(_name##_ms_max);                          \
+	static struct kobj_attribute _name##_ms_avg   = __ATTR_RO(_name##_ms_avg)
+
+media_shift(deinit,     SL_MEDIA_JACK_SHIFT_STEP_DEINIT);
+media_shift(low_power,  SL_MEDIA_JACK_SHIFT_STEP_LOW_POWER);
+media_shift(apply,      SL_MEDIA_JACK_SHIFT_STEP_APPLY);
+media_shift(high_power, SL_MEDIA_JACK_SHIFT_STEP_HIGH_POWER);
+media_shift(reinit,     SL_MEDIA_JACK_SHIFT_STEP_REINIT);
+
+static struct attribute *ldev_media_shift_vendor_attrs[] = {
+	&deinit_count.attr,
+	&deinit_timeouts.attr,
+	&deinit_ms_last.attr,
+	&deinit_ms_max.attr,
+	&deinit_ms_avg.attr,
+	&low_power_count.attr,
+	&low_power_timeouts.attr,
+	&low_power_ms_last.attr,
+	&low_power_ms_max.attr,
+	&low_power_ms_avg.attr,
+	&apply_count.attr,
+	&apply_timeouts.attr,
+	&apply_ms_last.attr,
+	&apply_ms_max.attr,
+	&apply_ms_avg.attr,
+	&high_power_count.attr,
+	&high_power_timeouts.attr,
+	&high_power_ms_last.attr,
+	&high_power_ms_max.attr,
+	&high_power_ms_avg.attr,
+	&reinit_count.attr,
+	&reinit_timeouts.attr,
+	&reinit_ms_last.attr,
+	&reinit_ms_max.attr,
+	&reinit_ms_avg.attr,
+	NULL,
+};
+ATTRIBUTE_GROUPS(ldev_media_shift_vendor);
+
+static struct kobj_type ldev_media_shift_vendor_info = {
+	.sysfs_ops      = &kobj_sysfs_ops,
+	.default_groups = ldev_media_shift_vendor_groups,
+};
+
+static void sl_sysfs_ldev_media_shift_vendors_delete(struct sl_ctrl_ldev *ctrl_ldev, u32 vendor_end)
+{
+	u32 vendor;
+
+	for (vendor = SL_MEDIA_VENDOR_TE; vendor < vendor_end; ++vendor)
+		kobject_put(&ctrl_ldev->media_shift_vendors_kobj[vendor].kobj);
+}
+
+int sl_sysfs_ldev_media_shift_create(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	int rtn;
+	u32 vendor;
+
+	sl_log_dbg(ctrl_ldev, LOG_BLOCK, LOG_NAME, "media shift create (ldev = 0x%p)", ctrl_ldev);
+
+	rtn = kobject_init_and_add(&ctrl_ldev->media_shift_kobj, &ldev_media_shift_info,
+				   &ctrl_ldev->sl_info_kobj, "media_shift");
+	if (rtn) {
+		sl_log_err(ctrl_ldev, LOG_BLOCK, LOG_NAME,
+			   "media shift create kobject_init_and_add failed [%d]", rtn);
+		kobject_put(&ctrl_ldev->media_shift_kobj);
+		return -ENOMEM;
+	}
+
+	for (vendor = SL_MEDIA_VENDOR_TE; vendor < SL_MEDIA_JACK_SHIFT_VENDORS_NUM; ++vendor) {
+		ctrl_ldev->media_shift_vendors_kobj[vendor].ctrl_ldev = ctrl_ldev;
+		ctrl_ldev->media_shift_vendors_kobj[vendor].vendor    = vendor;
+		rtn = kobject_init_and_add(&ctrl_ldev->media_shift_vendors_kobj[vendor].kobj,
+					   &ldev_media_shift_vendor_info, &ctrl_ldev->media_shift_kobj,
+					   sl_media_vendor_str(vendor));
+		if (rtn) {
+			sl_log_err(ctrl_ldev, LOG_BLOCK, LOG_NAME,
+				   "media shift vendor create failed (vendor = %u %s) [%d]",
+				   vendor, sl_media_vendor_str(vendor), rtn);
+			kobject_put(&ctrl_ldev->media_shift_vendors_kobj[vendor].kobj);
+			sl_sysfs_ldev_media_shift_vendors_delete(ctrl_ldev, vendor);
+			kobject_put(&ctrl_ldev->media_shift_kobj);
+			return -ENOMEM;
+		}
+	}
+
+	return 0;
+}
+
+void sl_sysfs_ldev_media_shift_delete(struct sl_ctrl_ldev *ctrl_ldev)
+{
+	sl_log_dbg(ctrl_ldev, LOG_BLOCK, LOG_NAME, "media shift delete (ldev = 0x%p)", ctrl_ldev);
+
+	sl_sysfs_ldev_media_shift_vendors_delete(ctrl_ldev, SL_MEDIA_JACK_SHIFT_VENDORS_NUM);
+	kobject_put(&ctrl_ldev->media_shift_kobj);
+}
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/kobject.h>
 
@@ -51,6 +51,24 @@ int sl_sysfs_lgrp_create(struct sl_ctrl_lgrp *ctrl_lgrp)
 		return -ENOMEM;
 	}
 
+	rtn = sl_sysfs_lgrp_notif_create(ctrl_lgrp);
+	if (rtn) {
+		sl_log_err(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "notif create failed [%d]", rtn);
+		return -ENOMEM;
+	}
+
+	rtn = sl_sysfs_lgrp_link_up_phase_create(ctrl_lgrp);
+	if (rtn) {
+		sl_log_err(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "link up phase create failed [%d]", rtn);
+		return -ENOMEM;
+	}
+
+	rtn = sl_sysfs_lgrp_workq_create(ctrl_lgrp);
+	if (rtn) {
+		sl_log_err(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "workq create failed [%d]", rtn);
+		return -ENOMEM;
+	}
+
 	rtn = sl_sysfs_pmi_create(ctrl_lgrp);
 	if (rtn) {
 		sl_log_err(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "pmi create failed [%d]", rtn);
@@ -82,6 +100,9 @@ void sl_sysfs_lgrp_delete(struct sl_ctrl_lgrp *ctrl_lgrp)
 	sl_sysfs_sbus_pmi_delete(ctrl_lgrp);
 	sl_sysfs_sbus_delete(ctrl_lgrp);
 	sl_sysfs_pmi_delete(ctrl_lgrp);
+	sl_sysfs_lgrp_workq_delete(ctrl_lgrp);
+	sl_sysfs_lgrp_link_up_phase_delete(ctrl_lgrp);
+	sl_sysfs_lgrp_notif_delete(ctrl_lgrp);
 	sl_sysfs_media_delete(ctrl_lgrp);
 	sl_sysfs_serdes_delete(ctrl_lgrp);
 	sl_sysfs_lgrp_policy_delete(ctrl_lgrp);
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/kobject.h>
+#include <linux/kernel.h>
+
+#include "sl_log.h"
+#include "sl_sysfs.h"
+#include "sl_ctrl_lgrp.h"
+#include "sl_ctrl_ldev.h"
+#include "sl_core_lgrp.h"
+#include "sl_core_str.h"
+#include "data/sl_core_data_lgrp.h"
+
+#define LOG_BLOCK SL_LOG_BLOCK
+#define LOG_NAME  SL_LOG_SYSFS_LOG_NAME
+
+static ssize_t link_up_phase_hist_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf, u32 phase)
+{
+	struct sl_ctrl_lgrp *ctrl_lgrp;
+	struct sl_core_lgrp *core_lgrp;
+	u32                  buckets[SL_CORE_LINK_UP_HIST_NUM_BUCKETS];
+	int                  rtn;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, link_up_phase_kobj);
+	core_lgrp = sl_core_lgrp_get(ctrl_lgrp->ctrl_ldev->num, ctrl_lgrp->num);
+
+	rtn = sl_core_data_lgrp_link_up_hist_get(core_lgrp, phase, buckets);
+	if (rtn)
+		return scnprintf(buf, PAGE_SIZE, "error\n");
+
+	sl_log_dbg(core_lgrp, LOG_BLOCK, LOG_NAME, "link up phase hist show (phase = %s)",
+		   sl_core_link_up_phase_str(phase));
+
+	return sl_sysfs_link_up_hist_show(buf, buckets);
+}
+
+#define lgrp_link_up_phase(_name, _phase)                                                                       \
+	static inline ssize_t _name##_hist_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf) \
+	{                                                                                                       \
+		return link_up_phase_hist_show(kobj, kattr, buf, (_phase));                                     \
+	}                                                                                                       \
+	static struct kobj_attribute lgrp_link_up_phase_##_name##_hist = __ATTR_RO(_name##_hist)
+
+lgrp_link_up_phase(an,         SL_CORE_LINK_UP_PHASE_AN);
+lgrp_link_up_phase(start,      SL_CORE_LINK_UP_PHASE_START);
+lgrp_link_up_phase(media,      SL_CORE_LINK_UP_PHASE_MEDIA);
+lgrp_link_up_phase(serdes,     SL_CORE_LINK_UP_PHASE_SERDES);
+lgrp_link_up_phase(pcs_lock,   SL_CORE_LINK_UP_PHASE_PCS_LOCK);
+lgrp_link_up_phase(up_check,   SL_CORE_LINK_UP_PHASE_UP_CHECK);
+lgrp_link_up_phase(fec_settle, SL_CORE_LINK_UP_PHASE_FEC_SETTLE);
+lgrp_link_up_phase(fec_check,  SL_CORE_LINK_UP_PHASE_FEC_CHECK);
+
+static ssize_t hist_reset_store(struct kobject *kobj, struct kobj_attribute *kattr, const char *buf, size_t count)
+{
+	struct sl_ctrl_lgrp *ctrl_lgrp;
+	struct sl_core_lgrp *core_lgrp;
+	bool                 reset;
+	int                  rtn;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, link_up_phase_kobj);
+	core_lgrp = sl_core_lgrp_get(ctrl_lgrp->ctrl_ldev->num, ctrl_lgrp->num);
+
+	rtn = kstrtobool(buf, &reset);
+	if (rtn) {
+		sl_log_err(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "link up phase hist reset kstrtobool failed [%d]", rtn);
+		return count;
+	}
+
+	if (reset)
+		sl_core_data_lgrp_link_up_hist_clr(core_lgrp);
+
+	return count;
+}
+
+static struct kobj_attribute lgrp_link_up_phase_hist_reset = __ATTR_WO(hist_reset);
+
+static struct attribute *lgrp_link_up_phase_attrs[] = {
+	&lgrp_link_up_phase_an_hist.attr,
+	&lgrp_link_up_phase_start_hist.attr,
+	&lgrp_link_up_phase_media_hist.attr,
+	&lgrp_link_up_phase_serdes_hist.attr,
+	&lgrp_link_up_phase_pcs_lock_hist.attr,
+	&lgrp_link_up_phase_up_check_hist.attr,
+	&lgrp_link_up_phase_fec_settle_hist.attr,
+	&lgrp_link_up_phase_fec_check_hist.attr,
+	&lgrp_link_up_phase_hist_reset.attr,
+	NULL,
+};
+ATTRIBUTE_GROUPS(lgrp_link_up_phase);
+
+static struct kobj_type lgrp_link_up_phase_info = {
+	.sysfs_ops      = &kobj_sysfs_ops,
+	.default_groups = lgrp_link_up_phase_groups,
+};
+
+int sl_sysfs_lgrp_link_up_phase_create(struct sl_ctrl_lgrp *ctrl_lgrp)
+{
+	int rtn;
+
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "link up phase create (lgrp = 0x%p)", ctrl_lgrp);
+
+	if (!ctrl_lgrp->parent_kobj) {
+		sl_log_err(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "link up phase create missing parent");
+		return -EBADRQC;
+	}
+
+	rtn = kobject_init_and_add(&ctrl_lgrp->link_up_phase_kobj, &lgrp_link_up_phase_info,
+				   ctrl_lgrp->parent_kobj, "link_up_phase");
+	if (rtn) {
+		sl_log_err(ctrl_lgrp, LOG_BLOCK, LOG_NAME,
+			   "link up phase create kobject_init_and_add failed [%d]", rtn);
+		kobject_put(&ctrl_lgrp->link_up_phase_kobj);
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+
+void sl_sysfs_lgrp_link_up_phase_delete(struct sl_ctrl_lgrp *ctrl_lgrp)
+{
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "link up phase delete (lgrp = 0x%p)", ctrl_lgrp);
+
+	if (!ctrl_lgrp->parent_kobj)
+		return;
+
+	kobject_put(&ctrl_lgrp->link_up_phase_kobj);
+}
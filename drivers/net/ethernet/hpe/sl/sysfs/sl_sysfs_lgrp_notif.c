@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/kobject.h>
+
+#include "sl_log.h"
+#include "sl_sysfs.h"
+#include "sl_ctrl_lgrp.h"
+#include "sl_ctrl_lgrp_notif.h"
+
+#define LOG_BLOCK SL_LOG_BLOCK
+#define LOG_NAME  SL_LOG_SYSFS_LOG_NAME
+
+static ssize_t depth_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_lgrp             *ctrl_lgrp;
+	struct sl_ctrl_lgrp_notif_stats  stats;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, notif_kobj);
+
+	sl_ctrl_lgrp_notif_stats_get(ctrl_lgrp, &stats);
+
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "notif depth show (depth = %u)", stats.depth);
+
+	return scnprintf(buf, PAGE_SIZE, "%u\n", stats.depth);
+}
+
+static ssize_t count_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_lgrp             *ctrl_lgrp;
+	struct sl_ctrl_lgrp_notif_stats  stats;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, notif_kobj);
+
+	sl_ctrl_lgrp_notif_stats_get(ctrl_lgrp, &stats);
+
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "notif count show (count = %u)", stats.count);
+
+	return scnprintf(buf, PAGE_SIZE, "%u\n", stats.count);
+}
+
+static ssize_t high_watermark_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_lgrp             *ctrl_lgrp;
+	struct sl_ctrl_lgrp_notif_stats  stats;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, notif_kobj);
+
+	sl_ctrl_lgrp_notif_stats_get(ctrl_lgrp, &stats);
+
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME,
+		   "notif high watermark show (high_watermark = %u)", stats.high_watermark);
+
+	return scnprintf(buf, PAGE_SIZE, "%u\n", stats.high_watermark);
+}
+
+static ssize_t sl_sysfs_lgrp_notif_type_cntrs_show(char *buf, u64 *cntrs)
+{
+	int    x;
+	size_t len;
+
+	len = 0;
+	for (x = 0; x < SL_CTRL_LGRP_NOTIF_TYPE_COUNT; ++x) {
+		if (!cntrs[x])
+			continue;
+		len += scnprintf(buf + len, PAGE_SIZE - len, "%s %llu\n",
+				 sl_lgrp_notif_str(BIT(x)), cntrs[x]);
+	}
+
+	return len;
+}
+
+static ssize_t dropped_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_lgrp             *ctrl_lgrp;
+	struct sl_ctrl_lgrp_notif_stats  stats;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, notif_kobj);
+
+	sl_ctrl_lgrp_notif_stats_get(ctrl_lgrp, &stats);
+
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "notif dropped show");
+
+	return sl_sysfs_lgrp_notif_type_cntrs_show(buf, stats.dropped);
+}
+
+static ssize_t coalesced_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_lgrp             *ctrl_lgrp;
+	struct sl_ctrl_lgrp_notif_stats  stats;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, notif_kobj);
+
+	sl_ctrl_lgrp_notif_stats_get(ctrl_lgrp, &stats);
+
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "notif coalesced show");
+
+	return sl_sysfs_lgrp_notif_type_cntrs_show(buf, stats.coalesced);
+}
+
+static struct kobj_attribute notif_depth          = __ATTR_RO(depth);
+static struct kobj_attribute notif_count          = __ATTR_RO(count);
+static struct kobj_attribute notif_high_watermark = __ATTR_RO(high_watermark);
+static struct kobj_attribute notif_dropped        = __ATTR_RO(dropped);
+static struct kobj_attribute notif_coalesced      = __ATTR_RO(coalesced);
+
+static struct attribute *notif_attrs[] = {
+	&notif_depth.attr,
+	&notif_count.attr,
+	&notif_high_watermark.attr,
+	&notif_dropped.attr,
+	&notif_coalesced.attr,
+	NULL,
+};
+ATTRIBUTE_GROUPS(notif);
+
+static struct kobj_type notif_info = {
+	.sysfs_ops      = &kobj_sysfs_ops,
+	.default_groups = notif_groups,
+};
+
+int sl_sysfs_lgrp_notif_create(struct sl_ctrl_lgrp *ctrl_lgrp)
+{
+	int rtn;
+
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "notif create (lgrp = 0x%p)", ctrl_lgrp);
+
+	if (!ctrl_lgrp->parent_kobj) {
+		sl_log_err(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "notif create missing parent");
+		return -EBADRQC;
+	}
+
+	rtn = kobject_init_and_add(&ctrl_lgrp->notif_kobj, &notif_info, ctrl_lgrp->parent_kobj, "notif");
+	if (rtn) {
+		sl_log_err(ctrl_lgrp, LOG_BLOCK, LOG_NAME,
+			   "notif create kobject_init_and_add failed [%d]", rtn);
+		kobject_put(&ctrl_lgrp->notif_kobj);
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+
+void sl_sysfs_lgrp_notif_delete(struct sl_ctrl_lgrp *ctrl_lgrp)
+{
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "notif delete (lgrp = 0x%p)", ctrl_lgrp);
+
+	if (!ctrl_lgrp->parent_kobj)
+		return;
+
+	kobject_put(&ctrl_lgrp->notif_kobj);
+}
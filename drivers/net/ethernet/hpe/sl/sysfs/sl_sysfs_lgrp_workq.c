@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/kobject.h>
+#include <linux/kernel.h>
+#include <linux/cpumask.h>
+#include <linux/math64.h>
+
+#include "sl_log.h"
+#include "sl_sysfs.h"
+#include "sl_ctrl_lgrp.h"
+#include "base/sl_core_workq.h"
+
+#define LOG_BLOCK SL_LOG_BLOCK
+#define LOG_NAME  SL_LOG_SYSFS_LOG_NAME
+
+static ssize_t shard_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_lgrp *ctrl_lgrp;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, workq_kobj);
+
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "workq shard show (shard = %u)",
+		   ctrl_lgrp->core_workq->num);
+
+	return scnprintf(buf, PAGE_SIZE, "%u\n", ctrl_lgrp->core_workq->num);
+}
+
+static ssize_t lgrps_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_lgrp *ctrl_lgrp;
+	u32                  first;
+	u32                  last;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, workq_kobj);
+
+	first = ctrl_lgrp->core_workq->num * SL_CORE_WORKQ_LGRPS_PER_SHARD;
+	last  = min(first + SL_CORE_WORKQ_LGRPS_PER_SHARD, (u32)SL_ASIC_MAX_LGRPS) - 1;
+
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "workq lgrps show (first = %u, last = %u)", first, last);
+
+	if (first == last)
+		return scnprintf(buf, PAGE_SIZE, "%u\n", first);
+
+	return scnprintf(buf, PAGE_SIZE, "%u-%u\n", first, last);
+}
+
+static ssize_t cpumask_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_lgrp *ctrl_lgrp;
+	cpumask_var_t        cpumask;
+	ssize_t              len;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, workq_kobj);
+
+	if (!zalloc_cpumask_var(&cpumask, GFP_KERNEL))
+		return -ENOMEM;
+
+	sl_core_workq_cpumask_get(ctrl_lgrp->core_workq, cpumask);
+
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "workq cpumask show (cpumask = %*pbl)",
+		   cpumask_pr_args(cpumask));
+
+	len = scnprintf(buf, PAGE_SIZE, "%*pbl\n", cpumask_pr_args(cpumask));
+
+	free_cpumask_var(cpumask);
+
+	return len;
+}
+
+static ssize_t cpumask_store(struct kobject *kobj, struct kobj_attribute *kattr, const char *buf, size_t count)
+{
+	struct sl_ctrl_lgrp *ctrl_lgrp;
+	cpumask_var_t        cpumask;
+	int                  rtn;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, workq_kobj);
+
+	if (!zalloc_cpumask_var(&cpumask, GFP_KERNEL))
+		return -ENOMEM;
+
+	/* empty list clears the affinity */
+	rtn = cpulist_parse(buf, cpumask);
+	if (rtn) {
+		sl_log_err(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "workq cpumask cpulist_parse failed [%d]", rtn);
+		rtn = count;
+		goto out;
+	}
+
+	rtn = sl_core_workq_cpumask_set(ctrl_lgrp->core_workq, cpumask);
+	if (rtn) {
+		sl_log_err(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "workq cpumask set failed [%d]", rtn);
+		goto out;
+	}
+
+	rtn = count;
+
+out:
+	free_cpumask_var(cpumask);
+
+	return rtn;
+}
+
+static ssize_t numa_node_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_lgrp *ctrl_lgrp;
+	int                  numa_node;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, workq_kobj);
+
+	numa_node = sl_core_workq_numa_node_get(ctrl_lgrp->core_workq);
+
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "workq numa node show (numa_node = %d)", numa_node);
+
+	return scnprintf(buf, PAGE_SIZE, "%d\n", numa_node);
+}
+
+static ssize_t numa_node_store(struct kobject *kobj, struct kobj_attribute *kattr, const char *buf, size_t count)
+{
+	struct sl_ctrl_lgrp *ctrl_lgrp;
+	int                  numa_node;
+	int                  rtn;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, workq_kobj);
+
+	rtn = kstrtoint(buf, 0, &numa_node);
+	if (rtn) {
+		sl_log_err(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "workq numa node kstrtoint failed [%d]", rtn);
+		return count;
+	}
+
+	rtn = sl_core_workq_numa_node_set(ctrl_lgrp->core_workq, numa_node);
+	if (rtn) {
+		sl_log_err(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "workq numa node set failed [%d]", rtn);
+		return rtn;
+	}
+
+	return count;
+}
+
+#define lgrp_workq_stat(_name, _expr)                                                                          \
+	static ssize_t _name##_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)             \
+	{                                                                                                      \
+		struct sl_ctrl_lgrp        *ctrl_lgrp;                                                         \
+		struct sl_core_workq_stats  stats;                                                             \
+		u64                         val;                                                               \
+		                                                                                               \
+		ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, workq_kobj);                               \
+		sl_core_workq_stats_get(ctrl_lgrp->core_workq, &stats);                                        \
+		val = (_expr);                                                                                 \
+		sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "workq " #_name " show (" #_name " = %llu)", val); \
+		return scnprintf(buf, PAGE_SIZE, "%llu\n", val);                                               \
+	}                                                                                                      \
+	static struct kobj_attribute lgrp_workq_##_name = __ATTR_RO(_name)
+
+lgrp_workq_stat(queued,     stats.queued);
+lgrp_workq_stat(busy,       stats.busy);
+lgrp_workq_stat(run,        stats.run);
+lgrp_workq_stat(depth,      stats.depth);
+lgrp_workq_stat(depth_max,  stats.depth_max);
+lgrp_workq_stat(lat_avg_us, stats.run ? div64_u64(stats.lat_sum_ns, stats.run * NSEC_PER_USEC) : 0);
+lgrp_workq_stat(lat_max_us, div64_u64(stats.lat_max_ns, NSEC_PER_USEC));
+lgrp_workq_stat(run_avg_us, stats.run ? div64_u64(stats.run_sum_ns, stats.run * NSEC_PER_USEC) : 0);
+lgrp_workq_stat(run_max_us, div64_u64(stats.run_max_ns, NSEC_PER_USEC));
+
+static ssize_t stats_reset_store(struct kobject *kobj, struct kobj_attribute *kattr, const char *buf, size_t count)
+{
+	struct sl_ctrl_lgrp *ctrl_lgrp;
+	bool                 reset;
+	int                  rtn;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, workq_kobj);
+
+	rtn = kstrtobool(buf, &reset);
+	if (rtn) {
+		sl_log_err(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "workq stats reset kstrtobool failed [%d]", rtn);
+		return count;
+	}
+
+	if (reset)
+		sl_core_workq_stats_clr(ctrl_lgrp->core_workq);
+
+	return count;
+}
+
+static struct kobj_attribute lgrp_workq_shard       = __ATTR_RO(shard);
+static struct kobj_attribute lgrp_workq_lgrps       = __ATTR_RO(lgrps);
+static struct kobj_attribute lgrp_workq_cpumask     = __ATTR_RW(cpumask);
+static struct kobj_attribute lgrp_workq_numa_node   = __ATTR_RW(numa_node);
+static struct kobj_attribute lgrp_workq_stats_reset = __ATTR_WO(stats_reset);
+
+static struct attribute *lgrp_workq_attrs[] = {
+	&lgrp_workq_shard.attr,
+	&lgrp_workq_lgrps.attr,
+	&lgrp_workq_cpumask.attr,
+	&lgrp_workq_numa_node.attr,
+	&lgrp_workq_queued.attr,
+	&lgrp_workq_busy.attr,
+	&lgrp_workq_run.attr,
+	&lgrp_workq_depth.attr,
+	&lgrp_workq_depth_max.attr,
+	&lgrp_workq_lat_avg_us.attr,
+	&lgrp_workq_lat_max_us.attr,
+	&lgrp_workq_run_avg_us.attr,
+	&lgrp_workq_run_max_us.attr,
+	&lgrp_workq_stats_reset.attr,
+	NULL,
+};
+ATTRIBUTE_GROUPS(lgrp_workq);
+
+static struct kobj_type lgrp_workq_info = {
+	.sysfs_ops      = &kobj_sysfs_ops,
+	.default_groups = lgrp_workq_groups,
+};
+
+int sl_sysfs_lgrp_workq_create(struct sl_ctrl_lgrp *ctrl_lgrp)
+{
+	int rtn;
+
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "workq create (lgrp = 0x%p)", ctrl_lgrp);
+
+	if (!ctrl_lgrp->parent_kobj) {
+		sl_log_err(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "workq create missing parent");
+		return -EBADRQC;
+	}
+
+	rtn = kobject_init_and_add(&ctrl_lgrp->workq_kobj, &lgrp_workq_info,
+				   ctrl_lgrp->parent_kobj, "workq");
+	if (rtn) {
+		sl_log_err(ctrl_lgrp, LOG_BLOCK, LOG_NAME,
+			   "workq create kobject_init_and_add failed [%d]", rtn);
+		kobject_put(&ctrl_lgrp->workq_kobj);
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+
+void sl_sysfs_lgrp_workq_delete(struct sl_ctrl_lgrp *ctrl_lgrp)
+{
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "workq delete (lgrp = 0x%p)", ctrl_lgrp);
+
+	if (!ctrl_lgrp->parent_kobj)
+		return;
+
+	kobject_put(&ctrl_lgrp->workq_kobj);
+}
@@ -787,6 +787,40 @@ int sl_sysfs_link_create(struct sl_ctrl_link *ctrl_link)
 		return rtn;
 	}
 
+	rtn = sl_sysfs_link_up_phase_create(core_link, &ctrl_link->kobj);
+	if (rtn) {
+		sl_log_err(ctrl_link, LOG_BLOCK, LOG_NAME,
+			   "sl_sysfs_link_up_phase_create failed [%d]", rtn);
+		sl_sysfs_link_policy_delete(ctrl_link);
+		sl_sysfs_link_config_delete(ctrl_link);
+		sl_sysfs_link_degrade_delete(core_link);
+		sl_sysfs_link_pml_rec_delete(core_link);
+		sl_sysfs_link_fec_delete(ctrl_link);
+		sl_sysfs_link_caps_delete(ctrl_link);
+		sl_sysfs_link_counters_delete(ctrl_link);
+		sl_sysfs_link_last_down_delete(ctrl_link);
+		sl_sysfs_link_last_up_fail_delete(ctrl_link);
+		kobject_put(&ctrl_link->kobj);
+		return rtn;
+	}
+
+	rtn = sl_sysfs_link_intr_create(core_link, &ctrl_link->kobj);
+	if (rtn) {
+		sl_log_err(ctrl_link, LOG_BLOCK, LOG_NAME,
+			   "sl_sysfs_link_intr_create failed [%d]", rtn);
+		sl_sysfs_link_policy_delete(ctrl_link);
+		sl_sysfs_link_config_delete(ctrl_link);
+		sl_sysfs_link_degrade_delete(core_link);
+		sl_sysfs_link_pml_rec_delete(core_link);
+		sl_sysfs_link_fec_delete(ctrl_link);
+		sl_sysfs_link_caps_delete(ctrl_link);
+		sl_sysfs_link_counters_delete(ctrl_link);
+		sl_sysfs_link_last_down_delete(ctrl_link);
+		sl_sysfs_link_last_up_fail_delete(ctrl_link);
+		sl_sysfs_link_up_phase_delete(core_link);
+		kobject_put(&ctrl_link->kobj);
+		return rtn;
+	}
 
 	sl_log_dbg(ctrl_link, LOG_BLOCK, LOG_NAME,
 		   "link create (link_kobj = 0x%p)", &ctrl_link->kobj);
@@ -815,5 +849,7 @@ void sl_sysfs_link_delete(struct sl_ctrl_link *ctrl_link)
 	sl_sysfs_link_counters_delete(ctrl_link);
 	sl_sysfs_link_last_down_delete(ctrl_link);
 	sl_sysfs_link_last_up_fail_delete(ctrl_link);
+	sl_sysfs_link_up_phase_delete(core_link);
+	sl_sysfs_link_intr_delete(core_link);
 	kobject_put(&ctrl_link->kobj);
 }
@@ -87,14 +87,105 @@ static ssize_t gcw_show(struct kobject *kobj, struct kobj_attribute *kattr, char
 	return scnprintf(buf, PAGE_SIZE, "%llu\n", gcw);
 }
 
+static ssize_t snapshot_max_age_ms_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_core_link *core_link;
+	u32                  max_age_ms;
+
+	core_link = container_of(kobj, struct sl_core_link, fec.current_kobj);
+
+	max_age_ms = sl_core_link_fec_snapshot_max_age_ms_get(core_link);
+
+	sl_log_dbg(core_link, LOG_BLOCK, LOG_NAME,
+		   "snapshot max age ms show (max_age_ms = %u)", max_age_ms);
+
+	return scnprintf(buf, PAGE_SIZE, "%u\n", max_age_ms);
+}
+
+static ssize_t snapshot_max_age_ms_store(struct kobject *kobj, struct kobj_attribute *kattr,
+					 const char *buf, size_t count)
+{
+	int                  rtn;
+	struct sl_core_link *core_link;
+	u32                  max_age_ms;
+
+	core_link = container_of(kobj, struct sl_core_link, fec.current_kobj);
+
+	rtn = kstrtou32(buf, 0, &max_age_ms);
+	if (rtn) {
+		sl_log_dbg(core_link, LOG_BLOCK, LOG_NAME,
+			   "snapshot max age ms store failed [%d]", rtn);
+		return count;
+	}
+
+	sl_log_dbg(core_link, LOG_BLOCK, LOG_NAME,
+		   "snapshot max age ms store (max_age_ms = %u)", max_age_ms);
+
+	sl_core_link_fec_snapshot_max_age_ms_set(core_link, max_age_ms);
+
+	return count;
+}
+
+static ssize_t snapshot_age_ms_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_core_link *core_link;
+	s64                  age_ms;
+	u64                  refresh_count;
+	u64                  hit_count;
+
+	core_link = container_of(kobj, struct sl_core_link, fec.current_kobj);
+
+	sl_core_link_fec_snapshot_stats_get(core_link, &age_ms, &refresh_count, &hit_count);
+	if (age_ms < 0)
+		return scnprintf(buf, PAGE_SIZE, "none\n");
+
+	return scnprintf(buf, PAGE_SIZE, "%lld\n", age_ms);
+}
+
+static ssize_t snapshot_refresh_count_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_core_link *core_link;
+	s64                  age_ms;
+	u64                  refresh_count;
+	u64                  hit_count;
+
+	core_link = container_of(kobj, struct sl_core_link, fec.current_kobj);
+
+	sl_core_link_fec_snapshot_stats_get(core_link, &age_ms, &refresh_count, &hit_count);
+
+	return scnprintf(buf, PAGE_SIZE, "%llu\n", refresh_count);
+}
+
+static ssize_t snapshot_hit_count_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_core_link *core_link;
+	s64                  age_ms;
+	u64                  refresh_count;
+	u64                  hit_count;
+
+	core_link = container_of(kobj, struct sl_core_link, fec.current_kobj);
+
+	sl_core_link_fec_snapshot_stats_get(core_link, &age_ms, &refresh_count, &hit_count);
+
+	return scnprintf(buf, PAGE_SIZE, "%llu\n", hit_count);
+}
+
 static struct kobj_attribute link_fec_ccw = __ATTR_RO(ccw);
 static struct kobj_attribute link_fec_ucw = __ATTR_RO(ucw);
 static struct kobj_attribute link_fec_gcw = __ATTR_RO(gcw);
+static struct kobj_attribute link_fec_snapshot_max_age_ms = __ATTR_RW(snapshot_max_age_ms);
+static struct kobj_attribute link_fec_snapshot_age_ms = __ATTR_RO(snapshot_age_ms);
+static struct kobj_attribute link_fec_snapshot_refresh_count = __ATTR_RO(snapshot_refresh_count);
+static struct kobj_attribute link_fec_snapshot_hit_count = __ATTR_RO(snapshot_hit_count);
 
 static struct attribute *link_fec_current_attrs[] = {
 	&link_fec_ccw.attr,
 	&link_fec_ucw.attr,
 	&link_fec_gcw.attr,
+	&link_fec_snapshot_max_age_ms.attr,
+	&link_fec_snapshot_age_ms.attr,
+	&link_fec_snapshot_refresh_count.attr,
+	&link_fec_snapshot_hit_count.attr,
 	NULL
 };
 ATTRIBUTE_GROUPS(link_fec_current);
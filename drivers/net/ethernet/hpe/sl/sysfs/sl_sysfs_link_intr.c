@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/kobject.h>
+#include <linux/kernel.h>
+#include <linux/types.h>
+
+#include "sl_log.h"
+#include "data/sl_core_data_link.h"
+
+#include "sl_sysfs.h"
+
+#define LOG_BLOCK SL_LOG_BLOCK
+#define LOG_NAME  SL_LOG_SYSFS_LOG_NAME
+
+static ssize_t link_intr_hist_show(char *buf, u32 *buckets)
+{
+	ssize_t size;
+	u32     bucket;
+
+	size = 0;
+	for (bucket = 0; bucket < SL_CORE_LINK_INTR_HIST_NUM_BUCKETS; ++bucket)
+		size += scnprintf(buf + size, PAGE_SIZE - size, "%u%s", buckets[bucket],
+				  (bucket == SL_CORE_LINK_INTR_HIST_NUM_BUCKETS - 1) ? "\n" : " ");
+
+	return size;
+}
+
+static ssize_t intr_count_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf, u32 intr_num)
+{
+	struct sl_core_link           *core_link;
+	struct sl_core_link_intr_hist  hist;
+	int                            rtn;
+
+	core_link = container_of(kobj, struct sl_core_link, intr_kobj);
+
+	rtn = sl_core_data_link_intr_hist_get(core_link, intr_num, &hist);
+	if (rtn)
+		return scnprintf(buf, PAGE_SIZE, "error\n");
+
+	sl_log_dbg(core_link, LOG_BLOCK, LOG_NAME, "intr count show (intr = %u, count = %llu)",
+		   intr_num, hist.count);
+
+	return scnprintf(buf, PAGE_SIZE, "%llu\n", hist.count);
+}
+
+static ssize_t intr_lat_hist_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf, u32 intr_num)
+{
+	struct sl_core_link           *core_link;
+	struct sl_core_link_intr_hist  hist;
+	int                            rtn;
+
+	core_link = container_of(kobj, struct sl_core_link, intr_kobj);
+
+	rtn = sl_core_data_link_intr_hist_get(core_link, intr_num, &hist);
+	if (rtn)
+		return scnprintf(buf, PAGE_SIZE, "error\n");
+
+	sl_log_dbg(core_link, LOG_BLOCK, LOG_NAME, "intr lat hist show (intr = %u)", intr_num);
+
+	return link_intr_hist_show(buf, hist.lat);
+}
+
+static ssize_t intr_run_hist_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf, u32 intr_num)
+{
+	struct sl_core_link           *core_link;
+	struct sl_core_link_intr_hist  hist;
+	int                            rtn;
+
+	core_link = container_of(kobj, struct sl_core_link, intr_kobj);
+
+	rtn = sl_core_data_link_intr_hist_get(core_link, intr_num, &hist);
+	if (rtn)
+		return scnprintf(buf, PAGE_SIZE, "error\n");
+
+	sl_log_dbg(core_link, LOG_BLOCK, LOG_NAME, "intr run hist show (intr = %u)", intr_num);
+
+	return link_intr_hist_show(buf, hist.run);
+}
+
+#define link_intr(_name, _intr_num)                                                                                  \
+	static inline ssize_t _name##_count_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)     \
+	{                                                                                                            \
+		return intr_count_show(kobj, kattr, buf, (_intr_num));                                               \
+	}                                                                                                            \
+	static inline ssize_t _name##_lat_hist_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)  \
+	{                                                                                                            \
+		return intr_lat_hist_show(kobj, kattr, buf, (_intr_num));                                            \
+	}                                                                                                            \
+	static inline ssize_t _name##_run_hist_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)  \
+	{                                                                                                            \
+		return intr_run_hist_show(kobj, kattr, buf, (_intr_num));                                            \
+	}                                                                                                            \
+	static struct kobj_attribute link_intr_##_name##_count    = __ATTR_RO(_name##_count);                        \
+	static struct kobj_attribute link_intr_##_name##_lat_hist = __ATTR_RO(_name##_lat_hist);                     \
+	static struct kobj_attribute link_intr_##_name##_run_hist = __ATTR_RO(_name##_run_hist)
+
+link_intr(link_up,            SL_CORE_HW_INTR_LINK_UP);
+link_intr(high_ser,           SL_CORE_HW_INTR_LINK_HIGH_SER);
+link_intr(llr_max_starvation, SL_CORE_HW_INTR_LINK_LLR_MAX_STARVATION);
+link_intr(llr_starved,        SL_CORE_HW_INTR_LINK_LLR_STARVED);
+link_intr(fault,              SL_CORE_HW_INTR_LINK_FAULT);
+link_intr(an_page_recv,       SL_CORE_HW_INTR_AN_PAGE_RECV);
+link_intr(lane_degrade,       SL_CORE_HW_INTR_LANE_DEGRADE);
+
+static ssize_t hist_reset_store(struct kobject *kobj, struct kobj_attribute *kattr, const char *buf, size_t count)
+{
+	struct sl_core_link *core_link;
+	bool                 reset;
+	int                  rtn;
+
+	core_link = container_of(kobj, struct sl_core_link, intr_kobj);
+
+	rtn = kstrtobool(buf, &reset);
+	if (rtn) {
+		sl_log_err(core_link, LOG_BLOCK, LOG_NAME, "intr hist reset kstrtobool failed [%d]", rtn);
+		return count;
+	}
+
+	if (reset)
+		sl_core_data_link_intr_hist_clr(core_link);
+
+	return count;
+}
+
+static struct kobj_attribute link_intr_hist_reset = __ATTR_WO(hist_reset);
+
+static struct attribute *link_intr_attrs[] = {
+	&link_intr_link_up_count.attr,
+	&link_intr_link_up_lat_hist.attr,
+	&link_intr_link_up_run_hist.attr,
+	&link_intr_high_ser_count.attr,
+	&link_intr_high_ser_lat_hist.attr,
+	&link_intr_high_ser_run_hist.attr,
+	&link_intr_llr_max_starvation_count.attr,
+	&link_intr_llr_max_starvation_lat_hist.attr,
+	&link_intr_llr_max_starvation_run_hist.attr,
+	&link_intr_llr_starved_count.attr,
+	&link_intr_llr_starved_lat_hist.attr,
+	&link_intr_llr_starved_run_hist.attr,
+	&link_intr_fault_count.attr,
+	&link_intr_fault_lat_hist.attr,
+	&link_intr_fault_run_hist.attr,
+	&link_intr_an_page_recv_count.attr,
+	&link_intr_an_page_recv_lat_hist.attr,
+	&link_intr_an_page_recv_run_hist.attr,
+	&link_intr_lane_degrade_count.attr,
+	&link_intr_lane_degrade_lat_hist.attr,
+	&link_intr_lane_degrade_run_hist.attr,
+	&link_intr_hist_reset.attr,
+	NULL
+};
+ATTRIBUTE_GROUPS(link_intr);
+
+static struct kobj_type link_intr = {
+	.sysfs_ops      = &kobj_sysfs_ops,
+	.default_groups = link_intr_groups,
+};
+
+int sl_sysfs_link_intr_create(struct sl_core_link *core_link, struct kobject *parent_kobj)
+{
+	int rtn;
+
+	sl_log_dbg(core_link, LOG_BLOCK, LOG_NAME, "link intr create (num = %u)", core_link->num);
+
+	rtn = kobject_init_and_add(&core_link->intr_kobj, &link_intr, parent_kobj, "intr");
+	if (rtn) {
+		sl_log_err(core_link, LOG_BLOCK, LOG_NAME,
+			   "link intr create kobject_init_and_add failed [%d]", rtn);
+		kobject_put(&core_link->intr_kobj);
+		return rtn;
+	}
+
+	return 0;
+}
+
+void sl_sysfs_link_intr_delete(struct sl_core_link *core_link)
+{
+	sl_log_dbg(core_link, LOG_BLOCK, LOG_NAME, "link intr delete (num = %u)", core_link->num);
+
+	kobject_put(&core_link->intr_kobj);
+}
@@ -3,6 +3,7 @@
 
 #include <linux/kobject.h>
 #include <linux/types.h>
+#include <linux/kernel.h>
 
 #include "sl_log.h"
 #include "data/sl_core_data_link.h"
@@ -134,6 +135,82 @@ static ssize_t pml_rec_rate_limit_exceeded_show(struct kobject *kobj, struct kob
 	return scnprintf(buf, PAGE_SIZE, "%d\n", rate_limit_exceeded);
 }
 
+static ssize_t link_pml_rec_hist_show(char *buf, u32 *buckets)
+{
+	ssize_t size;
+	u32     bucket;
+
+	size = 0;
+	for (bucket = 0; bucket < SL_CORE_LINK_PML_REC_HIST_NUM_BUCKETS; ++bucket)
+		size += scnprintf(buf + size, PAGE_SIZE - size, "%u%s", buckets[bucket],
+				  (bucket == SL_CORE_LINK_PML_REC_HIST_NUM_BUCKETS - 1) ? "\n" : " ");
+
+	return size;
+}
+
+static ssize_t pml_rec_hist_count_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_core_link              *core_link;
+	struct sl_core_link_pml_rec_hist  hist;
+
+	core_link = container_of(kobj, struct sl_core_link, pml_rec_kobj);
+
+	sl_core_data_link_pml_rec_hist_get(core_link, &hist);
+
+	sl_log_dbg(core_link, LOG_BLOCK, LOG_NAME, "pml rec hist count show (count = %llu)", hist.count);
+
+	return scnprintf(buf, PAGE_SIZE, "%llu\n", hist.count);
+}
+
+static ssize_t pml_rec_success_hist_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_core_link              *core_link;
+	struct sl_core_link_pml_rec_hist  hist;
+
+	core_link = container_of(kobj, struct sl_core_link, pml_rec_kobj);
+
+	sl_core_data_link_pml_rec_hist_get(core_link, &hist);
+
+	sl_log_dbg(core_link, LOG_BLOCK, LOG_NAME, "pml rec success hist show");
+
+	return link_pml_rec_hist_show(buf, hist.success);
+}
+
+static ssize_t pml_rec_fail_hist_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_core_link              *core_link;
+	struct sl_core_link_pml_rec_hist  hist;
+
+	core_link = container_of(kobj, struct sl_core_link, pml_rec_kobj);
+
+	sl_core_data_link_pml_rec_hist_get(core_link, &hist);
+
+	sl_log_dbg(core_link, LOG_BLOCK, LOG_NAME, "pml rec fail hist show");
+
+	return link_pml_rec_hist_show(buf, hist.fail);
+}
+
+static ssize_t pml_rec_hist_reset_store(struct kobject *kobj, struct kobj_attribute *kattr,
+					const char *buf, size_t count)
+{
+	struct sl_core_link *core_link;
+	bool                 reset;
+	int                  rtn;
+
+	core_link = container_of(kobj, struct sl_core_link, pml_rec_kobj);
+
+	rtn = kstrtobool(buf, &reset);
+	if (rtn) {
+		sl_log_err(core_link, LOG_BLOCK, LOG_NAME, "pml rec hist reset kstrtobool failed [%d]", rtn);
+		return count;
+	}
+
+	if (reset)
+		sl_core_data_link_pml_rec_hist_clr(core_link);
+
+	return count;
+}
+
 static struct kobj_attribute link_pml_rec_attempts                = __ATTR_RO(pml_rec_attempts);
 static struct kobj_attribute link_pml_rec_successes               = __ATTR_RO(pml_rec_successes);
 static struct kobj_attribute link_pml_rec_link_fault_cause        = __ATTR_RO(pml_rec_link_fault_cause);
@@ -141,6 +218,10 @@ static struct kobj_attribute link_pml_rec_link_down_cause         = __ATTR_RO(pm
 static struct kobj_attribute link_pml_rec_link_fault_failed_cause = __ATTR_RO(pml_rec_link_fault_failed_cause);
 static struct kobj_attribute link_pml_rec_link_down_failed_cause  = __ATTR_RO(pml_rec_link_down_failed_cause);
 static struct kobj_attribute link_pml_rec_rate_limit_exceeded     = __ATTR_RO(pml_rec_rate_limit_exceeded);
+static struct kobj_attribute link_pml_rec_hist_count              = __ATTR_RO(pml_rec_hist_count);
+static struct kobj_attribute link_pml_rec_success_hist            = __ATTR_RO(pml_rec_success_hist);
+static struct kobj_attribute link_pml_rec_fail_hist               = __ATTR_RO(pml_rec_fail_hist);
+static struct kobj_attribute link_pml_rec_hist_reset              = __ATTR_WO(pml_rec_hist_reset);
 
 static struct attribute *link_pml_rec_attrs[] = {
 	&link_pml_rec_attempts.attr,
@@ -150,6 +231,10 @@ static struct attribute *link_pml_rec_attrs[] = {
 	&link_pml_rec_link_fault_failed_cause.attr,
 	&link_pml_rec_link_down_failed_cause.attr,
 	&link_pml_rec_rate_limit_exceeded.attr,
+	&link_pml_rec_hist_count.attr,
+	&link_pml_rec_success_hist.attr,
+	&link_pml_rec_fail_hist.attr,
+	&link_pml_rec_hist_reset.attr,
 	NULL
 };
 ATTRIBUTE_GROUPS(link_pml_rec);
@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#include <linux/kobject.h>
+#include <linux/kernel.h>
+#include <linux/types.h>
+
+#include "sl_log.h"
+#include "sl_core_str.h"
+#include "data/sl_core_data_link.h"
+
+#include "sl_sysfs.h"
+
+#define LOG_BLOCK SL_LOG_BLOCK
+#define LOG_NAME  SL_LOG_SYSFS_LOG_NAME
+
+ssize_t sl_sysfs_link_up_hist_show(char *buf, u32 *buckets)
+{
+	ssize_t size;
+	u32     bucket;
+
+	size = 0;
+	for (bucket = 0; bucket < SL_CORE_LINK_UP_HIST_NUM_BUCKETS; ++bucket)
+		size += scnprintf(buf + size, PAGE_SIZE - size, "%u%s", buckets[bucket],
+				  (bucket == SL_CORE_LINK_UP_HIST_NUM_BUCKETS - 1) ? "\n" : " ");
+
+	return size;
+}
+
+static ssize_t up_phase_last_ms_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf, u32 phase)
+{
+	struct sl_core_link *core_link;
+	u32                  last_ms;
+	int                  rtn;
+
+	core_link = container_of(kobj, struct sl_core_link, up_phase_kobj);
+
+	rtn = sl_core_data_link_up_phase_last_ms_get(core_link, phase, &last_ms);
+	if (rtn)
+		return scnprintf(buf, PAGE_SIZE, "error\n");
+
+	sl_log_dbg(core_link, LOG_BLOCK, LOG_NAME, "up phase last ms show (phase = %s, last_ms = %u)",
+		   sl_core_link_up_phase_str(phase), last_ms);
+
+	return scnprintf(buf, PAGE_SIZE, "%u\n", last_ms);
+}
+
+static ssize_t up_phase_hist_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf, u32 phase)
+{
+	struct sl_core_link *core_link;
+	u32                  buckets[SL_CORE_LINK_UP_HIST_NUM_BUCKETS];
+	int                  rtn;
+
+	core_link = container_of(kobj, struct sl_core_link, up_phase_kobj);
+
+	rtn = sl_core_data_link_up_phase_hist_get(core_link, phase, buckets);
+	if (rtn)
+		return scnprintf(buf, PAGE_SIZE, "error\n");
+
+	sl_log_dbg(core_link, LOG_BLOCK, LOG_NAME, "up phase hist show (phase = %s)",
+		   sl_core_link_up_phase_str(phase));
+
+	return sl_sysfs_link_up_hist_show(buf, buckets);
+}
+
+#define link_up_phase(_name, _phase)                                                                                 \
+	static inline ssize_t _name##_last_ms_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)   \
+	{                                                                                                            \
+		return up_phase_last_ms_show(kobj, kattr, buf, (_phase));                                            \
+	}                                                                                                            \
+	static inline ssize_t _name##_hist_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)      \
+	{                                                                                                            \
+		return up_phase_hist_show(kobj, kattr, buf, (_phase));                                               \
+	}                                                                                                            \
+	static struct kobj_attribute link_up_phase_##_name##_last_ms = __ATTR_RO(_name##_last_ms);                   \
+	static struct kobj_attribute link_up_phase_##_name##_hist    = __ATTR_RO(_name##_hist)
+
+link_up_phase(an,         SL_CORE_LINK_UP_PHASE_AN);
+link_up_phase(start,      SL_CORE_LINK_UP_PHASE_START);
+link_up_phase(media,      SL_CORE_LINK_UP_PHASE_MEDIA);
+link_up_phase(serdes,     SL_CORE_LINK_UP_PHASE_SERDES);
+link_up_phase(pcs_lock,   SL_CORE_LINK_UP_PHASE_PCS_LOCK);
+link_up_phase(up_check,   SL_CORE_LINK_UP_PHASE_UP_CHECK);
+link_up_phase(fec_settle, SL_CORE_LINK_UP_PHASE_FEC_SETTLE);
+link_up_phase(fec_check,  SL_CORE_LINK_UP_PHASE_FEC_CHECK);
+
+static ssize_t serdes_lanes_up_phase_last_us_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf,
+						  u32 phase)
+{
+	struct sl_core_link *core_link;
+	u32                  last_us;
+	int                  rtn;
+
+	core_link = container_of(kobj, struct sl_core_link, up_phase_kobj);
+
+	rtn = sl_core_data_link_serdes_lanes_up_phase_us_get(core_link, phase, &last_us);
+	if (rtn)
+		return scnprintf(buf, PAGE_SIZE, "error\n");
+
+	sl_log_dbg(core_link, LOG_BLOCK, LOG_NAME, "serdes lanes up phase last us show (phase = %s, last_us = %u)",
+		   sl_core_serdes_lanes_up_phase_str(phase), last_us);
+
+	return scnprintf(buf, PAGE_SIZE, "%u\n", last_us);
+}
+
+#define serdes_lanes_up_phase(_name, _phase)                                                                               \
+	static inline ssize_t serdes_##_name##_last_us_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf) \
+	{                                                                                                                  \
+		return serdes_lanes_up_phase_last_us_show(kobj, kattr, buf, (_phase));                                     \
+	}                                                                                                                  \
+	static struct kobj_attribute link_up_phase_serdes_##_name##_last_us = __ATTR_RO(serdes_##_name##_last_us)          \
+
+serdes_lanes_up_phase(start,         SL_CORE_HW_SERDES_LANES_UP_PHASE_START);
+serdes_lanes_up_phase(clock_align,   SL_CORE_HW_SERDES_LANES_UP_PHASE_CLOCK_ALIGN);
+serdes_lanes_up_phase(tx_check,      SL_CORE_HW_SERDES_LANES_UP_PHASE_TX_CHECK);
+serdes_lanes_up_phase(settle,        SL_CORE_HW_SERDES_LANES_UP_PHASE_SETTLE);
+serdes_lanes_up_phase(rx_check,      SL_CORE_HW_SERDES_LANES_UP_PHASE_RX_CHECK);
+serdes_lanes_up_phase(quality_check, SL_CORE_HW_SERDES_LANES_UP_PHASE_QUALITY_CHECK);
+
+static ssize_t hist_reset_store(struct kobject *kobj, struct kobj_attribute *kattr, const char *buf, size_t count)
+{
+	struct sl_core_link *core_link;
+	bool                 reset;
+	int                  rtn;
+
+	core_link = container_of(kobj, struct sl_core_link, up_phase_kobj);
+
+	rtn = kstrtobool(buf, &reset);
+	if (rtn) {
+		sl_log_err(core_link, LOG_BLOCK, LOG_NAME, "up phase hist reset kstrtobool failed [%d]", rtn);
+		return count;
+	}
+
+	if (reset)
+		sl_core_data_link_up_phase_hist_clr(core_link);
+
+	return count;
+}
+
+static struct kobj_attribute link_up_phase_hist_reset = __ATTR_WO(hist_reset);
+
+static struct attribute *link_up_phase_attrs[] = {
+	&link_up_phase_an_last_ms.attr,
+	&link_up_phase_an_hist.attr,
+	&link_up_phase_start_last_ms.attr,
+	&link_up_phase_start_hist.attr,
+	&link_up_phase_media_last_ms.attr,
+	&link_up_phase_media_hist.attr,
+	&link_up_phase_serdes_last_ms.attr,
+	&link_up_phase_serdes_hist.attr,
+	&link_up_phase_pcs_lock_last_ms.attr,
+	&link_up_phase_pcs_lock_hist.attr,
+	&link_up_phase_up_check_last_ms.attr,
+	&link_up_phase_up_check_hist.attr,
+	&link_up_phase_fec_settle_last_ms.attr,
+	&link_up_phase_fec_settle_hist.attr,
+	&link_up_phase_fec_check_last_ms.attr,
+	&link_up_phase_fec_check_hist.attr,
+	&link_up_phase_serdes_start_last_us.attr,
+	&link_up_phase_serdes_clock_align_last_us.attr,
+	&link_up_phase_serdes_tx_check_last_us.attr,
+	&link_up_phase_serdes_settle_last_us.attr,
+	&link_up_phase_serdes_rx_check_last_us.attr,
+	&link_up_phase_serdes_quality_check_last_us.attr,
+	&link_up_phase_hist_reset.attr,
+	NULL
+};
+ATTRIBUTE_GROUPS(link_up_phase);
+
+static struct kobj_type link_up_phase = {
+	.sysfs_ops      = &kobj_sysfs_ops,
+	.default_groups = link_up_phase_groups,
+};
+
+int sl_sysfs_link_up_phase_create(struct sl_core_link *core_link, struct kobject *parent_kobj)
+{
+	int rtn;
+
+	sl_log_dbg(core_link, LOG_BLOCK, LOG_NAME, "link up phase create (num = %u)", core_link->num);
+
+	rtn = kobject_init_and_add(&core_link->up_phase_kobj, &link_up_phase, parent_kobj, "up_phase");
+	if (rtn) {
+		sl_log_err(core_link, LOG_BLOCK, LOG_NAME,
+			   "link up phase create kobject_init_and_add failed [%d]", rtn);
+		kobject_put(&core_link->up_phase_kobj);
+		return rtn;
+	}
+
+	return 0;
+}
+
+void sl_sysfs_link_up_phase_delete(struct sl_core_link *core_link)
+{
+	sl_log_dbg(core_link, LOG_BLOCK, LOG_NAME, "link up phase delete (num = %u)", core_link->num);
+
+	kobject_put(&core_link->up_phase_kobj);
+}
@@ -185,6 +185,69 @@ static ssize_t temperature_state_show(struct kobject *kobj, struct kobj_attribut
 	return scnprintf(buf, PAGE_SIZE, "%s\n", sl_media_temp_state_str(temperature_state));
 }
 
+static ssize_t temperature_sample_age_ms_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	int                   rtn;
+	struct sl_media_lgrp *media_lgrp;
+	s64                   age_ms;
+	u32                   read_latency_us;
+	u32                   read_latency_max_us;
+
+	media_lgrp = container_of(kobj, struct sl_media_lgrp, kobj);
+
+	rtn = sl_media_jack_cable_temp_sample_get(media_lgrp->media_ldev->num, media_lgrp->num,
+		&age_ms, &read_latency_us, &read_latency_max_us);
+	if (rtn)
+		return scnprintf(buf, PAGE_SIZE, "no-sample\n");
+
+	sl_log_dbg(media_lgrp, LOG_BLOCK, LOG_NAME,
+		   "temperature sample age show (age = %lldms)", age_ms);
+
+	return scnprintf(buf, PAGE_SIZE, "%lld\n", age_ms);
+}
+
+static ssize_t temperature_read_latency_us_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	int                   rtn;
+	struct sl_media_lgrp *media_lgrp;
+	s64                   age_ms;
+	u32                   read_latency_us;
+	u32                   read_latency_max_us;
+
+	media_lgrp = container_of(kobj, struct sl_media_lgrp, kobj);
+
+	rtn = sl_media_jack_cable_temp_sample_get(media_lgrp->media_ldev->num, media_lgrp->num,
+		&age_ms, &read_latency_us, &read_latency_max_us);
+	if (rtn)
+		return scnprintf(buf, PAGE_SIZE, "no-sample\n");
+
+	sl_log_dbg(media_lgrp, LOG_BLOCK, LOG_NAME,
+		   "temperature read latency show (latency = %uus)", read_latency_us);
+
+	return scnprintf(buf, PAGE_SIZE, "%u\n", read_latency_us);
+}
+
+static ssize_t temperature_read_latency_max_us_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	int                   rtn;
+	struct sl_media_lgrp *media_lgrp;
+	s64                   age_ms;
+	u32                   read_latency_us;
+	u32                   read_latency_max_us;
+
+	media_lgrp = container_of(kobj, struct sl_media_lgrp, kobj);
+
+	rtn = sl_media_jack_cable_temp_sample_get(media_lgrp->media_ldev->num, media_lgrp->num,
+		&age_ms, &read_latency_us, &read_latency_max_us);
+	if (rtn)
+		return scnprintf(buf, PAGE_SIZE, "no-sample\n");
+
+	sl_log_dbg(media_lgrp, LOG_BLOCK, LOG_NAME,
+		   "temperature read latency max show (latency_max = %uus)", read_latency_max_us);
+
+	return scnprintf(buf, PAGE_SIZE, "%u\n", read_latency_max_us);
+}
+
 static ssize_t vendor_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
 {
 	struct sl_media_lgrp *media_lgrp;
@@ -924,6 +987,9 @@ static struct kobj_attribute media_temperature_celsius              = __ATTR_RO(
 static struct kobj_attribute media_temperature_warn_limit_celsius   = __ATTR_RO(temperature_warn_limit_celsius);
 static struct kobj_attribute media_temperature_down_limit_celsius   = __ATTR_RO(temperature_down_limit_celsius);
 static struct kobj_attribute media_temperature_state                = __ATTR_RO(temperature_state);
+static struct kobj_attribute media_temperature_sample_age_ms        = __ATTR_RO(temperature_sample_age_ms);
+static struct kobj_attribute media_temperature_read_latency_us      = __ATTR_RO(temperature_read_latency_us);
+static struct kobj_attribute media_temperature_read_latency_max_us  = __ATTR_RO(temperature_read_latency_max_us);
 static struct kobj_attribute media_vendor                           = __ATTR_RO(vendor);
 static struct kobj_attribute media_vendor_part_num                  = __ATTR_RO(vendor_part_num);
 static struct kobj_attribute media_type                             = __ATTR_RO(type);
@@ -961,6 +1027,9 @@ static struct attribute *media_attrs[] = {
 	&media_temperature_warn_limit_celsius.attr,
 	&media_temperature_down_limit_celsius.attr,
 	&media_temperature_state.attr,
+	&media_temperature_sample_age_ms.attr,
+	&media_temperature_read_latency_us.attr,
+	&media_temperature_read_latency_max_us.attr,
 	&media_vendor.attr,
 	&media_vendor_part_num.attr,
 	&media_type.attr,
@@ -2,14 +2,19 @@
 /* Copyright 2024-2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/kobject.h>
+#include <linux/kernel.h>
+#include <linux/math64.h>
 
 #include "sl_log.h"
 #include "sl_sysfs.h"
 #include "sl_ctrl_link.h"
 #include "sl_ctrl_lgrp.h"
 #include "sl_ctrl_ldev.h"
+#include "sl_core_ldev.h"
 #include "sl_core_lgrp.h"
 #include "sl_core_str.h"
+#include "base/sl_core_serdes_fw_cache.h"
+#include "data/sl_core_data_lgrp.h"
 #include "sl_sysfs_serdes_settings.h"
 #include "sl_sysfs_serdes_eye.h"
 #include "sl_sysfs_serdes_state.h"
@@ -20,6 +25,26 @@
 #define LOG_BLOCK SL_LOG_BLOCK
 #define LOG_NAME  SL_LOG_SYSFS_LOG_NAME
 
+enum {
+	SERDES_SETTLE_COUNT = 0,
+	SERDES_SETTLE_TIMEOUTS,
+	SERDES_SETTLE_POLLS_LAST,
+	SERDES_SETTLE_US_LAST,
+	SERDES_SETTLE_US_MAX,
+	SERDES_SETTLE_US_AVG,
+};
+
+enum {
+	SERDES_INIT_OK = 0,
+	SERDES_INIT_ATTEMPTS,
+	SERDES_INIT_FAILURES,
+	SERDES_INIT_RTN_LAST,
+	SERDES_INIT_US_LAST,
+	SERDES_INIT_US_TOTAL,
+	SERDES_INIT_FW_LOADS,
+	SERDES_INIT_FW_SKIPS,
+};
+
 u8 lane_num_to_link_num(struct sl_ctrl_lgrp *ctrl_lgrp, u8 lane_num)
 {
 	switch (ctrl_lgrp->config.furcation) {
@@ -116,11 +141,257 @@ static ssize_t fw_version_show(struct kobject *kobj, struct kobj_attribute *katt
 		core_lgrp->core_ldev->serdes.fw_info[LGRP_TO_SERDES(core_lgrp->num)].version);
 }
 
-static struct kobj_attribute hw_rev_id_1   = __ATTR_RO(hw_rev_1);
-static struct kobj_attribute hw_rev_id_2   = __ATTR_RO(hw_rev_2);
-static struct kobj_attribute hw_version    = __ATTR_RO(hw_version);
-static struct kobj_attribute fw_signature  = __ATTR_RO(fw_signature);
-static struct kobj_attribute fw_version    = __ATTR_RO(fw_version);
+/* 0 until the serdes is loaded with the cached image */
+static ssize_t fw_image_crc_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_lgrp             *ctrl_lgrp;
+	struct sl_core_lgrp             *core_lgrp;
+	struct sl_core_serdes_fw_loaded  loaded;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, serdes_kobj);
+	core_lgrp = sl_core_lgrp_get(ctrl_lgrp->ctrl_ldev->num, ctrl_lgrp->num);
+
+	sl_core_serdes_fw_cache_loaded_get(ctrl_lgrp->ctrl_ldev->num, LGRP_TO_SERDES(core_lgrp->num), &loaded);
+
+	sl_log_dbg(core_lgrp, LOG_BLOCK, LOG_NAME, "fw image crc show (fw_image_crc = 0x%08X)", loaded.image_crc);
+
+	return scnprintf(buf, PAGE_SIZE, "0x%08X\n", loaded.image_crc);
+}
+
+/* cache is shared by every ldev, so these are module wide */
+static ssize_t fw_cache_hits_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_lgrp                  *ctrl_lgrp;
+	struct sl_core_serdes_fw_cache_stats  stats;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, serdes_kobj);
+
+	sl_core_serdes_fw_cache_stats_get(&stats);
+
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "fw cache hits show (hits = %u)", stats.hits);
+
+	return scnprintf(buf, PAGE_SIZE, "%u\n", stats.hits);
+}
+
+static ssize_t fw_cache_misses_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	struct sl_ctrl_lgrp                  *ctrl_lgrp;
+	struct sl_core_serdes_fw_cache_stats  stats;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, serdes_kobj);
+
+	sl_core_serdes_fw_cache_stats_get(&stats);
+
+	sl_log_dbg(ctrl_lgrp, LOG_BLOCK, LOG_NAME, "fw cache misses show (misses = %u)", stats.misses);
+
+	return scnprintf(buf, PAGE_SIZE, "%u\n", stats.misses);
+}
+
+static ssize_t serdes_init_show(struct kobject *kobj, char *buf, u32 field)
+{
+	struct sl_ctrl_lgrp                   *ctrl_lgrp;
+	struct sl_core_lgrp                   *core_lgrp;
+	struct sl_core_ldev_serdes_init_stats  stats;
+	s64                                    value;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, serdes_kobj);
+	core_lgrp = sl_core_lgrp_get(ctrl_lgrp->ctrl_ldev->num, ctrl_lgrp->num);
+
+	sl_core_ldev_serdes_init_stats_get(core_lgrp->core_ldev, LGRP_TO_SERDES(core_lgrp->num), &stats);
+
+	switch (field) {
+	case SERDES_INIT_OK:
+		value = stats.is_ok;
+		break;
+	case SERDES_INIT_ATTEMPTS:
+		value = stats.attempts;
+		break;
+	case SERDES_INIT_FAILURES:
+		value = stats.failures;
+		break;
+	case SERDES_INIT_RTN_LAST:
+		value = stats.rtn_last;
+		break;
+	case SERDES_INIT_US_LAST:
+		value = stats.us_last;
+		break;
+	case SERDES_INIT_US_TOTAL:
+		value = stats.us_total;
+		break;
+	case SERDES_INIT_FW_LOADS:
+		value = stats.fw_loads;
+		break;
+	case SERDES_INIT_FW_SKIPS:
+		value = stats.fw_skips;
+		break;
+	default:
+		return scnprintf(buf, PAGE_SIZE, "error\n");
+	}
+
+	sl_log_dbg(core_lgrp, LOG_BLOCK, LOG_NAME, "serdes init show (field = %u, value = %lld)", field, value);
+
+	return scnprintf(buf, PAGE_SIZE, "%lld\n", value);
+}
+
+static ssize_t init_ok_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	return serdes_init_show(kobj, buf, SERDES_INIT_OK);
+}
+
+static ssize_t init_attempts_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	return serdes_init_show(kobj, buf, SERDES_INIT_ATTEMPTS);
+}
+
+static ssize_t init_failures_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	return serdes_init_show(kobj, buf, SERDES_INIT_FAILURES);
+}
+
+static ssize_t init_rtn_last_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	return serdes_init_show(kobj, buf, SERDES_INIT_RTN_LAST);
+}
+
+static ssize_t init_us_last_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	return serdes_init_show(kobj, buf, SERDES_INIT_US_LAST);
+}
+
+static ssize_t init_us_total_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	return serdes_init_show(kobj, buf, SERDES_INIT_US_TOTAL);
+}
+
+static ssize_t init_fw_loads_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	return serdes_init_show(kobj, buf, SERDES_INIT_FW_LOADS);
+}
+
+static ssize_t init_fw_skips_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)
+{
+	return serdes_init_show(kobj, buf, SERDES_INIT_FW_SKIPS);
+}
+
+static ssize_t serdes_settle_show(struct kobject *kobj, char *buf, u32 step, u32 field)
+{
+	struct sl_ctrl_lgrp                *ctrl_lgrp;
+	struct sl_core_lgrp                *core_lgrp;
+	struct sl_core_serdes_settle_stats  stats;
+	int                                 rtn;
+	u64                                 value;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, serdes_kobj);
+	core_lgrp = sl_core_lgrp_get(ctrl_lgrp->ctrl_ldev->num, ctrl_lgrp->num);
+
+	rtn = sl_core_data_lgrp_serdes_settle_get(core_lgrp, step, &stats);
+	if (rtn)
+		return scnprintf(buf, PAGE_SIZE, "error\n");
+
+	switch (field) {
+	case SERDES_SETTLE_COUNT:
+		value = stats.count;
+		break;
+	case SERDES_SETTLE_TIMEOUTS:
+		value = stats.timeouts;
+		break;
+	case SERDES_SETTLE_POLLS_LAST:
+		value = stats.polls_last;
+		break;
+	case SERDES_SETTLE_US_LAST:
+		value = stats.us_last;
+		break;
+	case SERDES_SETTLE_US_MAX:
+		value = stats.us_max;
+		break;
+	case SERDES_SETTLE_US_AVG:
+		value = stats.count ? div_u64(stats.us_sum, stats.count) : 0;
+		break;
+	default:
+		return scnprintf(buf, PAGE_SIZE, "error\n");
+	}
+
+	sl_log_dbg(core_lgrp, LOG_BLOCK, LOG_NAME, "serdes settle show (step = %s, field = %u, value = %llu)",
+		   sl_core_serdes_settle_step_str(step), field, value);
+
+	return scnprintf(buf, PAGE_SIZE, "%llu\n", value);
+}
+
+#define serdes_settle(_name, _step)                                                                                    \
+	static ssize_t _name##_settle_count_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)        \
+	{                                                                                                              \
+		return serdes_settle_show(kobj, buf, (_step), SERDES_SETTLE_COUNT);                                    \
+	}                                                                                                              \
+	static ssize_t _name##_settle_timeouts_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)     \
+	{                                                                                                              \
+		return serdes_settle_show(kobj, buf, (_step), SERDES_SETTLE_TIMEOUTS);                                 \
+	}                                                                                                              \
+	static ssize_t _name##_settle_polls_last_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)   \
+	{                                                                                                              \
+		return serdes_settle_show(kobj, buf, (_step), SERDES_SETTLE_POLLS_LAST);                               \
+	}                                                                                                              \
+	static ssize_t _name##_settle_us_last_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)      \
+	{                                                                                                              \
+		return serdes_settle_show(kobj, buf, (_step), SERDES_SETTLE_US_LAST);                                  \
+	}                                                                                                              \
+	static ssize_t _name##_settle_us_max_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)       \
+	{                                                                                                              \
+		return serdes_settle_show(kobj, buf, (_step), SERDES_SETTLE_US_MAX);                                   \
+	}                                                                                                              \
+	static ssize_t _name##_settle_us_avg_show(struct kobject *kobj, struct kobj_attribute *kattr, char *buf)       \
+	{                                                                                                              \
+		return serdes_settle_show(kobj, buf, (_step), SERDES_SETTLE_US_AVG);                                   \
+	}                                                                                                              \
+	static struct kobj_attribute _name##_settle_count      = __ATTR_RO(_name##_settle_count);                      \
+	static struct kobj_attribute _name##_settle_timeouts   = __ATTR_RO(_name##_settle_timeouts);                   \
+	static struct kobj_attribute _name##_settle_polls_last = __ATTR_RO(_name##_settle_polls_last);                 \
+	static struct kobj_attribute _name##_settle_us_last    = __ATTR_RO(_name##_settle_us_last);                    \
+	static struct kobj_attribute _name##_settle_us_max     = __ATTR_RO(_name##_settle_us_max);                     \
+	static struct kobj_attribute _name##_settle_us_avg     = __ATTR_RO(_name##_settle_us_avg)
+
+serdes_settle(uc_active,  SL_CORE_SERDES_SETTLE_UC_ACTIVE);
+serdes_settle(clock_init, SL_CORE_SERDES_SETTLE_CLOCK_INIT);
+serdes_settle(pll_lock,   SL_CORE_SERDES_SETTLE_PLL_LOCK);
+
+static ssize_t settle_reset_store(struct kobject *kobj, struct kobj_attribute *kattr, const char *buf, size_t count)
+{
+	struct sl_ctrl_lgrp *ctrl_lgrp;
+	struct sl_core_lgrp *core_lgrp;
+	bool                 reset;
+	int                  rtn;
+
+	ctrl_lgrp = container_of(kobj, struct sl_ctrl_lgrp, serdes_kobj);
+	core_lgrp = sl_core_lgrp_get(ctrl_lgrp->ctrl_ldev->num, ctrl_lgrp->num);
+
+	rtn = kstrtobool(buf, &reset);
+	if (rtn) {
+		sl_log_err(core_lgrp, LOG_BLOCK, LOG_NAME, "serdes settle reset kstrtobool failed [%d]", rtn);
+		return count;
+	}
+
+	if (reset)
+		sl_core_data_lgrp_serdes_settle_clr(core_lgrp);
+
+	return count;
+}
+
+static struct kobj_attribute hw_rev_id_1     = __ATTR_RO(hw_rev_1);
+static struct kobj_attribute hw_rev_id_2     = __ATTR_RO(hw_rev_2);
+static struct kobj_attribute hw_version      = __ATTR_RO(hw_version);
+static struct kobj_attribute fw_signature    = __ATTR_RO(fw_signature);
+static struct kobj_attribute fw_version      = __ATTR_RO(fw_version);
+static struct kobj_attribute fw_image_crc    = __ATTR_RO(fw_image_crc);
+static struct kobj_attribute fw_cache_hits   = __ATTR_RO(fw_cache_hits);
+static struct kobj_attribute fw_cache_misses = __ATTR_RO(fw_cache_misses);
+static struct kobj_attribute init_ok         = __ATTR_RO(init_ok);
+static struct kobj_attribute init_attempts   = __ATTR_RO(init_attempts);
+static struct kobj_attribute init_failures   = __ATTR_RO(init_failures);
+static struct kobj_attribute init_rtn_last   = __ATTR_RO(init_rtn_last);
+static struct kobj_attribute init_us_last    = __ATTR_RO(init_us_last);
+static struct kobj_attribute init_us_total   = __ATTR_RO(init_us_total);
+static struct kobj_attribute init_fw_loads   = __ATTR_RO(init_fw_loads);
+static struct kobj_attribute init_fw_skips   = __ATTR_RO(init_fw_skips);
+static struct kobj_attribute settle_reset    = __ATTR_WO(settle_reset);
 
 static struct attribute *serdes_attrs[] = {
 	&hw_rev_id_1.attr,
@@ -128,6 +399,36 @@ static struct attribute *serdes_attrs[] = {
 	&hw_version.attr,
 	&fw_signature.attr,
 	&fw_version.attr,
+	&fw_image_crc.attr,
+	&fw_cache_hits.attr,
+	&fw_cache_misses.attr,
+	&init_ok.attr,
+	&init_attempts.attr,
+	&init_failures.attr,
+	&init_rtn_last.attr,
+	&init_us_last.attr,
+	&init_us_total.attr,
+	&init_fw_loads.attr,
+	&init_fw_skips.attr,
+	&uc_active_settle_count.attr,
+	&uc_active_settle_timeouts.attr,
+	&uc_active_settle_polls_last.attr,
+	&uc_active_settle_us_last.attr,
+	&uc_active_settle_us_max.attr,
+	&uc_active_settle_us_avg.attr,
+	&clock_init_settle_count.attr,
+	&clock_init_settle_timeouts.attr,
+	&clock_init_settle_polls_last.attr,
+	&clock_init_settle_us_last.attr,
+	&clock_init_settle_us_max.attr,
+	&clock_init_settle_us_avg.attr,
+	&pll_lock_settle_count.attr,
+	&pll_lock_settle_timeouts.attr,
+	&pll_lock_settle_polls_last.attr,
+	&pll_lock_settle_us_last.attr,
+	&pll_lock_settle_us_max.attr,
+	&pll_lock_settle_us_avg.attr,
+	&settle_reset.attr,
 	NULL
 };
 ATTRIBUTE_GROUPS(serdes);
@@ -1,8 +1,14 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/kernel.h>
 #include <linux/debugfs.h>
+#include <linux/err.h>
+
+#include <linux/hpe/sl/sl_test.h>
+#if defined(SL_BUILD_EMU)
+#include <linux/hpe/sl/sl_emu.h>
+#endif
 
 #include "sl_asic.h"
 #include "sl_ldev.h"
@@ -17,15 +23,22 @@
 static struct dentry *ldev_dir;
 static struct sl_ldev ldev;
 
+#if defined(SL_BUILD_EMU)
+static struct sl_emu_config emu_config;
+static bool                 emu_ldev_created;
+#endif
+
 enum ldev_cmd_index {
 	LDEV_NEW_CMD,
 	LDEV_DEL_CMD,
+	CABLE_DB_CHECK_CMD,
 	NUM_CMDS,
 };
 
 static struct cmd_entry ldev_cmd_list[]  = {
-	[LDEV_NEW_CMD] = { .cmd = "ldev_new", .desc = "create ldev object" },
-	[LDEV_DEL_CMD] = { .cmd = "ldev_del", .desc = "delete ldev object" },
+	[LDEV_NEW_CMD]       = { .cmd = "ldev_new",       .desc = "create ldev object" },
+	[LDEV_DEL_CMD]       = { .cmd = "ldev_del",       .desc = "delete ldev object" },
+	[CABLE_DB_CHECK_CMD] = { .cmd = "cable_db_check", .desc = "check cable db index against linear search" },
 };
 
 #define LDEV_CMD_MATCH(_index, _str) \
@@ -108,6 +121,17 @@ static ssize_t sl_test_ldev_cmd_write(struct file *f, const char __user *buf, si
 		return size;
 	}
 
+	match_found = LDEV_CMD_MATCH(CABLE_DB_CHECK_CMD, cmd_buf);
+	if (match_found) {
+		rtn = sl_test_media_cable_db_check();
+		if (rtn < 0) {
+			sl_log_err(NULL, LOG_BLOCK, LOG_NAME,
+				"sl_test_media_cable_db_check failed [%d]", rtn);
+			return rtn;
+		}
+		return size;
+	}
+
 	sl_log_err(NULL, LOG_BLOCK, LOG_NAME,
 		"cmd_write no cmd found (cmd_buf = %s)", cmd_buf);
 
@@ -125,9 +149,40 @@ struct sl_ldev *sl_test_ldev_get(void)
 	return &ldev;
 }
 
+#if defined(SL_BUILD_EMU)
+static int sl_test_debugfs_ldev_emu_create(struct dentry *parent)
+{
+	struct dentry *emu_dir;
+
+	emu_dir = debugfs_create_dir("emu", parent);
+	if (!emu_dir) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME,
+			"emu debugfs_create_dir failed");
+		return -ENOMEM;
+	}
+
+	/* returns defaults when no emu ldev exists */
+	sl_emu_config_get(ldev.num, &emu_config);
+
+	debugfs_create_u32("link_up_ms", 0644, emu_dir, &emu_config.link_up_ms);
+	debugfs_create_u32("link_up_jitter_ms", 0644, emu_dir, &emu_config.link_up_jitter_ms);
+	debugfs_create_u32("link_up_fault_pct", 0644, emu_dir, &emu_config.link_up_fault_pct);
+	debugfs_create_u32("link_up_timeout_pct", 0644, emu_dir, &emu_config.link_up_timeout_pct);
+	debugfs_create_u32("an_page_ms", 0644, emu_dir, &emu_config.an_page_ms);
+	debugfs_create_u64("fec_gcw_per_sec", 0644, emu_dir, &emu_config.fec_gcw_per_sec);
+	debugfs_create_u64("fec_ccw_per_sec", 0644, emu_dir, &emu_config.fec_ccw_per_sec);
+	debugfs_create_u64("fec_ucw_per_sec", 0644, emu_dir, &emu_config.fec_ucw_per_sec);
+
+	return 0;
+}
+#endif
+
 int sl_test_debugfs_ldev_create(struct dentry *top_dir)
 {
 	struct dentry *dentry;
+#if defined(SL_BUILD_EMU)
+	int            rtn;
+#endif
 
 	ldev_dir = debugfs_create_dir("ldev", top_dir);
 	if (!ldev_dir) {
@@ -140,6 +195,12 @@ int sl_test_debugfs_ldev_create(struct dentry *top_dir)
 
 	debugfs_create_u8("num", 0644, ldev_dir, &ldev.num);
 
+#if defined(SL_BUILD_EMU)
+	rtn = sl_test_debugfs_ldev_emu_create(ldev_dir);
+	if (rtn)
+		return rtn;
+#endif
+
 	dentry = debugfs_create_file("cmds", 0644, ldev_dir, NULL, &sl_test_ldev_cmds_fops);
 	if (!dentry) {
 		sl_log_err(NULL, LOG_BLOCK, LOG_NAME,
@@ -165,21 +226,61 @@ u8 sl_test_debugfs_ldev_num_get(void)
 int sl_test_ldev_new(void)
 {
 	struct sl_ctrl_ldev *ctrl_ldev;
+#if defined(SL_BUILD_EMU)
+	int                  rtn;
+	struct sl_ldev      *emu_ldev;
+#endif
 
-	//TODO: Create ldev object
-	/* We rely on the ldev created by the client. Don't create new */
+	/* We rely on the ldev created by the client when there is one */
 	ctrl_ldev = sl_test_ctrl_ldev_get(sl_test_debugfs_ldev_num_get());
-	if (!ctrl_ldev) {
-		sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "ldev_new ctrl_ldev_get failed");
-		return -ENODEV;
+	if (ctrl_ldev) {
+#if defined(SL_BUILD_EMU)
+		/* ldev_new on an emulated ldev applies the emu config */
+		if (emu_ldev_created) {
+			rtn = sl_emu_config_set(sl_test_debugfs_ldev_num_get(), &emu_config);
+			if (rtn) {
+				sl_log_err(NULL, LOG_BLOCK, LOG_NAME,
+					"ldev_new sl_emu_config_set failed [%d]", rtn);
+				return rtn;
+			}
+		}
+#endif
+		return 0;
 	}
 
+#if defined(SL_BUILD_EMU)
+	emu_ldev = sl_emu_ldev_new(sl_test_debugfs_ldev_num_get(), &emu_config);
+	if (IS_ERR(emu_ldev)) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME,
+			"ldev_new sl_emu_ldev_new failed [%ld]", PTR_ERR(emu_ldev));
+		return PTR_ERR(emu_ldev);
+	}
+	emu_ldev_created = true;
+
 	return 0;
+#else
+	sl_log_err(NULL, LOG_BLOCK, LOG_NAME, "ldev_new ctrl_ldev_get failed");
+	return -ENODEV;
+#endif
 }
 
 int sl_test_ldev_del(void)
 {
-	//TODO: Delete ldev object.
+#if defined(SL_BUILD_EMU)
+	int rtn;
+
+	/* only the emulated ldev is owned here */
+	if (!emu_ldev_created)
+		return 0;
+
+	rtn = sl_emu_ldev_del(sl_test_debugfs_ldev_num_get());
+	if (rtn) {
+		sl_log_err(NULL, LOG_BLOCK, LOG_NAME,
+			"ldev_del sl_emu_ldev_del failed [%d]", rtn);
+		return rtn;
+	}
+	emu_ldev_created = false;
+#endif
 	return 0;
 }
 
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: GPL-2.0
-/* Copyright 2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #include <linux/types.h>
 #include <linux/debugfs.h>
@@ -12,6 +12,7 @@
 
 #include <linux/hpe/sl/sl_lgrp.h>
 #include <linux/hpe/sl/sl_media.h>
+#include <linux/hpe/sl/sl_test.h>
 
 #include "sl_asic.h"
 #include "sl_lgrp.h"
@@ -57,6 +58,7 @@ enum lgrp_cmd_index {
 	LGRP_POLICY_WRITE_CMD,
 	LGRP_NOTIFS_REG_CMD,
 	LGRP_NOTIFS_UNREG_CMD,
+	LGRP_UC_RAM_BENCH_CMD,
 	NUM_CMDS,
 };
 
@@ -67,6 +69,7 @@ static struct cmd_entry lgrp_cmd_list[]  = {
 	[LGRP_POLICY_WRITE_CMD] = { .cmd = "lgrp_policy_write", .desc = "write out the lgrp policy from dir" },
 	[LGRP_NOTIFS_REG_CMD]   = { .cmd = "lgrp_notifs_reg",   .desc = "register for all notifications"     },
 	[LGRP_NOTIFS_UNREG_CMD] = { .cmd = "lgrp_notifs_unreg", .desc = "unregister for all notifications"   },
+	[LGRP_UC_RAM_BENCH_CMD] = { .cmd = "uc_ram_bench",      .desc = "compare uc ram eye reads"           },
 };
 
 #define LGRP_CMD_MATCH(_index, _str) \
@@ -483,6 +486,17 @@ static ssize_t sl_test_lgrp_cmd_write(struct file *f, const char __user *buf, si
 		return size;
 	}
 
+	match_found = LGRP_CMD_MATCH(LGRP_UC_RAM_BENCH_CMD, cmd_buf);
+	if (match_found) {
+		rtn = sl_test_uc_ram_bench(sl_test_lgrp_get());
+		if (rtn < 0) {
+			sl_log_err(NULL, LOG_BLOCK, LOG_NAME,
+				"sl_test_uc_ram_bench failed [%d]", rtn);
+			return rtn;
+		}
+		return size;
+	}
+
 	sl_log_err(NULL, LOG_BLOCK, LOG_NAME,
 		"cmd_write no cmd found (cmd_buf = %s)", cmd_buf);
 
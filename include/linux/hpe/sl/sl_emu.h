@@ -0,0 +1,42 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#ifndef _LINUX_SL_EMU_H_
+#define _LINUX_SL_EMU_H_
+
+#include <linux/types.h>
+
+struct sl_ldev;
+
+/*
+ * Emulated ASIC backend, only available in the SL_BUILD_SWITCH_EMU build.
+ *
+ * The emulator reports itself as a NETSIM platform so the SerDes uC paths
+ * are skipped. Link up, AN pages and FEC counters are simulated with the
+ * latencies and error injection below.
+ */
+
+#define SL_EMU_CONFIG_MAGIC 0x736c656d
+#define SL_EMU_CONFIG_VER   1
+struct sl_emu_config {
+	u32 magic;
+	u32 ver;
+	u32 size;
+
+	u32 link_up_ms;          /* PCS enable to link up interrupt      */
+	u32 link_up_jitter_ms;   /* random extra added to link_up_ms     */
+	u32 link_up_fault_pct;   /* link up raised with PCS faulted      */
+	u32 link_up_timeout_pct; /* link up never raised                 */
+	u32 an_page_ms;          /* page write to page received          */
+
+	u64 fec_gcw_per_sec;
+	u64 fec_ccw_per_sec;
+	u64 fec_ucw_per_sec;
+};
+
+struct sl_ldev *sl_emu_ldev_new(u8 ldev_num, struct sl_emu_config *config);
+int             sl_emu_ldev_del(u8 ldev_num);
+int             sl_emu_config_set(u8 ldev_num, struct sl_emu_config *config);
+int             sl_emu_config_get(u8 ldev_num, struct sl_emu_config *config);
+
+#endif /* _LINUX_SL_EMU_H_ */
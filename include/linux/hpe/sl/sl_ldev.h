@@ -1,9 +1,10 @@
 /* SPDX-License-Identifier: GPL-2.0 */
-/* Copyright 2023,2024,2025 Hewlett Packard Enterprise Development LP */
+/* Copyright 2023,2024,2025,2026 Hewlett Packard Enterprise Development LP */
 
 #ifndef _LINUX_SL_LDEV_H_
 #define _LINUX_SL_LDEV_H_
 
+#include <linux/bitops.h>
 #include <linux/kobject.h>
 #include <linux/workqueue.h>
 
@@ -25,12 +26,24 @@ typedef void (*sl_intr_handler_t)(u64 *err_flags, int flag_count, void *data);
 typedef u64 (*sl_read64_t)(void *pci_accessor, long addr);
 typedef void (*sl_write64_t)(void *pci_accessor, long addr, u64 data);
 
+/* ASIC register batch types */
+#define SL_REG_OP_RD64  1
+#define SL_REG_OP_WR64  2
+struct sl_reg_op {
+	long addr;
+	u64  data;
+	u8   op;
+};
+typedef int (*sl_reg_ops_t)(void *pci_accessor, struct sl_reg_op *ops, u32 count);
+
 /* Sbus types */
 #define SL_SBUS_OP_RST  1
 #define SL_SBUS_OP_RD   2
 #define SL_SBUS_OP_WR   3
 typedef int (*sl_sbus_op_t)(void *sbus_accessor, u8 op,
 			    u8 ring, u8 dev_addr, u8 reg, u32 *rd_data, u32 wr_data);
+typedef int (*sl_sbus_wr_blk_t)(void *sbus_accessor, u8 ring, u8 dev_addr, u8 reg,
+				const u32 *wr_data, u32 count);
 
 /* PMI types */
 #define SL_PMI_OP_RST  1
@@ -104,7 +117,7 @@ struct sl_ops {
 	sl_pml_intr_enable_t     pml_intr_enable;
 	sl_pml_intr_disable_t    pml_intr_disable;
 
-	/* DT */
+	/* DT (optional when the platform is not hardware) */
 	sl_dt_info_get_t dt_info_get;
 
 	/* MB */
@@ -113,8 +126,17 @@ struct sl_ops {
 	sl_dmac_alloc_t dmac_alloc;
 	sl_dmac_xfer_t  dmac_xfer;
 	sl_dmac_free_t  dmac_free;
+
+	/* Sbus block write (optional) */
+	sl_sbus_wr_blk_t sbus_wr_blk;
+
+	/* ASIC register batch, ops in order in one access (optional) */
+	sl_reg_ops_t reg_ops;
 };
 
+#define SL_LDEV_ATTR_OPT_SERDES_FW_RUNNING_SKIP BIT(0) /* Skip the firmware download for serdes already running it */
+#define SL_LDEV_ATTR_OPT_AN_EMU                 BIT(1) /* Backend emulates the autoneg link partner */
+
 #define SL_LDEV_ATTR_MAGIC 0x736c6461
 #define SL_LDEV_ATTR_VER   1
 struct sl_ldev_attr {
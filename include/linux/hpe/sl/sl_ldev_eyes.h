@@ -0,0 +1,69 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#ifndef _LINUX_SL_LDEV_EYES_H_
+#define _LINUX_SL_LDEV_EYES_H_
+
+#include <linux/types.h>
+
+/*
+ * Binary SerDes eye snapshot read from sl_info/eyes.
+ *
+ * Layout is a header, hdr.num_lgrps lgrp entries of hdr.lgrp_size bytes
+ * and a trailer. Values come from the background eye sampler, reading the
+ * file never touches the SerDes. Each lgrp has its own sample timestamp.
+ * A reader must check that hdr.seq and trailer.seq match, a mismatch
+ * means a newer snapshot replaced the one being read.
+ */
+
+#define SL_LDEV_EYES_MAGIC 0x736c6579
+#define SL_LDEV_EYES_VER   1
+
+#define SL_LDEV_EYES_LANES_MAX 4
+#define SL_LDEV_EYES_HIST_MAX  16
+
+struct sl_ldev_eyes_hdr {
+	__u32 magic;
+	__u32 ver;
+	__u32 hdr_size;
+	__u32 lgrp_size;
+	__u64 seq;
+	__u64 timestamp_ns;             /* CLOCK_REALTIME */
+	__u8  ldev_num;
+	__u8  num_lanes;
+	__u8  hist_max;
+	__u8  rsvd;
+	__u32 period_ms;                /* 0 is sampling off */
+	__u32 num_lgrps;
+	__u32 rsvd2;
+};
+
+struct sl_ldev_eyes_lane {
+	__u8  upper;                    /* last sample */
+	__u8  lower;
+	__u8  upper_min;                /* over the history */
+	__u8  upper_max;
+	__u8  upper_mean;
+	__u8  lower_min;
+	__u8  lower_max;
+	__u8  lower_mean;
+	__u32 num_samples;              /* total taken */
+	__u8  upper_hist[SL_LDEV_EYES_HIST_MAX]; /* oldest first */
+	__u8  lower_hist[SL_LDEV_EYES_HIST_MAX];
+	__u32 num_hist;                 /* valid history entries */
+};
+
+struct sl_ldev_eyes_lgrp {
+	__u8  lgrp_num;
+	__u8  active_lanes;             /* lanes in the last sample */
+	__u16 rsvd;
+	__u32 rsvd2;
+	__u64 timestamp_ns;             /* CLOCK_REALTIME, 0 is never sampled */
+	struct sl_ldev_eyes_lane lanes[SL_LDEV_EYES_LANES_MAX];
+};
+
+struct sl_ldev_eyes_trailer {
+	__u64 seq;
+};
+
+#endif /* _LINUX_SL_LDEV_EYES_H_ */
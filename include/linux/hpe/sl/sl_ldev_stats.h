@@ -0,0 +1,67 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+#ifndef _LINUX_SL_LDEV_STATS_H_
+#define _LINUX_SL_LDEV_STATS_H_
+
+#include <linux/types.h>
+
+/*
+ * Binary link statistics snapshot read from sl_info/link_stats.
+ *
+ * Layout is a header, hdr.num_links link entries of hdr.link_size bytes
+ * and a trailer. Every value is taken in one pass at hdr.timestamp_ns.
+ * A reader must check that hdr.seq and trailer.seq match, a mismatch
+ * means a newer snapshot replaced the one being read.
+ */
+
+#define SL_LDEV_STATS_MAGIC 0x736c7374
+#define SL_LDEV_STATS_VER   1
+
+#define SL_LDEV_STATS_LINK_CNTRS_MAX     32
+#define SL_LDEV_STATS_CAUSE_CNTRS_MAX    64
+#define SL_LDEV_STATS_AN_CAUSE_CNTRS_MAX 32
+#define SL_LDEV_STATS_MAC_CNTRS_MAX      16
+
+#define SL_LDEV_STATS_LINK_FLAG_LINK 0x1 /* link entries valid */
+#define SL_LDEV_STATS_LINK_FLAG_MAC  0x2 /* mac entries valid  */
+
+struct sl_ldev_stats_hdr {
+	__u32 magic;
+	__u32 ver;
+	__u32 hdr_size;
+	__u32 link_size;
+	__u64 seq;
+	__u64 timestamp_ns;             /* CLOCK_REALTIME */
+	__u8  ldev_num;
+	__u8  rsvd[3];
+	__u32 num_links;
+	__u32 num_link_cntrs;
+	__u32 num_cause_cntrs;
+	__u32 num_an_cause_cntrs;
+	__u32 num_mac_cntrs;
+};
+
+struct sl_ldev_stats_link {
+	__u8  lgrp_num;
+	__u8  link_num;
+	__u16 flags;
+	__u32 link_state;               /* SL_LINK_STATE_* */
+	__u32 link_cntrs[SL_LDEV_STATS_LINK_CNTRS_MAX];
+	__u32 cause_cntrs[SL_LDEV_STATS_CAUSE_CNTRS_MAX];
+	__u32 an_cause_cntrs[SL_LDEV_STATS_AN_CAUSE_CNTRS_MAX];
+	__u32 mac_cntrs[SL_LDEV_STATS_MAC_CNTRS_MAX];
+	struct {
+		__u64 ucw;              /* counts over period_ms */
+		__u64 ccw;
+		__u64 gcw;
+		__u32 period_ms;
+		__u32 rsvd;
+	} fec;
+};
+
+struct sl_ldev_stats_trailer {
+	__u64 seq;
+};
+
+#endif /* _LINUX_SL_LDEV_STATS_H_ */
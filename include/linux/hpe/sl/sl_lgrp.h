@@ -134,6 +134,19 @@ struct sl_lgrp_policy {
 	u32 options;
 };
 
+#define SL_LGRP_NOTIF_DEPTH_DEFAULT   8
+#define SL_LGRP_NOTIF_DEPTH_MAX    4096
+
+#define SL_LGRP_ATTR_MAGIC 0x6c676174
+#define SL_LGRP_ATTR_VER   1
+struct sl_lgrp_attr {
+	u32 magic;
+	u32 ver;
+	u32 size;
+
+	u32 notif_depth;        /* notification ring depth, 0 = default, rounded up to power of 2 */
+};
+
 #define SL_HW_ATTR_MAGIC 0x73736861
 #define SL_HW_ATTR_VER   1
 struct sl_hw_attr {
@@ -188,6 +201,8 @@ struct sl_dt_lgrp_info {
 };
 
 struct sl_lgrp *sl_lgrp_new(struct sl_ldev *ldev, u8 lgrp_num, struct kobject *sysfs_parent);
+struct sl_lgrp *sl_lgrp_new_attr(struct sl_ldev *ldev, u8 lgrp_num, struct kobject *sysfs_parent,
+				 struct sl_lgrp_attr *lgrp_attr);
 int             sl_lgrp_del(struct sl_lgrp *lgrp);
 
 int sl_lgrp_config_set(struct sl_lgrp *lgrp, struct sl_lgrp_config *lgrp_config);
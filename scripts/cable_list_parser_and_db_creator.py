@@ -4,17 +4,91 @@
 
 # RUN:  pthon3 cable_list_parser_and_db_creator.py
 # infile is expected to be in the active directory at script run time
-# outfile will be created in the active directory at script run time
+# outfile and idx_outfile will be created in the active directory at script run time
+#
+# RUN:  python3 cable_list_parser_and_db_creator.py --idx-only <sl_media_data_cable_db.h>
+# regenerates idx_outfile from an existing outfile
 
 import re
-from openpyxl import load_workbook
+import sys
 
 # Defines:  sources must match sheets within the xlsm file exactly
 infile = "SlingshotCableCompatibilityMatrix.xlsm"
 outfile = "sl_media_data_cable_db.h"
+idx_outfile = "sl_media_data_cable_db_idx.h"
 source1 = "S1 S2 Cable List 11.24.25"
 source2 = "OSFP Cable List 11.05.25"
 
+# Index: cable_db rows are bucketed on hash(hpe_pn), must match sl_media_data_cable_db_ops.c
+idx_bits = 10
+idx_mult = 0x61C88647
+
+# hpe_pn of every cable_db row, in cable_db order
+db_hpe_pns = []
+
+def idx_hash(hpe_pn):
+    return ((hpe_pn * idx_mult) & 0xFFFFFFFF) >> (32 - idx_bits)
+
+# write the bucket offsets and the rows sorted by bucket (cable_db order within a bucket)
+def idx_write(hpe_pns):
+    num_buckets = 1 << idx_bits
+    if len(hpe_pns) > 0xFFFF:
+        print("Too many cable_db rows for the index =", str(len(hpe_pns)))
+        sys.exit(1)
+
+    buckets = [[] for x in range(num_buckets)]
+    for row in range(len(hpe_pns)):
+        buckets[idx_hash(hpe_pns[row])].append(row)
+
+    f = open(idx_outfile, "w")
+    f.write("/* SPDX-License-Identifier: GPL-2.0 */\n")
+    f.write("/* Copyright 2026 Hewlett Packard Enterprise Development LP */\n\n")
+    f.write("/* This file is auto-generated through script and should not be modified */\n\n")
+    f.write("#ifndef _SL_MEDIA_DATA_CABLE_DB_IDX_H_\n")
+    f.write("#define _SL_MEDIA_DATA_CABLE_DB_IDX_H_\n\n")
+    f.write("#define SL_MEDIA_DATA_CABLE_DB_IDX_BITS    " + str(idx_bits) + "\n")
+    f.write("#define SL_MEDIA_DATA_CABLE_DB_IDX_MULT    0x%08X\n" % idx_mult)
+    f.write("#define SL_MEDIA_DATA_CABLE_DB_IDX_NUM_ROWS " + str(len(hpe_pns)) + "\n\n")
+
+    f.write("/* rows of bucket b are cable_db_idx_rows[cable_db_idx_buckets[b]] up to cable_db_idx_buckets[b + 1] */\n")
+    f.write("static const u16 cable_db_idx_buckets[(1 << SL_MEDIA_DATA_CABLE_DB_IDX_BITS) + 1] = {")
+    offset = 0
+    for bucket in range(num_buckets + 1):
+        if bucket % 8 == 0:
+            f.write("\n\t")
+        else:
+            f.write(" ")
+        f.write("%5u," % offset)
+        if bucket < num_buckets:
+            offset = offset + len(buckets[bucket])
+    f.write("\n};\n\n")
+
+    f.write("static const u16 cable_db_idx_rows[SL_MEDIA_DATA_CABLE_DB_IDX_NUM_ROWS] = {")
+    count = 0
+    for bucket in range(num_buckets):
+        for row in buckets[bucket]:
+            if count % 8 == 0:
+                f.write("\n\t")
+            else:
+                f.write(" ")
+            f.write("%5u," % row)
+            count = count + 1
+    f.write("\n};\n\n")
+    f.write("#endif /* _SL_MEDIA_DATA_CABLE_DB_IDX_H_ */\n")
+    f.close()
+
+if len(sys.argv) == 3 and sys.argv[1] == "--idx-only":
+    with open(sys.argv[2]) as db:
+        for line in db:
+            match = re.match(r'\s*\.hpe_pn\s*=\s*(\d+),', line)
+            if match:
+                db_hpe_pns.append(int(match.group(1)))
+    idx_write(db_hpe_pns)
+    print("Total number of indexed cables =", str(len(db_hpe_pns)))
+    sys.exit(0)
+
+from openpyxl import load_workbook
+
 # count the rows
 def rows_count(df):
     curr_row = 1
@@ -80,6 +154,7 @@ def cable_info_write(f, df, part_nums, sheet_name):
             if part_nums[i] == hp_pn_int:
                 f.write("\t{\n")
                 f.write("\t\t.hpe_pn                   = " + str(part_nums[i]) + ",\n")
+                db_hpe_pns.append(part_nums[i])
             
                 cell_obj = df.cell(row = curr_row+1, column = 7) #read the vendor
                 cell_value = str(cell_obj.value).strip() #remove whitespace
@@ -283,3 +358,5 @@ cable_info_write(file1, df2, OSFP_HP_PN, source2)
 file1.write("};\n\n")
 file1.write("#endif /* _SL_MEDIA_DATA_CABLE_DB_H_ */\n")
 file1.close()
+
+idx_write(db_hpe_pns)
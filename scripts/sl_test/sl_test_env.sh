@@ -1,6 +1,6 @@
 # SPDX-License-Identifier: GPL-2.0
 #
-# Copyright 2025 Hewlett Packard Enterprise Development LP. All rights reserved.
+# Copyright 2025,2026 Hewlett Packard Enterprise Development LP. All rights reserved.
 #
 
 ##########################################################################################
@@ -59,6 +59,7 @@ SL_TEST_LINK_DEBUGFS_NUM="${SL_TEST_LINK_DEBUGFS_DIR}/num"
 SL_TEST_LLR_DEBUGFS_NUM="${SL_TEST_LLR_DEBUGFS_DIR}/num"
 SL_TEST_MAC_DEBUGFS_NUM="${SL_TEST_MAC_DEBUGFS_DIR}/num"
 
+SL_TEST_LDEV_DEBUGFS_EMU_DIR="${SL_TEST_LDEV_DEBUGFS_DIR}/emu/"
 SL_TEST_LGRP_DEBUGFS_CONFIG_DIR="${SL_TEST_LGRP_DEBUGFS_DIR}/config/"
 SL_TEST_LGRP_DEBUGFS_POLICY_DIR="${SL_TEST_LGRP_DEBUGFS_DIR}/policies/"
 SL_TEST_LINK_DEBUGFS_CONFIG_DIR="${SL_TEST_LINK_DEBUGFS_DIR}/config/"
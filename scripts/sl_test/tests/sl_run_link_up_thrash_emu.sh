@@ -0,0 +1,324 @@
+#!/bin/bash
+# SPDX-License-Identifier: GPL-2.0
+#
+# Copyright 2026 Hewlett Packard Enterprise Development LP. All rights reserved.
+#
+
+brief="Cycle links up and down on the emulated ldev and report CPU time per cycle."
+
+source "${SL_TEST_DIR}/sl_test_env.sh"
+
+LINK_NOTIF_TIMEOUT=60000 # Timeout in milliseconds
+settings="${SL_TEST_DIR}/systems/settings/ck400_x1_lb_fec_on.sh"
+ldev_num=0
+lgrp_nums=({0..63})
+num_cycles=100
+link_up_cycles=($(seq 0 ${num_cycles}))
+emu_link_up_ms=10
+emu_an_page_ms=1
+
+function test_cleanup {
+	local rtn
+
+	sl_test_lgrp_cleanup ${ldev_num} "${lgrp_nums[*]}"
+	rtn=$?
+	if [[ "${rtn}" != 0 ]]; then
+		sl_test_error_log "${FUNCNAME}" "lgrp_cleanup failed [${rtn}]"
+		return ${rtn}
+	fi
+
+	sl_test_ldev_del ${ldev_num}
+	rtn=$?
+	if [[ "${rtn}" != 0 ]]; then
+		sl_test_error_log "${FUNCNAME}" "ldev_del failed [${rtn}]"
+		return ${rtn}
+	fi
+
+	return 0
+}
+
+# busy jiffies across all CPUs (user + nice + system + irq + softirq)
+function cpu_busy_jiffies_get {
+	local fields
+
+	read -ra fields < /proc/stat
+	echo $(( fields[1] + fields[2] + fields[3] + fields[6] + fields[7] ))
+}
+
+function emu_config_set {
+	echo ${emu_link_up_ms} > ${SL_TEST_LDEV_DEBUGFS_EMU_DIR}/link_up_ms || return 1
+	echo 0 > ${SL_TEST_LDEV_DEBUGFS_EMU_DIR}/link_up_jitter_ms          || return 1
+	echo 0 > ${SL_TEST_LDEV_DEBUGFS_EMU_DIR}/link_up_fault_pct          || return 1
+	echo 0 > ${SL_TEST_LDEV_DEBUGFS_EMU_DIR}/link_up_timeout_pct        || return 1
+	echo ${emu_an_page_ms} > ${SL_TEST_LDEV_DEBUGFS_EMU_DIR}/an_page_ms || return 1
+
+	return 0
+}
+
+function test_verify {
+	local data
+	local notifs
+	local notif
+	local notif_fields
+	local notif_ldev_num
+	local notif_lgrp_num
+	local notif_link_num
+	local notif_type
+
+	data=$1
+
+	IFS=';' read -ra notifs <<< "${data}"
+	for notif in "${notifs[@]}"; do
+		notif_fields=(${notif})
+		notif_ldev_num=${notif_fields[2]}
+		notif_lgrp_num=${notif_fields[3]}
+		notif_link_num=${notif_fields[4]}
+		notif_type=${notif_fields[6]}
+
+		if [[ "${notif_type}" == "link-up" || "${notif_type}" == "link-down" ]]; then
+			continue
+		else
+			sl_test_error_log "${FUNCNAME}" "failed (ldev_num = ${ldev_num}, lgrp_num = ${lgrp_num}, link_num = ${link_num})"
+			sl_test_error_log "${FUNCNAME}" "Expected: link-up, link-down, Found: ${notif_type}"
+			return 1
+		fi
+	done
+
+	return 0
+}
+
+function main {
+
+	local rtn
+	local link_nums
+	local lgrp_sysfs
+	local furcation
+	local sl_test_link_thrash_notifs
+	local clk_tck
+	local busy_start
+	local busy_end
+	local wall_start_ms
+	local wall_end_ms
+	local cycle_count
+	local cpu_ms
+
+	sl_test_info_log "${FUNCNAME}" \
+		"emu_config_set (link_up_ms = ${emu_link_up_ms}, an_page_ms = ${emu_an_page_ms})"
+
+	emu_config_set
+	rtn=$?
+	if [[ "${rtn}" != 0 ]]; then
+		sl_test_error_log "${FUNCNAME}" "emu_config_set failed [${rtn}]"
+		return ${rtn}
+	fi
+
+	sl_test_info_log "${FUNCNAME}" "ldev_new (ldev_num = ${ldev_num})"
+
+	sl_test_ldev_new ${ldev_num}
+	rtn=$?
+	if [[ "${rtn}" != 0 ]]; then
+		sl_test_error_log "${FUNCNAME}" "ldev_new failed [${rtn}]"
+		return ${rtn}
+	fi
+
+	__sl_test_lgrp_sysfs_parent_set ${ldev_num} lgrp_sysfs
+	rtn=$?
+	if [[ "${rtn}" != 0 ]]; then
+		sl_test_error_log "${FUNCNAME}" "lgrp_sysfs_parent_set failed [${rtn}]"
+		return ${rtn}
+	fi
+
+	sl_test_info_log "${FUNCNAME}" \
+		"lgrp_setup (ldev_num = ${ldev_num}, lgrp_nums = (${lgrp_nums[*]}), settings = ${settings})"
+
+	sl_test_lgrp_setup ${ldev_num} "${lgrp_nums[*]}" ${settings}
+	rtn=$?
+	if [[ "${rtn}" != 0 ]]; then
+		sl_test_error_log "${FUNCNAME}" "link_setup failed [${rtn}]"
+		return ${rtn}
+	fi
+
+	sl_test_info_log "${FUNCNAME}" "lgrp_notifs_reg (ldev_num = ${ldev_num}, lgrp_nums = (${lgrp_nums[*]}))"
+
+	sl_test_lgrp_notifs_reg ${ldev_num} "${lgrp_nums[*]}"
+	rtn=$?
+	if [[ "${rtn}" != 0 ]]; then
+		sl_test_error_log "${FUNCNAME}" "lgrp_notifs_reg failed [${rtn}]"
+		return ${rtn}
+	fi
+
+	sl_test_info_log "${FUNCNAME}" \
+		"lgrp_notifs_remove (ldev_num = ${ldev_num}, lgrp_nums = (${lgrp_nums[*]}))"
+
+	# Give time for any media-present notifications to arrive. Link groups may or may not receive this notification.
+	# Either way the notification queue must be empty before continuing.
+	sleep 1
+
+	sl_test_lgrp_notifs_remove ${ldev_num} "${lgrp_nums[*]}"
+	rtn=$?
+	if [[ "${rtn}" != 0 ]]; then
+		sl_test_error_log "${FUNCNAME}" "lgrp_notifs_remove failed [${rtn}]"
+		return ${rtn}
+	fi
+
+	furcation=$(cat ${lgrp_sysfs}/${lgrp_nums[0]}/config/furcation)
+	rtn=$?
+	if [[ "${rtn}" != 0 ]]; then
+		sl_test_error_log "${FUNCNAME}" "furcation read failed [${rtn}]"
+		return ${rtn}
+	fi
+
+	sl_test_info_log "${FUNCNAME}" "(furcation = ${furcation})"
+
+	__sl_test_set_links_from_furcation ${furcation} link_nums
+	if [[ "${rtn}" != 0 ]]; then
+		sl_test_error_log "${FUNCNAME}" "set_links_from_furcation failed [${rtn}]"
+		return ${rtn}
+	fi
+
+	clk_tck=$(getconf CLK_TCK)
+	busy_start=$(cpu_busy_jiffies_get)
+	wall_start_ms=$(date +%s%3N)
+
+	for link_up_cycle in "${link_up_cycles[@]}"; do
+
+		sl_test_info_log "${FUNCNAME}" "Thrash cycle (link_up_cycle = ${link_up_cycle})"
+
+		sl_test_info_log "${FUNCNAME}" "link_up (ldev_num = ${ldev_num}, lgrp_nums = (${lgrp_nums[*]}), link_nums = (${link_nums[*]}))"
+
+		sl_test_link_up ${ldev_num} "${lgrp_nums[*]}" "${link_nums[*]}"
+		rtn=$?
+		if [[ "${rtn}" != 0 ]]; then
+			sl_test_error_log "${FUNCNAME}" "link_up failed [${rtn}]"
+			return ${rtn}
+		fi
+
+		sl_test_info_log "${FUNCNAME}" \
+			"lgrp_links_notif_wait link-up (ldev_num = ${ldev_num}, lgrp_nums = (${lgrp_nums[*]}), LINK_NOTIF_TIMEOUT = ${LINK_NOTIF_TIMEOUT})"
+
+		sl_test_lgrp_links_notif_wait ${ldev_num} "${lgrp_nums[*]}" \
+			"link-up" ${LINK_NOTIF_TIMEOUT} sl_test_link_thrash_notifs
+		rtn=$?
+		if [[ "${rtn}" != 0 ]]; then
+			sl_test_error_log "${FUNCNAME}" "lgrp_links_notif_wait failed [${rtn}]"
+			return ${rtn}
+		fi
+
+		sl_test_info_log "${FUNCNAME}" "link_down (ldev_num = ${ldev_num}, lgrp_nums = (${lgrp_nums[*]}), link_nums = (${link_nums[*]}))"
+
+		sl_test_link_down ${ldev_num} "${lgrp_nums[*]}" "${link_nums[*]}"
+		rtn=$?
+		if [[ "${rtn}" != 0 ]]; then
+			sl_test_error_log "${FUNCNAME}" "link_down failed [${rtn}]"
+			return ${rtn}
+		fi
+
+		sl_test_info_log "${FUNCNAME}" \
+			"lgrp_links_notif_wait link-down (ldev_num = ${ldev_num}, lgrp_nums = (${lgrp_nums[*]}), LINK_NOTIF_TIMEOUT = ${LINK_NOTIF_TIMEOUT})"
+
+		sl_test_lgrp_links_notif_wait ${ldev_num} "${lgrp_nums[*]}" \
+			"link-down" ${LINK_NOTIF_TIMEOUT} sl_test_link_thrash_notifs
+		rtn=$?
+		if [[ "${rtn}" != 0 ]]; then
+			sl_test_error_log "${FUNCNAME}" "lgrp_links_notif_wait failed [${rtn}]"
+			return ${rtn}
+		fi
+	done
+
+	busy_end=$(cpu_busy_jiffies_get)
+	wall_end_ms=$(date +%s%3N)
+
+	cycle_count=$(( ${#link_up_cycles[@]} * ${#lgrp_nums[@]} * ${#link_nums[@]} ))
+	cpu_ms=$(( (busy_end - busy_start) * 1000 / clk_tck ))
+
+	sl_test_info_log "${FUNCNAME}" \
+		"cpu (link_cycles = ${cycle_count}, wall_ms = $(( wall_end_ms - wall_start_ms )), cpu_ms = ${cpu_ms}, cpu_us_per_link_cycle = $(( cpu_ms * 1000 / cycle_count )))"
+
+	sl_test_info_log "${FUNCNAME}" "test_verify"
+	test_verify "${sl_test_link_thrash_notifs}"
+	rtn=$?
+	if [[ "${rtn}" != 0 ]]; then
+		return 1
+	fi
+
+	return 0
+}
+
+SCRIPT_NAME=$(basename $0)
+
+usage="Usage: ${SCRIPT_NAME} [-h | --help] [-b | --brief] [-g | --lgrp_nums] [-c | --count]"
+description=$(cat <<-EOF
+${brief}
+
+Options:
+-b, --brief     Brief test description.
+-c, --count     Number of thrash cycles.
+-g, --lgrp_nums Link group numbers to test.
+-h, --help      This message.
+EOF
+)
+
+options=$(getopt -o "hg:bc:" --long "help,lgrp_nums:,brief,count:" -- "$@")
+
+if [ "$?" != 0 ]; then
+	sl_test_error_log "${SCRIPT_NAME}" "Incorrect number of arguments"
+	echo "${usage}"
+	echo "${description}"
+	exit 1
+fi
+
+eval set -- "${options}"
+
+while true; do
+	case "$1" in
+		-h | --help)
+			echo "${usage}"
+			echo "${description}"
+			exit 0
+			;;
+		-g | --lgrp_nums)
+			lgrp_nums=(${2})
+			shift 2
+			;;
+		-c | --count)
+			num_cycles=$2
+			link_up_cycles=($(seq 0 ${num_cycles}))
+			shift 2
+			;;
+		-b | --brief)
+			echo ${brief}
+			exit 0
+			;;
+		-- )
+			shift
+			break
+			;;
+		* )
+			break
+			;;
+	esac
+done
+
+if [[ "$#" != 0 ]]; then
+	sl_test_error_log "${SCRIPT_NAME}" "Incorrect number of arguments"
+	echo "${usage}"
+	echo "${description}"
+	exit 1
+fi
+
+sl_test_info_log "${SCRIPT_NAME}" "Starting"
+main $1
+main_rtn=$?
+if [[ "${main_rtn}" != 0 ]]; then
+	sl_test_error_log "${SCRIPT_NAME}" "failed [${main_rtn}]"
+else
+	sl_test_info_log "${SCRIPT_NAME}" "cleanup"
+	test_cleanup
+	rtn=$?
+	if [[ "${rtn}" != 0 ]]; then
+		sl_test_error_log "${SCRIPT_NAME}" "test_cleanup failed [${rtn}]"
+	fi
+fi
+
+sl_test_info_log "${SCRIPT_NAME}" "exit (main_rtn = ${main_rtn})"
+exit ${main_rtn}
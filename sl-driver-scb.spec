@@ -101,6 +101,7 @@ for flavor in %flavors_to_build; do
     pushd obj/$flavor
 	# make all-cass STAGING_DIR=$PWD/staging-dir KNL_REL="%{knl_rel}" KDIR=%{kernel_source $flavor} %platform_arg %{?_smp_mflags}
 	make all-cass STAGING_DIR=$PWD/staging-dir KNL_REL="%{knl_rel}" KDIR=/lib/modules/%{knl_rel}/build %platform_arg %{?_smp_mflags}
+	make -C usr/sl_stat sl_stat
     popd
 done
 
@@ -114,6 +115,7 @@ for flavor in %flavors_to_build; do
     make INSTALL_DIR=$RPM_BUILD_ROOT STAGING_DIR=$PWD/staging-dir KNL_REL="%{knl_rel}" KDIR=%{kernel_source $flavor} %platform_arg %{?_smp_mflags} install
     popd
     install -D $PWD/obj/$flavor/drivers/net/ethernet/hep/sl/Module.symvers  $RPM_BUILD_ROOT/%{prefix}/src/sl/$flavor/Module.symvers
+    install -D -m 755 $PWD/obj/$flavor/usr/sl_stat/sl_stat $RPM_BUILD_ROOT/usr/bin/sl_stat
 done
 
 %if 0%{?rhel}
@@ -180,6 +182,7 @@ rm -rf %{buildroot}/${dkms_source_dir}/runBuildPrep.rhel.sh
 rm -rf %{buildroot}/${dkms_source_dir}/set_slingshot_version.sh
 rm -rf %{buildroot}/${dkms_source_dir}/sl-driver.spec
 rm -rf %{buildroot}/${dkms_source_dir}/usr/Makefile
+rm -rf %{buildroot}/${dkms_source_dir}/usr/sl_stat
 
 # QUIRK: copy make configuration into place
 cp source/common/configs/config.mak.cassini.scb %{buildroot}/${dkms_source_dir}/config.mak
@@ -239,10 +242,14 @@ ${postinst} %{name} %{version}-%{release}
 %{_includedir}/linux/hpe/sl/sl_media.h
 %{_includedir}/linux/hpe/sl/sl_test.h
 %{_includedir}/linux/hpe/sl/sl_fec.h
+%{_includedir}/linux/hpe/sl/sl_ldev_stats.h
+%{_includedir}/linux/hpe/sl/sl_ldev_eyes.h
+%{_includedir}/linux/hpe/sl/sl_emu.h
 %{prefix}/src/sl/*/Module.symvers
 /lib/firmware/sl_fw_quad_3.04.bin
 /lib/firmware/sl_fw_octet_3.08.bin
 /usr/bin/slstat
+/usr/bin/sl_stat
 
 %if 0%{?rhel} || 0%{?sle_version} >= 150600
 /lib/modules/%{knl_rel}/module.symvers.sl
@@ -97,6 +97,7 @@ for flavor in %flavors_to_build; do
     cp obj/$flavor/common/configs/config.mak.cassini obj/$flavor/config.mak
     pushd obj/$flavor
     make all-cass STAGING_DIR=$PWD/staging-dir KDIR=%{kernel_source $flavor} %platform_arg %{?_smp_mflags}
+    make -C usr/sl_stat sl_stat
     popd
 done
 
@@ -109,6 +110,7 @@ for flavor in %flavors_to_build; do
     make INSTALL_DIR=$RPM_BUILD_ROOT STAGING_DIR=$PWD/staging-dir KDIR=%{kernel_source $flavor} %platform_arg %{?_smp_mflags} install
     popd
     install -D $PWD/obj/$flavor/drivers/net/ethernet/hpe/sl/Module.symvers  $RPM_BUILD_ROOT/%{prefix}/src/sl/$flavor/Module.symvers
+    install -D -m 755 $PWD/obj/$flavor/usr/sl_stat/sl_stat $RPM_BUILD_ROOT/usr/bin/sl_stat
 done
 
 %if 0%{?rhel}
@@ -175,6 +177,7 @@ rm -rf %{buildroot}/${dkms_source_dir}/runBuildPrep.rhel.sh
 rm -rf %{buildroot}/${dkms_source_dir}/set_slingshot_version.sh
 rm -rf %{buildroot}/${dkms_source_dir}/sl-driver.spec
 rm -rf %{buildroot}/${dkms_source_dir}/usr/Makefile
+rm -rf %{buildroot}/${dkms_source_dir}/usr/sl_stat
 
 # QUIRK: copy make configuration into place
 cp source/common/configs/config.mak.cassini %{buildroot}/${dkms_source_dir}/config.mak
@@ -217,6 +220,7 @@ ${postinst} %{name} %{version}-%{release}
 /lib/firmware/sl_fw_quad_3.04.bin
 /lib/firmware/sl_fw_octet_3.08.bin
 /usr/bin/slstat
+/usr/bin/sl_stat
 
 %files devel
 %{_includedir}/linux/hpe/sl/sl.h
@@ -228,10 +232,14 @@ ${postinst} %{name} %{version}-%{release}
 %{_includedir}/linux/hpe/sl/sl_media.h
 %{_includedir}/linux/hpe/sl/sl_test.h
 %{_includedir}/linux/hpe/sl/sl_fec.h
+%{_includedir}/linux/hpe/sl/sl_ldev_stats.h
+%{_includedir}/linux/hpe/sl/sl_ldev_eyes.h
+%{_includedir}/linux/hpe/sl/sl_emu.h
 %{prefix}/src/sl/*/Module.symvers
 /lib/firmware/sl_fw_quad_3.04.bin
 /lib/firmware/sl_fw_octet_3.08.bin
 /usr/bin/slstat
+/usr/bin/sl_stat
 
 %files dkms -f dkms-files
 
@@ -0,0 +1,1703 @@
+// SPDX-License-Identifier: GPL-2.0
+/* Copyright 2026 Hewlett Packard Enterprise Development LP */
+
+/*
+ * Native slstat.
+ *
+ * Prints the same reports as the slstat script. Attribute files are opened
+ * once and re-read with pread, so repeat mode only costs one syscall per
+ * changing attribute. Targets (ldev:lgrp:link) are collected concurrently,
+ * each worker renders into its own buffer and the buffers are printed in
+ * target order.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <getopt.h>
+#include <fcntl.h>
+#include <time.h>
+#include <errno.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#define MAJOR                 1
+#define MINOR                 16
+#define VERSION               "1.16"
+
+#define SW_SYSFS              "/sys/class/rossw"
+#define NIC_SYSFS             "/sys/class/cxi"
+#define ROOT_ENV              "SLSTAT_SYSFS_ROOT"
+
+#define ATTR_VAL_SIZE         256
+#define ATTR_TABLE_SIZE_INIT  256
+#define TARGETS_MAX           4096
+#define LANES_MAX             4
+#define ANY_NUM               -1
+#define NO_NUM                -2
+
+#define HELP_SHORT_OPT        'h'
+#define VERSION_SHORT_OPT     'v'
+#define JSON_SHORT_OPT        'j'
+#define COUNT_SHORT_OPT       'c'
+#define INTERVAL_SHORT_OPT    'i'
+#define THREADS_SHORT_OPT     't'
+#define ROOT_SHORT_OPT        'r'
+
+enum {
+	OPT_HELP,
+	OPT_VERSION,
+	OPT_JSON,
+	OPT_COUNT,
+	OPT_INTERVAL,
+	OPT_THREADS,
+	OPT_ROOT,
+	NUM_OPTS,
+};
+
+static const char getopt_short_opts[] = {
+	HELP_SHORT_OPT,
+	VERSION_SHORT_OPT,
+	JSON_SHORT_OPT,
+	COUNT_SHORT_OPT,
+	':',                  /* Has argument */
+	INTERVAL_SHORT_OPT,
+	':',                  /* Has argument */
+	THREADS_SHORT_OPT,
+	':',                  /* Has argument */
+	ROOT_SHORT_OPT,
+	':',                  /* Has argument */
+	'\0',
+};
+
+static const struct cmd_option {
+	const char  short_option;
+	const char *long_option;
+	const char *description;
+	const char *argument_name;
+	const int   required;
+} cmd_options[] = {
+	[OPT_HELP]     = {HELP_SHORT_OPT,     "help",     "This help message.",                                NULL,       no_argument       },
+	[OPT_VERSION]  = {VERSION_SHORT_OPT,  "version",  "Print the version information.",                    NULL,       no_argument       },
+	[OPT_JSON]     = {JSON_SHORT_OPT,     "json",     "Print one JSON document per pass.",                 NULL,       no_argument       },
+	[OPT_COUNT]    = {COUNT_SHORT_OPT,    "count",    "Number of passes, 0 repeats until interrupted.",    "COUNT",    required_argument },
+	[OPT_INTERVAL] = {INTERVAL_SHORT_OPT, "interval", "Milliseconds between passes (default 1000).",       "INTERVAL", required_argument },
+	[OPT_THREADS]  = {THREADS_SHORT_OPT,  "threads",  "Worker threads (default online CPUs).",             "THREADS",  required_argument },
+	[OPT_ROOT]     = {ROOT_SHORT_OPT,     "root",     "Prefix for the sysfs paths (default $" ROOT_ENV ").", "ROOT",     required_argument },
+};
+
+static struct option long_options[] = {
+	{ "help",     no_argument,       NULL, HELP_SHORT_OPT     },
+	{ "version",  no_argument,       NULL, VERSION_SHORT_OPT  },
+	{ "json",     no_argument,       NULL, JSON_SHORT_OPT     },
+	{ "count",    required_argument, NULL, COUNT_SHORT_OPT    },
+	{ "interval", required_argument, NULL, INTERVAL_SHORT_OPT },
+	{ "threads",  required_argument, NULL, THREADS_SHORT_OPT  },
+	{ "root",     required_argument, NULL, ROOT_SHORT_OPT     },
+	{0, 0, 0, 0}
+};
+
+enum report {
+	REPORT_ALL,
+	REPORT_STATE,
+	REPORT_LINK,
+	REPORT_MAC,
+	REPORT_LLR,
+	REPORT_PMI,
+	REPORT_SBUS,
+	REPORT_SBUS_PMI,
+	REPORT_SERDES,
+	REPORT_FEC,
+	REPORT_CABLE,
+	REPORT_COUNTERS,
+	REPORT_SHOW_DB,
+	REPORT_USE_TEST,
+};
+
+static const char *report_names[] = {
+	[REPORT_ALL]      = "",
+	[REPORT_STATE]    = "state",
+	[REPORT_LINK]     = "link",
+	[REPORT_MAC]      = "mac",
+	[REPORT_LLR]      = "llr",
+	[REPORT_PMI]      = "pmi",
+	[REPORT_SBUS]     = "sbus",
+	[REPORT_SBUS_PMI] = "sbus_pmi",
+	[REPORT_SERDES]   = "serdes",
+	[REPORT_FEC]      = "fec",
+	[REPORT_CABLE]    = "cable",
+	[REPORT_COUNTERS] = "counters",
+	[REPORT_SHOW_DB]  = "show_db",
+	[REPORT_USE_TEST] = "use_test",
+};
+
+/*
+ * Attributes that only change on reconfiguration. In repeat mode these are
+ * read on the first pass only.
+ */
+static const char *static_attr_strs[] = {
+	"/config/",
+	"/caps/",
+	"/policies/",
+	"/settings/",
+	"/swizzle/",
+	"/sl_info/",
+	"/supported_cables/",
+	"/serdes/hw_version",
+	"/serdes/fw_version",
+};
+
+struct attr {
+	char        *path;
+	const char  *key;            /* path relative to the target */
+	int          fd;
+	bool         is_static;
+	bool         is_read;
+	bool         is_changed;
+	char         val[ATTR_VAL_SIZE];
+	char         prev[ATTR_VAL_SIZE];
+	struct attr *next;           /* read order */
+};
+
+struct dir_list {
+	char            *path;
+	char           **names;
+	int              count;
+	struct dir_list *next;
+};
+
+struct target {
+	int              ldev_num;
+	int              lgrp_num;
+	int              link_num;
+
+	char             ldev_path[PATH_MAX];
+	char             lgrp_path[PATH_MAX];
+	char             link_path[PATH_MAX];
+	char             mac_path[PATH_MAX];
+	char             llr_path[PATH_MAX];
+	char             media_path[PATH_MAX];
+	const char      *key_base;
+
+	struct attr    **table;
+	size_t           table_size;
+	size_t           num_attrs;
+	struct attr     *first;
+	struct attr     *last;
+	struct dir_list *dirs;
+
+	char            *buf;
+	size_t           buf_len;
+	FILE            *out;
+};
+
+static const char    *sysfs_root = "";
+static bool           is_switch;
+static const char    *port_dir = "port";
+static enum report    report;
+static int            num_args;
+static bool           json;
+
+static struct target *targets[TARGETS_MAX];
+static int            num_targets;
+static int            next_target;
+
+/* ==================== attribute cache ==================== */
+
+static void path_fmt(char *path, size_t len, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+
+static void path_fmt(char *path, size_t len, const char *fmt, ...)
+{
+	va_list args;
+
+	va_start(args, fmt);
+	vsnprintf(path, len, fmt, args);
+	va_end(args);
+}
+
+static uint64_t hash_str(const char *str)
+{
+	uint64_t hash = 0xcbf29ce484222325ULL;
+
+	while (*str) {
+		hash ^= (unsigned char)*str++;
+		hash *= 0x100000001b3ULL;
+	}
+
+	return hash;
+}
+
+static bool is_static_attr(const char *path)
+{
+	size_t x;
+
+	for (x = 0; x < (sizeof(static_attr_strs) / sizeof(static_attr_strs[0])); ++x) {
+		if (strstr(path, static_attr_strs[x]))
+			return true;
+	}
+
+	return false;
+}
+
+static void table_grow(struct target *t)
+{
+	struct attr **table;
+	struct attr  *attr;
+	size_t        size;
+	size_t        idx;
+
+	size  = t->table_size ? (t->table_size * 2) : ATTR_TABLE_SIZE_INIT;
+	table = calloc(size, sizeof(*table));
+	if (!table) {
+		perror("calloc failed");
+		exit(ENOMEM);
+	}
+
+	for (attr = t->first; attr; attr = attr->next) {
+		idx = hash_str(attr->path) & (size - 1);
+		while (table[idx])
+			idx = (idx + 1) & (size - 1);
+		table[idx] = attr;
+	}
+
+	free(t->table);
+	t->table      = table;
+	t->table_size = size;
+}
+
+static void attr_read(struct attr *attr)
+{
+	ssize_t len;
+
+	attr->is_read = true;
+
+	if (attr->fd < 0) {
+		attr->val[0] = '\0';
+		return;
+	}
+
+	len = pread(attr->fd, attr->val, sizeof(attr->val) - 1, 0);
+	if (len < 0)
+		len = 0;
+
+	/* strip trailing newlines like $(cat ...) */
+	while ((len > 0) && (attr->val[len - 1] == '\n'))
+		len--;
+	attr->val[len] = '\0';
+}
+
+static struct attr *attr_find(struct target *t, const char *path)
+{
+	struct attr *attr;
+	size_t       idx;
+	size_t       base_len;
+
+	if ((t->num_attrs + 1) * 10 > t->table_size * 7)
+		table_grow(t);
+
+	idx = hash_str(path) & (t->table_size - 1);
+	while (t->table[idx]) {
+		if (!strcmp(t->table[idx]->path, path))
+			return t->table[idx];
+		idx = (idx + 1) & (t->table_size - 1);
+	}
+
+	attr = calloc(1, sizeof(*attr));
+	if (!attr) {
+		perror("calloc failed");
+		exit(ENOMEM);
+	}
+	attr->path = strdup(path);
+	if (!attr->path) {
+		perror("strdup failed");
+		exit(ENOMEM);
+	}
+
+	base_len = strlen(t->key_base);
+	if (!strncmp(attr->path, t->key_base, base_len) && (attr->path[base_len] == '/'))
+		attr->key = attr->path + base_len + 1;
+	else
+		attr->key = attr->path;
+
+	attr->is_static = is_static_attr(attr->path);
+	attr->fd        = open(attr->path, O_RDONLY | O_CLOEXEC);
+
+	t->table[idx] = attr;
+	t->num_attrs++;
+	if (t->last)
+		t->last->next = attr;
+	else
+		t->first = attr;
+	t->last = attr;
+
+	return attr;
+}
+
+static const char *attr_get(struct target *t, const char *base, const char *fmt, ...)
+	__attribute__((format(printf, 3, 4)));
+
+static const char *attr_get(struct target *t, const char *base, const char *fmt, ...)
+{
+	va_list      args;
+	char         path[PATH_MAX];
+	int          len;
+	struct attr *attr;
+
+	len = snprintf(path, sizeof(path), "%s/", base);
+	va_start(args, fmt);
+	vsnprintf(path + len, sizeof(path) - len, fmt, args);
+	va_end(args);
+
+	attr = attr_find(t, path);
+	if (!attr->is_read)
+		attr_read(attr);
+
+	return attr->val;
+}
+
+static long long attr_num(const char *val)
+{
+	return strtoll(val, NULL, 0);
+}
+
+static bool path_exists(const char *base, const char *rel)
+{
+	char path[PATH_MAX];
+
+	if (rel)
+		path_fmt(path, sizeof(path), "%s/%s", base, rel);
+	else
+		path_fmt(path, sizeof(path), "%s", base);
+
+	return (access(path, F_OK) == 0);
+}
+
+static int dir_filter(const struct dirent *entry)
+{
+	return (entry->d_name[0] != '.');
+}
+
+static int dir_compare(const struct dirent **a, const struct dirent **b)
+{
+	return strcmp((*a)->d_name, (*b)->d_name);
+}
+
+/* directory listings are taken once per target */
+static struct dir_list *dir_get(struct target *t, const char *path)
+{
+	struct dir_list  *dir;
+	struct dirent   **entries;
+	int               x;
+
+	for (dir = t->dirs; dir; dir = dir->next) {
+		if (!strcmp(dir->path, path))
+			return dir;
+	}
+
+	dir = calloc(1, sizeof(*dir));
+	if (!dir) {
+		perror("calloc failed");
+		exit(ENOMEM);
+	}
+	dir->path = strdup(path);
+
+	dir->count = scandir(path, &entries, dir_filter, dir_compare);
+	if (dir->count < 0) {
+		dir->count = 0;
+	} else {
+		dir->names = calloc(dir->count + 1, sizeof(*dir->names));
+		for (x = 0; x < dir->count; ++x) {
+			dir->names[x] = strdup(entries[x]->d_name);
+			free(entries[x]);
+		}
+		free(entries);
+	}
+
+	dir->next = t->dirs;
+	t->dirs   = dir;
+
+	return dir;
+}
+
+/* ==================== output ==================== */
+
+static void out(struct target *t, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+static void out(struct target *t, const char *fmt, ...)
+{
+	va_list args;
+
+	if (json)
+		return;
+
+	va_start(args, fmt);
+	vfprintf(t->out, fmt, args);
+	va_end(args);
+}
+
+static bool is_json_num(const char *val)
+{
+	const char *ptr = val;
+
+	if (*ptr == '-')
+		ptr++;
+	if (!*ptr)
+		return false;
+	if ((ptr[0] == '0') && ptr[1])
+		return false;
+	for (; *ptr; ++ptr) {
+		if ((*ptr < '0') || (*ptr > '9'))
+			return false;
+	}
+
+	return true;
+}
+
+static void json_str(FILE *file, const char *str)
+{
+	fputc('"', file);
+	for (; *str; ++str) {
+		switch (*str) {
+		case '"':
+			fputs("\\\"", file);
+			break;
+		case '\\':
+			fputs("\\\\", file);
+			break;
+		case '\n':
+			fputs("\\n", file);
+			break;
+		case '\t':
+			fputs("\\t", file);
+			break;
+		default:
+			if ((unsigned char)*str < 0x20)
+				fprintf(file, "\\u%04x", *str);
+			else
+				fputc(*str, file);
+		}
+	}
+	fputc('"', file);
+}
+
+static void json_attrs(struct target *t, FILE *file, bool changed_only)
+{
+	struct attr *attr;
+	bool         first;
+
+	first = true;
+	fputs("{", file);
+	for (attr = t->first; attr; attr = attr->next) {
+		if ((attr->fd < 0) || (changed_only && !attr->is_changed))
+			continue;
+		if (!first)
+			fputc(',', file);
+		first = false;
+		json_str(file, attr->key);
+		fputc(':', file);
+		if (is_json_num(attr->val))
+			fputs(attr->val, file);
+		else
+			json_str(file, attr->val);
+	}
+	fputs("}", file);
+}
+
+/* ==================== reports ==================== */
+
+static void print_ldev(struct target *t)
+{
+	char name[32];
+	char hash[80];
+
+	if (!path_exists(t->ldev_path, NULL))
+		return;
+
+	snprintf(name, sizeof(name), "slstat v%d.%d", MAJOR, MINOR);
+	snprintf(hash, sizeof(hash), "hash: %s", attr_get(t, t->ldev_path, "sl_info/mod_hash"));
+
+	out(t, "-------------------------------------------------------------------------------------------\n");
+	out(t, " %-19s SL %-19s %45s\n", name, attr_get(t, t->ldev_path, "sl_info/mod_ver"), hash);
+	out(t, "-----------+-------------------------------------------------------------------------------\n");
+}
+
+static bool is_dir(const char *base, const char *name)
+{
+	char        path[PATH_MAX];
+	struct stat st;
+
+	path_fmt(path, sizeof(path), "%s/%s", base, name);
+
+	return (!stat(path, &st) && S_ISDIR(st.st_mode));
+}
+
+static void print_supported_db(struct target *t)
+{
+	char             sc_path[PATH_MAX];
+	char             type_path[PATH_MAX];
+	char             vendor_path[PATH_MAX];
+	char             part_path[PATH_MAX];
+	struct dir_list *types;
+	struct dir_list *vendors;
+	struct dir_list *parts;
+	const char      *length;
+	int              x, y, z;
+	bool             type_printed;
+	bool             vendor_printed;
+
+	path_fmt(sc_path, sizeof(sc_path), "%s/supported_cables", t->ldev_path);
+	if (!is_dir(sc_path, "."))
+		return;
+
+	out(t, "%-10s | ", "cable_db");
+	out(t, "%-7s  %-12s  %-30s  %-9s\n", "type", "vendor", "part_num", "length_cm");
+	out(t, "%-10s | ", "");
+	out(t, "%s\n", "----------------------------------------------------------------");
+
+	types = dir_get(t, sc_path);
+	for (x = 0; x < types->count; ++x) {
+		if (!is_dir(sc_path, types->names[x]))
+			continue;
+		path_fmt(type_path, sizeof(type_path), "%s/%s", sc_path, types->names[x]);
+		type_printed = false;
+
+		vendors = dir_get(t, type_path);
+		for (y = 0; y < vendors->count; ++y) {
+			if (!is_dir(type_path, vendors->names[y]))
+				continue;
+			path_fmt(vendor_path, sizeof(vendor_path), "%s/%s", type_path, vendors->names[y]);
+			vendor_printed = false;
+
+			parts = dir_get(t, vendor_path);
+			for (z = 0; z < parts->count; ++z) {
+				if (!is_dir(vendor_path, parts->names[z]))
+					continue;
+				path_fmt(part_path, sizeof(part_path), "%s/%s", vendor_path, parts->names[z]);
+
+				if (path_exists(part_path, "length_cm"))
+					length = attr_get(t, part_path, "length_cm");
+				else
+					length = "?";
+
+				out(t, "%-10s | ", "");
+				out(t, "%-7s  %-12s  %-30s  %-9s\n",
+					type_printed ? "" : types->names[x],
+					vendor_printed ? "" : vendors->names[y],
+					parts->names[z], length);
+
+				type_printed   = true;
+				vendor_printed = true;
+			}
+		}
+	}
+}
+
+static bool is_active_cable(const char *type)
+{
+	return (!strcmp(type, "AEC") || !strcmp(type, "AOC") ||
+		!strcmp(type, "ACC") || !strcmp(type, "POC"));
+}
+
+static void print_jack_state(struct target *t)
+{
+	const char *type;
+	const char *temp_c;
+
+	if (!path_exists(t->lgrp_path, "media"))
+		return;
+
+	out(t, "jack%03lld    | state: %s, shift: %s, power: %s\n",
+		attr_num(attr_get(t, t->lgrp_path, "media/jack_num")),
+		attr_get(t, t->lgrp_path, "media/state"),
+		attr_get(t, t->lgrp_path, "media/cable_shift_state"),
+		attr_get(t, t->lgrp_path, "media/jack_power_state"));
+
+	type = attr_get(t, t->lgrp_path, "media/type");
+	if (!is_active_cable(type))
+		return;
+
+	temp_c = attr_get(t, t->lgrp_path, "media/temperature_celsius");
+	if (!strcmp(temp_c, "unsupported-format") || !strcmp(temp_c, "no-cable") ||
+		!strcmp(temp_c, "not-active") || !strcmp(temp_c, "io-error")) {
+		out(t, "           | temperature: %s\n", temp_c);
+		return;
+	}
+
+	out(t, "           | temperature: %sc (state = %s, warn_limit: %sc, down_limit: %sc)\n", temp_c,
+		attr_get(t, t->lgrp_path, "media/temperature_state"),
+		attr_get(t, t->lgrp_path, "media/temperature_warn_limit_celsius"),
+		attr_get(t, t->lgrp_path, "media/temperature_down_limit_celsius"));
+}
+
+static void print_link_state(struct target *t)
+{
+	const char *up_time;
+	const char *time_to_link_up;
+	const char *units;
+	long long   ms;
+
+	if (!path_exists(t->link_path, NULL))
+		return;
+
+	up_time         = attr_get(t, t->link_path, "up_time_ms");
+	time_to_link_up = attr_get(t, t->link_path, "time_to_link_up_ms");
+	units           = strcmp(time_to_link_up, "no-link") ? "ms" : "";
+
+	if (!strcmp(up_time, "no-link")) {
+		out(t, "link%d      | state: %s\n", t->link_num, attr_get(t, t->link_path, "state"));
+	} else {
+		ms = attr_num(up_time);
+		out(t, "link%d      | state: %s  [%lldd %lldh %lldm %llds %lldms]\n", t->link_num,
+			attr_get(t, t->link_path, "state"), ms / 1000 / 60 / 60 / 24, ms / 1000 / 60 / 60 % 24,
+			ms / 1000 / 60 % 60, ms / 1000 % 60, ms % 1000);
+	}
+	out(t, "           | speed: %s\n", attr_get(t, t->link_path, "speed"));
+	out(t, "           | time_to_link_up: %s%s, total_time_to_link_up: %s%s\n", time_to_link_up, units,
+		attr_get(t, t->link_path, "total_time_to_link_up_ms"), units);
+	out(t, "           | info_map: %s\n", attr_get(t, t->link_path, "info_map"));
+}
+
+static void print_mac_state(struct target *t)
+{
+	if (!path_exists(t->mac_path, NULL))
+		return;
+
+	out(t, "mac%d       | state: tx %s, rx %s\n", t->link_num,
+		attr_get(t, t->mac_path, "tx_state"), attr_get(t, t->mac_path, "rx_state"));
+	out(t, "           | last_start_result: tx = %s, rx = %s\n",
+		attr_get(t, t->mac_path, "tx_last_start_result"),
+		attr_get(t, t->mac_path, "rx_last_start_result"));
+	out(t, "           | info_map: %s\n", attr_get(t, t->mac_path, "info_map"));
+}
+
+static void print_llr_state(struct target *t)
+{
+	if (!path_exists(t->llr_path, NULL))
+		return;
+
+	out(t, "llr%d       | state: %s\n", t->link_num, attr_get(t, t->llr_path, "state"));
+	out(t, "           | info_map: %s\n", attr_get(t, t->llr_path, "info_map"));
+}
+
+static bool is_cause_counter(const char *name)
+{
+	return (!strncmp(name, "cause_", 6) || !strncmp(name, "an_cause_", 9));
+}
+
+static void print_counters(struct target *t, const char *base, const char *lead,
+			   int width, bool causes)
+{
+	char             path[PATH_MAX];
+	struct dir_list *dir;
+	bool             first;
+	int              x;
+
+	if (!path_exists(base, "counters"))
+		return;
+
+	path_fmt(path, sizeof(path), "%s/counters", base);
+	dir = dir_get(t, path);
+
+	first = true;
+	out(t, "%s", lead);
+	for (x = 0; x < dir->count; ++x) {
+		if (is_cause_counter(dir->names[x]) != causes)
+			continue;
+		out(t, "%s %*s = %s\n", first ? "" : "           |", width, dir->names[x],
+			attr_get(t, path, "%s", dir->names[x]));
+		first = false;
+	}
+}
+
+static void print_jack(struct target *t)
+{
+	static const char *speeds[] = {
+		"cd50G", "bj100G", "cd100G", "bs200G", "ck100G", "ck200G", "ck400G", "ck800G",
+	};
+	const char *type;
+	const char *length;
+	bool        have_speed;
+	size_t      x;
+
+	if (!path_exists(t->lgrp_path, "media"))
+		return;
+
+	type   = attr_get(t, t->lgrp_path, "media/type");
+	length = attr_get(t, t->lgrp_path, "media/length_cm");
+
+	print_jack_state(t);
+
+	out(t, "           | cable: %s %s %s%s          (serial#: %s)\n",
+		attr_get(t, t->lgrp_path, "media/vendor"), type, length,
+		(!strcmp(length, "unsupported-format") || !strcmp(length, "no-cable")) ? "" : "cm",
+		attr_get(t, t->lgrp_path, "media/serial_num"));
+	out(t, "           |        vendor part#: %s, hpe part#: %s, data_code: %s\n",
+		attr_get(t, t->lgrp_path, "media/vendor_part_num"),
+		attr_get(t, t->lgrp_path, "media/hpe_part_num"),
+		attr_get(t, t->lgrp_path, "media/date_code"));
+	out(t, "           |        type: %s, shape: %s, end: %s, jack_part: %s\n",
+		attr_get(t, t->lgrp_path, "media/jack_type"),
+		attr_get(t, t->lgrp_path, "media/shape"),
+		attr_get(t, t->lgrp_path, "media/cable_end"),
+		attr_get(t, t->lgrp_path, "media/jack_part"));
+	out(t, "           |        furcation: %s\n", attr_get(t, t->lgrp_path, "media/furcation"));
+	out(t, "           | is_supported_cable: %s, is_supported_ss200_cable: %s\n",
+		attr_get(t, t->lgrp_path, "media/is_supported_cable"),
+		attr_get(t, t->lgrp_path, "media/is_supported_ss200_cable"));
+	if (is_active_cable(type)) {
+		out(t, "           | active_cable: fw_ver_hex: %s (target_fw_ver_hex = %s)\n",
+			attr_get(t, t->lgrp_path, "media/firmware_version_hex"),
+			attr_get(t, t->lgrp_path, "media/target_firmware_version_hex"));
+		out(t, "           | active_cable_200g: host_interface: %s, lane_count: %s, appselect: %s\n",
+			attr_get(t, t->lgrp_path, "media/active_cable_200g_host_interface"),
+			attr_get(t, t->lgrp_path, "media/active_cable_200g_lane_count"),
+			attr_get(t, t->lgrp_path, "media/active_cable_200g_appsel_num"));
+		out(t, "           | active_cable_400g: host_interface: %s, lane_count: %s, appselect: %s\n",
+			attr_get(t, t->lgrp_path, "media/active_cable_400g_host_interface"),
+			attr_get(t, t->lgrp_path, "media/active_cable_400g_lane_count"),
+			attr_get(t, t->lgrp_path, "media/active_cable_400g_appsel_num"));
+	}
+	out(t, "           | speeds: ");
+	have_speed = false;
+	for (x = 0; x < (sizeof(speeds) / sizeof(speeds[0])); ++x) {
+		char speed[32];
+
+		snprintf(speed, sizeof(speed), "media/speeds/%s", speeds[x]);
+		if (path_exists(t->lgrp_path, speed)) {
+			out(t, "%s ", speeds[x]);
+			have_speed = true;
+		}
+	}
+	if (!have_speed)
+		out(t, "none ");
+	out(t, "\n");
+	out(t, "           |         max_speed: %s\n", attr_get(t, t->lgrp_path, "media/max_speed"));
+	out(t, "           | error_info: %s\n", attr_get(t, t->lgrp_path, "media/error_info"));
+	out(t, "           | last_fault_cause: [%s] %s\n",
+		attr_get(t, t->lgrp_path, "media/last_fault_time"),
+		attr_get(t, t->lgrp_path, "media/last_fault_cause"));
+}
+
+static void print_lgrp(struct target *t)
+{
+	if (!path_exists(t->lgrp_path, "config"))
+		return;
+
+	out(t, "lgrp%02d     | furcation  : %s\n", t->lgrp_num, attr_get(t, t->lgrp_path, "config/furcation"));
+	out(t, "           | mfs        : %s\n", attr_get(t, t->lgrp_path, "config/mfs"));
+	out(t, "           | technology : %s\n", attr_get(t, t->lgrp_path, "config/tech_map"));
+	out(t, "           | fec        : %s  (fec_mode = %s)\n",
+		attr_get(t, t->lgrp_path, "config/fec_map"), attr_get(t, t->lgrp_path, "config/fec_mode"));
+	out(t, "           | link_type  : %s\n", attr_get(t, t->lgrp_path, "config/link_type"));
+	out(t, "           | loopback   : %s\n", attr_get(t, t->lgrp_path, "config/loopback"));
+	out(t, "           | fabric_link: %s\n", attr_get(t, t->lgrp_path, "config/fabric_link"));
+	out(t, "           | r1_partner : %s\n", attr_get(t, t->lgrp_path, "config/r1_partner"));
+}
+
+static void print_ald_state(struct target *t)
+{
+	const char *state;
+	const char *units;
+
+	if (!path_exists(t->link_path, NULL))
+		return;
+
+	state = attr_get(t, t->link_path, "auto_lane_degrade/state");
+	units = strcmp(state, "active") ? "" : "Gbps";
+
+	out(t, "   degrade | state: %s\n", state);
+	out(t, "           | is_recoverable: %s\n", attr_get(t, t->link_path, "auto_lane_degrade/is_recoverable"));
+	out(t, "           | is_rx_degraded: %s (lane_map = %s, speed = %s%s)\n",
+		attr_get(t, t->link_path, "auto_lane_degrade/is_rx_degraded"),
+		attr_get(t, t->link_path, "auto_lane_degrade/rx_degrade_map"),
+		attr_get(t, t->link_path, "auto_lane_degrade/rx_link_speed_gbps"), units);
+	out(t, "           | is_tx_degraded: %s (lane_map = %s, speed = %s%s)\n",
+		attr_get(t, t->link_path, "auto_lane_degrade/is_tx_degraded"),
+		attr_get(t, t->link_path, "auto_lane_degrade/tx_degrade_map"),
+		attr_get(t, t->link_path, "auto_lane_degrade/tx_link_speed_gbps"), units);
+}
+
+static void print_link(struct target *t)
+{
+	int entry_num;
+
+	if (!path_exists(t->link_path, NULL))
+		return;
+
+	print_link_state(t);
+
+	out(t, "           | link_up_timeout: %sms (max tries = %s)\n",
+		attr_get(t, t->link_path, "config/link_up_timeout_ms"),
+		attr_get(t, t->link_path, "config/link_up_tries_max"));
+	out(t, "    causes | last_autoneg_fail: [%s] %s\n",
+		attr_get(t, t->link_path, "last_autoneg_fail_time"),
+		attr_get(t, t->link_path, "last_autoneg_fail_cause"));
+	for (entry_num = 0; entry_num < 10; ++entry_num)
+		out(t, "           | %-15s %d: [%s] %s\n", entry_num ? "" : "last_down", entry_num,
+			attr_get(t, t->link_path, "last_down/time_%d", entry_num),
+			attr_get(t, t->link_path, "last_down/cause_map_%d", entry_num));
+	for (entry_num = 0; entry_num < 10; ++entry_num)
+		out(t, "           | %-15s %d: [%s] %s\n", entry_num ? "" : "last_up_fail", entry_num,
+			attr_get(t, t->link_path, "last_up_fail/up_fail_time_%d", entry_num),
+			attr_get(t, t->link_path, "last_up_fail/up_fail_cause_map_%d", entry_num));
+	out(t, "  policies | keep_serdes_up           : %s\n", attr_get(t, t->link_path, "policies/keep_serdes_up"));
+	out(t, "           | use_unsupported_cable    : %s\n", attr_get(t, t->link_path, "policies/use_unsupported_cable"));
+	out(t, "           | use_supported_ss200_cable: %s\n", attr_get(t, t->link_path, "policies/use_supported_ss200_cable"));
+	out(t, "           | ignore_media_error       : %s\n", attr_get(t, t->link_path, "policies/ignore_media_error"));
+	out(t, "           | fec_monitor: period = %sms\n", attr_get(t, t->link_path, "policies/fec_mon_period_ms"));
+	out(t, "           |              ccw_warn_limit = %s, ucw_warn_limit = %s\n",
+		attr_get(t, t->link_path, "policies/fec_mon_ccw_warn_limit"),
+		attr_get(t, t->link_path, "policies/fec_mon_ucw_warn_limit"));
+	out(t, "           |              ccw_down_limit = %s, ucw_down_limit = %s\n",
+		attr_get(t, t->link_path, "policies/fec_mon_ccw_down_limit"),
+		attr_get(t, t->link_path, "policies/fec_mon_ucw_down_limit"));
+	out(t, "    config | hpe              : %s\n", attr_get(t, t->link_path, "config/hpe_map"));
+	out(t, "           | autoneg          : %s\n", attr_get(t, t->link_path, "config/autoneg"));
+	out(t, "           | loopback         : %s\n", attr_get(t, t->link_path, "config/loopback"));
+	out(t, "           | pause            : %s\n", attr_get(t, t->link_path, "config/pause_map"));
+	out(t, "           | pml_recovery     : %s\n", attr_get(t, t->link_path, "config/pml_recovery"));
+	out(t, "           | auto_lane_degrade: %s\n", attr_get(t, t->link_path, "config/auto_lane_degrade"));
+	out(t, "   autoneg | pause_caps: %s\n", attr_get(t, t->link_path, "caps/pause_map"));
+	out(t, "           | tech_caps : %s\n", attr_get(t, t->link_path, "caps/tech_map"));
+	out(t, "           | fec_caps  : %s\n", attr_get(t, t->link_path, "caps/fec_map"));
+	out(t, "           | hpe_caps  : %s\n", attr_get(t, t->link_path, "caps/hpe_map"));
+	out(t, "  recovery | attempts : %s\n", attr_get(t, t->link_path, "pml_recovery/pml_rec_attempts"));
+	out(t, "           | successes: %s\n", attr_get(t, t->link_path, "pml_recovery/pml_rec_successes"));
+	out(t, "           | rate_limit_exceeded     : %s\n",
+		attr_get(t, t->link_path, "pml_recovery/pml_rec_rate_limit_exceeded"));
+	out(t, "           | link_down_cause         : %s\n",
+		attr_get(t, t->link_path, "pml_recovery/pml_rec_link_down_cause"));
+	out(t, "           | link_down_failed_cause  : %s\n",
+		attr_get(t, t->link_path, "pml_recovery/pml_rec_link_down_failed_cause"));
+	out(t, "           | local_fault_cause       : %s\n",
+		attr_get(t, t->link_path, "pml_recovery/pml_rec_link_fault_cause"));
+	out(t, "           | local_fault_failed_cause: %s\n",
+		attr_get(t, t->link_path, "pml_recovery/pml_rec_link_fault_failed_cause"));
+
+	print_ald_state(t);
+}
+
+static void print_llr(struct target *t)
+{
+	if (!path_exists(t->llr_path, NULL))
+		return;
+
+	print_llr_state(t);
+
+	out(t, "           | loop_calc: %sns, loop_min: %sns, loop_max: %sns, loop_avg: %sns\n",
+		attr_get(t, t->llr_path, "loop/calc_ns"), attr_get(t, t->llr_path, "loop/min_ns"),
+		attr_get(t, t->llr_path, "loop/max_ns"), attr_get(t, t->llr_path, "loop/average_ns"));
+	out(t, "           | mode: %s, link_down_behavior: %s\n",
+		attr_get(t, t->llr_path, "config/mode"), attr_get(t, t->llr_path, "config/link_down_behavior"));
+	out(t, "           | setup_timeout: %sms, start_timeout: %sms\n",
+		attr_get(t, t->llr_path, "config/setup_timeout_ms"),
+		attr_get(t, t->llr_path, "config/start_timeout_ms"));
+	out(t, "           | continuous_tries: %s\n", attr_get(t, t->llr_path, "policies/continuous_tries"));
+	out(t, "           | last_fail_cause: [%s] %s\n",
+		attr_get(t, t->llr_path, "last_fail_time"), attr_get(t, t->llr_path, "last_fail_cause"));
+}
+
+static void print_pmi(struct target *t)
+{
+	if (!path_exists(t->lgrp_path, "pmi"))
+		return;
+
+	out(t, "pmi        | rd: addr = %s, data = %s, dev_id = %s, lane = %s, pll = %s, result = %s\n",
+		attr_get(t, t->lgrp_path, "pmi/rd/addr"), attr_get(t, t->lgrp_path, "pmi/rd/data"),
+		attr_get(t, t->lgrp_path, "pmi/rd/dev_id"), attr_get(t, t->lgrp_path, "pmi/rd/lane"),
+		attr_get(t, t->lgrp_path, "pmi/rd/pll"), attr_get(t, t->lgrp_path, "pmi/rd/result"));
+	out(t, "           | wr: addr = %s, data = %s, mask = %s, dev_id = %s, lane = %s, pll = %s, result = %s\n",
+		attr_get(t, t->lgrp_path, "pmi/wr/addr"), attr_get(t, t->lgrp_path, "pmi/wr/data"),
+		attr_get(t, t->lgrp_path, "pmi/wr/mask"), attr_get(t, t->lgrp_path, "pmi/wr/dev_id"),
+		attr_get(t, t->lgrp_path, "pmi/wr/lane"), attr_get(t, t->lgrp_path, "pmi/wr/pll"),
+		attr_get(t, t->lgrp_path, "pmi/wr/result"));
+}
+
+static void print_sbus(struct target *t)
+{
+	if (!path_exists(t->lgrp_path, "sbus"))
+		return;
+
+	out(t, "sbus       | rd:  dev_addr = %s, data = %s, mask = %s, reg = %s, lsb = %s, result = %s\n",
+		attr_get(t, t->lgrp_path, "sbus/rd/dev_addr"), attr_get(t, t->lgrp_path, "sbus/rd/data"),
+		attr_get(t, t->lgrp_path, "sbus/rd/mask"), attr_get(t, t->lgrp_path, "sbus/rd/reg"),
+		attr_get(t, t->lgrp_path, "sbus/rd/lsb"), attr_get(t, t->lgrp_path, "sbus/rd/result"));
+	out(t, "           | wr:  dev_addr = %s, data = %s, mask = %s, reg = %s, lsb = %s, result = %s\n",
+		attr_get(t, t->lgrp_path, "sbus/wr/dev_addr"), attr_get(t, t->lgrp_path, "sbus/wr/data"),
+		attr_get(t, t->lgrp_path, "sbus/wr/mask"), attr_get(t, t->lgrp_path, "sbus/wr/reg"),
+		attr_get(t, t->lgrp_path, "sbus/wr/lsb"), attr_get(t, t->lgrp_path, "sbus/wr/result"));
+	out(t, "           | rst: dev_addr = %s, result = %s\n",
+		attr_get(t, t->lgrp_path, "sbus/rst/dev_addr"), attr_get(t, t->lgrp_path, "sbus/rst/result"));
+}
+
+static void print_sbus_pmi(struct target *t)
+{
+	if (!path_exists(t->lgrp_path, "sbus_pmi"))
+		return;
+
+	out(t, "sbus_pmi   | rd: dev_addr = %s, addr = %s, data = %s, mask = %s, dev_id = %s, lane = %s, pll = %s, result = %s\n",
+		attr_get(t, t->lgrp_path, "sbus_pmi/rd/dev_addr"), attr_get(t, t->lgrp_path, "sbus_pmi/rd/addr"),
+		attr_get(t, t->lgrp_path, "sbus_pmi/rd/data"), attr_get(t, t->lgrp_path, "sbus_pmi/rd/mask"),
+		attr_get(t, t->lgrp_path, "sbus_pmi/rd/dev_id"), attr_get(t, t->lgrp_path, "sbus_pmi/rd/lane"),
+		attr_get(t, t->lgrp_path, "sbus_pmi/rd/pll"), attr_get(t, t->lgrp_path, "sbus_pmi/rd/result"));
+	out(t, "           | wr: dev_addr = %s, addr = %s, data = %s, mask = %s, dev_id = %s, lane = %s, pll = %s, result = %s\n",
+		attr_get(t, t->lgrp_path, "sbus_pmi/wr/dev_addr"), attr_get(t, t->lgrp_path, "sbus_pmi/wr/addr"),
+		attr_get(t, t->lgrp_path, "sbus_pmi/wr/data"), attr_get(t, t->lgrp_path, "sbus_pmi/wr/mask"),
+		attr_get(t, t->lgrp_path, "sbus_pmi/wr/dev_id"), attr_get(t, t->lgrp_path, "sbus_pmi/wr/lane"),
+		attr_get(t, t->lgrp_path, "sbus_pmi/wr/pll"), attr_get(t, t->lgrp_path, "sbus_pmi/wr/result"));
+}
+
+static void print_serdes(struct target *t)
+{
+	if (!path_exists(t->lgrp_path, "serdes"))
+		return;
+
+	out(t, "serdes     | hw: %s, fw: %s\n",
+		attr_get(t, t->lgrp_path, "serdes/hw_version"), attr_get(t, t->lgrp_path, "serdes/fw_version"));
+}
+
+/* one row of "a,b" pairs, one column per lane */
+static void print_col_serdes_pair(struct target *t, const char *lead, const char *first, const char *second)
+{
+	char pair[2 * ATTR_VAL_SIZE + 2];
+	int  lane;
+
+	if (!path_exists(t->lgrp_path, "serdes/lane"))
+		return;
+
+	out(t, "%s", lead);
+	for (lane = 0; lane < LANES_MAX; ++lane) {
+		snprintf(pair, sizeof(pair), "%s,%s",
+			attr_get(t, t->lgrp_path, "serdes/lane/%d/%s", lane, first),
+			attr_get(t, t->lgrp_path, "serdes/lane/%d/%s", lane, second));
+		out(t, "%15s ", pair);
+	}
+	out(t, "\n");
+}
+
+static void print_col_serdes(struct target *t, const char *lead, const char *which, const char *str,
+			     bool is_first)
+{
+	const char *val;
+	int         lane;
+
+	if (!path_exists(t->lgrp_path, "serdes/lane"))
+		return;
+
+	out(t, "%s %12s | ", lead, str);
+	for (lane = 0; lane < LANES_MAX; ++lane) {
+		val = attr_get(t, t->lgrp_path, "serdes/lane/%d/%s", lane, which);
+		if (is_first)
+			out(t, "%15s ", val);
+		else
+			out(t, " %14s ", val);
+	}
+	out(t, "\n");
+}
+
+static void print_serdes_header(struct target *t)
+{
+	print_serdes(t);
+	out(t, "           | lanes:                   lane0           lane1           lane2           lane3\n");
+	out(t, "           |              +----------------------------------------------------------------\n");
+}
+
+static void print_serdes_footer(struct target *t)
+{
+	out(t, "           |              +----------------------------------------------------------------\n");
+}
+
+static void print_lane_state(struct target *t)
+{
+	if (!path_exists(t->lgrp_path, NULL))
+		return;
+
+	print_serdes_header(t);
+	print_col_serdes_pair(t, "  state    |        tx,rx | ", "state/tx", "state/rx");
+	print_serdes_footer(t);
+}
+
+static void print_serdes_settings(struct target *t)
+{
+	static const char *settings[][2] = {
+		{ "pre2",          "pre2"         },
+		{ "pre3",          "pre3"         },
+		{ "cursor",        "cursor"       },
+		{ "post1",         "post1"        },
+		{ "post2",         "post2"        },
+		{ "width",         "width"        },
+		{ "dfe",           "dfe"          },
+		{ "encoding",      "encoding"     },
+		{ "link_training", "link_train"   },
+		{ "media",         "media"        },
+		{ "osr",           "osr"          },
+		{ "scramble_dis",  "scramble_dis" },
+		{ "clocking",      "clocking"     },
+	};
+	char   which[64];
+	size_t x;
+
+	if (!path_exists(t->lgrp_path, NULL))
+		return;
+
+	print_serdes_header(t);
+	print_col_serdes_pair(t, "  state    |        tx,rx | ", "state/tx", "state/rx");
+	print_col_serdes_pair(t, "  swizzle  |        tx,rx | ", "swizzle/tx_source", "swizzle/rx_source");
+	print_col_serdes_pair(t, "  eye high |    val,limit | ", "eye/value_upper", "eye/limit_high");
+	print_col_serdes_pair(t, "  eye low  |    val,limit | ", "eye/value_lower", "eye/limit_low");
+	out(t, "  settings |");
+	print_col_serdes(t, "", "settings/pre1", "pre1", true);
+	for (x = 0; x < (sizeof(settings) / sizeof(settings[0])); ++x) {
+		snprintf(which, sizeof(which), "settings/%s", settings[x][0]);
+		print_col_serdes(t, "           |", which, settings[x][1], false);
+	}
+	print_serdes_footer(t);
+}
+
+static void print_fec(struct target *t)
+{
+	if (!path_exists(t->link_path, "fec"))
+		return;
+
+	out(t, "fec        | up_settle: wait = %sms\n", attr_get(t, t->link_path, "fec/up_check/settle_wait_ms"));
+	out(t, "           | up_check:  wait = %sms\n", attr_get(t, t->link_path, "fec/up_check/check_wait_ms"));
+	out(t, "           |            ccw_limit = %sms, ucw_limit = %sms\n",
+		attr_get(t, t->link_path, "fec/up_check/ccw_limit"),
+		attr_get(t, t->link_path, "fec/up_check/ucw_limit"));
+	out(t, "           | monitor:   state = %s\n", attr_get(t, t->link_path, "fec/monitor_state"));
+	out(t, "           |            period = %sms\n", attr_get(t, t->link_path, "fec/monitor_check/period_ms"));
+	out(t, "           |            ccw_warn_limit = %s, ucw_warn_limit = %s\n",
+		attr_get(t, t->link_path, "fec/monitor_check/ccw_warn_limit"),
+		attr_get(t, t->link_path, "fec/monitor_check/ucw_warn_limit"));
+	out(t, "           |            ccw_down_limit = %s, ucw_down_limit = %s\n",
+		attr_get(t, t->link_path, "fec/monitor_check/ccw_down_limit"),
+		attr_get(t, t->link_path, "fec/monitor_check/ucw_down_limit"));
+}
+
+static long long fec_delta(struct target *t, const char *rel)
+{
+	return attr_num(attr_get(t, t->link_path, "fec/current/%s", rel)) -
+		attr_num(attr_get(t, t->link_path, "fec/up/%s", rel));
+}
+
+static bool fec_no_link(struct target *t, const char *rel)
+{
+	return !strcmp(attr_get(t, t->link_path, "fec/current/%s", rel), "no-link");
+}
+
+static void print_fec_bins(struct target *t)
+{
+	char rel[32];
+	int  bin;
+	int  lane;
+	int  fecl;
+
+	if (!path_exists(t->link_path, "fec/up") || !path_exists(t->link_path, "fec/current"))
+		return;
+
+	if (fec_no_link(t, "ccw") || fec_no_link(t, "ucw"))
+		out(t, "           | ccw: no-link, ucw: no-link\n");
+	else
+		out(t, "           | ccw: %lld, ucw: %lld\n", fec_delta(t, "ccw"), fec_delta(t, "ucw"));
+
+	for (bin = 0; bin < 15; ++bin) {
+		snprintf(rel, sizeof(rel), "tail/bin%02d", bin);
+		out(t, "           | %s [%02d] ", bin ? "     " : "bins:", bin);
+		if (fec_no_link(t, rel))
+			out(t, "no-link\n");
+		else
+			out(t, "%lld\n", fec_delta(t, rel));
+	}
+
+	out(t, "           | fecls:                 fecl0           fecl1           fecl2           fecl3\n");
+	out(t, "           |            +----------------------------------------------------------------\n");
+	for (lane = 0; lane < LANES_MAX; ++lane) {
+		snprintf(rel, sizeof(rel), "lane%d", lane);
+		out(t, "           | %10s | ", rel);
+		for (fecl = 0; fecl < 4; ++fecl) {
+			snprintf(rel, sizeof(rel), "lane/%d/fecl%d", lane, fecl);
+			if (fec_no_link(t, rel))
+				out(t, "%15s ", "no-link");
+			else
+				out(t, "%15lld ", fec_delta(t, rel));
+		}
+		out(t, "\n");
+	}
+	out(t, "           |            +----------------------------------------------------------------\n");
+}
+
+static void print_target(struct target *t)
+{
+	switch (report) {
+	case REPORT_STATE:
+		if (num_args >= 2)
+			print_jack_state(t);
+		if (num_args >= 3) {
+			print_link_state(t);
+			print_ald_state(t);
+			print_mac_state(t);
+			print_llr_state(t);
+		}
+		if (num_args >= 2)
+			print_lane_state(t);
+		break;
+	case REPORT_LINK:
+		print_lgrp(t);
+		print_link(t);
+		print_counters(t, t->link_path, "  counters |", 36, false);
+		break;
+	case REPORT_MAC:
+		print_lgrp(t);
+		print_mac_state(t);
+		print_counters(t, t->mac_path, "  counters |", 20, false);
+		break;
+	case REPORT_LLR:
+		print_lgrp(t);
+		print_llr(t);
+		print_counters(t, t->llr_path, "  counters |", 23, false);
+		break;
+	case REPORT_PMI:
+		print_pmi(t);
+		break;
+	case REPORT_SBUS:
+		print_sbus(t);
+		break;
+	case REPORT_SBUS_PMI:
+		print_sbus_pmi(t);
+		break;
+	case REPORT_SERDES:
+		print_serdes_settings(t);
+		break;
+	case REPORT_FEC:
+		print_fec(t);
+		print_fec_bins(t);
+		break;
+	case REPORT_CABLE:
+		print_jack(t);
+		break;
+	case REPORT_COUNTERS:
+		print_jack_state(t);
+		print_counters(t, t->media_path, "  counters |", 39, true);
+		print_link_state(t);
+		print_counters(t, t->link_path, "  counters |", 36, false);
+		print_counters(t, t->link_path, "           |", 36, true);
+		print_mac_state(t);
+		print_counters(t, t->mac_path, "  counters |", 20, false);
+		print_llr_state(t);
+		print_counters(t, t->llr_path, "  counters |", 23, false);
+		print_counters(t, t->llr_path, "           |", 23, true);
+		break;
+	case REPORT_ALL:
+	case REPORT_USE_TEST:
+		if (num_args >= 2) {
+			print_jack(t);
+			print_lgrp(t);
+		}
+		if (num_args >= 3) {
+			print_link(t);
+			print_counters(t, t->link_path, "  counters |", 36, false);
+			print_mac_state(t);
+			print_counters(t, t->mac_path, "  counters |", 20, false);
+			print_llr(t);
+			print_counters(t, t->llr_path, "  counters |", 23, false);
+			print_serdes_settings(t);
+			print_fec(t);
+			print_fec_bins(t);
+		}
+		break;
+	case REPORT_SHOW_DB:
+		break;
+	}
+}
+
+static int report_min_args(void)
+{
+	switch (report) {
+	case REPORT_ALL:
+	case REPORT_USE_TEST:
+	case REPORT_STATE:
+	case REPORT_SHOW_DB:
+		return 1;
+	case REPORT_CABLE:
+		return 2;
+	default:
+		return 3;
+	}
+}
+
+/* ==================== targets ==================== */
+
+static struct target *target_new(int ldev_num, int lgrp_num, int link_num)
+{
+	struct target *t;
+	char           lgrp_str[16];
+
+	t = calloc(1, sizeof(*t));
+	if (!t) {
+		perror("calloc failed");
+		exit(ENOMEM);
+	}
+
+	t->ldev_num = ldev_num;
+	t->lgrp_num = lgrp_num;
+	t->link_num = link_num;
+
+	if (lgrp_num >= 0)
+		snprintf(lgrp_str, sizeof(lgrp_str), "%d", lgrp_num);
+	else
+		snprintf(lgrp_str, sizeof(lgrp_str), "no");
+
+	if (is_switch) {
+		path_fmt(t->ldev_path, sizeof(t->ldev_path), "%s" SW_SYSFS "/rossw%d", sysfs_root, ldev_num);
+		path_fmt(t->lgrp_path, sizeof(t->lgrp_path), "%s/pgrp/%s", t->ldev_path, lgrp_str);
+		path_fmt(t->link_path, sizeof(t->link_path), "%s/%s/%d/link", t->lgrp_path, port_dir, link_num);
+		path_fmt(t->mac_path, sizeof(t->mac_path), "%s/%s/%d/mac", t->lgrp_path, port_dir, link_num);
+		path_fmt(t->llr_path, sizeof(t->llr_path), "%s/%s/%d/llr", t->lgrp_path, port_dir, link_num);
+	} else {
+		path_fmt(t->ldev_path, sizeof(t->ldev_path), "%s" NIC_SYSFS "/cxi%d/device/%s/%s",
+			sysfs_root, ldev_num, port_dir, lgrp_str);
+		path_fmt(t->lgrp_path, sizeof(t->lgrp_path), "%s", t->ldev_path);
+		path_fmt(t->link_path, sizeof(t->link_path), "%s/link", t->lgrp_path);
+		path_fmt(t->mac_path, sizeof(t->mac_path), "%s/mac", t->lgrp_path);
+		path_fmt(t->llr_path, sizeof(t->llr_path), "%s/llr", t->lgrp_path);
+	}
+	path_fmt(t->media_path, sizeof(t->media_path), "%s/media", t->lgrp_path);
+
+	t->key_base = (lgrp_num >= 0) ? t->lgrp_path : t->ldev_path;
+
+	return t;
+}
+
+static void target_add(int ldev_num, int lgrp_num, int link_num)
+{
+	if (num_targets >= TARGETS_MAX) {
+		fprintf(stderr, "too many targets (max = %d)\n", TARGETS_MAX);
+		exit(E2BIG);
+	}
+
+	targets[num_targets++] = target_new(ldev_num, lgrp_num, link_num);
+}
+
+static int num_parse(const char *str)
+{
+	char *end;
+	long  num;
+
+	if (!strcmp(str, "*"))
+		return ANY_NUM;
+
+	num = strtol(str, &end, 0);
+	if ((end == str) || *end || (num < 0) || (num > INT_MAX))
+		return NO_NUM;
+
+	return num;
+}
+
+/* numeric entries of a directory, in numeric order */
+static int nums_get(const char *path, int *nums, int max)
+{
+	struct dirent **entries;
+	int             count;
+	int             num;
+	int             x, y;
+	int             tmp;
+
+	count = scandir(path, &entries, dir_filter, NULL);
+	if (count < 0)
+		return 0;
+
+	num = 0;
+	for (x = 0; x < count; ++x) {
+		tmp = num_parse(entries[x]->d_name);
+		if ((tmp >= 0) && (num < max))
+			nums[num++] = tmp;
+		free(entries[x]);
+	}
+	free(entries);
+
+	for (x = 1; x < num; ++x) {
+		tmp = nums[x];
+		for (y = x; (y > 0) && (nums[y - 1] > tmp); --y)
+			nums[y] = nums[y - 1];
+		nums[y] = tmp;
+	}
+
+	return num;
+}
+
+static void targets_create(int ldev_num, int lgrp_num, int link_num)
+{
+	char path[PATH_MAX];
+	int  lgrps[TARGETS_MAX];
+	int  links[TARGETS_MAX];
+	int  num_lgrps;
+	int  num_links;
+	int  x, y;
+
+	if (num_args < 2) {
+		target_add(ldev_num, NO_NUM, 0);
+		return;
+	}
+
+	if (lgrp_num == ANY_NUM) {
+		if (is_switch)
+			path_fmt(path, sizeof(path), "%s" SW_SYSFS "/rossw%d/pgrp", sysfs_root, ldev_num);
+		else
+			path_fmt(path, sizeof(path), "%s" NIC_SYSFS "/cxi%d/device/%s", sysfs_root, ldev_num, port_dir);
+		num_lgrps = nums_get(path, lgrps, TARGETS_MAX);
+	} else {
+		lgrps[0]  = lgrp_num;
+		num_lgrps = 1;
+	}
+
+	for (x = 0; x < num_lgrps; ++x) {
+		if ((link_num == ANY_NUM) && is_switch) {
+			path_fmt(path, sizeof(path), "%s" SW_SYSFS "/rossw%d/pgrp/%d/%s",
+				sysfs_root, ldev_num, lgrps[x], port_dir);
+			num_links = nums_get(path, links, TARGETS_MAX);
+		} else {
+			links[0]  = (link_num == ANY_NUM) ? 0 : link_num;
+			num_links = 1;
+		}
+		for (y = 0; y < num_links; ++y)
+			target_add(ldev_num, lgrps[x], links[y]);
+	}
+}
+
+/* ==================== passes ==================== */
+
+static void target_collect(struct target *t)
+{
+	t->out = open_memstream(&t->buf, &t->buf_len);
+	if (!t->out) {
+		perror("open_memstream failed");
+		exit(ENOMEM);
+	}
+
+	if (t->lgrp_num == NO_NUM) {
+		print_ldev(t);
+		if (report == REPORT_SHOW_DB)
+			print_supported_db(t);
+	} else {
+		print_target(t);
+	}
+
+	fclose(t->out);
+	t->out = NULL;
+}
+
+/* later passes only re-read attributes that can change */
+static void target_refresh(struct target *t)
+{
+	struct attr *attr;
+
+	for (attr = t->first; attr; attr = attr->next) {
+		attr->is_changed = false;
+		if ((attr->fd < 0) || attr->is_static)
+			continue;
+		memcpy(attr->prev, attr->val, sizeof(attr->prev));
+		attr_read(attr);
+		attr->is_changed = (strcmp(attr->prev, attr->val) != 0);
+	}
+}
+
+static void *worker(void *arg)
+{
+	bool refresh = *(bool *)arg;
+	int  idx;
+
+	while ((idx = __atomic_fetch_add(&next_target, 1, __ATOMIC_RELAXED)) < num_targets) {
+		if (refresh)
+			target_refresh(targets[idx]);
+		else
+			target_collect(targets[idx]);
+	}
+
+	return NULL;
+}
+
+static void pass_run(int num_threads, bool refresh)
+{
+	pthread_t threads[num_threads];
+	int       x;
+	int       rtn;
+
+	next_target = 0;
+
+	for (x = 1; x < num_threads; ++x) {
+		rtn = pthread_create(&threads[x], NULL, worker, &refresh);
+		if (rtn) {
+			fprintf(stderr, "%s: pthread_create failed [%d]\n", strerror(rtn), rtn);
+			num_threads = x;
+			break;
+		}
+	}
+
+	worker(&refresh);
+
+	for (x = 1; x < num_threads; ++x)
+		pthread_join(threads[x], NULL);
+}
+
+static unsigned long long now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+
+	return (ts.tv_sec * 1000000000ULL) + ts.tv_nsec;
+}
+
+static void timestamp_str(char *str, size_t len, unsigned long long ns)
+{
+	time_t    secs;
+	struct tm tm;
+	size_t    pos;
+
+	secs = ns / 1000000000ULL;
+	localtime_r(&secs, &tm);
+	pos = strftime(str, len, "%Y-%m-%d %H:%M:%S", &tm);
+	snprintf(str + pos, len - pos, ".%03llu", (ns / 1000000ULL) % 1000);
+}
+
+static void json_target_print(struct target *t, bool changed_only, bool *first)
+{
+	if (!*first)
+		fputc(',', stdout);
+	*first = false;
+
+	if (t->lgrp_num == NO_NUM)
+		printf("{\"ldev\":%d,\"attrs\":", t->ldev_num);
+	else
+		printf("{\"ldev\":%d,\"lgrp\":%d,\"link\":%d,\"attrs\":", t->ldev_num, t->lgrp_num, t->link_num);
+	json_attrs(t, stdout, changed_only);
+	fputc('}', stdout);
+}
+
+static void pass_print(unsigned long long pass, unsigned long long ns, struct target *ldev_target)
+{
+	char         timestamp[64];
+	struct attr *attr;
+	bool         first;
+	int          x;
+
+	if (json) {
+		printf("{\"slstat\":\"%s\",\"pass\":%llu,\"timestamp_ns\":%llu,\"targets\":[", VERSION, pass, ns);
+		first = true;
+		if (ldev_target)
+			json_target_print(ldev_target, pass > 0, &first);
+		for (x = 0; x < num_targets; ++x)
+			json_target_print(targets[x], pass > 0, &first);
+		printf("]}\n");
+		fflush(stdout);
+		return;
+	}
+
+	if (pass == 0) {
+		if (ldev_target && ldev_target->buf)
+			fwrite(ldev_target->buf, 1, ldev_target->buf_len, stdout);
+		for (x = 0; x < num_targets; ++x) {
+			if (targets[x]->buf)
+				fwrite(targets[x]->buf, 1, targets[x]->buf_len, stdout);
+			free(targets[x]->buf);
+			targets[x]->buf = NULL;
+		}
+		fflush(stdout);
+		return;
+	}
+
+	timestamp_str(timestamp, sizeof(timestamp), ns);
+	for (x = 0; x < num_targets; ++x) {
+		for (attr = targets[x]->first; attr; attr = attr->next) {
+			if (!attr->is_changed)
+				continue;
+			printf("[%s] %d:%d:%d %s: %s -> %s\n", timestamp, targets[x]->ldev_num,
+				targets[x]->lgrp_num, targets[x]->link_num, attr->key, attr->prev, attr->val);
+		}
+	}
+	fflush(stdout);
+}
+
+/* ==================== main ==================== */
+
+static void print_help(const char *name)
+{
+	int                      opt;
+	const struct cmd_option *o;
+
+	printf("%s [options] ldev_num[:lgrp_num][:link_num] [option]\n", name);
+	printf("  target:\n");
+	printf("    ldev_num = link device number (0-1)\n");
+	printf("    lgrp_num = link group number (0-63, * for all)\n");
+	printf("    link_num = link number (0-3, * for all)\n");
+	printf("  option: (omitted option will print all available info for target)\n");
+	printf("    state    = print state info for the target\n");
+	printf("    link     = print link info for the target\n");
+	printf("    mac      = print mac info for the target\n");
+	printf("    llr      = print llr info for the target\n");
+	printf("    pmi      = print pmi info for the target\n");
+	printf("    sbus     = print sbus info for the target\n");
+	printf("    sbus_pmi = print sbus_pmi info for the target\n");
+	printf("    serdes   = print serdes info for the target\n");
+	printf("    fec      = print fec info for the target\n");
+	printf("    cable    = print cable info for the target\n");
+	printf("    counters = print counters for a link target (requires #:#:#)\n");
+	printf("    show_db  = print supported cable database\n");
+	printf("    use_test = use the \"test_port\" directory\n");
+	printf("  options:\n");
+
+	for (opt = 0; opt < NUM_OPTS; ++opt) {
+		o = &cmd_options[opt];
+		printf("    -%c, --%-9s %-9s %s\n", o->short_option, o->long_option,
+			o->argument_name ? o->argument_name : " ", o->description);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	int                 opt;
+	int                 x;
+	int                 num_threads;
+	int                 nums[3];
+	char               *target_str;
+	char               *tok;
+	char               *save;
+	char                path[PATH_MAX];
+	unsigned long long  count;
+	unsigned long long  pass;
+	unsigned long long  interval_ms;
+	struct timespec     interval;
+	struct target      *ldev_target;
+	bool                refresh;
+
+	count       = 1;
+	interval_ms = 1000;
+	num_threads = sysconf(_SC_NPROCESSORS_ONLN);
+	if (getenv(ROOT_ENV))
+		sysfs_root = getenv(ROOT_ENV);
+
+	while (1) {
+		opt = getopt_long(argc, argv, getopt_short_opts, long_options, NULL);
+		if (opt == -1)
+			break;
+
+		switch (opt) {
+		case HELP_SHORT_OPT:
+			print_help(argv[0]);
+			exit(EXIT_SUCCESS);
+		case VERSION_SHORT_OPT:
+			printf("Version: %s\n", VERSION);
+			exit(EXIT_SUCCESS);
+		case JSON_SHORT_OPT:
+			json = true;
+			break;
+		case COUNT_SHORT_OPT:
+			count = strtoull(optarg, NULL, 0);
+			break;
+		case INTERVAL_SHORT_OPT:
+			interval_ms = strtoull(optarg, NULL, 0);
+			break;
+		case THREADS_SHORT_OPT:
+			num_threads = strtol(optarg, NULL, 0);
+			break;
+		case ROOT_SHORT_OPT:
+			sysfs_root = optarg;
+			break;
+		default:
+			print_help(argv[0]);
+			exit(EINVAL);
+		}
+	}
+
+	if ((argc - optind) < 1 || (argc - optind) > 2) {
+		print_help(argv[0]);
+		exit(EINVAL);
+	}
+
+	report = REPORT_ALL;
+	if ((argc - optind) == 2) {
+		for (x = REPORT_STATE; x <= REPORT_USE_TEST; ++x) {
+			if (!strcmp(argv[optind + 1], report_names[x]))
+				break;
+		}
+		if (x > REPORT_USE_TEST) {
+			print_help(argv[0]);
+			exit(EINVAL);
+		}
+		report = x;
+		if (report == REPORT_USE_TEST)
+			port_dir = "test_port";
+	}
+
+	target_str = argv[optind];
+	num_args   = 0;
+	for (tok = strtok_r(target_str, ":", &save); tok; tok = strtok_r(NULL, ":", &save)) {
+		if (num_args == 3) {
+			print_help(argv[0]);
+			exit(EINVAL);
+		}
+		nums[num_args] = num_parse(tok);
+		if ((nums[num_args] == NO_NUM) || ((num_args == 0) && (nums[0] == ANY_NUM))) {
+			print_help(argv[0]);
+			exit(EINVAL);
+		}
+		num_args++;
+	}
+	if (num_args == 0) {
+		print_help(argv[0]);
+		exit(EINVAL);
+	}
+	for (x = num_args; x < 3; ++x)
+		nums[x] = 0;
+
+	path_fmt(path, sizeof(path), "%s" SW_SYSFS, sysfs_root);
+	if (access(path, F_OK) == 0) {
+		is_switch = true;
+	} else {
+		path_fmt(path, sizeof(path), "%s" NIC_SYSFS, sysfs_root);
+		if (access(path, F_OK)) {
+			printf("nothing initialized\n");
+			exit(EXIT_SUCCESS);
+		}
+	}
+
+	if (num_args < report_min_args())
+		exit(EXIT_SUCCESS);
+
+	if (num_args >= 2)
+		targets_create(nums[0], nums[1], nums[2]);
+
+	/* the NIC ldev directory is per port, use the first one found */
+	ldev_target = target_new(nums[0], NO_NUM, 0);
+	if (!is_switch && num_targets)
+		path_fmt(ldev_target->ldev_path, sizeof(ldev_target->ldev_path), "%s", targets[0]->ldev_path);
+
+	if (num_threads < 1)
+		num_threads = 1;
+	if (num_threads > num_targets)
+		num_threads = num_targets ? num_targets : 1;
+
+	interval.tv_sec  = interval_ms / 1000;
+	interval.tv_nsec = (interval_ms % 1000) * 1000000;
+
+	for (pass = 0; (count == 0) || (pass < count); ++pass) {
+		if (pass > 0)
+			nanosleep(&interval, NULL);
+
+		refresh = (pass > 0);
+		if (refresh)
+			target_refresh(ldev_target);
+		else
+			target_collect(ldev_target);
+		pass_run(num_threads, refresh);
+		pass_print(pass, now_ns(), ldev_target);
+	}
+
+	exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,217 @@
+#!/usr/bin/bash
+# SPDX-License-Identifier: GPL-2.0
+# Copyright 2026 Hewlett Packard Enterprise Development LP
+#
+# Compare slstat (bash) and sl_stat (native) on a synthetic switch sysfs tree.
+#
+#   sl_stat_bench.sh [num_lgrps] [report]
+#
+# SLSTAT and SL_STAT override the script and binary under test.
+
+NUM_LGRPS=${1:-16}
+REPORT=${2:-counters}
+NUM_LINKS=4
+NUM_PASSES=10
+
+BENCH_DIR=$(dirname $(readlink -f $0))
+SLSTAT=${SLSTAT:-${BENCH_DIR}/../slstat}
+SL_STAT=${SL_STAT:-${BENCH_DIR}/sl_stat}
+
+if [ ! -x "${SL_STAT}" ] ; then
+        echo "${SL_STAT} not found, run make first"
+        exit 1
+fi
+
+ROOT=$(mktemp -d)
+trap "rm -rf ${ROOT}" EXIT
+
+function attrs_write {
+        local dir=$1
+        shift
+
+        mkdir -p ${dir}
+        while [ "$#" -gt 0 ] ; do
+                mkdir -p $(dirname ${dir}/$1)
+                echo "$2" > ${dir}/$1
+                shift 2
+        done
+}
+
+function tree_lgrp_create {
+        local lgrp=$1
+        local x
+
+        attrs_write ${lgrp}/config \
+                furcation unfurcated mfs 9216 tech_map "ck400G" fec_map "rs" fec_mode "rs" \
+                link_type "fabric" loopback "off" fabric_link "enabled" r1_partner "disabled"
+
+        attrs_write ${lgrp}/media \
+                state online jack_num 12 cable_shift_state none jack_power_state on type AEC \
+                temperature_celsius 41 temperature_state normal temperature_warn_limit_celsius 70 \
+                temperature_down_limit_celsius 75 jack_type qsfp vendor vendor0 vendor_part_num VPN0 \
+                serial_num SN0 hpe_part_num HPN0 date_code 20260101 is_supported_cable yes \
+                is_supported_ss200_cable no furcation unfurcated length_cm 200 max_speed ck400G \
+                firmware_version_hex 0x1 target_firmware_version_hex 0x1 \
+                active_cable_200g_host_interface 0 active_cable_200g_lane_count 4 \
+                active_cable_200g_appsel_num 1 active_cable_400g_host_interface 0 \
+                active_cable_400g_lane_count 4 active_cable_400g_appsel_num 2 error_info none \
+                last_fault_cause none last_fault_time never shape straight cable_end a jack_part 0 \
+                speeds/ck400G "" speeds/ck200G ""
+        for x in $(seq -w 0 15) ; do
+                attrs_write ${lgrp}/media/counters cause_media_${x} ${x}
+        done
+
+        for op in rd wr ; do
+                attrs_write ${lgrp}/pmi/${op} addr 0x0 data 0x0 mask 0x0 dev_id 0 lane 0 pll 0 result 0
+                attrs_write ${lgrp}/sbus/${op} dev_addr 0x0 data 0x0 mask 0x0 reg 0 lsb 0 result 0
+                attrs_write ${lgrp}/sbus_pmi/${op} dev_addr 0x0 addr 0x0 data 0x0 mask 0x0 dev_id 0 \
+                        lane 0 pll 0 result 0
+        done
+        attrs_write ${lgrp}/sbus/rst dev_addr 0x0 result 0
+
+        attrs_write ${lgrp}/serdes hw_version 0x1 fw_version 0x3004
+        for x in 0 1 2 3 ; do
+                attrs_write ${lgrp}/serdes/lane/${x} \
+                        state/tx busy state/rx busy swizzle/tx_source ${x} swizzle/rx_source ${x} \
+                        eye/limit_high 100 eye/limit_low 10 eye/value_upper 120 eye/value_lower 20 \
+                        settings/pre1 0 settings/pre2 0 settings/pre3 0 settings/cursor 100 \
+                        settings/post1 0 settings/post2 0 settings/width 2 settings/dfe on \
+                        settings/encoding pam4 settings/link_training off settings/media aec \
+                        settings/osr 1 settings/scramble_dis 0 settings/clocking 85/170
+        done
+}
+
+function tree_link_create {
+        local port=$1
+        local x
+        local y
+
+        attrs_write ${port}/link \
+                state up speed ck400G up_time_ms 123456789 time_to_link_up_ms 1234 \
+                total_time_to_link_up_ms 2345 info_map none last_autoneg_fail_cause none \
+                last_autoneg_fail_time never \
+                config/link_up_timeout_ms 10000 config/link_up_tries_max 3 config/hpe_map none \
+                config/pause_map none config/autoneg off config/loopback off config/pml_recovery on \
+                config/auto_lane_degrade off caps/pause_map none caps/tech_map none caps/fec_map none \
+                caps/hpe_map none policies/keep_serdes_up off policies/use_unsupported_cable off \
+                policies/use_supported_ss200_cable off policies/ignore_media_error off \
+                policies/fec_mon_ccw_down_limit 0 policies/fec_mon_ccw_warn_limit 0 \
+                policies/fec_mon_ucw_down_limit 0 policies/fec_mon_ucw_warn_limit 0 \
+                policies/fec_mon_period_ms 1000 \
+                pml_recovery/pml_rec_attempts 0 pml_recovery/pml_rec_successes 0 \
+                pml_recovery/pml_rec_link_fault_cause none pml_recovery/pml_rec_link_down_cause none \
+                pml_recovery/pml_rec_link_fault_failed_cause none \
+                pml_recovery/pml_rec_link_down_failed_cause none \
+                pml_recovery/pml_rec_rate_limit_exceeded 0 \
+                auto_lane_degrade/state off auto_lane_degrade/is_rx_degraded no \
+                auto_lane_degrade/rx_degrade_map 0x0 auto_lane_degrade/rx_link_speed_gbps 0 \
+                auto_lane_degrade/is_tx_degraded no auto_lane_degrade/tx_degrade_map 0x0 \
+                auto_lane_degrade/tx_link_speed_gbps 0 auto_lane_degrade/is_recoverable yes \
+                fec/up_check/check_wait_ms 100 fec/up_check/settle_wait_ms 100 \
+                fec/up_check/ccw_limit 0 fec/up_check/ucw_limit 0 fec/monitor_state running \
+                fec/monitor_check/period_ms 1000 fec/monitor_check/ccw_down_limit 0 \
+                fec/monitor_check/ccw_warn_limit 0 fec/monitor_check/ucw_down_limit 0 \
+                fec/monitor_check/ucw_warn_limit 0 \
+                fec/up/ccw 10 fec/up/ucw 0 fec/current/ccw 20 fec/current/ucw 0
+        for x in $(seq 0 9) ; do
+                attrs_write ${port}/link \
+                        last_down/cause_map_${x} none last_down/time_${x} never \
+                        last_up_fail/up_fail_cause_map_${x} none last_up_fail/up_fail_time_${x} never
+        done
+        for x in $(seq -w 0 14) ; do
+                attrs_write ${port}/link/fec up/tail/bin${x} 1 current/tail/bin${x} 2
+        done
+        for x in 0 1 2 3 ; do
+                for y in 0 1 2 3 ; do
+                        attrs_write ${port}/link/fec up/lane/${x}/fecl${y} 1 current/lane/${x}/fecl${y} 3
+                done
+        done
+        for x in $(seq -w 0 23) ; do
+                attrs_write ${port}/link/counters link_cntr_${x} ${x} cause_cntr_${x} ${x} an_cause_cntr_${x} ${x}
+        done
+
+        attrs_write ${port}/mac tx_state running rx_state running tx_last_start_result ok \
+                rx_last_start_result ok info_map none
+        for x in $(seq -w 0 11) ; do
+                attrs_write ${port}/mac/counters mac_cntr_${x} ${x}
+        done
+
+        attrs_write ${port}/llr state running info_map none loop/calc_ns 1 loop/min_ns 1 loop/max_ns 1 \
+                loop/average_ns 1 config/mode on config/link_down_behavior discard \
+                config/setup_timeout_ms 1000 config/start_timeout_ms 1000 \
+                policies/continuous_tries 0 last_fail_cause none last_fail_time never
+        for x in $(seq -w 0 11) ; do
+                attrs_write ${port}/llr/counters llr_cntr_${x} ${x} cause_llr_${x} ${x}
+        done
+}
+
+function tree_create {
+        local ldev=${ROOT}/sys/class/rossw/rossw0
+        local lgrp
+        local link
+
+        attrs_write ${ldev}/sl_info mod_ver 1.20.18 mod_hash 0123456789abcdef
+
+        tree_lgrp_create ${ROOT}/template/lgrp
+        for link in $(seq 0 $((NUM_LINKS - 1))) ; do
+                tree_link_create ${ROOT}/template/lgrp/port/${link}
+        done
+
+        mkdir -p ${ldev}/pgrp
+        for lgrp in $(seq 0 $((NUM_LGRPS - 1))) ; do
+                cp -r ${ROOT}/template/lgrp ${ldev}/pgrp/${lgrp}
+        done
+}
+
+function bench {
+        local name=$1
+        shift
+        local start
+        local end
+
+        start=$(date +%s%N)
+        "$@" > /dev/null 2>&1
+        end=$(date +%s%N)
+
+        printf "  %-40s %10d ms\n" "${name}" $(((end - start) / 1000000))
+}
+
+function bash_all {
+        local lgrp
+        local link
+
+        for lgrp in $(seq 0 $((NUM_LGRPS - 1))) ; do
+                for link in $(seq 0 $((NUM_LINKS - 1))) ; do
+                        ${SLSTAT} 0:${lgrp}:${link} ${REPORT}
+                done
+        done
+}
+
+function check {
+        local mode
+        local rtn=0
+
+        for mode in "" state link mac llr pmi sbus sbus_pmi serdes fec cable counters ; do
+                if ! diff <(${SLSTAT} 0:1:2 ${mode}) <(${SL_STAT} 0:1:2 ${mode}) > /dev/null ; then
+                        echo "  output mismatch (report = ${mode:-all})"
+                        rtn=1
+                fi
+        done
+
+        return ${rtn}
+}
+
+export SLSTAT_SYSFS_ROOT=${ROOT}
+
+echo "creating ${NUM_LGRPS} lgrps x ${NUM_LINKS} links in ${ROOT}"
+tree_create
+
+echo "checking output matches"
+check || exit 1
+
+echo "report = ${REPORT}, targets = $((NUM_LGRPS * NUM_LINKS))"
+bench "slstat, one call per target"             bash_all
+bench "sl_stat 0:*:*, 1 thread"                 ${SL_STAT} -t 1 0:*:* ${REPORT}
+bench "sl_stat 0:*:*"                           ${SL_STAT} 0:*:* ${REPORT}
+bench "sl_stat 0:*:* --json"                    ${SL_STAT} -j 0:*:* ${REPORT}
+bench "sl_stat 0:*:*, ${NUM_PASSES} passes"     ${SL_STAT} -c ${NUM_PASSES} -i 0 0:*:* ${REPORT}